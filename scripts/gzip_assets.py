@@ -0,0 +1,89 @@
+# Kompresja zasobów statycznych (web/) do tablic PROGMEM.
+#
+# Uruchamiany przez PlatformIO przed kompilacją (extra_scripts = pre:...),
+# można też ręcznie: python scripts/gzip_assets.py
+#
+# Dla każdego pliku z ASSETS powstaje tablica z zawartością gzip oraz wersja
+# (skrót SHA-1 skompresowanej treści) - ETag i parametr ?v= w odnośnikach.
+# Pliki src/static_assets.h/.cpp są nadpisywane tylko przy zmianie treści,
+# żeby nie wymuszać przebudowy przy każdym uruchomieniu.
+#
+# W plikach .html znaczniki %SYMBOL_VER% (np. %APP_CSS_VER%) są zastępowane
+# wersjami zasobów wymienionych wcześniej na liście - strona statyczna
+# odwołuje się do bieżących adresów ?v= tak samo jak strony generowane.
+
+import gzip
+import hashlib
+import os
+
+# (plik w web/, nazwa symbolu)
+ASSETS = [
+    ("app.css", "APP_CSS"),
+    ("app.js", "APP_JS"),
+    ("icon.svg", "ICON_SVG"),
+    ("dashboard.js", "DASHBOARD_JS"),
+    ("index.html", "INDEX_HTML"),  # Po zasobach, do których się odwołuje
+    ("config.js", "CONFIG_JS"),
+    ("config.html", "CONFIG_HTML"),
+]
+
+HEADER = "// Wygenerowano przez scripts/gzip_assets.py z plików web/ - nie edytować ręcznie\n"
+
+
+def project_dir():
+    try:
+        Import("env")  # noqa: F821 - dostępne tylko w PlatformIO
+        return env["PROJECT_DIR"]  # noqa: F821
+    except NameError:
+        return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def compress(path, versions):
+    with open(path, "rb") as f:
+        raw = f.read()
+    if path.endswith(".html"):
+        text = raw.decode("utf-8")
+        for sym, ver in versions.items():
+            text = text.replace("%%%s_VER%%" % sym, ver)
+        raw = text.encode("utf-8")
+    # mtime=0 - wynik zależy tylko od treści (powtarzalny ETag)
+    return gzip.compress(raw, compresslevel=9, mtime=0), len(raw)
+
+
+def write_if_changed(path, text):
+    if os.path.exists(path):
+        with open(path, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(text)
+    print("gzip_assets: zapisano " + os.path.relpath(path))
+
+
+def generate(root):
+    h = [HEADER, "#ifndef STATIC_ASSETS_H\n#define STATIC_ASSETS_H\n\n#include <Arduino.h>\n"]
+    c = [HEADER, '#include "static_assets.h"\n']
+
+    versions = {}
+    for name, sym in ASSETS:
+        data, raw_len = compress(os.path.join(root, "web", name), versions)
+        ver = hashlib.sha1(data).hexdigest()[:8]
+        versions[sym] = ver
+
+        h.append("\n// web/%s: %d B -> %d B gzip\n" % (name, raw_len, len(data)))
+        h.append("extern const uint8_t STATIC_%s_GZ[] PROGMEM;\n" % sym)
+        h.append("#define STATIC_%s_GZ_LEN %d\n" % (sym, len(data)))
+        h.append('#define STATIC_%s_VER "%s"\n' % (sym, ver))
+
+        c.append("\nconst uint8_t STATIC_%s_GZ[] PROGMEM = {" % sym)
+        for i in range(0, len(data), 16):
+            c.append("\n    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+        c.append("\n};\n")
+
+    h.append("\n#endif // STATIC_ASSETS_H\n")
+
+    write_if_changed(os.path.join(root, "src", "static_assets.h"), "".join(h))
+    write_if_changed(os.path.join(root, "src", "static_assets.cpp"), "".join(c))
+
+
+generate(project_dir())
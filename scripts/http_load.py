@@ -0,0 +1,140 @@
+# Pomiar opóźnień pętli głównej pod równoległym obciążeniem HTTP.
+#
+#   python scripts/http_load.py 192.168.1.50 --password HASLO [--clients 4] [--seconds 20]
+#
+# Dwie fazy po --seconds sekund: bez obciążenia i z --clients wątkami, które
+# bez przerwy pobierają strony z --paths. Przed każdą fazą liczniki są zerowane
+# (POST /api/perf/reset), po niej skrypt czyta /api/perf i wypisuje opóźnienie
+# startu zadań harmonogramu (termin -> uruchomienie) oraz czasy odpowiedzi.
+# Najważniejsze wiersze to "ping" i "mode" - o tyle obsługa WWW opóźnia pingi i decyzje watchdoga.
+# Wszystkie wątki mają ten sam adres IP, więc po wyczerpaniu limitu żądań
+# (rate_limit.h) część odpowiedzi to 429 - opóźnienie pętli ma zostać niskie.
+#
+# Porównanie serwerów: ten sam pomiar na obrazie zbudowanym z -DHTTP_ASYNC_ENABLED=1
+# (async_http.h) i bez niego. Przy serwerze asynchronicznym trasy spoza portu 80
+# odpowiadają 307 (liczone jako udane), a skrypt wypisuje też jego liczniki
+# (odmowy przy limicie połączeń, przekroczenia czasu).
+#
+# Tylko biblioteka standardowa Pythona; do uruchomienia z komputera w tej samej sieci.
+
+import argparse
+import http.client
+import json
+import threading
+import time
+import urllib.parse
+
+DEFAULT_PATHS = ["/", "/api/status", "/static/app.css", "/config", "/api/rtt"]
+
+
+def request(host, method, path, cookie=None, body=None, timeout=10, follow=False):
+    conn = http.client.HTTPConnection(host, timeout=timeout)
+    headers = {"Connection": "close"}
+    if cookie:
+        headers["Cookie"] = cookie
+    if body is not None:
+        headers["Content-Type"] = "application/x-www-form-urlencoded"
+    try:
+        conn.request(method, path, body=body, headers=headers)
+        resp = conn.getresponse()
+        data = resp.read()
+        location = resp.getheader("Location")
+    finally:
+        conn.close()
+    # Serwer asynchroniczny przekierowuje logowanie i akcje na port ESP8266WebServer
+    if follow and resp.status == 307 and location:
+        target = urllib.parse.urlsplit(location)
+        path = target.path + ("?" + target.query if target.query else "")
+        return request(target.netloc, method, path, cookie, body, timeout)
+    return resp.status, resp.getheader("Set-Cookie"), data
+
+
+def login(host, user, password):
+    body = urllib.parse.urlencode({"user": user, "pass": password})
+    status, set_cookie, _ = request(host, "POST", "/login", body=body, follow=True)
+    if not set_cookie:
+        raise SystemExit("Logowanie nieudane (HTTP %d) - sprawdź --user/--password" % status)
+    return set_cookie.split(";", 1)[0]
+
+
+def worker(host, cookie, paths, stop, results, lock):
+    i = 0
+    while not stop.is_set():
+        path = paths[i % len(paths)]
+        i += 1
+        start = time.monotonic()
+        try:
+            status, _, _ = request(host, "GET", path, cookie=cookie)
+            ok = status < 400
+        except OSError:
+            status, ok = 0, False
+        ms = (time.monotonic() - start) * 1000
+        with lock:
+            results.append((path, ok, status, ms))
+
+
+def percentile(values, p):
+    if not values:
+        return 0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def run_phase(host, cookie, clients, seconds, paths):
+    request(host, "POST", "/api/perf/reset", cookie=cookie, follow=True)
+    results, lock, stop = [], threading.Lock(), threading.Event()
+    threads = [threading.Thread(target=worker, args=(host, cookie, paths, stop, results, lock))
+               for _ in range(clients)]
+    for t in threads:
+        t.start()
+    time.sleep(seconds)
+    stop.set()
+    for t in threads:
+        t.join()
+    _, _, data = request(host, "GET", "/api/perf", cookie=cookie, follow=True)
+    return json.loads(data), results
+
+
+def print_phase(title, perf, results, seconds):
+    print("\n== %s ==" % title)
+    print("%-10s %8s %12s %12s %10s" % ("zadanie", "wywołań", "opóźn. śr.", "opóźn. max", "max µs"))
+    for t in perf.get("tasks", []):
+        print("%-10s %8d %9.1f ms %9d ms %10d" % (t["name"], t["runs"], t.get("lateAvgMs", 0),
+                                                  t.get("lateMaxMs", 0), t["maxUs"]))
+    if not results:
+        return
+    ms = [r[3] for r in results]
+    limited = sum(1 for r in results if r[2] == 429)
+    failed = sum(1 for r in results if not r[1]) - limited
+    print("żądania: %d (%.1f/s), limit (429): %d, błędy: %d, czas odpowiedzi P50 %.0f ms, P95 %.0f ms, max %.0f ms"
+          % (len(results), len(results) / seconds, limited, failed, percentile(ms, 50), percentile(ms, 95), max(ms)))
+    async_http = perf.get("httpAsync")
+    if async_http:
+        print("serwer asynchroniczny: połączeń %d (naraz max %d/%d), odmów %d, przekierowań %d, limit czasu %d, błędów %d"
+              % (async_http["accepted"], async_http["maxActive"], async_http["maxConns"], async_http["refused"],
+                 async_http["redirected"], async_http["timeouts"], async_http["errors"]))
+    limits = perf.get("rateLimit")
+    if limits:
+        print("limity: " + ", ".join("%s %d/%d odrzuconych" % (c["name"], c["rejected"], c["allowed"] + c["rejected"])
+                                     for c in limits["classes"]))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Opóźnienie pętli Strażnika pod obciążeniem HTTP")
+    ap.add_argument("host")
+    ap.add_argument("--user", default="admin")
+    ap.add_argument("--password", required=True)
+    ap.add_argument("--clients", type=int, default=4)
+    ap.add_argument("--seconds", type=int, default=20)
+    ap.add_argument("--paths", nargs="+", default=DEFAULT_PATHS)
+    args = ap.parse_args()
+
+    cookie = login(args.host, args.user, args.password)
+    perf, results = run_phase(args.host, cookie, 0, args.seconds, args.paths)
+    print_phase("bez obciążenia", perf, results, args.seconds)
+    perf, results = run_phase(args.host, cookie, args.clients, args.seconds, args.paths)
+    print_phase("%d klientów równolegle" % args.clients, perf, results, args.seconds)
+
+
+if __name__ == "__main__":
+    main()
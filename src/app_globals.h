@@ -18,11 +18,6 @@
 // --- Webserver (z webserver.cpp) ---
 extern ESP8266WebServer server;
 
-// --- Zmienne sesji (z main.cpp) ---
-extern bool isSessionActive;              // Czy sesja użytkownika jest aktywna
-extern unsigned long lastSessionActivity; // Ostatnia aktywność sesji (ms)
-extern String sessionToken;               // Token sesji cookie
-
 // --- Zmienne symulacji (z main.cpp) ---
 extern bool simPingFail; // Symulacja awarii ping
 extern bool simNoWiFi;   // Symulacja braku WiFi
@@ -39,12 +34,13 @@ extern unsigned long lastBackupSwitchTime;   // Czas ostatniego przełączenia
 
 // --- Stałe (z main.cpp) ---
 extern const char *LOG_FILE; // Ścieżka do pliku logów
+extern uint32_t logEventSeq; // Licznik wpisów do logu (wersja listy zdarzeń)
 
 // --- Funkcje pomocnicze (z main.cpp) ---
 extern void logEvent(String msg);          // Zapisz zdarzenie do logów
 extern void ledOK();                       // Ustaw LED na zielony (OK)
 extern void ledFail();                     // Ustaw LED na czerwony (błąd)
 extern bool checkAuth(bool quiet = false); // Sprawdź autoryzację użytkownika
-extern String generateToken();             // Generuj losowy token sesji
+extern bool requestSessionToken(char *out, size_t outSize); // Token sesji z ciasteczka żądania
 
 #endif // APP_GLOBALS_H
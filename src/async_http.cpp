@@ -0,0 +1,675 @@
+#include "async_http.h"
+
+#if HTTP_ASYNC_ENABLED
+
+#include "webserver.h"     // apiJson*() - treść tras API wspólna z ESP8266WebServer
+#include "app_globals.h"   // logEventSeq
+#include "http_head.h"     // Odczyt nagłówka żądania
+#include "session_store.h" // Sprawdzenie sesji (API diagnostyczne)
+#include "rate_limit.h"    // Limity żądań na adres IP (429)
+#include "history.h"       // Strumień /api/history
+#include "static_assets.h" // Zasoby gzip w PROGMEM
+#include "perf.h"
+#include "diag.h"
+#include <lwip/tcp.h>
+
+enum AsyncConnState : uint8_t
+{
+    AC_FREE = 0,
+    AC_HEAD,  // Zbieranie nagłówka żądania (wywołanie recv)
+    AC_READY, // Nagłówek kompletny - czeka na zadanie "httpasync"
+    AC_SEND,  // Odpowiedź w trakcie wysyłki
+    AC_GONE   // lwIP zwolnił połączenie (błąd) - sprzątanie w loop()
+};
+
+enum AsyncBody : uint8_t
+{
+    AB_NONE = 0, // Cała odpowiedź w out
+    AB_PROGMEM,  // Treść z pamięci Flash (zasoby statyczne)
+    AB_HISTORY   // Kubełki archiwum czytane z pliku porcjami
+};
+
+struct AsyncConn
+{
+    tcp_pcb *pcb;
+    AsyncConnState state;
+    bool headTooLarge;
+    uint32_t ip;              // Adres klienta (limity żądań)
+    uint32_t localIp;         // Adres, pod którym klient nas widzi (przekierowanie bez Host)
+    unsigned long progressMs; // Ostatni postęp: dane nagłówka albo potwierdzenie wysyłki
+    uint16_t headLen;
+    char head[HTTP_ASYNC_HEAD_MAX + 1];
+
+    String out; // Linia statusu, nagłówki (i treść tekstowa)
+    size_t outOffset;
+    AsyncBody body;
+    const uint8_t *pgm;
+    size_t pgmLen;
+    size_t pgmOffset;
+    HistoryStream hist;
+    HistBucket stage[8]; // Odczytane z pliku, jeszcze nie w buforze nadawczym
+    uint8_t stageLen;    // Bajty w stage
+    uint8_t stageOffset;
+};
+
+struct AsyncAsset
+{
+    const char *path;
+    const uint8_t *data;
+    size_t len;
+    const char *contentType;
+    const char *version;
+    bool immutable;
+};
+
+static const AsyncAsset ASSETS[] = {
+    {"/", STATIC_INDEX_HTML_GZ, STATIC_INDEX_HTML_GZ_LEN, "text/html; charset=utf-8", STATIC_INDEX_HTML_VER, false},
+    {"/static/app.css", STATIC_APP_CSS_GZ, STATIC_APP_CSS_GZ_LEN, "text/css", STATIC_APP_CSS_VER, true},
+    {"/static/app.js", STATIC_APP_JS_GZ, STATIC_APP_JS_GZ_LEN, "application/javascript", STATIC_APP_JS_VER, true},
+    {"/static/icon.svg", STATIC_ICON_SVG_GZ, STATIC_ICON_SVG_GZ_LEN, "image/svg+xml", STATIC_ICON_SVG_VER, true},
+    {"/static/dashboard.js", STATIC_DASHBOARD_JS_GZ, STATIC_DASHBOARD_JS_GZ_LEN, "application/javascript", STATIC_DASHBOARD_JS_VER, true},
+};
+
+static void routeStatus(AsyncConn &c, const char *query);
+static void routeHistory(AsyncConn &c, const char *query);
+static void routeEvents(AsyncConn &c, const char *query);
+static void routeRtt(AsyncConn &c, const char *query);
+static void routeIncidents(AsyncConn &c, const char *query);
+static void routePerf(AsyncConn &c, const char *query);
+static void routeHeap(AsyncConn &c, const char *query);
+
+struct AsyncRoute
+{
+    const char *path;
+    void (*fn)(AsyncConn &c, const char *query);
+    bool auth; // Tylko z ważną sesją (jak checkAuth(true))
+};
+
+static const AsyncRoute ROUTES[] = {
+    {"/api/status", routeStatus, false},
+    {"/api/history", routeHistory, false},
+    {"/api/events", routeEvents, false},
+    {"/api/rtt", routeRtt, true},
+    {"/api/incidents", routeIncidents, true},
+    {"/api/perf", routePerf, true},
+    {"/api/heap", routeHeap, true},
+};
+
+static AsyncConn conns[HTTP_ASYNC_MAX_CONNS];
+static tcp_pcb *listenPcb = nullptr;
+static uint8_t nextConn = 0; // Od którego połączenia szukać gotowego żądania (po kolei)
+static AsyncHttpCounters counters;
+
+// ---------------------------------------------------------------------------
+// Połączenia (wywołania zwrotne lwIP - poza loop(), bez blokowania)
+// ---------------------------------------------------------------------------
+
+static void resetConn(AsyncConn &c)
+{
+    if (c.body == AB_HISTORY)
+        c.hist.file.close();
+    c.pcb = nullptr;
+    c.state = AC_FREE;
+    c.out = String(); // Zwolnij bufor odpowiedzi
+    c.body = AB_NONE;
+}
+
+// Odłącza wywołania zwrotne i zamyka połączenie; ERR_ABRT gdy trzeba było przerwać (RST)
+static err_t closeConn(AsyncConn &c, bool abort)
+{
+    tcp_pcb *pcb = c.pcb;
+    resetConn(c);
+    if (!pcb)
+        return ERR_OK;
+    tcp_arg(pcb, nullptr);
+    tcp_recv(pcb, nullptr);
+    tcp_sent(pcb, nullptr);
+    tcp_err(pcb, nullptr);
+    // Zamknięcie wysyła jeszcze dane z kolejki lwIP, potem FIN
+    if (!abort && tcp_close(pcb) == ERR_OK)
+        return ERR_OK;
+    tcp_abort(pcb);
+    return ERR_ABRT;
+}
+
+static uint8_t activeCount()
+{
+    uint8_t n = 0;
+    for (AsyncConn &c : conns)
+    {
+        if (c.state != AC_FREE)
+            n++;
+    }
+    return n;
+}
+
+static err_t onRecv(void *arg, tcp_pcb *pcb, pbuf *p, err_t err)
+{
+    AsyncConn *c = (AsyncConn *)arg;
+    if (!c)
+    {
+        if (p)
+            pbuf_free(p);
+        return ERR_OK;
+    }
+    if (!p)
+    {
+        // Klient zamknął swoją stronę - bez pełnego nagłówka nie ma na co odpowiadać
+        if (c->state == AC_HEAD)
+            return closeConn(*c, false);
+        return ERR_OK;
+    }
+    if (err != ERR_OK)
+    {
+        pbuf_free(p);
+        return err;
+    }
+
+    if (c->state == AC_HEAD)
+    {
+        size_t room = HTTP_ASYNC_HEAD_MAX - c->headLen;
+        size_t n = p->tot_len < room ? p->tot_len : room;
+        pbuf_copy_partial(p, c->head + c->headLen, n, 0);
+        c->headLen += n;
+        c->head[c->headLen] = '\0';
+        c->progressMs = millis();
+
+        size_t headLen = httpHeadLength(c->head, c->headLen);
+        if (headLen)
+        {
+            c->head[headLen] = '\0'; // Treść żądania (POST) nie jest potrzebna
+            c->state = AC_READY;
+        }
+        else if (c->headLen >= HTTP_ASYNC_HEAD_MAX)
+        {
+            c->headTooLarge = true;
+            c->state = AC_READY;
+        }
+    }
+    // Dane po nagłówku są pomijane, ale potwierdzane - okno odbioru nie zostaje zamknięte
+    tcp_recved(pcb, p->tot_len);
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+static err_t onSent(void *arg, tcp_pcb *pcb, u16_t len)
+{
+    AsyncConn *c = (AsyncConn *)arg;
+    if (c)
+        c->progressMs = millis(); // Klient odbiera - dalsza wysyłka w zadaniu "httpasync"
+    return ERR_OK;
+}
+
+static void onError(void *arg, err_t err)
+{
+    // lwIP już zwolnił połączenie (RST od klienta, brak pamięci). Plik historii
+    // i bufor odpowiedzi zwalnia zadanie "httpasync", nie kontekst lwIP.
+    AsyncConn *c = (AsyncConn *)arg;
+    if (!c)
+        return;
+    c->pcb = nullptr;
+    c->state = AC_GONE;
+}
+
+static err_t onAccept(void *arg, tcp_pcb *pcb, err_t err)
+{
+    if (err != ERR_OK || !pcb)
+        return ERR_VAL;
+
+    AsyncConn *c = nullptr;
+    for (AsyncConn &slot : conns)
+    {
+        if (slot.state == AC_FREE)
+        {
+            c = &slot;
+            break;
+        }
+    }
+    if (!c)
+    {
+        // Limit połączeń - odmowa od razu zamiast trzymania gniazda i buforów
+        counters.refused++;
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+
+    c->pcb = pcb;
+    c->state = AC_HEAD;
+    c->headTooLarge = false;
+    c->ip = ip4_addr_get_u32(ip_2_ip4(&pcb->remote_ip));
+    c->localIp = ip4_addr_get_u32(ip_2_ip4(&pcb->local_ip));
+    c->progressMs = millis();
+    c->headLen = 0;
+    c->head[0] = '\0';
+    c->outOffset = 0;
+    c->body = AB_NONE;
+
+    tcp_setprio(pcb, TCP_PRIO_MIN);
+    tcp_nagle_disable(pcb);
+    tcp_arg(pcb, c);
+    tcp_recv(pcb, onRecv);
+    tcp_sent(pcb, onSent);
+    tcp_err(pcb, onError);
+
+    counters.accepted++;
+    uint8_t active = activeCount();
+    if (active > counters.maxActive)
+        counters.maxActive = active;
+    return ERR_OK;
+}
+
+// ---------------------------------------------------------------------------
+// Odpowiedzi (zadanie "httpasync")
+// ---------------------------------------------------------------------------
+
+static const char *reasonPhrase(int code)
+{
+    switch (code)
+    {
+    case 200:
+        return "OK";
+    case 303:
+        return "See Other";
+    case 304:
+        return "Not Modified";
+    case 307:
+        return "Temporary Redirect";
+    case 400:
+        return "Bad Request";
+    case 429:
+        return "Too Many Requests";
+    case 431:
+        return "Request Header Fields Too Large";
+    default:
+        return "Service Unavailable";
+    }
+}
+
+// Linia statusu i nagłówki; extraHeaders = gotowe linie zakończone CRLF
+static void responseHead(AsyncConn &c, int code, const char *contentType, size_t length, const char *extraHeaders = "")
+{
+    char line[56];
+    snprintf(line, sizeof(line), "HTTP/1.1 %d %s\r\n", code, reasonPhrase(code));
+    c.out = line;
+    if (contentType)
+    {
+        c.out += F("Content-Type: ");
+        c.out += contentType;
+        c.out += F("\r\n");
+    }
+    snprintf(line, sizeof(line), "Content-Length: %u\r\n", (unsigned)length);
+    c.out += line;
+    c.out += F("Connection: close\r\n");
+    c.out += extraHeaders;
+    c.out += F("\r\n");
+}
+
+static void respondText(AsyncConn &c, int code, const char *text, const char *extraHeaders = "")
+{
+    responseHead(c, code, "text/plain", strlen(text), extraHeaders);
+    c.out += text;
+}
+
+static void respondJson(AsyncConn &c, JsonDocument &doc)
+{
+    String json; // serializeJson() zastępuje zawartość String - nie dopisuje do nagłówków
+    serializeJson(doc, json);
+    responseHead(c, 200, "application/json", json.length(), "Cache-Control: no-cache, no-store, must-revalidate\r\n");
+    c.out += json;
+}
+
+static void respondAsset(AsyncConn &c, const AsyncAsset &a)
+{
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%s\"", a.version);
+    String headers = F("ETag: ");
+    headers += etag;
+    headers += F("\r\nCache-Control: ");
+    headers += a.immutable ? F("public, max-age=31536000, immutable") : F("no-cache");
+    headers += F("\r\n");
+
+    char known[16];
+    if (httpHeadField(c.head, "If-None-Match", known, sizeof(known)) && strcmp(known, etag) == 0)
+    {
+        responseHead(c, 304, nullptr, 0, headers.c_str());
+        return;
+    }
+    headers += F("Content-Encoding: gzip\r\n");
+    responseHead(c, 200, a.contentType, a.len, headers.c_str());
+    c.body = AB_PROGMEM;
+    c.pgm = a.data;
+    c.pgmLen = a.len;
+    c.pgmOffset = 0;
+}
+
+// Trasa obsługiwana przez ESP8266WebServer - ten sam host, port HTTP_SYNC_PORT
+static void respondRedirect(AsyncConn &c, const char *path, const char *query)
+{
+    char host[64];
+    if (httpHeadField(c.head, "Host", host, sizeof(host)) && host[0])
+    {
+        char *colon = strchr(host, ':');
+        if (colon)
+            *colon = '\0';
+    }
+    else
+        strlcpy(host, IPAddress(c.localIp).toString().c_str(), sizeof(host));
+
+    String location = F("Location: http://");
+    location += host;
+    location += ':';
+    location += HTTP_SYNC_PORT;
+    location += path;
+    if (query[0])
+    {
+        location += '?';
+        location += query;
+    }
+    location += F("\r\n");
+    responseHead(c, 307, nullptr, 0, location.c_str());
+    counters.redirected++;
+}
+
+static bool sessionValid(const AsyncConn &c)
+{
+    if (DEBUG_SKIP_AUTH)
+        return true;
+    char cookie[256];
+    char token[SESSION_TOKEN_LENGTH + 1];
+    return httpHeadField(c.head, "Cookie", cookie, sizeof(cookie)) &&
+           sessionTokenFromCookie(cookie, token, sizeof(token)) &&
+           sessionCheck(token, millis()) == SESSION_VALID; // Ważna sesja ma odświeżony czas aktywności
+}
+
+static void routeStatus(AsyncConn &c, const char *query)
+{
+    char ev[12];
+    bool withEvents = !httpQueryArg(query, "ev", ev, sizeof(ev)) || atol(ev) != (long)logEventSeq;
+    JsonDocument doc;
+    apiJsonStatus(doc, withEvents);
+    respondJson(c, doc);
+}
+
+static void routeHistory(AsyncConn &c, const char *query)
+{
+    char res[8] = "";
+    httpQueryArg(query, "res", res, sizeof(res));
+    HistTier tier = historyTierByName(res);
+    if (!historyStreamOpen(c.hist, tier, (uint8_t *)c.stage))
+    {
+        respondText(c, 503, "Historia niedostepna");
+        return;
+    }
+    responseHead(c, 200, "application/octet-stream", historyStreamLength(tier), "Cache-Control: no-cache\r\n");
+    c.body = AB_HISTORY;
+    c.stageLen = HISTORY_STREAM_HEADER;
+    c.stageOffset = 0;
+}
+
+static void routeEvents(AsyncConn &c, const char *query)
+{
+    // Strumień SSE nie jest przeniesiony - strona główna odpytuje /api/status
+    respondText(c, 503, "Powiadomienia na zywo niedostepne - odpytywanie", "Retry-After: 30\r\n");
+}
+
+static void routeRtt(AsyncConn &c, const char *query)
+{
+    JsonDocument doc;
+    apiJsonRtt(doc);
+    respondJson(c, doc);
+}
+
+static void routeIncidents(AsyncConn &c, const char *query)
+{
+    JsonDocument doc;
+    apiJsonIncidents(doc);
+    respondJson(c, doc);
+}
+
+static void routePerf(AsyncConn &c, const char *query)
+{
+    JsonDocument doc;
+    apiJsonPerf(doc);
+    respondJson(c, doc);
+}
+
+static void routeHeap(AsyncConn &c, const char *query)
+{
+    JsonDocument doc;
+    apiJsonHeap(doc);
+    respondJson(c, doc);
+}
+
+static void handleRequest(AsyncConn &c)
+{
+    PERF_SCOPE("http.async");
+    c.state = AC_SEND;
+    c.progressMs = millis();
+    c.outOffset = 0;
+
+    if (c.headTooLarge)
+    {
+        counters.errors++;
+        respondText(c, 431, "Naglowek zadania za dlugi");
+        return;
+    }
+    char method[8], path[64], query[128];
+    if (!httpHeadRequestLine(c.head, method, sizeof(method), path, sizeof(path), query, sizeof(query)))
+    {
+        counters.errors++;
+        respondText(c, 400, "Niepoprawne zadanie");
+        return;
+    }
+
+    const AsyncAsset *asset = nullptr;
+    const AsyncRoute *route = nullptr;
+    if (strcmp(method, "GET") == 0)
+    {
+        for (const AsyncAsset &a : ASSETS)
+        {
+            if (strcmp(path, a.path) == 0)
+                asset = &a;
+        }
+        for (const AsyncRoute &r : ROUTES)
+        {
+            if (strcmp(path, r.path) == 0)
+                route = &r;
+        }
+    }
+    if (!asset && !route)
+    {
+        respondRedirect(c, path, query);
+        return;
+    }
+
+    // Klasy limitów jak routeRateClass() w webserver.cpp: zasoby statyczne bez limitu
+    uint32_t retryMs;
+    if (strncmp(path, "/static/", 8) != 0 && !rateAllow(c.ip, RATE_PAGE, millis(), retryMs))
+    {
+        char retry[32];
+        snprintf(retry, sizeof(retry), "Retry-After: %lu\r\n", (unsigned long)((retryMs + 999) / 1000));
+        respondText(c, 429, "", retry);
+        return;
+    }
+
+    counters.served++;
+    if (asset)
+    {
+        respondAsset(c, *asset);
+        return;
+    }
+    if (route->auth && !sessionValid(c))
+    {
+        responseHead(c, 303, nullptr, 0, "Location: /login\r\nCache-Control: no-cache\r\n");
+        return;
+    }
+    route->fn(c, query);
+}
+
+// Kolejna porcja odpowiedzi do bufora nadawczego; 0 = brak miejsca, koniec albo błąd
+static size_t writeSome(AsyncConn &c, size_t room, bool &failed)
+{
+    if (room == 0)
+        return 0;
+    uint8_t flash[256];
+    const void *data;
+    size_t n;
+    if (c.outOffset < c.out.length())
+    {
+        data = c.out.c_str() + c.outOffset;
+        n = c.out.length() - c.outOffset;
+    }
+    else if (c.body == AB_PROGMEM && c.pgmOffset < c.pgmLen)
+    {
+        n = c.pgmLen - c.pgmOffset;
+        if (n > sizeof(flash))
+            n = sizeof(flash);
+        if (n > room)
+            n = room;
+        memcpy_P(flash, c.pgm + c.pgmOffset, n);
+        data = flash;
+    }
+    else if (c.body == AB_HISTORY)
+    {
+        if (c.stageOffset >= c.stageLen)
+        {
+            uint16_t got = historyStreamRead(c.hist, c.stage, sizeof(c.stage) / sizeof(c.stage[0]));
+            c.stageLen = got * sizeof(HistBucket);
+            c.stageOffset = 0;
+            if (got == 0)
+                return 0;
+        }
+        data = (const uint8_t *)c.stage + c.stageOffset;
+        n = c.stageLen - c.stageOffset;
+    }
+    else
+        return 0;
+
+    if (n > room)
+        n = room;
+    err_t err = tcp_write(c.pcb, data, n, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+    if (err == ERR_MEM)
+        return 0; // Kolejka lwIP pełna - reszta w kolejnym obiegu
+    if (err != ERR_OK)
+    {
+        failed = true;
+        return 0;
+    }
+
+    if (c.outOffset < c.out.length())
+        c.outOffset += n;
+    else if (c.body == AB_PROGMEM)
+        c.pgmOffset += n;
+    else
+        c.stageOffset += n;
+    return n;
+}
+
+static bool responseDone(const AsyncConn &c)
+{
+    if (c.outOffset < c.out.length())
+        return false;
+    if (c.body == AB_PROGMEM)
+        return c.pgmOffset >= c.pgmLen;
+    if (c.body == AB_HISTORY)
+        return c.stageOffset >= c.stageLen && c.hist.done >= historyTierInfo(c.hist.tier).count;
+    return true;
+}
+
+// Wysyła tyle odpowiedzi, ile mieści bufor nadawczy; całość w kolejce = zamknięcie
+static void pump(AsyncConn &c)
+{
+    bool failed = false;
+    size_t written = 0;
+    size_t n;
+    while ((n = writeSome(c, tcp_sndbuf(c.pcb), failed)) > 0)
+        written += n;
+    if (failed)
+    {
+        counters.errors++;
+        closeConn(c, true);
+        return;
+    }
+    if (written == 0 && !responseDone(c))
+        return;
+    tcp_output(c.pcb);
+    c.progressMs = millis();
+    if (responseDone(c))
+        closeConn(c, false);
+}
+
+void asyncHttpBegin()
+{
+    tcp_pcb *pcb = tcp_new();
+    if (!pcb)
+        return;
+    if (tcp_bind(pcb, IP_ADDR_ANY, HTTP_PORT) != ERR_OK)
+    {
+        DIAG_PRINTF("[HTTP] Port %u zajęty - serwer asynchroniczny wyłączony\n", HTTP_PORT);
+        tcp_close(pcb);
+        return;
+    }
+    // Gniazdo nasłuchujące zajmuje mniej pamięci - poprzednie jest zwalniane
+    listenPcb = tcp_listen_with_backlog(pcb, HTTP_LISTEN_BACKLOG);
+    if (!listenPcb)
+    {
+        tcp_close(pcb);
+        return;
+    }
+    tcp_accept(listenPcb, onAccept);
+    DIAG_PRINTF("[HTTP] Serwer asynchroniczny na porcie %u, pozostałe trasy na %u\n", HTTP_PORT, HTTP_SYNC_PORT);
+}
+
+void asyncHttpLoop()
+{
+    for (AsyncConn &c : conns)
+    {
+        if (c.state == AC_GONE)
+            resetConn(c);
+        if (c.state == AC_SEND)
+            pump(c);
+        unsigned long idleMs = millis() - c.progressMs;
+        if ((c.state == AC_HEAD || c.state == AC_SEND) && idleMs >= HTTP_CLIENT_TIMEOUT_MS)
+        {
+            DIAG_PRINTF("[HTTP] Klient bez postępu od %lu ms - rozłączam\n", idleMs);
+            counters.timeouts++;
+            closeConn(c, true);
+        }
+    }
+
+    // Jedno nowe żądanie na obieg - pozostałe gotowe czekają do kolejnego (po kolei)
+    for (uint8_t k = 0; k < HTTP_ASYNC_MAX_CONNS; k++)
+    {
+        uint8_t i = (nextConn + k) % HTTP_ASYNC_MAX_CONNS;
+        AsyncConn &c = conns[i];
+        if (c.state != AC_READY)
+            continue;
+        nextConn = (i + 1) % HTTP_ASYNC_MAX_CONNS;
+        handleRequest(c);
+        if (c.pcb)
+            pump(c);
+        break;
+    }
+}
+
+bool asyncHttpListening()
+{
+    return listenPcb != nullptr;
+}
+
+uint8_t asyncHttpActive()
+{
+    return activeCount();
+}
+
+void asyncHttpCounters(AsyncHttpCounters &out)
+{
+    out = counters;
+}
+
+void asyncHttpResetCounters()
+{
+    memset(&counters, 0, sizeof(counters));
+}
+
+#endif // HTTP_ASYNC_ENABLED
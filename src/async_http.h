@@ -0,0 +1,60 @@
+#ifndef ASYNC_HTTP_H
+#define ASYNC_HTTP_H
+
+#include <Arduino.h>
+#include "constants.h" // HTTP_ASYNC_ENABLED, limity połączeń
+
+// ============================================================================
+// SERWER HTTP NA ZDARZENIACH lwIP (OPCJONALNY: -DHTTP_ASYNC_ENABLED=1)
+// ============================================================================
+// Wywołania zwrotne TCP (accept/recv/sent/err) działają poza loop() i tylko
+// zbierają nagłówek żądania do stałego bufora połączenia - nikt nie czeka na
+// wolnego klienta. Zadanie "httpasync" obsługuje jedno kompletne żądanie na
+// obieg i wysyła odpowiedź porcjami, które mieszczą się w buforze nadawczym
+// (reszta w kolejnych obiegach) - zapis nigdy nie blokuje pętli.
+//
+// Na porcie 80 obsługiwane są: strona główna, /static/*, /api/status,
+// /api/history oraz API diagnostyczne do odczytu (/api/rtt, /api/incidents,
+// /api/perf, /api/heap - po zalogowaniu). Pozostałe trasy (logowanie,
+// konfiguracja, akcje, OTA) zostają na ESP8266WebServer na HTTP_SYNC_PORT -
+// tu dostają przekierowanie 307 (ciasteczko sesji nie zależy od portu).
+// /api/events odpowiada 503 - strona główna przechodzi wtedy na odpytywanie.
+//
+// Limity kolejki: HTTP_ASYNC_MAX_CONNS połączeń naraz (kolejne odrzucane od
+// razu), nagłówek do HTTP_ASYNC_HEAD_MAX bajtów (431), klient bez postępu
+// (nagłówek albo odbiór odpowiedzi) rozłączany po HTTP_CLIENT_TIMEOUT_MS.
+
+/** @brief Liczniki serwera (do /api/perf i scripts/http_load.py) */
+struct AsyncHttpCounters
+{
+    uint32_t accepted;   // Przyjęte połączenia
+    uint32_t refused;    // Odrzucone - brak wolnego miejsca
+    uint32_t served;     // Odpowiedzi z tras obsługiwanych tutaj
+    uint32_t redirected; // Przekierowania 307 do ESP8266WebServer
+    uint32_t timeouts;   // Rozłączenia klientów bez postępu
+    uint32_t errors;     // Nagłówek za długi/niepoprawny, błąd zapisu
+    uint8_t maxActive;   // Najwięcej połączeń naraz
+};
+
+#if HTTP_ASYNC_ENABLED
+
+/** @brief Otwiera gniazdo nasłuchujące na HTTP_PORT (z setupWebServer) */
+void asyncHttpBegin();
+
+/** @brief Czy port 80 nasłuchuje (false = bind się nie udał, setupWebServer przenosi wtedy ESP8266WebServer na HTTP_PORT) */
+bool asyncHttpListening();
+
+/** @brief Zadanie "httpasync": jedno żądanie na obieg, wysyłka odpowiedzi, limity czasu */
+void asyncHttpLoop();
+
+/** @brief Liczba otwartych połączeń */
+uint8_t asyncHttpActive();
+
+void asyncHttpCounters(AsyncHttpCounters &out);
+
+/** @brief Zeruje liczniki (razem z /api/perf/reset) */
+void asyncHttpResetCounters();
+
+#endif // HTTP_ASYNC_ENABLED
+
+#endif // ASYNC_HTTP_H
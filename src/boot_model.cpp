@@ -0,0 +1,160 @@
+#include "boot_model.h"
+#include "config.h"
+#include "app_globals.h" // logEvent()
+#include <LittleFS.h>
+
+#define BOOT_MODEL_FILE "/boot_model.bin"
+#define BOOT_MODEL_MAGIC 0x314D5442UL // "BTM1"
+#define BOOT_SAMPLE_NONE 0xFFFF       // Faza nieosiągnięta
+
+// Pomiar w dziesiątych sekundy (max ~109 min)
+struct __attribute__((packed)) BootSample
+{
+    uint16_t ds[BOOT_PHASE_COUNT];
+};
+
+struct __attribute__((packed)) BootModelFile
+{
+    uint32_t magic;
+    uint8_t head;
+    uint8_t count;
+    uint8_t timeoutMask[(BOOT_MODEL_SAMPLES + 7) / 8]; // Bit = rozruch bez potwierdzenia internetu
+    BootSample samples[BOOT_MODEL_SAMPLES];
+};
+
+static BootModelFile model;
+
+static uint16_t msToDs(uint32_t ms)
+{
+    uint32_t ds = (ms + 50) / 100;
+    return ds >= BOOT_SAMPLE_NONE ? BOOT_SAMPLE_NONE - 1 : (uint16_t)ds;
+}
+
+static void saveModel()
+{
+    File f = LittleFS.open(BOOT_MODEL_FILE, "w");
+    if (!f)
+        return;
+    f.write((const uint8_t *)&model, sizeof(model));
+    f.close();
+}
+
+void bootModelBegin()
+{
+    File f = LittleFS.open(BOOT_MODEL_FILE, "r");
+    bool ok = f && f.size() == sizeof(model) &&
+              f.read((uint8_t *)&model, sizeof(model)) == sizeof(model) &&
+              model.magic == BOOT_MODEL_MAGIC &&
+              model.head < BOOT_MODEL_SAMPLES && model.count <= BOOT_MODEL_SAMPLES;
+    if (f)
+        f.close();
+
+    if (!ok)
+    {
+        memset(&model, 0, sizeof(model));
+        model.magic = BOOT_MODEL_MAGIC;
+    }
+}
+
+// Percentyl metodą najbliższej rangi (kilkanaście próbek - bez interpolacji)
+static uint32_t percentileDs(uint16_t *values, uint8_t n, uint8_t pct)
+{
+    // Sortowanie przez wstawianie - n <= BOOT_MODEL_SAMPLES
+    for (uint8_t i = 1; i < n; i++)
+    {
+        uint16_t v = values[i];
+        int8_t j = i - 1;
+        while (j >= 0 && values[j] > v)
+        {
+            values[j + 1] = values[j];
+            j--;
+        }
+        values[j + 1] = v;
+    }
+    uint8_t rank = (uint8_t)((pct * n + 99) / 100); // ceil(pct/100 * n)
+    if (rank < 1)
+        rank = 1;
+    return values[rank - 1];
+}
+
+void bootModelStats(BootModelStats &out)
+{
+    memset(&out, 0, sizeof(out));
+    out.samples = model.count;
+
+    for (uint8_t p = 0; p < BOOT_PHASE_COUNT; p++)
+    {
+        uint16_t values[BOOT_MODEL_SAMPLES];
+        uint8_t n = 0;
+        for (uint8_t i = 0; i < model.count; i++)
+        {
+            if (model.samples[i].ds[p] != BOOT_SAMPLE_NONE)
+                values[n++] = model.samples[i].ds[p];
+        }
+        BootPhaseStats &ps = out.phase[p];
+        ps.samples = n;
+        if (n == 0)
+            continue;
+        ps.p50Ms = percentileDs(values, n, 50) * 100UL;
+        ps.p95Ms = percentileDs(values, n, 95) * 100UL;
+        ps.maxMs = values[n - 1] * 100UL; // Po sortowaniu
+    }
+
+    for (uint8_t i = 0; i < model.count; i++)
+    {
+        if (model.timeoutMask[i / 8] & (1 << (i % 8)))
+            out.timeouts++;
+    }
+
+    // Propozycja: P95 czasu do internetu + margines, w granicach z konfiguracji
+    const BootPhaseStats &net = out.phase[BOOT_PHASE_INTERNET];
+    if (net.samples >= BOOT_MODEL_MIN_SAMPLES)
+    {
+        uint32_t suggestion = net.p95Ms + (uint32_t)config.bootTuneMarginSec * 1000UL;
+        uint32_t minMs = (uint32_t)config.bootTuneMinSec * 1000UL;
+        uint32_t maxMs = (uint32_t)config.bootTuneMaxSec * 1000UL;
+        if (suggestion < minMs)
+            suggestion = minMs;
+        if (maxMs >= minMs && suggestion > maxMs)
+            suggestion = maxMs;
+        out.suggestedBootMs = (suggestion + 500) / 1000 * 1000; // Pełne sekundy
+    }
+}
+
+void bootModelRecord(const RouterBootTiming &timing, uint32_t limitMs)
+{
+    uint8_t slot = model.head;
+    BootSample &s = model.samples[slot];
+    s.ds[BOOT_PHASE_WIFI] = timing.wifiMs ? msToDs(timing.wifiMs) : BOOT_SAMPLE_NONE;
+    s.ds[BOOT_PHASE_GATEWAY] = timing.gatewayMs ? msToDs(timing.gatewayMs) : BOOT_SAMPLE_NONE;
+    // Brak potwierdzenia = "co najmniej limit" (cenzura z prawej strony)
+    s.ds[BOOT_PHASE_INTERNET] = timing.confirmed ? msToDs(timing.internetMs) : msToDs(limitMs);
+
+    if (timing.confirmed)
+        model.timeoutMask[slot / 8] &= ~(1 << (slot % 8));
+    else
+        model.timeoutMask[slot / 8] |= (1 << (slot % 8));
+
+    model.head = (model.head + 1) % BOOT_MODEL_SAMPLES;
+    if (model.count < BOOT_MODEL_SAMPLES)
+        model.count++;
+    saveModel();
+
+    if (!config.bootAutoTune)
+        return;
+
+    BootModelStats st;
+    bootModelStats(st);
+    if (st.suggestedBootMs == 0)
+        return;
+
+    unsigned long current = config.baseBootTime;
+    unsigned long diff = (st.suggestedBootMs > current) ? st.suggestedBootMs - current : current - st.suggestedBootMs;
+    if (diff < BOOT_MODEL_APPLY_HYSTERESIS_MS)
+        return;
+
+    logEvent("Auto-strojenie: baseBootTime " + String(current / 1000) + "s -> " + String(st.suggestedBootMs / 1000) +
+             "s (P95 internetu " + String(st.phase[BOOT_PHASE_INTERNET].p95Ms / 1000) + "s)");
+    config.baseBootTime = st.suggestedBootMs;
+    saveConfig();
+}
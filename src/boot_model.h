@@ -0,0 +1,67 @@
+#ifndef BOOT_MODEL_H
+#define BOOT_MODEL_H
+
+#include <Arduino.h>
+#include "router_cycle.h"
+
+// ============================================================================
+// MODEL CZASU ROZRUCHU ROUTERA (UCZONY Z POMIARÓW)
+// ============================================================================
+// Po każdym resecie router_cycle mierzy czas do WiFi, bramy i internetu.
+// Ostatnie BOOT_MODEL_SAMPLES pomiarów trzymamy w pierścieniu (6 B na pomiar,
+// w dziesiątych sekundy) i zapisujemy na LittleFS.
+// Z nich liczymy percentyle, a propozycja baseBootTime = P95(internet) + margines,
+// przycięta do [bootTuneMinSec, bootTuneMaxSec]. Przy bootAutoTune propozycja
+// jest stosowana automatycznie.
+//
+// Rozruch bez potwierdzenia internetu (limit czasu) liczy się jako próbka
+// "co najmniej baseBootTime" - wolny router podnosi P95 zamiast znikać z modelu.
+// Cykl zasilania dotyczy tylko routera głównego - przy aktywnej sieci rezerwowej
+// ESP mierzy inny router, więc takie pomiary są pomijane.
+
+/** @brief Liczba pomiarów pamiętanych dla każdego routera */
+#define BOOT_MODEL_SAMPLES 16
+
+/** @brief Minimalna liczba pomiarów, od której model daje propozycję */
+#define BOOT_MODEL_MIN_SAMPLES 3
+
+/** @brief Zmiana baseBootTime mniejsza niż ta wartość (ms) nie jest stosowana */
+#define BOOT_MODEL_APPLY_HYSTERESIS_MS 5000
+
+enum BootPhase
+{
+    BOOT_PHASE_WIFI = 0,
+    BOOT_PHASE_GATEWAY,
+    BOOT_PHASE_INTERNET,
+    BOOT_PHASE_COUNT
+};
+
+struct BootPhaseStats
+{
+    uint8_t samples; // Pomiary, w których faza została osiągnięta (lub przekroczyła limit)
+    uint32_t p50Ms;
+    uint32_t p95Ms;
+    uint32_t maxMs;
+};
+
+struct BootModelStats
+{
+    uint8_t samples;  // Wszystkie pomiary w pierścieniu
+    uint8_t timeouts; // Rozruchy bez potwierdzenia internetu
+    BootPhaseStats phase[BOOT_PHASE_COUNT];
+    uint32_t suggestedBootMs; // 0 = za mało danych
+};
+
+/** @brief Wczytuje pomiary z Flash (wywołać po zamontowaniu LittleFS) */
+void bootModelBegin();
+
+/**
+ * @brief Dodaje pomiar rozruchu i (przy bootAutoTune) stosuje nową propozycję
+ * @param limitMs limit rozruchu obowiązujący w tym cyklu (baseBootTime)
+ */
+void bootModelRecord(const RouterBootTiming &timing, uint32_t limitMs);
+
+/** @brief Statystyki i propozycja baseBootTime */
+void bootModelStats(BootModelStats &out);
+
+#endif // BOOT_MODEL_H
@@ -0,0 +1,171 @@
+#include "button.h"
+
+#define BUTTON_QUEUE_SIZE 4
+
+static uint8_t buttonPin = 0xFF;
+static bool useInterrupt = false;
+
+// Zapisywane w przerwaniu
+static volatile unsigned long edgeMs = 0;
+static volatile bool edgePending = false;
+
+// Stan po debounce
+static bool stablePressed = false;
+static bool lastRawPressed = false; // Tylko tryb odpytywania
+static unsigned long pressStartMs = 0;
+static bool waitingSecond = false; // Po krótkim kliknięciu czekamy na ewentualne drugie
+static bool secondPress = false;
+static unsigned long firstReleaseMs = 0;
+
+static ButtonEvent queue[BUTTON_QUEUE_SIZE];
+static uint8_t queueHead = 0;
+static uint8_t queueCount = 0;
+
+static void IRAM_ATTR buttonIsr()
+{
+    edgeMs = millis();
+    edgePending = true;
+}
+
+static void pushEvent(ButtonEvent ev)
+{
+    if (queueCount >= BUTTON_QUEUE_SIZE)
+        return; // loop() nie odbiera zdarzeń - najnowsze odrzucamy
+    queue[(queueHead + queueCount) % BUTTON_QUEUE_SIZE] = ev;
+    queueCount++;
+}
+
+static void onPress(unsigned long now)
+{
+    pressStartMs = now;
+    if (waitingSecond)
+        secondPress = true;
+}
+
+static void onRelease(unsigned long now)
+{
+    unsigned long duration = now - pressStartMs;
+    ButtonEvent ev = BTN_SHORT;
+    if (duration > BUTTON_LONG_MS)
+        ev = BTN_LONG;
+    else if (duration > BUTTON_MEDIUM_MS)
+        ev = BTN_MEDIUM;
+
+    if (secondPress)
+    {
+        // Drugie wciśnięcie: krótkie = podwójne kliknięcie, dłuższe = pierwsze krótkie + to zdarzenie
+        waitingSecond = false;
+        secondPress = false;
+        if (ev == BTN_SHORT)
+        {
+            pushEvent(BTN_DOUBLE);
+            return;
+        }
+        pushEvent(BTN_SHORT);
+        pushEvent(ev);
+        return;
+    }
+
+    if (ev == BTN_SHORT)
+    {
+        waitingSecond = true;
+        firstReleaseMs = now;
+        return;
+    }
+    pushEvent(ev);
+}
+
+void buttonBegin(uint8_t pin)
+{
+    buttonPin = pin;
+    pinMode(pin, INPUT_PULLUP);
+    stablePressed = lastRawPressed = (digitalRead(pin) == LOW);
+    if (stablePressed)
+        pressStartMs = millis();
+
+    int irq = digitalPinToInterrupt(pin);
+    useInterrupt = (irq != NOT_AN_INTERRUPT);
+    if (useInterrupt)
+        attachInterrupt(irq, buttonIsr, CHANGE);
+}
+
+void buttonLoop()
+{
+    if (buttonPin == 0xFF)
+        return;
+
+    unsigned long now = millis();
+
+    if (!useInterrupt)
+    {
+        bool raw = (digitalRead(buttonPin) == LOW);
+        if (raw != lastRawPressed)
+        {
+            lastRawPressed = raw;
+            edgeMs = now;
+            edgePending = true;
+        }
+    }
+
+    noInterrupts();
+    bool pending = edgePending;
+    unsigned long lastEdge = edgeMs;
+    interrupts();
+
+    if (pending && now - lastEdge >= BUTTON_DEBOUNCE_MS)
+    {
+        noInterrupts();
+        if (edgeMs == lastEdge)
+            edgePending = false; // Nowe zbocze w międzyczasie - zostaw do następnego obiegu
+        interrupts();
+
+        bool pressed = (digitalRead(buttonPin) == LOW);
+        if (pressed != stablePressed)
+        {
+            stablePressed = pressed;
+            if (pressed)
+                onPress(lastEdge);
+            else
+                onRelease(lastEdge);
+        }
+    }
+
+    // Pojedyncze kliknięcie - drugie nie nadeszło w czasie
+    if (waitingSecond && !stablePressed && now - firstReleaseMs > BUTTON_DOUBLE_GAP_MS)
+    {
+        waitingSecond = false;
+        pushEvent(BTN_SHORT);
+    }
+}
+
+ButtonEvent buttonPoll()
+{
+    if (queueCount == 0)
+        return BTN_NONE;
+    ButtonEvent ev = queue[queueHead];
+    queueHead = (queueHead + 1) % BUTTON_QUEUE_SIZE;
+    queueCount--;
+    return ev;
+}
+
+unsigned long buttonHeldMs()
+{
+    return stablePressed ? millis() - pressStartMs : 0;
+}
+
+const char *buttonEventName(ButtonEvent ev)
+{
+    switch (ev)
+    {
+    case BTN_SHORT:
+        return "krótkie";
+    case BTN_DOUBLE:
+        return "podwójne";
+    case BTN_MEDIUM:
+        return "średnie";
+    case BTN_LONG:
+        return "długie";
+    default:
+        return "-";
+    }
+}
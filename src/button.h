@@ -0,0 +1,53 @@
+#ifndef BUTTON_H
+#define BUTTON_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// PRZYCISK - PRZERWANIE + DEBOUNCE W loop() (BEZ BLOKOWANIA)
+// ============================================================================
+// Przerwanie GPIO (CHANGE) zapisuje tylko czas ostatniego zbocza. buttonLoop()
+// uznaje stan za stabilny, gdy od ostatniego zbocza minęło BUTTON_DEBOUNCE_MS,
+// mierzy czas wciśnięcia i wystawia zdarzenia do kolejki odczytywanej w loop().
+// Pin bez przerwań (GPIO16/D0) jest odpytywany w buttonLoop() - logika ta sama.
+//
+// Krótkie wciśnięcie jest zgłaszane dopiero po BUTTON_DOUBLE_GAP_MS bez drugiego
+// wciśnięcia - inaczej nie dałoby się odróżnić podwójnego kliknięcia.
+
+/** @brief Czas stabilnego stanu pinu wymagany do uznania zmiany (ms) */
+#define BUTTON_DEBOUNCE_MS 30
+
+/** @brief Maksymalna przerwa między kliknięciami podwójnego kliknięcia (ms) */
+#define BUTTON_DOUBLE_GAP_MS 400
+
+/** @brief Wciśnięcie dłuższe niż ta wartość = średnie (ms) */
+#define BUTTON_MEDIUM_MS 3000
+
+/** @brief Wciśnięcie dłuższe niż ta wartość = długie (ms) */
+#define BUTTON_LONG_MS 10000
+
+enum ButtonEvent
+{
+    BTN_NONE = 0,
+    BTN_SHORT,  // < BUTTON_MEDIUM_MS, bez drugiego kliknięcia
+    BTN_DOUBLE, // Dwa krótkie kliknięcia w odstępie < BUTTON_DOUBLE_GAP_MS
+    BTN_MEDIUM, // BUTTON_MEDIUM_MS .. BUTTON_LONG_MS
+    BTN_LONG    // > BUTTON_LONG_MS
+};
+
+/** @brief Konfiguruje pin (INPUT_PULLUP, aktywny stan niski) i przerwanie */
+void buttonBegin(uint8_t pin);
+
+/** @brief Debounce i klasyfikacja - wywoływać w każdym obiegu loop() */
+void buttonLoop();
+
+/** @brief Następne zdarzenie z kolejki (BTN_NONE gdy pusta) */
+ButtonEvent buttonPoll();
+
+/** @brief Czas trwania bieżącego wciśnięcia (0 gdy przycisk zwolniony) */
+unsigned long buttonHeldMs();
+
+/** @brief Nazwa zdarzenia (do logów) */
+const char *buttonEventName(ButtonEvent ev);
+
+#endif // BUTTON_H
@@ -1,5 +1,6 @@
 #include "config.h"
 #include "constants.h"
+#include "perf.h"
 #include <LittleFS.h>
 #include <ArduinoJson.h>
 
@@ -8,6 +9,7 @@ const char *CONFIG_FILE = "/config.json";
 
 bool saveConfig()
 {
+    PERF_SCOPE("saveConfig");
     Serial.println(F("\n┌────────────────────────────────────────┐"));
     Serial.println(F("│ [ZAPIS] ZAPISUJĘ DO JSON / FLASH       │"));
     Serial.println(F("└────────────────────────────────────────┘"));
@@ -25,10 +27,18 @@ bool saveConfig()
     Serial.println(config.maxPingMs);
     Serial.print(F("  • config.lagRetries: "));
     Serial.println(config.lagRetries);
+    Serial.print(F("  • config.lagUseP95: "));
+    Serial.println(config.lagUseP95 ? "ON" : "OFF");
+    Serial.print(F("  • config.burstCount: "));
+    Serial.println(config.burstCount);
+    Serial.print(F("  • config.lossFailPct: "));
+    Serial.println(config.lossFailPct);
     Serial.print(F("  • config.routerOffTime: "));
     Serial.println(config.routerOffTime);
     Serial.print(F("  • config.baseBootTime: "));
     Serial.println(config.baseBootTime);
+    Serial.print(F("  • config.bootAutoTune: "));
+    Serial.println(config.bootAutoTune ? "ON" : "OFF");
     Serial.print(F("  • config.apMaxAttempts: "));
     Serial.println(config.apMaxAttempts);
     Serial.print(F("  • config.sleepWindowMs: "));
@@ -124,6 +134,15 @@ bool saveConfig()
     doc["providerFailureLimit"] = config.providerFailureLimit;
     doc["maxPingMs"] = config.maxPingMs;
     doc["lagRetries"] = config.lagRetries;
+    doc["lagUseP95"] = config.lagUseP95;
+    doc["burstCount"] = config.burstCount;
+    doc["burstGapMs"] = config.burstGapMs;
+    doc["lossFailPct"] = config.lossFailPct;
+    doc["lossWarnPct"] = config.lossWarnPct;
+    doc["bootAutoTune"] = config.bootAutoTune;
+    doc["bootTuneMarginSec"] = config.bootTuneMarginSec;
+    doc["bootTuneMinSec"] = config.bootTuneMinSec;
+    doc["bootTuneMaxSec"] = config.bootTuneMaxSec;
     doc["maxTotalResetsEver"] = config.maxTotalResetsEver;
     doc["totalResetsEver"] = config.totalResetsEver;
     doc["resetDefault"] = config.resetDefault;
@@ -245,6 +264,15 @@ bool loadConfig()
         config.providerFailureLimit = 5;
         config.maxPingMs = 2000;
         config.lagRetries = 3;
+        config.lagUseP95 = false;
+        config.burstCount = 1;
+        config.burstGapMs = 200;
+        config.lossFailPct = 50;
+        config.lossWarnPct = 10;
+        config.bootAutoTune = false;
+        config.bootTuneMarginSec = 15;
+        config.bootTuneMinSec = 30;
+        config.bootTuneMaxSec = 300;
         config.maxTotalResetsEver = 20;
         config.totalResetsEver = 0;
         config.resetDefault = 0;
@@ -316,10 +344,14 @@ bool loadConfig()
     Serial.println(config.maxPingMs);
     Serial.print(F("  • config.lagRetries: "));
     Serial.println(config.lagRetries);
+    Serial.print(F("  • config.lagUseP95: "));
+    Serial.println(config.lagUseP95 ? "ON" : "OFF");
     Serial.print(F("  • config.routerOffTime: "));
     Serial.println(config.routerOffTime);
     Serial.print(F("  • config.baseBootTime: "));
     Serial.println(config.baseBootTime);
+    Serial.print(F("  • config.bootAutoTune: "));
+    Serial.println(config.bootAutoTune ? "ON" : "OFF");
     Serial.print(F("  • config.apMaxAttempts: "));
     Serial.println(config.apMaxAttempts);
     Serial.print(F("  • config.sleepWindowMs: "));
@@ -383,6 +415,15 @@ bool loadConfig()
     config.providerFailureLimit = doc["providerFailureLimit"] | 5;
     config.maxPingMs = doc["maxPingMs"] | 2000;
     config.lagRetries = doc["lagRetries"] | 3;
+    config.lagUseP95 = doc["lagUseP95"] | false;
+    config.burstCount = doc["burstCount"] | 1;
+    config.burstGapMs = doc["burstGapMs"] | 200;
+    config.lossFailPct = doc["lossFailPct"] | 50;
+    config.lossWarnPct = doc["lossWarnPct"] | 10;
+    config.bootAutoTune = doc["bootAutoTune"] | false;
+    config.bootTuneMarginSec = doc["bootTuneMarginSec"] | 15;
+    config.bootTuneMinSec = doc["bootTuneMinSec"] | 30;
+    config.bootTuneMaxSec = doc["bootTuneMaxSec"] | 300;
     config.maxTotalResetsEver = doc["maxTotalResetsEver"] | 20;
     config.totalResetsEver = doc["totalResetsEver"] | 0;
     config.resetDefault = doc["resetDefault"] | 0;
@@ -54,6 +54,15 @@ struct Config
     int providerFailureLimit = 5;             // Limit resetów bez sukcesu, po którym uznać awarię dostawcy
     int maxPingMs = 2000;                     // Maksymalny czas ping w ms, powyżej którego uznaje się lag
     int lagRetries = 3;                       // Ile pingów w jednym teście do potwierdzenia lagu
+    bool lagUseP95 = false;                   // Lag wg P95 z okna 15 min zamiast kolejnych spike'ów
+    int burstCount = 1;                       // Liczba pingów w serii (1 = pojedynczy ping, bez pomiaru straty)
+    int burstGapMs = 200;                     // Odstęp między pingami serii (ms)
+    int lossFailPct = 50;                     // Strata w serii (%) od której próba jest błędem
+    int lossWarnPct = 10;                     // Strata w serii (%) od której logujemy ostrzeżenie
+    bool bootAutoTune = false;                // Automatyczne strojenie baseBootTime z pomiarów rozruchu
+    int bootTuneMarginSec = 15;               // Margines dodawany do P95 czasu rozruchu (s)
+    int bootTuneMinSec = 30;                  // Dolna granica strojonego baseBootTime (s)
+    int bootTuneMaxSec = 300;                 // Górna granica strojonego baseBootTime (s)
     int maxTotalResetsEver = 20;              // Maksymalna liczba resetów ogółem, niezależnie od powodzenia
     int totalResetsEver = 0;                  // Licznik wszystkich resetów ever
     int autoResetCountersHours = 0;           // Auto-reset liczników po X godzinach (0 = wyłączone)
@@ -28,6 +28,28 @@ const unsigned long SLEEP_TIME_MAX_MS = 60 * 60 * 1000; // 60 minut (3600000 ms)
 const unsigned long BACKOFF_MAX_MS = 60 * 60 * 1000;    // Maksymalnie +60 minut backoff
 const unsigned long SIM_NO_WIFI_TIMEOUT_MS = 60 * 1000; // 60 sekund dla symulacji
 
+// === Strona główna (/api/status) ===
+const uint8_t STATUS_EVENTS_MAX = 8;          // Ostatnie zdarzenia w odpowiedzi
+const size_t STATUS_EVENTS_TAIL_BYTES = 1024; // Czytany tylko koniec pliku logów
+
+// === Serwer WWW - ograniczenie wpływu na pętlę główną ===
+// Serwer obsługuje jedno żądanie naraz w loop(). Połączenia ponad kolejkę lwIP
+// odrzuca od razu (przeglądarka ponowi), a zablokowany klient (brak ACK)
+// wstrzymuje pętlę najwyżej na HTTP_CLIENT_TIMEOUT_MS zamiast 5 s z biblioteki.
+const uint8_t HTTP_LISTEN_BACKLOG = 2;           // Połączenia czekające na obsłużenie
+const unsigned long HTTP_CLIENT_TIMEOUT_MS = 2000; // Oczekiwanie na zapis do klienta
+
+// === Serwer na zdarzeniach lwIP (async_http.h) - włączany -DHTTP_ASYNC_ENABLED=1 ===
+// Zajmuje port 80 (strona główna, zasoby statyczne, API do odczytu), a
+// ESP8266WebServer z pozostałymi trasami przechodzi na HTTP_SYNC_PORT.
+#ifndef HTTP_ASYNC_ENABLED
+#define HTTP_ASYNC_ENABLED 0
+#endif
+const uint16_t HTTP_PORT = 80;
+const uint16_t HTTP_SYNC_PORT = HTTP_ASYNC_ENABLED ? 8080 : HTTP_PORT; // ESP8266WebServer
+const uint8_t HTTP_ASYNC_MAX_CONNS = 3;     // Jednoczesne połączenia; kolejne są odrzucane (RST)
+const uint16_t HTTP_ASYNC_HEAD_MAX = 1024;  // Największy nagłówek żądania (więcej = 431)
+
 // === DEBUG - Przełącznik wyłączający autoryzację ===
 // Zmień na 'true' aby pominąć logowanie przy testach
 const bool DEBUG_SKIP_AUTH = false; // ⚠️ UWAGA: ustaw na 'false' przed wdrożeniem w produkcji!
@@ -0,0 +1,238 @@
+#include "crash_log.h"
+#include <LittleFS.h>
+#include <ArduinoJson.h>
+#include <user_interface.h>
+
+#define CRASH_MAGIC 0x31485243UL // "CRH1"
+
+// Stan w .noinit - zapisywany w trakcie pracy, odczytywany po restarcie
+struct CrashState
+{
+    uint32_t magic;
+    char task[16];
+    uint32_t taskStartMs;
+    bool inTask;
+
+    char events[CRASH_EVENTS][CRASH_EVENT_LEN];
+    uint8_t eventHead;
+    uint8_t eventCount;
+
+    // Wypełniane przez custom_crash_callback
+    bool captured;
+    uint32_t uptimeMs;
+    uint32_t reason;
+    uint32_t exccause;
+    uint32_t epc1;
+    uint32_t epc2;
+    uint32_t epc3;
+    uint32_t excvaddr;
+    uint32_t depc;
+    uint8_t stackCount;
+    uint32_t stack[CRASH_STACK_ADDRS];
+};
+
+static CrashState state __attribute__((section(".noinit")));
+static bool ready = false; // Do crashLogBegin() stan poprzedniej pracy jest nietykalny
+
+static void clearState()
+{
+    memset(&state, 0, sizeof(state));
+    state.magic = CRASH_MAGIC;
+}
+
+static bool isCodeAddress(uint32_t v)
+{
+    // IRAM (0x4010xxxx) albo kod we Flash zmapowany od 0x40200000
+    return (v >= 0x40100000UL && v < 0x40110000UL) || (v >= 0x40200000UL && v < 0x40300000UL);
+}
+
+// Wywoływane przez core przy wyjątku, panic i Software WDT - tylko RAM, bez Flash i Serial
+extern "C" void custom_crash_callback(struct rst_info *info, uint32_t stack, uint32_t stackEnd)
+{
+    if (state.magic != CRASH_MAGIC)
+        clearState();
+
+    state.captured = true;
+    state.uptimeMs = millis();
+    state.reason = info->reason;
+    state.exccause = info->exccause;
+    state.epc1 = info->epc1;
+    state.epc2 = info->epc2;
+    state.epc3 = info->epc3;
+    state.excvaddr = info->excvaddr;
+    state.depc = info->depc;
+
+    // Wyciąg ze stosu: tylko słowa wyglądające jak adresy powrotu (jak w dekoderze)
+    state.stackCount = 0;
+    for (uint32_t p = stack; p < stackEnd && state.stackCount < CRASH_STACK_ADDRS; p += 4)
+    {
+        uint32_t v = *(const uint32_t *)(uintptr_t)p;
+        if (isCodeAddress(v))
+            state.stack[state.stackCount++] = v;
+    }
+}
+
+static const char *reasonName(uint32_t reason)
+{
+    switch (reason)
+    {
+    case REASON_WDT_RST:
+        return "Hardware WDT";
+    case REASON_EXCEPTION_RST:
+        return "Exception";
+    case REASON_SOFT_WDT_RST:
+        return "Software WDT";
+    default:
+        return "Unknown";
+    }
+}
+
+static String hex32(uint32_t v)
+{
+    char buf[11];
+    snprintf(buf, sizeof(buf), "0x%08lx", (unsigned long)v);
+    return String(buf);
+}
+
+// Dopisuje rekord, zostawiając najwyżej CRASH_LOG_MAX ostatnich
+static void appendRecord(const String &line)
+{
+    String kept[CRASH_LOG_MAX - 1];
+    uint8_t keptCount = 0;
+
+    File f = LittleFS.open(CRASH_LOG_FILE, "r");
+    if (f)
+    {
+        while (f.available())
+        {
+            String l = f.readStringUntil('\n');
+            if (l.length() == 0)
+                continue;
+            if (keptCount == CRASH_LOG_MAX - 1)
+            {
+                for (uint8_t i = 1; i < keptCount; i++)
+                    kept[i - 1] = kept[i];
+                keptCount--;
+            }
+            kept[keptCount++] = l;
+        }
+        f.close();
+    }
+
+    f = LittleFS.open(CRASH_LOG_FILE, "w");
+    if (!f)
+        return;
+    for (uint8_t i = 0; i < keptCount; i++)
+        f.println(kept[i]);
+    f.println(line);
+    f.close();
+}
+
+void crashLogBegin()
+{
+    const rst_info *info = system_get_rst_info();
+    uint32_t reason = info ? info->reason : REASON_DEFAULT_RST;
+    bool unplanned = (reason == REASON_WDT_RST || reason == REASON_EXCEPTION_RST || reason == REASON_SOFT_WDT_RST);
+
+    if (state.magic != CRASH_MAGIC)
+    {
+        // Zimny start: śmieci w .noinit - nie ma czego zapisać
+        clearState();
+        ready = true;
+        return;
+    }
+
+    if (unplanned)
+    {
+        JsonDocument doc;
+        doc["reason"] = reasonName(reason);
+        doc["task"] = state.task;
+        doc["inTask"] = state.inTask; // true = awaria w trakcie zadania
+        if (state.inTask)
+            doc["taskStartMs"] = state.taskStartMs;
+
+        // Rejestry: z callbacku, a gdy go nie było (Hardware WDT) - z rst_info SDK
+        const bool captured = state.captured && state.reason == reason;
+        doc["exccause"] = captured ? state.exccause : info->exccause;
+        doc["epc1"] = hex32(captured ? state.epc1 : info->epc1);
+        doc["epc2"] = hex32(captured ? state.epc2 : info->epc2);
+        doc["epc3"] = hex32(captured ? state.epc3 : info->epc3);
+        doc["excvaddr"] = hex32(captured ? state.excvaddr : info->excvaddr);
+        doc["depc"] = hex32(captured ? state.depc : info->depc);
+        if (captured)
+        {
+            doc["uptimeMs"] = state.uptimeMs;
+            JsonArray stack = doc["stack"].to<JsonArray>();
+            for (uint8_t i = 0; i < state.stackCount && i < CRASH_STACK_ADDRS; i++)
+                stack.add(hex32(state.stack[i]));
+        }
+
+        // Zdarzenia od najstarszego
+        JsonArray events = doc["events"].to<JsonArray>();
+        uint8_t count = state.eventCount < CRASH_EVENTS ? state.eventCount : CRASH_EVENTS;
+        uint8_t start = (state.eventHead + CRASH_EVENTS - count) % CRASH_EVENTS;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            char *e = state.events[(start + i) % CRASH_EVENTS];
+            e[CRASH_EVENT_LEN - 1] = '\0';
+            events.add(e);
+        }
+
+        String line;
+        serializeJson(doc, line);
+        appendRecord(line);
+        Serial.print("[CRASH] ");
+        Serial.println(line);
+    }
+
+    clearState();
+    ready = true;
+}
+
+void crashTaskBegin(const char *name)
+{
+    if (!ready)
+        return;
+    strncpy(state.task, name, sizeof(state.task) - 1);
+    state.task[sizeof(state.task) - 1] = '\0';
+    state.taskStartMs = millis();
+    state.inTask = true;
+}
+
+void crashTaskEnd()
+{
+    if (!ready)
+        return;
+    state.inTask = false;
+}
+
+void crashNoteEvent(const char *line)
+{
+    if (!ready)
+        return;
+    strncpy(state.events[state.eventHead], line, CRASH_EVENT_LEN - 1);
+    state.events[state.eventHead][CRASH_EVENT_LEN - 1] = '\0';
+    state.eventHead = (state.eventHead + 1) % CRASH_EVENTS;
+    if (state.eventCount < CRASH_EVENTS)
+        state.eventCount++;
+}
+
+uint8_t crashLogCount()
+{
+    File f = LittleFS.open(CRASH_LOG_FILE, "r");
+    if (!f)
+        return 0;
+    uint8_t count = 0;
+    while (f.available())
+    {
+        if (f.readStringUntil('\n').length() > 0)
+            count++;
+    }
+    f.close();
+    return count;
+}
+
+void crashLogClear()
+{
+    LittleFS.remove(CRASH_LOG_FILE);
+}
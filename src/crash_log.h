@@ -0,0 +1,53 @@
+#ifndef CRASH_LOG_H
+#define CRASH_LOG_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// POST-MORTEM: ZAPIS STANU PRZED AWARIĄ ESP (EXCEPTION / WDT)
+// ============================================================================
+// W pamięci .noinit (przetrwa restart, nie przetrwa odłączenia zasilania):
+//   - bieżące zadanie harmonogramu (nazwa, od kiedy, czy wciąż trwa),
+//   - ostatnie CRASH_EVENTS wpisy logEvent (skrócone),
+//   - przy wyjątku / Software WDT: przyczyna, epc1-3, excvaddr, depc
+//     i adresy kodu znalezione na stosie (custom_crash_callback z core).
+// Hardware WDT nie wywołuje żadnego callbacku - zostaje ostatnie zadanie i zdarzenia.
+//
+// Przy kolejnym starcie po nieplanowanym resecie rekord (JSON w jednej linii)
+// trafia do CRASH_LOG_FILE (ostatnie CRASH_LOG_MAX rekordów), a stan jest czyszczony.
+// Adresy dekoduje się narzędziem EspExceptionDecoder / addr2line z plikiem .elf.
+
+/** @brief Plik z rekordami awarii (JSON, rekord na linię) */
+#define CRASH_LOG_FILE "/crash.log"
+
+/** @brief Liczba przechowywanych rekordów */
+#define CRASH_LOG_MAX 5
+
+/** @brief Liczba zapamiętanych ostatnich zdarzeń */
+#define CRASH_EVENTS 5
+
+/** @brief Maksymalna długość zdarzenia (ze znakiem końca) */
+#define CRASH_EVENT_LEN 56
+
+/** @brief Liczba adresów kodu zapisywanych ze stosu */
+#define CRASH_STACK_ADDRS 16
+
+/** @brief Zapis rekordu po nieplanowanym resecie i wyczyszczenie stanu (po zamontowaniu LittleFS) */
+void crashLogBegin();
+
+/** @brief Zadanie harmonogramu zaczyna pracę (nazwa jest kopiowana) */
+void crashTaskBegin(const char *name);
+
+/** @brief Zadanie harmonogramu skończyło pracę */
+void crashTaskEnd();
+
+/** @brief Dopisuje zdarzenie do pierścienia ostatnich zdarzeń */
+void crashNoteEvent(const char *line);
+
+/** @brief Liczba zapisanych rekordów */
+uint8_t crashLogCount();
+
+/** @brief Usuwa plik z rekordami */
+void crashLogClear();
+
+#endif // CRASH_LOG_H
@@ -0,0 +1,142 @@
+#include "heap_stats.h"
+
+static HeapSample ring[HEAP_RING_SIZE];
+static uint8_t ringHead = 0; // Indeks następnego zapisu
+static uint8_t ringCount = 0;
+static unsigned long lastSampleMs = 0;
+
+static HeapSiteStats sites[HEAP_MAX_SITES];
+static uint8_t siteCount = 0;
+
+static HeapScope *innermost = nullptr; // Najgłębszy aktywny zakres
+static uint32_t lowWater = UINT32_MAX;
+
+static uint16_t clamp16(uint32_t v)
+{
+    return v > 0xFFFF ? 0xFFFF : (uint16_t)v;
+}
+
+static uint32_t freeHeapNow()
+{
+    uint32_t free = ESP.getFreeHeap();
+    if (free < lowWater)
+        lowWater = free;
+    return free;
+}
+
+static void takeSample()
+{
+    HeapSample &s = ring[ringHead];
+    s.uptimeSec = millis() / 1000;
+    s.freeHeap = clamp16(freeHeapNow());
+    s.maxBlock = clamp16(ESP.getMaxFreeBlockSize());
+    s.fragPct = ESP.getHeapFragmentation();
+
+    ringHead = (ringHead + 1) % HEAP_RING_SIZE;
+    if (ringCount < HEAP_RING_SIZE)
+        ringCount++;
+    lastSampleMs = millis();
+}
+
+void heapStatsBegin()
+{
+    takeSample();
+}
+
+void heapStatsLoop()
+{
+    if (millis() - lastSampleMs >= HEAP_SAMPLE_MS)
+        takeSample();
+}
+
+int8_t heapRegister(const char *name)
+{
+    for (uint8_t i = 0; i < siteCount; i++)
+    {
+        if (strcmp(sites[i].name, name) == 0)
+            return i;
+    }
+    if (siteCount >= HEAP_MAX_SITES)
+        return -1;
+    HeapSiteStats &s = sites[siteCount];
+    memset(&s, 0, sizeof(s));
+    s.name = name;
+    s.minFree = 0xFFFF;
+    s.minBlock = 0xFFFF;
+    return siteCount++;
+}
+
+void heapCheckpoint()
+{
+    if (!innermost)
+        return;
+    uint32_t free = freeHeapNow();
+    // Wystarczy najgłębszy - zewnętrzne dostaną minimum przy jego zamknięciu
+    if (free < innermost->minFree)
+        innermost->minFree = free;
+}
+
+HeapScope::HeapScope(int8_t site) : site(site), outer(innermost)
+{
+    entryFree = freeHeapNow();
+    minFree = entryFree;
+    innermost = this;
+}
+
+HeapScope::~HeapScope()
+{
+    innermost = outer;
+    uint32_t exitFree = freeHeapNow();
+    if (exitFree < minFree)
+        minFree = exitFree;
+    if (outer && minFree < outer->minFree)
+        outer->minFree = minFree;
+
+    if (site < 0)
+        return;
+    HeapSiteStats &s = sites[site];
+    s.calls++;
+    if (minFree < s.minFree)
+        s.minFree = clamp16(minFree);
+    uint16_t used = clamp16(entryFree - minFree);
+    if (used > s.maxUsed)
+        s.maxUsed = used;
+    uint16_t block = clamp16(ESP.getMaxFreeBlockSize());
+    if (block < s.minBlock)
+        s.minBlock = block;
+    uint8_t frag = ESP.getHeapFragmentation();
+    if (frag > s.maxFrag)
+        s.maxFrag = frag;
+}
+
+uint32_t heapLowWater()
+{
+    return lowWater;
+}
+
+uint8_t heapSampleCount()
+{
+    return ringCount;
+}
+
+bool heapSample(uint8_t index, HeapSample &out)
+{
+    if (index >= ringCount)
+        return false;
+    uint8_t oldest = (ringHead + HEAP_RING_SIZE - ringCount) % HEAP_RING_SIZE;
+    out = ring[(oldest + index) % HEAP_RING_SIZE];
+    return true;
+}
+
+uint8_t heapSiteCount()
+{
+    return siteCount;
+}
+
+bool heapSiteStats(uint8_t index, HeapSiteStats &out)
+{
+    if (index >= siteCount)
+        return false;
+    out = sites[index];
+    return true;
+}
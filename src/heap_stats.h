@@ -0,0 +1,96 @@
+#ifndef HEAP_STATS_H
+#define HEAP_STATS_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// TELEMETRIA STERTY (WOLNA PAMIĘĆ, NAJWIĘKSZY BLOK, FRAGMENTACJA)
+// ============================================================================
+// Co HEAP_SAMPLE_MS próbka ESP.getFreeHeap(), getMaxFreeBlockSize() i
+// getHeapFragmentation() trafia do pierścienia w RAM (ostatnia godzina).
+//
+// HEAP_SCOPE("nazwa") na początku bloku zapamiętuje najniższą wolną stertę
+// widzianą w trakcie jego wykonania (wejście, wyjście i każde heapCheckpoint()
+// po drodze). Zakresy mogą być zagnieżdżone - minimum zagnieżdżonego zakresu
+// jest też minimum zakresu zewnętrznego. Dla każdego miejsca liczymy też
+// największe zużycie (wolna przy wejściu - minimum) i najmniejszy wolny blok
+// przy wyjściu - po tym widać, która strona lub faza watchdoga fragmentuje stertę.
+//
+// Wartości w bajtach są nasycane na 65535 (sterta ESP8266 ma ~50 KB).
+
+/** @brief Co ile próbkować stertę (ms) */
+#define HEAP_SAMPLE_MS 60000UL
+
+/** @brief Liczba próbek w pierścieniu (60 x 1 min = 1 h) */
+#define HEAP_RING_SIZE 60
+
+/** @brief Maksymalna liczba miejsc pomiaru (trasy HTTP + fazy watchdoga) */
+#define HEAP_MAX_SITES 48
+
+struct HeapSample
+{
+    uint32_t uptimeSec;
+    uint16_t freeHeap;
+    uint16_t maxBlock;
+    uint8_t fragPct;
+};
+
+struct HeapSiteStats
+{
+    const char *name;
+    uint32_t calls;
+    uint16_t minFree;  // Najniższa wolna sterta w trakcie wykonania
+    uint16_t maxUsed;  // Największe zużycie w trakcie (wolna przy wejściu - minimum)
+    uint16_t minBlock; // Najmniejszy największy wolny blok przy wyjściu
+    uint8_t maxFrag;   // Największa fragmentacja przy wyjściu (%)
+};
+
+/** @brief Pierwsza próbka (wywołać w setup()) */
+void heapStatsBegin();
+
+/** @brief Próbkowanie co HEAP_SAMPLE_MS (wywoływać w pętli) */
+void heapStatsLoop();
+
+/** @brief Rejestruje miejsce pomiaru (ta sama nazwa = to samo miejsce); -1 gdy brak miejsca */
+int8_t heapRegister(const char *name);
+
+/** @brief Aktualizuje minimum aktywnych zakresów (np. tuż przed wysłaniem dużego bufora) */
+void heapCheckpoint();
+
+/** @brief Pomiar sterty w zakresie bloku (RAII) */
+class HeapScope
+{
+public:
+    explicit HeapScope(int8_t site);
+    ~HeapScope();
+
+private:
+    friend void heapCheckpoint();
+    int8_t site;
+    uint32_t entryFree;
+    uint32_t minFree;
+    HeapScope *outer;
+};
+
+#define HEAP_CONCAT_(a, b) a##b
+#define HEAP_CONCAT(a, b) HEAP_CONCAT_(a, b)
+#define HEAP_SCOPE(name)                                                        \
+    static const int8_t HEAP_CONCAT(heapSite_, __LINE__) = heapRegister(name); \
+    HeapScope HEAP_CONCAT(heapScope_, __LINE__)(HEAP_CONCAT(heapSite_, __LINE__))
+
+/** @brief Najniższa wolna sterta od startu (próbki + zakresy) */
+uint32_t heapLowWater();
+
+/** @brief Liczba próbek w pierścieniu */
+uint8_t heapSampleCount();
+
+/** @brief Próbka; index 0 = najstarsza; false gdy spoza zakresu */
+bool heapSample(uint8_t index, HeapSample &out);
+
+/** @brief Liczba zarejestrowanych miejsc */
+uint8_t heapSiteCount();
+
+/** @brief Statystyki miejsca; false gdy indeks spoza zakresu */
+bool heapSiteStats(uint8_t index, HeapSiteStats &out);
+
+#endif // HEAP_STATS_H
@@ -0,0 +1,374 @@
+#include "history.h"
+#include "config.h"
+#include "perf.h"
+#include <LittleFS.h>
+#include <time.h>
+
+static_assert(sizeof(HistBucket) == 16, "HistBucket musi mieć 16 B (format pliku i API)");
+
+static const HistTierInfo HIST_TIERS[HIST_TIER_COUNT] = {
+    {"/hist_1m.bin", 60, 1440},
+    {"/hist_15m.bin", 900, 672},
+    {"/hist_1h.bin", 3600, 2160},
+};
+
+// Akumulator bieżącego (otwartego) kubełka jednego poziomu
+struct HistAccum
+{
+    uint32_t start; // 0 = brak otwartego kubełka
+    uint32_t rttSum;
+    uint16_t rttCount;
+    uint16_t rttMin;
+    uint16_t rttMax;
+    uint16_t up;
+    uint16_t down;
+    uint16_t sent;
+    uint16_t lost;
+};
+
+struct HistPending
+{
+    uint8_t tier;
+    uint16_t index;
+    HistBucket bucket;
+};
+
+static HistAccum accum[HIST_TIER_COUNT];
+static HistPending pending[HISTORY_PENDING_MAX];
+static uint8_t pendingCount = 0;
+static unsigned long lastProbeMs = 0;
+static unsigned long lastCheckpointMs = 0;
+static bool historyReady = false;
+
+const HistTierInfo &historyTierInfo(HistTier tier)
+{
+    return HIST_TIERS[tier < HIST_TIER_COUNT ? tier : HIST_TIER_1M];
+}
+
+HistTier historyTierByName(const char *name)
+{
+    if (strcmp(name, "15m") == 0)
+        return HIST_TIER_15M;
+    if (strcmp(name, "1h") == 0)
+        return HIST_TIER_1H;
+    return HIST_TIER_1M;
+}
+
+uint32_t historyNow()
+{
+    time_t now = time(nullptr);
+    if (now > 1600000000)
+        return (uint32_t)now;
+
+    // Brak bieżącego NTP - szacunek od ostatniej synchronizacji (tylko w tej samej sesji pracy)
+    if (config.lastNtpSync > 1600000000 && config.ntpSyncMillis > 0 && millis() >= config.ntpSyncMillis)
+        return (uint32_t)config.lastNtpSync + (millis() - config.ntpSyncMillis) / 1000;
+
+    return 0;
+}
+
+static uint16_t bucketIndex(const HistTierInfo &info, uint32_t start)
+{
+    return (start / info.bucketSeconds) % info.count;
+}
+
+static HistBucket accumToBucket(const HistAccum &a)
+{
+    HistBucket b;
+    b.start = a.start;
+    if (a.rttCount > 0)
+    {
+        b.rttMin = a.rttMin;
+        b.rttAvg = (uint16_t)(a.rttSum / a.rttCount);
+        b.rttMax = a.rttMax;
+    }
+    else
+    {
+        b.rttMin = b.rttAvg = b.rttMax = 0xFFFF;
+    }
+    b.upSeconds = a.up;
+    b.downSeconds = a.down;
+    b.lossPct = a.sent ? (uint8_t)((a.lost * 100UL + a.sent / 2) / a.sent) : 0xFF;
+    b.probes = a.sent > 255 ? 255 : (uint8_t)a.sent;
+    return b;
+}
+
+// Po restarcie ESP kontynuuj kubełek zapisany przy ostatnim checkpoincie
+static void seedAccumFromFile(HistTier tier, HistAccum &a)
+{
+    HistBucket b;
+    if (!historyReadBucket(tier, bucketIndex(HIST_TIERS[tier], a.start), b) || b.start != a.start)
+        return;
+
+    a.up = b.upSeconds;
+    a.down = b.downSeconds;
+    if (b.lossPct != 0xFF)
+    {
+        a.sent = b.probes;
+        a.lost = (uint16_t)((b.probes * b.lossPct + 50) / 100);
+    }
+    if (b.rttAvg != 0xFFFF)
+    {
+        a.rttCount = (a.sent > a.lost) ? (a.sent - a.lost) : 1;
+        a.rttSum = (uint32_t)b.rttAvg * a.rttCount;
+        a.rttMin = b.rttMin;
+        a.rttMax = b.rttMax;
+    }
+}
+
+static void writeBucket(File &f, uint16_t index, const HistBucket &b)
+{
+    f.seek((uint32_t)index * sizeof(HistBucket), SeekSet);
+    f.write((const uint8_t *)&b, sizeof(HistBucket));
+}
+
+static void flushPending()
+{
+    if (!historyReady)
+    {
+        pendingCount = 0;
+        return;
+    }
+
+    // Jeden plik otwierany raz na checkpoint - zapisujemy wszystkie jego kubełki naraz
+    for (uint8_t t = 0; t < HIST_TIER_COUNT; t++)
+    {
+        bool hasWork = (accum[t].start != 0);
+        for (uint8_t i = 0; i < pendingCount && !hasWork; i++)
+            hasWork = (pending[i].tier == t);
+        if (!hasWork)
+            continue;
+
+        File f = LittleFS.open(HIST_TIERS[t].path, "r+");
+        if (!f)
+            continue;
+        for (uint8_t i = 0; i < pendingCount; i++)
+        {
+            if (pending[i].tier == t)
+                writeBucket(f, pending[i].index, pending[i].bucket);
+        }
+        // Częściowy bieżący kubełek - aby restart ESP nie gubił danych
+        if (accum[t].start != 0)
+            writeBucket(f, bucketIndex(HIST_TIERS[t], accum[t].start), accumToBucket(accum[t]));
+        f.close();
+    }
+    pendingCount = 0;
+}
+
+static void closeBucket(HistTier tier)
+{
+    HistAccum &a = accum[tier];
+    if (a.start == 0)
+        return;
+
+    if (pendingCount >= HISTORY_PENDING_MAX)
+        flushPending();
+
+    HistPending &p = pending[pendingCount++];
+    p.tier = tier;
+    p.index = bucketIndex(HIST_TIERS[tier], a.start);
+    p.bucket = accumToBucket(a);
+    a.start = 0;
+}
+
+void historyBegin()
+{
+    static const uint8_t zeros[64] = {0};
+
+    for (uint8_t t = 0; t < HIST_TIER_COUNT; t++)
+    {
+        const HistTierInfo &info = HIST_TIERS[t];
+        size_t expected = (size_t)info.count * sizeof(HistBucket);
+
+        File f = LittleFS.open(info.path, "r");
+        bool ok = f && f.size() == expected;
+        if (f)
+            f.close();
+        if (ok)
+            continue;
+
+        // Prealokacja - stały rozmiar pliku, później tylko nadpisywanie w miejscu
+        Serial.printf("[HISTORY] Tworzę %s (%u B)\n", info.path, (unsigned)expected);
+        f = LittleFS.open(info.path, "w");
+        if (!f)
+        {
+            Serial.printf("[HISTORY] Nie można utworzyć %s\n", info.path);
+            return;
+        }
+        for (size_t written = 0; written < expected; written += sizeof(zeros))
+        {
+            f.write(zeros, sizeof(zeros));
+            ESP.wdtFeed();
+        }
+        f.close();
+    }
+
+    memset(accum, 0, sizeof(accum));
+    pendingCount = 0;
+    lastCheckpointMs = millis();
+    historyReady = true;
+}
+
+void historyRecordProbe(bool up, int rttMs, uint8_t sent, uint8_t lost)
+{
+    if (!historyReady)
+        return;
+
+    unsigned long nowMs = millis();
+    uint32_t now = historyNow();
+
+    // Czas od poprzedniej próby przypisujemy werdyktowi tej próby.
+    // Dłuższe przerwy (restart, brak prób) to brak obserwacji, a nie awaria.
+    unsigned long maxGapMs = config.pingInterval * 2;
+    unsigned long elapsedMs = (lastProbeMs == 0) ? config.pingInterval : (nowMs - lastProbeMs);
+    if (elapsedMs > maxGapMs)
+        elapsedMs = config.pingInterval;
+    lastProbeMs = nowMs;
+
+    if (now == 0)
+        return; // Bez czasu kalendarzowego nie umiemy umieścić kubełka
+
+    uint16_t elapsedSec = (elapsedMs >= 3600000UL) ? 3600 : (uint16_t)(elapsedMs / 1000UL);
+
+    for (uint8_t t = 0; t < HIST_TIER_COUNT; t++)
+    {
+        const HistTierInfo &info = HIST_TIERS[t];
+        HistAccum &a = accum[t];
+        uint32_t start = now - (now % info.bucketSeconds);
+
+        if (a.start != start)
+        {
+            closeBucket((HistTier)t);
+            memset(&a, 0, sizeof(a));
+            a.start = start;
+            a.rttMin = 0xFFFF;
+            seedAccumFromFile((HistTier)t, a);
+        }
+
+        // Suma up+down nie może przekroczyć długości kubełka
+        uint16_t used = a.up + a.down;
+        uint16_t room = (used < info.bucketSeconds) ? (info.bucketSeconds - used) : 0;
+        uint16_t credit = (elapsedSec < room) ? elapsedSec : room;
+        if (up)
+            a.up += credit;
+        else
+            a.down += credit;
+
+        a.sent += sent;
+        a.lost += lost;
+        if (rttMs >= 0)
+        {
+            uint16_t rtt = (rttMs > 0xFFFE) ? 0xFFFE : (uint16_t)rttMs;
+            a.rttSum += rtt;
+            a.rttCount++;
+            if (rtt < a.rttMin)
+                a.rttMin = rtt;
+            if (rtt > a.rttMax)
+                a.rttMax = rtt;
+        }
+    }
+}
+
+void historyLoop()
+{
+    if (!historyReady)
+        return;
+    if (millis() - lastCheckpointMs >= HISTORY_CHECKPOINT_MS)
+    {
+        lastCheckpointMs = millis();
+        flushPending();
+    }
+}
+
+void historyFlush()
+{
+    PERF_SCOPE("history.flush");
+    lastCheckpointMs = millis();
+    flushPending();
+}
+
+void historyOverlay(HistTier tier, uint16_t firstIndex, HistBucket *buf, uint16_t n)
+{
+    if (tier >= HIST_TIER_COUNT)
+        return;
+
+    // Kolejka w kolejności zamykania - późniejsze wpisy nadpisują wcześniejsze
+    for (uint8_t i = 0; i < pendingCount; i++)
+    {
+        if (pending[i].tier == tier && pending[i].index >= firstIndex && pending[i].index < firstIndex + n)
+            buf[pending[i].index - firstIndex] = pending[i].bucket;
+    }
+    if (accum[tier].start != 0)
+    {
+        uint16_t idx = bucketIndex(HIST_TIERS[tier], accum[tier].start);
+        if (idx >= firstIndex && idx < firstIndex + n)
+            buf[idx - firstIndex] = accumToBucket(accum[tier]);
+    }
+}
+
+bool historyReadBucket(HistTier tier, uint16_t index, HistBucket &out)
+{
+    const HistTierInfo &info = historyTierInfo(tier);
+    if (index >= info.count)
+        return false;
+
+    File f = LittleFS.open(info.path, "r");
+    if (!f)
+        return false;
+    f.seek((uint32_t)index * sizeof(HistBucket), SeekSet);
+    bool ok = f.read((uint8_t *)&out, sizeof(HistBucket)) == sizeof(HistBucket);
+    f.close();
+    return ok;
+}
+
+bool historyStreamOpen(HistoryStream &s, HistTier tier, uint8_t header[HISTORY_STREAM_HEADER])
+{
+    const HistTierInfo &info = historyTierInfo(tier);
+    s.file = LittleFS.open(info.path, "r");
+    if (!s.file)
+        return false;
+
+    uint32_t now = historyNow();
+    memset(header, 0, HISTORY_STREAM_HEADER);
+    memcpy(header, "RRD1", 4);
+    header[4] = 1;
+    header[5] = sizeof(HistBucket);
+    memcpy(header + 6, &info.bucketSeconds, 2);
+    memcpy(header + 8, &info.count, 2);
+    memcpy(header + 12, &now, 4);
+
+    s.tier = tier;
+    s.first = now ? (uint16_t)(((now / info.bucketSeconds) + 1) % info.count) : 0;
+    s.done = 0;
+    return true;
+}
+
+uint16_t historyStreamRead(HistoryStream &s, HistBucket *buf, uint16_t max)
+{
+    const HistTierInfo &info = historyTierInfo(s.tier);
+    if (s.done >= info.count)
+        return 0;
+
+    uint16_t index = (s.first + s.done) % info.count;
+    uint16_t n = info.count - index; // Do końca pliku (potem zawinięcie)
+    if (n > max)
+        n = max;
+    if (n > info.count - s.done)
+        n = info.count - s.done;
+
+    s.file.seek((uint32_t)index * sizeof(HistBucket), SeekSet);
+    size_t got = s.file.read((uint8_t *)buf, n * sizeof(HistBucket));
+    if (got < n * sizeof(HistBucket))
+        memset((uint8_t *)buf + got, 0, n * sizeof(HistBucket) - got);
+    historyOverlay(s.tier, index, buf, n);
+
+    s.done += n;
+    if (s.done >= info.count)
+        s.file.close();
+    return n;
+}
+
+size_t historyStreamLength(HistTier tier)
+{
+    return HISTORY_STREAM_HEADER + (size_t)historyTierInfo(tier).count * sizeof(HistBucket);
+}
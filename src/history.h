@@ -0,0 +1,130 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// ============================================================================
+// ARCHIWUM HISTORII (RRD) - OPÓŹNIENIA I DOSTĘPNOŚĆ
+// ============================================================================
+// Trzy poziomy rozdzielczości, każdy jako pierścień o stałym rozmiarze:
+//   1 min  x 1440 (24 h)
+//   15 min x 672  (7 dni)
+//   1 h    x 2160 (90 dni)
+//
+// Pełne pierścienie (~67 KB) nie zmieszczą się w RAM ESP8266, dlatego leżą
+// w plikach LittleFS o stałym rozmiarze (prealokowanych przy starcie).
+// W RAM trzymamy tylko bieżący kubełek każdego poziomu oraz małą kolejkę
+// zamkniętych kubełków, zapisywaną na Flash co HISTORY_CHECKPOINT_MS.
+// Konsolidacja jest przyrostowa - każda próbka od razu trafia do wszystkich poziomów.
+//
+// Pozycja kubełka w pierścieniu = (start / długość) % liczba, więc luki
+// (brak zasilania, brak czasu NTP) są widoczne jako kubełki z nieaktualnym
+// polem start - czytelnik traktuje je jako "brak danych".
+
+/** @brief Co ile zapisywać zaległe kubełki na Flash (ochrona przed zużyciem) */
+#define HISTORY_CHECKPOINT_MS (15UL * 60UL * 1000UL)
+
+/** @brief Pojemność kolejki zamkniętych kubełków oczekujących na zapis */
+#define HISTORY_PENDING_MAX 20
+
+enum HistTier
+{
+    HIST_TIER_1M = 0,
+    HIST_TIER_15M,
+    HIST_TIER_1H,
+    HIST_TIER_COUNT
+};
+
+/** @brief Spakowany kubełek archiwum (16 B, taki sam w RAM, w pliku i w API) */
+struct __attribute__((packed)) HistBucket
+{
+    uint32_t start;       // Epoch (s) początku kubełka; 0 = brak danych
+    uint16_t rttMin;      // ms; 0xFFFF = brak udanych pingów
+    uint16_t rttAvg;      // ms
+    uint16_t rttMax;      // ms
+    uint16_t upSeconds;   // Sekundy z działającym internetem
+    uint16_t downSeconds; // Sekundy awarii (pozostała część kubełka = brak obserwacji)
+    uint8_t lossPct;      // Strata pakietów 0-100; 0xFF = brak wysłanych pingów
+    uint8_t probes;       // Liczba wysłanych pingów (nasyca się na 255)
+};
+
+struct HistTierInfo
+{
+    const char *path;
+    uint16_t bucketSeconds;
+    uint16_t count;
+};
+
+/** @brief Parametry poziomu (plik, długość kubełka, liczba kubełków) */
+const HistTierInfo &historyTierInfo(HistTier tier);
+
+/** @brief Poziom wg parametru ?res= ("15m", "1h"; inna wartość = 1 min) */
+HistTier historyTierByName(const char *name);
+
+/**
+ * @brief Przygotowuje pliki archiwum (prealokacja przy pierwszym starcie)
+ * Wywołać po zamontowaniu LittleFS.
+ */
+void historyBegin();
+
+/**
+ * @brief Rejestruje wynik jednej próby łącza
+ * @param up      werdykt: internet działa
+ * @param rttMs   RTT udanego pingu (ms) lub -1 gdy brak
+ * @param sent    liczba wysłanych pingów w tej próbie
+ * @param lost    liczba pingów bez odpowiedzi
+ * Czas od poprzedniej próby jest doliczany do upSeconds/downSeconds.
+ */
+void historyRecordProbe(bool up, int rttMs, uint8_t sent, uint8_t lost);
+
+/** @brief Okresowy zapis (wywoływać w loop()) */
+void historyLoop();
+
+/** @brief Natychmiastowy zapis kolejki i bieżących kubełków (np. przed restartem) */
+void historyFlush();
+
+/**
+ * @brief Odczytuje kubełek z pierścienia
+ * @return false gdy błąd odczytu
+ */
+bool historyReadBucket(HistTier tier, uint16_t index, HistBucket &out);
+
+/**
+ * @brief Nakłada na bufor kubełków odczytanych z pliku dane jeszcze niezapisane
+ * (kolejka i bieżące kubełki w RAM) - odczyt bez wymuszania zapisu na Flash.
+ * @param firstIndex indeks pierścienia pierwszego elementu bufora
+ */
+void historyOverlay(HistTier tier, uint16_t firstIndex, HistBucket *buf, uint16_t n);
+
+/** @brief Bieżący czas kalendarzowy (NTP lub szacunek od ostatniej synchronizacji); 0 = nieznany */
+uint32_t historyNow();
+
+/** @brief Nagłówek strumienia /api/history (format opisany w web/dashboard.js) */
+#define HISTORY_STREAM_HEADER 16
+
+/** @brief Odczyt poziomu od najstarszego kubełka, porcjami (/api/history) */
+struct HistoryStream
+{
+    HistTier tier;
+    File file;
+    uint16_t first; // Indeks najstarszego kubełka (następny po bieżącym)
+    uint16_t done;  // Kubełki już odczytane
+};
+
+/**
+ * @brief Otwiera plik poziomu i wypełnia nagłówek strumienia
+ * @return false gdy archiwum niedostępne
+ */
+bool historyStreamOpen(HistoryStream &s, HistTier tier, uint8_t header[HISTORY_STREAM_HEADER]);
+
+/**
+ * @brief Kolejne kubełki (z nałożonymi danymi z RAM); plik zamykany po ostatnim
+ * @return liczba kubełków w buf, 0 = koniec strumienia
+ */
+uint16_t historyStreamRead(HistoryStream &s, HistBucket *buf, uint16_t max);
+
+/** @brief Pełna długość strumienia w bajtach (nagłówek + wszystkie kubełki poziomu) */
+size_t historyStreamLength(HistTier tier);
+
+#endif // HISTORY_H
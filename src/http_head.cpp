@@ -0,0 +1,104 @@
+#include "http_head.h"
+
+// Kopiuje [from, to) do bufora z zerem na końcu; false gdy się nie mieści
+static bool copyPart(const char *from, const char *to, char *out, size_t outSize)
+{
+    size_t n = to - from;
+    if (n >= outSize)
+        return false;
+    memcpy(out, from, n);
+    out[n] = '\0';
+    return true;
+}
+
+// Koniec bieżącej linii (bez CR przed LF)
+static const char *lineEnd(const char *line)
+{
+    const char *end = strchr(line, '\n');
+    if (!end)
+        end = line + strlen(line);
+    if (end > line && end[-1] == '\r')
+        end--;
+    return end;
+}
+
+// Początek kolejnej linii albo nullptr na końcu tekstu
+static const char *nextLine(const char *line)
+{
+    const char *nl = strchr(line, '\n');
+    return nl ? nl + 1 : nullptr;
+}
+
+size_t httpHeadLength(const char *buf, size_t len)
+{
+    for (size_t i = 1; i < len; i++)
+    {
+        if (buf[i] != '\n')
+            continue;
+        if (buf[i - 1] == '\n')
+            return i + 1;
+        if (i >= 3 && buf[i - 1] == '\r' && buf[i - 2] == '\n' && buf[i - 3] == '\r')
+            return i + 1;
+    }
+    return 0;
+}
+
+bool httpHeadRequestLine(const char *head, char *method, size_t methodSize, char *path, size_t pathSize,
+                         char *query, size_t querySize)
+{
+    const char *end = lineEnd(head);
+    const char *sp1 = (const char *)memchr(head, ' ', end - head);
+    if (!sp1 || sp1 == head)
+        return false;
+    const char *target = sp1 + 1;
+    const char *sp2 = (const char *)memchr(target, ' ', end - target);
+    if (!sp2 || sp2 == target || *target != '/')
+        return false;
+
+    const char *q = (const char *)memchr(target, '?', sp2 - target);
+    if (!copyPart(head, sp1, method, methodSize))
+        return false;
+    if (!copyPart(target, q ? q : sp2, path, pathSize))
+        return false;
+    return copyPart(q ? q + 1 : sp2, sp2, query, querySize);
+}
+
+bool httpHeadField(const char *head, const char *name, char *out, size_t outSize)
+{
+    size_t nameLen = strlen(name);
+    // Pierwsza linia to linia żądania - pola zaczynają się od drugiej
+    for (const char *line = nextLine(head); line; line = nextLine(line))
+    {
+        const char *end = lineEnd(line);
+        if (end == line)
+            break; // Pusta linia - koniec nagłówka
+        if ((size_t)(end - line) <= nameLen || line[nameLen] != ':' || strncasecmp(line, name, nameLen) != 0)
+            continue;
+        const char *value = line + nameLen + 1;
+        while (value < end && (*value == ' ' || *value == '\t'))
+            value++;
+        return copyPart(value, end, out, outSize);
+    }
+    return false;
+}
+
+bool httpQueryArg(const char *query, const char *name, char *out, size_t outSize)
+{
+    size_t nameLen = strlen(name);
+    const char *p = query;
+    while (*p)
+    {
+        const char *end = strchr(p, '&');
+        if (!end)
+            end = p + strlen(p);
+        if ((size_t)(end - p) >= nameLen && strncmp(p, name, nameLen) == 0 && (p + nameLen == end || p[nameLen] == '='))
+        {
+            const char *value = p + nameLen;
+            if (value < end)
+                value++; // Pomija '='
+            return copyPart(value, end, out, outSize);
+        }
+        p = *end ? end + 1 : end;
+    }
+    return false;
+}
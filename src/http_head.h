@@ -0,0 +1,39 @@
+#ifndef HTTP_HEAD_H
+#define HTTP_HEAD_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// NAGŁÓWEK ŻĄDANIA HTTP (ODCZYT BEZ ALOKACJI)
+// ============================================================================
+// Dla serwera na zdarzeniach lwIP (async_http.h): nagłówek żądania leży w
+// stałym buforze połączenia (tekst zakończony zerem), a funkcje kopiują tylko
+// potrzebne fragmenty do buforów wywołującego. Wartość dłuższa niż bufor to
+// błąd, nie obcięcie. Linie mogą kończyć się CRLF albo samym LF.
+
+/**
+ * @brief Długość nagłówka razem z pustą linią kończącą
+ * @return 0 gdy nagłówek jest jeszcze niekompletny
+ */
+size_t httpHeadLength(const char *buf, size_t len);
+
+/**
+ * @brief Linia żądania: metoda, ścieżka (bez zapytania) i zapytanie (po '?', może być puste)
+ * @return false gdy linia jest niepoprawna albo pole nie mieści się w buforze
+ */
+bool httpHeadRequestLine(const char *head, char *method, size_t methodSize, char *path, size_t pathSize,
+                         char *query, size_t querySize);
+
+/**
+ * @brief Wartość pola nagłówka (nazwa bez rozróżniania wielkości liter, bez spacji wiodących)
+ * @return false gdy pola brak albo wartość nie mieści się w buforze
+ */
+bool httpHeadField(const char *head, const char *name, char *out, size_t outSize);
+
+/**
+ * @brief Wartość parametru zapytania (bez dekodowania %XX)
+ * @return false gdy parametru brak albo wartość nie mieści się w buforze
+ */
+bool httpQueryArg(const char *query, const char *name, char *out, size_t outSize);
+
+#endif // HTTP_HEAD_H
@@ -0,0 +1,275 @@
+#include "incidents.h"
+#include "history.h" // historyNow()
+#include <LittleFS.h>
+
+static_assert(sizeof(IncidentRecord) == 12, "IncidentRecord musi mieć 12 B (format pliku)");
+
+#define INCIDENTS_FILE "/incidents.bin"
+#define INCIDENTS_MAGIC 0x31434E49UL // "INC1"
+#define INCIDENTS_VERSION 1
+
+// Nagłówek pliku: stan pierścienia + sumy narastające
+struct __attribute__((packed)) IncidentFileHeader
+{
+    uint32_t magic;
+    uint8_t version;
+    uint8_t head;  // Indeks następnego zapisu
+    uint8_t count; // Liczba rekordów w pierścieniu
+    uint8_t reserved;
+    uint32_t observedSec;
+    uint32_t downtimeSec;
+    uint16_t incidents;
+    uint16_t resets;
+    uint16_t resetsFixed;
+    uint16_t reserved2;
+    uint16_t causeCount[INC_CAUSE_COUNT];
+    uint32_t causeDowntimeSec[INC_CAUSE_COUNT];
+};
+
+// Otwarty incydent - przetrwa ESP.restart() (reset routera kończy się restartem ESP)
+struct IncidentOpenState
+{
+    uint32_t magic;
+    IncidentRecord rec;
+    uint32_t resetAtSec; // rec.durationSec w chwili ostatniego resetu
+};
+
+static IncidentOpenState openState __attribute__((section(".noinit")));
+static IncidentFileHeader hdr;
+static bool incidentsReady = false;
+static unsigned long lastTickMs = 0;
+static unsigned long lastCheckpointMs = 0;
+
+static const char *const CAUSE_NAMES[INC_CAUSE_COUNT] = {
+    "wifi", "gateway", "upstream", "lag", "loss", "scheduled"};
+
+static bool openValid()
+{
+    return openState.magic == INCIDENTS_MAGIC && openState.rec.cause < INC_CAUSE_COUNT;
+}
+
+static void resetHeader()
+{
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = INCIDENTS_MAGIC;
+    hdr.version = INCIDENTS_VERSION;
+}
+
+static void writeHeader(File &f)
+{
+    f.seek(0, SeekSet);
+    f.write((const uint8_t *)&hdr, sizeof(hdr));
+}
+
+static void saveHeader()
+{
+    if (!incidentsReady)
+        return;
+    File f = LittleFS.open(INCIDENTS_FILE, "r+");
+    if (!f)
+        return;
+    writeHeader(f);
+    f.close();
+}
+
+void incidentsBegin()
+{
+    static const uint8_t zeros[sizeof(IncidentRecord)] = {0};
+    size_t expected = sizeof(IncidentFileHeader) + (size_t)INCIDENTS_MAX * sizeof(IncidentRecord);
+
+    File f = LittleFS.open(INCIDENTS_FILE, "r");
+    bool ok = f && f.size() == expected &&
+              f.read((uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+              hdr.magic == INCIDENTS_MAGIC && hdr.version == INCIDENTS_VERSION &&
+              hdr.head < INCIDENTS_MAX && hdr.count <= INCIDENTS_MAX;
+    if (f)
+        f.close();
+
+    if (!ok)
+    {
+        // Nowy lub niezgodny plik - prealokacja o stałym rozmiarze
+        Serial.println(F("[INCIDENTS] Tworzę rejestr awarii"));
+        resetHeader();
+        f = LittleFS.open(INCIDENTS_FILE, "w");
+        if (!f)
+        {
+            Serial.println(F("[INCIDENTS] Nie można utworzyć pliku"));
+            return;
+        }
+        writeHeader(f);
+        for (uint8_t i = 0; i < INCIDENTS_MAX; i++)
+            f.write(zeros, sizeof(zeros));
+        f.close();
+    }
+
+    if (!openValid())
+        memset(&openState, 0, sizeof(openState));
+    else
+        Serial.printf("[INCIDENTS] Kontynuacja awarii (%s, %lu s)\n",
+                      incidentCauseName(openState.rec.cause), (unsigned long)openState.rec.durationSec);
+
+    lastTickMs = millis();
+    lastCheckpointMs = millis();
+    incidentsReady = true;
+}
+
+void incidentsLoop()
+{
+    if (!incidentsReady)
+        return;
+
+    unsigned long now = millis();
+    unsigned long delta = now - lastTickMs;
+    if (delta >= 1000)
+    {
+        uint32_t sec = delta / 1000;
+        lastTickMs += sec * 1000;
+        hdr.observedSec += sec;
+        if (openValid())
+            openState.rec.durationSec += sec;
+    }
+
+    if (now - lastCheckpointMs >= INCIDENTS_CHECKPOINT_MS)
+    {
+        lastCheckpointMs = now;
+        saveHeader();
+    }
+}
+
+void incidentsFlush()
+{
+    incidentsLoop();
+    lastCheckpointMs = millis();
+    saveHeader();
+}
+
+void incidentOpen(IncidentCause cause)
+{
+    if (openValid() || cause >= INC_CAUSE_COUNT)
+        return;
+
+    memset(&openState, 0, sizeof(openState));
+    openState.rec.start = historyNow();
+    openState.rec.cause = cause;
+    if (openState.rec.start == 0)
+        openState.rec.flags |= INC_FLAG_NO_CLOCK;
+    openState.magic = INCIDENTS_MAGIC;
+}
+
+void incidentNoteReset()
+{
+    if (!openValid())
+        return;
+    openState.rec.actions |= INC_ACTION_ROUTER_RESET;
+    if (openState.rec.resets < 255)
+        openState.rec.resets++;
+    openState.resetAtSec = openState.rec.durationSec;
+}
+
+void incidentNoteAction(uint8_t action)
+{
+    if (openValid())
+        openState.rec.actions |= action;
+}
+
+void incidentClose()
+{
+    if (!openValid())
+        return;
+
+    IncidentRecord rec = openState.rec;
+    uint32_t sinceResetSec = rec.durationSec - openState.resetAtSec;
+    memset(&openState, 0, sizeof(openState));
+
+    if (rec.resets > 0 && sinceResetSec <= INCIDENT_FIX_WINDOW_MS / 1000UL)
+        rec.flags |= INC_FLAG_FIXED_BY_RESET;
+
+    // Sumy narastające - wskaźniki liczone bez przeglądania pierścienia
+    hdr.downtimeSec += rec.durationSec;
+    if (hdr.incidents < 0xFFFF)
+        hdr.incidents++;
+    hdr.resets += rec.resets;
+    if (rec.flags & INC_FLAG_FIXED_BY_RESET)
+        hdr.resetsFixed++;
+    if (hdr.causeCount[rec.cause] < 0xFFFF)
+        hdr.causeCount[rec.cause]++;
+    hdr.causeDowntimeSec[rec.cause] += rec.durationSec;
+
+    uint8_t slot = hdr.head;
+    hdr.head = (hdr.head + 1) % INCIDENTS_MAX;
+    if (hdr.count < INCIDENTS_MAX)
+        hdr.count++;
+
+    Serial.printf("[INCIDENTS] Awaria zamknięta: %s, %lu s, resety %u\n",
+                  incidentCauseName(rec.cause), (unsigned long)rec.durationSec, rec.resets);
+
+    if (!incidentsReady)
+        return;
+    File f = LittleFS.open(INCIDENTS_FILE, "r+");
+    if (!f)
+        return;
+    f.seek(sizeof(IncidentFileHeader) + (uint32_t)slot * sizeof(IncidentRecord), SeekSet);
+    f.write((const uint8_t *)&rec, sizeof(rec));
+    writeHeader(f);
+    f.close();
+    lastCheckpointMs = millis();
+}
+
+bool incidentIsOpen(IncidentRecord *current)
+{
+    if (!openValid())
+        return false;
+    if (current)
+        *current = openState.rec;
+    return true;
+}
+
+void incidentsSummary(IncidentSummary &out)
+{
+    memset(&out, 0, sizeof(out));
+    out.observedSec = hdr.observedSec;
+    out.downtimeSec = hdr.downtimeSec;
+    out.incidents = hdr.incidents;
+    out.resets = hdr.resets;
+    out.resetsFixed = hdr.resetsFixed;
+    memcpy(out.causeCount, hdr.causeCount, sizeof(out.causeCount));
+    memcpy(out.causeDowntimeSec, hdr.causeDowntimeSec, sizeof(out.causeDowntimeSec));
+
+    if (hdr.incidents > 0)
+    {
+        out.mttrSec = hdr.downtimeSec / hdr.incidents;
+        uint32_t upSec = (hdr.observedSec > hdr.downtimeSec) ? hdr.observedSec - hdr.downtimeSec : 0;
+        out.mtbfSec = upSec / hdr.incidents;
+    }
+
+    // Dostępność uwzględnia też trwającą awarię
+    uint32_t down = hdr.downtimeSec + (openValid() ? openState.rec.durationSec : 0);
+    out.availabilityPct = 100.0f;
+    if (hdr.observedSec > 0)
+        out.availabilityPct = (down >= hdr.observedSec) ? 0.0f : 100.0f * (1.0f - (float)down / hdr.observedSec);
+}
+
+uint8_t incidentsCount()
+{
+    return hdr.count;
+}
+
+bool incidentsRead(uint8_t newestIndex, IncidentRecord &out)
+{
+    if (!incidentsReady || newestIndex >= hdr.count)
+        return false;
+
+    uint8_t slot = (hdr.head + INCIDENTS_MAX - 1 - newestIndex) % INCIDENTS_MAX;
+    File f = LittleFS.open(INCIDENTS_FILE, "r");
+    if (!f)
+        return false;
+    f.seek(sizeof(IncidentFileHeader) + (uint32_t)slot * sizeof(IncidentRecord), SeekSet);
+    bool ok = f.read((uint8_t *)&out, sizeof(out)) == sizeof(out);
+    f.close();
+    return ok;
+}
+
+const char *incidentCauseName(uint8_t cause)
+{
+    return (cause < INC_CAUSE_COUNT) ? CAUSE_NAMES[cause] : "?";
+}
@@ -0,0 +1,112 @@
+#ifndef INCIDENTS_H
+#define INCIDENTS_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// REJESTR AWARII (INCYDENTÓW) - MTTR / MTBF / DOSTĘPNOŚĆ
+// ============================================================================
+// Każda awaria to jeden zwarty rekord: początek, czas trwania, wykryta przyczyna,
+// podjęte działania, liczba resetów i czy reset ją naprawił.
+//
+// Zamknięte incydenty trafiają do pierścienia w pliku LittleFS (INCIDENTS_MAX
+// rekordów). Nagłówek pliku trzyma sumy narastające (czas obserwacji, czas
+// awarii, liczniki wg przyczyny), z których MTTR, MTBF i dostępność liczone
+// są bez przeglądania historii. Otwarty incydent leży w sekcji .noinit,
+// więc przetrwa restart ESP wykonywany po resecie routera.
+
+/** @brief Pojemność pierścienia zamkniętych incydentów */
+#define INCIDENTS_MAX 32
+
+/** @brief Co ile zapisywać sumy narastające (czas obserwacji) na Flash */
+#define INCIDENTS_CHECKPOINT_MS (60UL * 60UL * 1000UL)
+
+/** @brief Powrót internetu w tym czasie od resetu = reset naprawił awarię */
+#define INCIDENT_FIX_WINDOW_MS (10UL * 60UL * 1000UL)
+
+enum IncidentCause
+{
+    INC_CAUSE_WIFI = 0,  // Brak połączenia WiFi
+    INC_CAUSE_GATEWAY,   // Brama (router) nie odpowiada
+    INC_CAUSE_UPSTREAM,  // Brak odpowiedzi hostów w internecie
+    INC_CAUSE_LAG,       // Potwierdzony wysoki ping
+    INC_CAUSE_LOSS,      // Strata pakietów powyżej progu
+    INC_CAUSE_SCHEDULED, // Zaplanowany reset routera
+    INC_CAUSE_COUNT
+};
+
+// Bity pola actions
+#define INC_ACTION_ROUTER_RESET 0x01 // Reset routera przekaźnikiem
+#define INC_ACTION_BACKUP 0x02       // Przełączenie na sieć rezerwową
+#define INC_ACTION_PROVIDER 0x04     // Uznano awarię dostawcy (resety wstrzymane)
+
+// Bity pola flags
+#define INC_FLAG_FIXED_BY_RESET 0x01 // Internet wrócił zaraz po resecie
+#define INC_FLAG_NO_CLOCK 0x02       // Brak czasu NTP - start nieznany (0)
+
+/** @brief Rekord zamkniętego incydentu (12 B) */
+struct __attribute__((packed)) IncidentRecord
+{
+    uint32_t start;       // Epoch początku; 0 = nieznany
+    uint32_t durationSec; // Czas trwania (mierzony zegarem ESP, także bez NTP)
+    uint8_t cause;        // IncidentCause (pierwsza wykryta przyczyna)
+    uint8_t actions;      // INC_ACTION_*
+    uint8_t resets;       // Liczba resetów routera w trakcie awarii
+    uint8_t flags;        // INC_FLAG_*
+};
+
+/** @brief Sumy narastające i wskaźniki wyliczone z nich */
+struct IncidentSummary
+{
+    uint32_t observedSec;  // Łączny czas obserwacji
+    uint32_t downtimeSec;  // Łączny czas awarii (zamknięte incydenty)
+    uint16_t incidents;    // Liczba zamkniętych incydentów
+    uint16_t resets;       // Resety routera w incydentach
+    uint16_t resetsFixed;  // Incydenty naprawione resetem
+    uint16_t causeCount[INC_CAUSE_COUNT];
+    uint32_t causeDowntimeSec[INC_CAUSE_COUNT];
+    uint32_t mttrSec;      // Średni czas naprawy
+    uint32_t mtbfSec;      // Średni czas między awariami
+    float availabilityPct; // 100 * (1 - awaria / obserwacja)
+};
+
+/** @brief Wczytuje pierścień i sumy (wywołać po zamontowaniu LittleFS) */
+void incidentsBegin();
+
+/** @brief Licznik czasu obserwacji i trwania otwartego incydentu (wywoływać w loop()) */
+void incidentsLoop();
+
+/** @brief Zapis sum narastających (np. przed restartem ESP) */
+void incidentsFlush();
+
+/** @brief Otwiera incydent (gdy już otwarty - bez zmian, przyczyna zostaje pierwsza) */
+void incidentOpen(IncidentCause cause);
+
+/** @brief Odnotowuje reset routera w otwartym incydencie */
+void incidentNoteReset();
+
+/** @brief Odnotowuje działanie (INC_ACTION_*) w otwartym incydencie */
+void incidentNoteAction(uint8_t action);
+
+/** @brief Zamyka otwarty incydent (internet wrócił) i zapisuje rekord */
+void incidentClose();
+
+/** @brief Czy trwa incydent; opcjonalnie zwraca jego bieżący stan */
+bool incidentIsOpen(IncidentRecord *current = nullptr);
+
+/** @brief Sumy narastające z wyliczonymi MTTR/MTBF/dostępnością */
+void incidentsSummary(IncidentSummary &out);
+
+/** @brief Liczba rekordów w pierścieniu */
+uint8_t incidentsCount();
+
+/**
+ * @brief Odczytuje rekord (0 = najnowszy)
+ * @return false gdy brak rekordu
+ */
+bool incidentsRead(uint8_t newestIndex, IncidentRecord &out);
+
+/** @brief Krótka nazwa przyczyny (do UI i JSON) */
+const char *incidentCauseName(uint8_t cause);
+
+#endif // INCIDENTS_H
@@ -0,0 +1,188 @@
+#include "led_pattern.h"
+#include "config.h"
+#include <Ticker.h>
+
+#define LED_OVERLAY_NONE 0xFF
+
+struct LedPattern
+{
+    const LedStep *steps; // PROGMEM
+    uint8_t count;
+    bool repeat;
+};
+
+// --- Tabele kroków ---
+static const LedStep STEPS_OFF[] PROGMEM = {{0, 0, 0}};
+static const LedStep STEPS_OK[] PROGMEM = {{LED_G, 255, 0}};
+static const LedStep STEPS_FAIL[] PROGMEM = {{LED_R, 255, 0}};
+static const LedStep STEPS_AP[] PROGMEM = {
+    {LED_B | LED_RAMP, 255, 1500},
+    {LED_B | LED_RAMP, 10, 1500}};
+static const LedStep STEPS_WIFI_CONNECTING[] PROGMEM = {
+    {LED_B, 255, 500},
+    {0, 0, 500}};
+static const LedStep STEPS_RESETTING[] PROGMEM = {
+    {LED_R, 255, 500},
+    {LED_G, 255, 500}};
+static const LedStep STEPS_SAFE_MODE[] PROGMEM = {
+    {LED_R, 255, 500},
+    {0, 0, 500}};
+static const LedStep STEPS_BUTTON_ACK[] PROGMEM = {
+    {LED_B, 255, 100}, {0, 0, 100}, {LED_B, 255, 100}, {0, 0, 100}, {LED_B, 255, 100}, {0, 0, 100}};
+static const LedStep STEPS_FACTORY_WARN[] PROGMEM = {
+    {LED_R | LED_G, 255, 200},
+    {0, 0, 200}};
+static const LedStep STEPS_FACTORY_RESET[] PROGMEM = {
+    {LED_R | LED_G, 255, 100}, {0, 0, 100}, {LED_R | LED_G, 255, 100}, {0, 0, 100}, {LED_R | LED_G, 255, 100}, {0, 0, 100}, {LED_R | LED_G, 255, 100}, {0, 0, 100}, {LED_R | LED_G, 255, 100}, {0, 0, 100}};
+
+#define PATTERN(steps, repeat) {steps, sizeof(steps) / sizeof(steps[0]), repeat}
+
+static const LedPattern PATTERNS[PATTERN_COUNT] = {
+    PATTERN(STEPS_OFF, false),
+    PATTERN(STEPS_OK, false),
+    PATTERN(STEPS_FAIL, false),
+    PATTERN(STEPS_AP, true),
+    PATTERN(STEPS_WIFI_CONNECTING, true),
+    PATTERN(STEPS_RESETTING, true),
+    PATTERN(STEPS_SAFE_MODE, true),
+    PATTERN(STEPS_BUTTON_ACK, false),
+    PATTERN(STEPS_FACTORY_WARN, true),
+    PATTERN(STEPS_FACTORY_RESET, false)};
+
+// Pozycja odtwarzania wzorca
+struct LedPlayState
+{
+    uint8_t id;
+    uint8_t step;
+    unsigned long stepStartMs;
+};
+
+static Ticker ledTicker;
+static LedPlayState base = {PATTERN_OFF, 0, 0};
+static LedPlayState overlay = {LED_OVERLAY_NONE, 0, 0};
+static uint16_t lastPwm[3] = {0xFFFF, 0xFFFF, 0xFFFF}; // Ostatnio zapisane PWM (R, G, B)
+
+static LedStep readStep(const LedPattern &p, uint8_t index)
+{
+    LedStep s;
+    memcpy_P(&s, &p.steps[index], sizeof(s));
+    return s;
+}
+
+// Przesuwa krok, gdy minął jego czas; false = wzorzec jednorazowy się skończył
+static bool advance(LedPlayState &st, unsigned long now)
+{
+    const LedPattern &p = PATTERNS[st.id];
+    LedStep s = readStep(p, st.step);
+    while (s.ms != 0 && now - st.stepStartMs >= s.ms)
+    {
+        st.stepStartMs += s.ms;
+        if (st.step + 1 < p.count)
+            st.step++;
+        else if (p.repeat)
+            st.step = 0;
+        else
+            return false;
+        s = readStep(p, st.step);
+    }
+    return true;
+}
+
+static void writePin(uint8_t index, int pin, uint16_t pwm)
+{
+    if (lastPwm[index] == pwm)
+        return; // analogWrite restartuje przebieg PWM - tylko przy zmianie
+    lastPwm[index] = pwm;
+    analogWrite(pin, pwm);
+}
+
+static void render(const LedPlayState &st, unsigned long now)
+{
+    const LedPattern &p = PATTERNS[st.id];
+    LedStep s = readStep(p, st.step);
+    uint32_t level = s.level;
+
+    if ((s.colors & LED_RAMP) && s.ms > 0)
+    {
+        uint8_t prevIndex = (st.step > 0) ? st.step - 1 : p.count - 1;
+        int32_t from = readStep(p, prevIndex).level;
+        uint32_t elapsed = now - st.stepStartMs;
+        if (elapsed > s.ms)
+            elapsed = s.ms;
+        level = from + ((int32_t)s.level - from) * (int32_t)elapsed / (int32_t)s.ms;
+        level = level * level / 255; // Korekcja jasności - oko słabo widzi zmiany przy dużym wypełnieniu
+    }
+
+    // Przeliczenie jasności (ESP8266 PWM 0-1023)
+    uint32_t pwmOn = level * (uint32_t)constrain(config.ledBrightness, 0, 255) * 1023UL / (255UL * 255UL);
+    writePin(0, config.pinRed, (s.colors & LED_R) ? pwmOn : 0);
+    writePin(1, config.pinGreen, (s.colors & LED_G) ? pwmOn : 0);
+    writePin(2, config.pinBlue, (s.colors & LED_B) ? pwmOn : 0);
+}
+
+static void ledTick()
+{
+    unsigned long now = millis();
+    advance(base, now); // Bazowy płynie dalej także pod nakładanym
+
+    if (overlay.id != LED_OVERLAY_NONE)
+    {
+        if (advance(overlay, now))
+        {
+            render(overlay, now);
+            return;
+        }
+        overlay.id = LED_OVERLAY_NONE;
+    }
+    render(base, now);
+}
+
+void ledPatternBegin()
+{
+    ledTicker.attach_ms(LED_TICK_MS, ledTick);
+    ledPatternRefresh();
+}
+
+void ledSetPattern(LedPatternId id)
+{
+    if (id >= PATTERN_COUNT || id == base.id)
+        return;
+    base.id = id;
+    base.step = 0;
+    base.stepStartMs = millis();
+    ledTick(); // Zmiana stanu widoczna od razu, nie po najbliższym ticku
+}
+
+LedPatternId ledPattern()
+{
+    return (LedPatternId)base.id;
+}
+
+void ledPlay(LedPatternId id)
+{
+    if (id >= PATTERN_COUNT || id == overlay.id)
+        return;
+    overlay.id = id;
+    overlay.step = 0;
+    overlay.stepStartMs = millis();
+    ledTick();
+}
+
+void ledStopOverlay()
+{
+    if (overlay.id == LED_OVERLAY_NONE)
+        return;
+    overlay.id = LED_OVERLAY_NONE;
+    ledTick();
+}
+
+bool ledOverlayActive()
+{
+    return overlay.id != LED_OVERLAY_NONE;
+}
+
+void ledPatternRefresh()
+{
+    lastPwm[0] = lastPwm[1] = lastPwm[2] = 0xFFFF;
+    ledTick();
+}
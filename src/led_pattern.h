@@ -0,0 +1,73 @@
+#ifndef LED_PATTERN_H
+#define LED_PATTERN_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// WZORCE DIODY RGB (Ticker, BEZ delay() I BEZ MIGANIA W loop())
+// ============================================================================
+// Każdy wzorzec to krótka tabela kroków w PROGMEM: kolory, poziom jasności
+// i czas trwania kroku. Ticker co LED_TICK_MS wylicza bieżący krok i zapisuje
+// PWM tylko przy zmianie. Jasność kroku jest skalowana przez config.ledBrightness.
+//
+// Wzorzec bazowy (ledSetPattern) opisuje stan urządzenia. Wzorzec nakładany
+// (ledPlay) - np. potwierdzenie przycisku - przykrywa go na czas odtwarzania,
+// po czym wraca bazowy. Callback Tickera działa w kontekście systemowym SDK
+// (nie w przerwaniu), więc odlicza czas także podczas delay() w innych modułach.
+
+/** @brief Okres odświeżania wzorców (ms) */
+#define LED_TICK_MS 20
+
+// Kolory kroku (maska bitowa)
+#define LED_R 0x01
+#define LED_G 0x02
+#define LED_B 0x04
+#define LED_RAMP 0x80 // Jasność narasta/opada liniowo od poziomu poprzedniego kroku (oddech)
+
+struct LedStep
+{
+    uint8_t colors; // LED_R | LED_G | LED_B (+ LED_RAMP)
+    uint8_t level;  // 0-255, względem config.ledBrightness
+    uint16_t ms;    // Czas kroku; 0 = trzymaj bez końca
+};
+
+enum LedPatternId
+{
+    PATTERN_OFF = 0,
+    PATTERN_OK,              // Zielona - internet działa
+    PATTERN_FAIL,            // Czerwona - błąd połączenia
+    PATTERN_AP,              // Niebieska, oddech - tryb konfiguracyjny (AP)
+    PATTERN_WIFI_CONNECTING, // Niebieska miga 500/500 ms - łączenie z WiFi
+    PATTERN_RESETTING,       // Czerwona/zielona naprzemiennie - cykl zasilania routera
+    PATTERN_SAFE_MODE,       // Czerwona miga 500/500 ms - Safe Mode
+    PATTERN_BUTTON_ACK,      // Niebieska 3x krótko - potwierdzenie przycisku (jednorazowy)
+    PATTERN_FACTORY_WARN,    // Czerwona+zielona miga 200 ms - przycisk trzymany > 10 s
+    PATTERN_FACTORY_RESET,   // Czerwona+zielona 5x krótko - przywracanie ustawień (jednorazowy)
+    PATTERN_COUNT
+};
+
+/** @brief Uruchamia Ticker wzorców (po pinMode i analogWriteRange) */
+void ledPatternBegin();
+
+/** @brief Ustawia wzorzec bazowy (ten sam wzorzec nie jest restartowany) */
+void ledSetPattern(LedPatternId id);
+
+/** @brief Bieżący wzorzec bazowy */
+LedPatternId ledPattern();
+
+/**
+ * @brief Odtwarza wzorzec nakładany ponad bazowym
+ * Wzorzec jednorazowy kończy się sam, powtarzany trwa do ledStopOverlay().
+ */
+void ledPlay(LedPatternId id);
+
+/** @brief Kończy wzorzec nakładany - wraca bazowy */
+void ledStopOverlay();
+
+/** @brief Czy wzorzec nakładany jest odtwarzany */
+bool ledOverlayActive();
+
+/** @brief Natychmiastowe przeliczenie PWM (np. po zmianie jasności) */
+void ledPatternRefresh();
+
+#endif // LED_PATTERN_H
@@ -5,6 +5,8 @@
 #include "html_common.h"
 #include "constants.h"
 #include "app_globals.h" // Centralne extern deklaracje
+#include "session_store.h"
+#include "rate_limit.h"
 #include <ESP8266WebServer.h>
 
 extern ESP8266WebServer server;
@@ -14,8 +16,9 @@ void handleLoginPage()
 {
     DIAG_PRINTLN(F("\n========== handleLoginPage START =========="));
 
-    // Jeśli już zalogowany, przekieruj na /config
-    if (isSessionActive && sessionToken.length() > 0)
+    // Jeśli ta przeglądarka jest już zalogowana, przekieruj na /config
+    char token[SESSION_TOKEN_LENGTH + 1];
+    if (requestSessionToken(token, sizeof(token)) && sessionCheck(token, millis()) == SESSION_VALID)
     {
         DIAG_PRINTLN(F("[LOGIN] User already logged in, redirecting to /config"));
         redirectTo(server, "/config");
@@ -25,45 +28,46 @@ void handleLoginPage()
     DIAG_PRINTLN(F("[LOGIN] Displaying login form"));
 
     // Prosty formularz logowania - używa wspólnych stylów motywu
-    String html = F("<!DOCTYPE html><html><head>");
-    html += F("<meta charset='UTF-8'>");
-    html += F("<meta name='viewport' content='width=device-width, initial-scale=1.0'>");
-    html += F("<title>Logowanie - ESP Tester</title>");
-    html += F("<link rel='icon' href='data:image/svg+xml;base64,PHN2ZyB4bWxucz0iaHR0cDovL3d3dy53My5vcmcvMjAwMC9zdmciIHZpZXdCb3g9IjAgMCAyNCAyNCI+PHBhdGggZmlsbD0iIzAwN2JmZiIgZD0iTTEyIDFMMyA1djZjMCA1LjU1IDMuODQgMTAuNzQgOSAxMiA1LjE2LTEuMjYgOS02LjQ1IDktMTJWNWwtOS00eiIvPjwvc3ZnPg=='>");
-    html += F("<style>");
-    html += FPSTR(HTML_THEME_STYLES); // Wspólne style motywu
-    html += F("body{display:flex;justify-content:center;align-items:center;height:100vh;margin:0}");
-    html += F(".login-box{background:var(--card);padding:40px;border-radius:8px;box-shadow:0 4px 6px rgba(0,0,0,0.1);text-align:center;width:320px;transition:background 0.3s}");
-    html += F("h2{color:var(--fg);margin-bottom:20px}");
-    html += F(".login-field{position:relative;margin:10px 0}");
-    html += F(".login-field input{width:100%;padding:12px 44px 12px 12px;border:1px solid var(--brd);border-radius:4px;font-size:15px;background:var(--inp);color:var(--fg);box-sizing:border-box;margin:0}");
-    html += F(".login-field input:focus{outline:none;border-color:var(--btn)}");
-    html += F(".login-field button{position:absolute;right:10px;top:50%;transform:translateY(-50%);background:transparent!important;border:none!important;outline:none!important;box-shadow:none!important;padding:0;margin:0;cursor:pointer;font-size:18px;line-height:1;display:flex;align-items:center;justify-content:center;width:28px;height:28px;color:var(--fg);z-index:10;-webkit-tap-highlight-color:transparent;appearance:none}");
-    html += F(".login-field button:focus{outline:none!important;box-shadow:none!important;background:transparent!important}");
-    html += F("input[type=text]{width:100%;padding:12px;margin:10px 0;border:1px solid var(--brd);border-radius:4px;font-size:15px;background:var(--inp);color:var(--fg);box-sizing:border-box}");
-    html += F("input[type=text]:focus{outline:none;border-color:var(--btn)}");
-    html += F("button{width:100%;padding:12px;background:var(--btn);color:white;border:none;border-radius:4px;cursor:pointer;font-size:16px;margin-top:10px}");
-    html += F("button:hover{background:var(--btn-hover)}");
-    html += F("a{color:var(--btn);text-decoration:none;display:inline-block;margin-top:15px}");
-    html += F("a:hover{text-decoration:underline}");
-    html += F("</style>");
-    html += getThemeScript(config.darkMode); // Automatyczne ustawienie motywu
-    html += F("</head><body>");
-    html += F("<div class='login-box'>");
-    html += F("<h2>🔐 Logowanie</h2>");
-    html += F("<form action='/login' method='POST'>");
-    html += F("<input type='text' name='user' placeholder='Nazwa użytkownika' required autofocus>");
-    html += F("<div class='login-field'>");
-    html += F("<input type='password' id='loginpass' name='pass' placeholder='Hasło' required>");
-    html += F("<button type='button' onclick=\"togglePassword('loginpass')\">👁️</button>");
-    html += F("</div>");
-    html += F("<button type='submit'>Zaloguj</button>");
-    html += F("</form>");
-    html += F("<script>function togglePassword(id){var x=document.getElementById(id);var btn=x.parentElement.querySelector('button');x.type=(x.type==='password')?'text':'password';if(btn)btn.textContent=x.type==='password'?'👁️':'👁️‍🗨️';if(x){x.focus();if(x.value){x.setSelectionRange(x.value.length,x.value.length);}}}</script>");
-    html += F("<br><a href='/'>← Powrót do strony głównej</a>");
-    html += F("</div></body></html>");
-
-    server.send(200, "text/html; charset=utf-8", html);
+    ResponseWriter out(server);
+    out.begin(200, "text/html; charset=utf-8");
+    out.print(F("<!DOCTYPE html><html><head>"));
+    out.print(F("<meta charset='UTF-8'>"));
+    out.print(F("<meta name='viewport' content='width=device-width, initial-scale=1.0'>"));
+    out.print(F("<title>Logowanie - ESP Tester</title>"));
+    out.print(F(HTML_ASSET_LINKS)); // Wspólne style motywu (/static/app.css)
+    out.print(F("<style>"));
+    out.print(F("body{display:flex;justify-content:center;align-items:center;height:100vh;margin:0}"));
+    out.print(F(".login-box{background:var(--card);padding:40px;border-radius:8px;box-shadow:0 4px 6px rgba(0,0,0,0.1);text-align:center;width:320px;transition:background 0.3s}"));
+    out.print(F("h2{color:var(--fg);margin-bottom:20px}"));
+    out.print(F(".login-field{position:relative;margin:10px 0}"));
+    out.print(F(".login-field input{width:100%;padding:12px 44px 12px 12px;border:1px solid var(--brd);border-radius:4px;font-size:15px;background:var(--inp);color:var(--fg);box-sizing:border-box;margin:0}"));
+    out.print(F(".login-field input:focus{outline:none;border-color:var(--btn)}"));
+    out.print(F(".login-field button{position:absolute;right:10px;top:50%;transform:translateY(-50%);background:transparent!important;border:none!important;outline:none!important;box-shadow:none!important;padding:0;margin:0;cursor:pointer;font-size:18px;line-height:1;display:flex;align-items:center;justify-content:center;width:28px;height:28px;color:var(--fg);z-index:10;-webkit-tap-highlight-color:transparent;appearance:none}"));
+    out.print(F(".login-field button:focus{outline:none!important;box-shadow:none!important;background:transparent!important}"));
+    out.print(F("input[type=text]{width:100%;padding:12px;margin:10px 0;border:1px solid var(--brd);border-radius:4px;font-size:15px;background:var(--inp);color:var(--fg);box-sizing:border-box}"));
+    out.print(F("input[type=text]:focus{outline:none;border-color:var(--btn)}"));
+    out.print(F("button{width:100%;padding:12px;background:var(--btn);color:white;border:none;border-radius:4px;cursor:pointer;font-size:16px;margin-top:10px}"));
+    out.print(F("button:hover{background:var(--btn-hover)}"));
+    out.print(F("a{color:var(--btn);text-decoration:none;display:inline-block;margin-top:15px}"));
+    out.print(F("a:hover{text-decoration:underline}"));
+    out.print(F("</style>"));
+    printThemeScript(out, config.darkMode); // Automatyczne ustawienie motywu
+    out.print(F("</head><body>"));
+    out.print(F("<div class='login-box'>"));
+    out.print(F("<h2>🔐 Logowanie</h2>"));
+    out.print(F("<form action='/login' method='POST'>"));
+    out.print(F("<input type='text' name='user' placeholder='Nazwa użytkownika' required autofocus>"));
+    out.print(F("<div class='login-field'>"));
+    out.print(F("<input type='password' id='loginpass' name='pass' placeholder='Hasło' required>"));
+    out.print(F("<button type='button' onclick=\"togglePassword('loginpass')\">👁️</button>"));
+    out.print(F("</div>"));
+    out.print(F("<button type='submit'>Zaloguj</button>"));
+    out.print(F("</form>"));
+    out.print(F("<script>function togglePassword(id){var x=document.getElementById(id);var btn=x.parentElement.querySelector('button');x.type=(x.type==='password')?'text':'password';if(btn)btn.textContent=x.type==='password'?'👁️':'👁️‍🗨️';if(x){x.focus();if(x.value){x.setSelectionRange(x.value.length,x.value.length);}}}</script>"));
+    out.print(F("<br><a href='/'>← Powrót do strony głównej</a>"));
+    out.print(F("</div></body></html>"));
+
+    out.end();
     DIAG_PRINTLN(F("========== handleLoginPage END ==========\n"));
 }
 
@@ -93,16 +97,14 @@ void handleLoginSubmit()
     {
         DIAG_PRINTLN(F("[LOGIN] ✓ Credentials VALID - creating session"));
 
-        // Generuj nowy token sesji
-        sessionToken = generateToken();
-        isSessionActive = true;
-        lastSessionActivity = millis();
+        rateLoginSucceeded(server.client().remoteIP());
 
-        DIAG_PRINT(F("[LOGIN] Generated session token: "));
-        DIAG_PRINTLN(sessionToken);
+        // Nowa sesja - pozostałe zalogowane przeglądarki zachowują swoje
+        const char *token = sessionCreate(millis());
+        DIAG_PRINTF("[LOGIN] Session created (%u active)\n", sessionActiveCount(millis()));
 
         // Ustaw ciasteczko w przeglądarce
-        String cookieValue = String(COOKIE_NAME) + "=" + sessionToken + "; Path=/; HttpOnly; Max-Age=3600";
+        String cookieValue = String(COOKIE_NAME) + "=" + token + "; Path=/; HttpOnly; Max-Age=3600";
         server.sendHeader("Set-Cookie", cookieValue);
         redirectTo(server, "/config");
 
@@ -113,11 +115,23 @@ void handleLoginSubmit()
     {
         DIAG_PRINTLN(F("[LOGIN] ✗ Credentials INVALID"));
 
-        // Błędne dane - użyj zunifikowanej funkcji błędu
-        sendErrorPage(server, "❌ Błąd logowania",
-                      "Nieprawidłowa nazwa użytkownika lub hasło.",
-                      "/login", "Spróbuj ponownie",
-                      config.darkMode);
+        // Kolejne porażki z tego adresu blokują logowanie coraz dłużej (429 w onRoute)
+        uint32_t lockMs = rateLoginFailed(server.client().remoteIP(), millis());
+        if (lockMs > 0)
+        {
+            logEvent("Logowanie zablokowane na " + String(lockMs / 1000) + "s (" + server.client().remoteIP().toString() + ")");
+            String msg = "Nieprawidłowa nazwa użytkownika lub hasło. Zbyt wiele nieudanych prób - kolejna możliwa za " +
+                         String(lockMs / 1000) + " s.";
+            sendErrorPage(server, "❌ Błąd logowania", msg.c_str(), "/login", "Spróbuj ponownie", config.darkMode);
+        }
+        else
+        {
+            // Błędne dane - użyj zunifikowanej funkcji błędu
+            sendErrorPage(server, "❌ Błąd logowania",
+                          "Nieprawidłowa nazwa użytkownika lub hasło.",
+                          "/login", "Spróbuj ponownie",
+                          config.darkMode);
+        }
 
         DIAG_PRINTLN(F("========== handleLoginSubmit END (failed) ==========\n"));
     }
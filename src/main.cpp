@@ -7,7 +7,6 @@
 #include <LittleFS.h>
 #include <time.h>
 #include <Updater.h>
-#include <elapsedMillis.h>
 #include <user_interface.h>
 #include "WiFiConfig.h" // Własna biblioteka WiFiConfig
 #include "config.h"
@@ -16,6 +15,19 @@
 #include "webserver.h"
 #include "watchdog.h"
 #include "serial_handler.h" // Obsługa poleceń Serial Monitor
+#include "history.h"        // Archiwum historii opóźnień i dostępności
+#include "incidents.h"      // Rejestr awarii (MTTR/MTBF)
+#include "boot_model.h"     // Model czasu rozruchu routera
+#include "router_cycle.h"   // Cykl zasilania routera (maszyna stanów)
+#include "button.h"         // Przycisk (przerwanie + debounce)
+#include "led_pattern.h"    // Wzorce diody RGB (Ticker)
+#include "scheduler.h"      // Harmonogram zadań loop()
+#include "perf.h"           // Pomiary czasu wykonania (PERF_SCOPE)
+#include "heap_stats.h"     // Telemetria sterty (HEAP_SCOPE)
+#include "crash_log.h"      // Post-mortem awarii ESP
+#include "sse.h"            // Powiadomienia na żywo (/api/events)
+#include "session_store.h"  // Sesje panelu (tablica, LRU)
+#include "async_http.h"     // Serwer na zdarzeniach lwIP (opcjonalny)
 
 // Ustawienie nazwy sieciowej urządzenia (adres: http://straznik.local)
 const char *NAZWA_ESP = "straznik";
@@ -34,7 +46,6 @@ int bootLoopResetCount __attribute__((section(".noinit")));                   //
 
 int failCount = 0;
 unsigned long lastPingTime = 0;
-unsigned long lastAPCheckTime = 0;              // Dla ponownego sprawdzania w AP
 unsigned long apModeStartTime = 0;              // Czas wejścia w AP mode
 int apModeAttempts = 0;                         // Licznik prób wyjścia z AP
 unsigned long lastResetTime = 0;                // Czas ostatniego resetu
@@ -43,6 +54,7 @@ unsigned long firstResetTime = 0;               // Czas pierwszego resetu
 unsigned long noWiFiStartTime = 0;              // Czas rozpoczęcia braku WiFi
 int lastPingMs = 0;
 String statusMsg = "Oczekiwanie...";
+uint32_t logEventSeq = 0; // Zmienia się przy każdym wpisie do logu (wersja listy zdarzeń w /api/status)
 bool simPingFail = false;
 bool simNoWiFi = false;
 bool simHighPing = false;
@@ -53,6 +65,7 @@ bool routerResetInProgress = false;          // Flaga blokująca watchdog podcza
 int lagCount = 0;                            // Licznik wysokich pingów z rzędu (Lag Detection)
 int knownNetworksCount = 0;                  // Liczba zapisanych sieci Wi-Fi (pierwsze uruchomienie)
 unsigned long apModeBackoffUntil = 0;        // Czas do końca backoff po porażce AP
+unsigned long resetBackoffUntil = 0;         // Koniec okna ochronnego po resecie (0 = brak) - do tego czasu bez auto-resetów
 bool lastGatewayFailReset = false;           // Czy ostatni reset był z powodu braku gateway
 unsigned long ntpLastSyncTime = 0;           // Czas ostatniej synchronizacji z NTP
 unsigned long routerBootStartTime = 0;       // Czas gdy router się ostatnio włączył (dla grace period)
@@ -60,13 +73,12 @@ unsigned long backupRouterBootStartTime = 0; // Czas gdy router backup się wł
 bool ntpSyncLost = false;                    // Czy straciśmy synchronizację z NTP
 time_t estimatedOfflineTime = 0;             // Szacunkowy czas offline (do offline timer)
 
-unsigned long lastSessionActivity = 0;
-bool isSessionActive = false;
 bool safeMode = false; // Tryb bezpieczeństwa - boot loop protection
 
 // Forward declaration - logEvent used by recordResetDiagnostics
 const char *LOG_FILE = "/events.log";
 void logEvent(String msg);
+static void setupTasks(); // Rejestracja zadań loop() (definicja przy loop())
 
 unsigned long wakeCycleStartMs = 0; // Początek bieżącego cyklu aktywności w trybie przerywanym
 
@@ -191,65 +203,27 @@ static void recordResetDiagnostics()
   saveConfig();
 }
 
-// Cookie-based authentication
-String sessionToken = "";
-
-// Funkcja generująca losowy token sesji
-String generateToken()
-{
-  String token = "";
-  const char alphanum[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
-  for (int i = 0; i < 32; i++)
-  {
-    token += alphanum[random(62)];
-  }
-  return token;
-}
-
 // Funkcje saveConfig i loadConfig zostały przeniesione do config.cpp
 
 // --- ZMIENNE ---
 
-int ledBrightness() { return constrain(config.ledBrightness, 0, 255); }
-
-// Śledź aktualny stan LED
-static bool currentRed = false;
-static bool currentGreen = false;
-static bool currentBlue = false;
-
-void setLed(bool rOn, bool gOn, bool bOn)
-{
-  currentRed = rOn;
-  currentGreen = gOn;
-  currentBlue = bOn;
-  // Przeliczenie jasności (ESP8266 PWM 0-1023)
-  int pwmOn = map(ledBrightness(), 0, 255, 0, 1023);
-  analogWrite(config.pinRed, rOn ? pwmOn : 0);
-  analogWrite(config.pinGreen, gOn ? pwmOn : 0);
-  analogWrite(config.pinBlue, bOn ? pwmOn : 0);
-}
-
+// Diody sterowane przez silnik wzorców (led_pattern) - tu tylko skróty stanów
 void refreshLed()
 {
-  // Odśwież LEDy z aktualnym stanem
-  setLed(currentRed, currentGreen, currentBlue);
+  // Odśwież LEDy z aktualnym stanem (np. po zmianie jasności)
+  ledPatternRefresh();
 }
 
-void ledOK() { setLed(false, true, false); }
-void ledFail() { setLed(true, false, false); }
-void ledBlue() { setLed(false, false, true); }
-void toggleBlue()
-{
-  static bool state = false;
-  state = !state;
-  setLed(false, false, state);
-}
+void ledOK() { ledSetPattern(PATTERN_OK); }
+void ledFail() { ledSetPattern(PATTERN_FAIL); }
+void ledBlue() { ledSetPattern(PATTERN_AP); }
 
 // logEvent moved to top as forward declaration
 // (actual implementation stays here for completeness)
 
 void logEvent(String msg)
 {
+  PERF_SCOPE("logEvent");
   File rFile = LittleFS.open(LOG_FILE, "r");
   String content = "";
   if (rFile)
@@ -291,7 +265,12 @@ void logEvent(String msg)
     timestamp = "[~" + String(millis() / 1000) + "s UNSYNC] ";
   }
 
-  content += timestamp + msg + "\n";
+  String line = timestamp + msg;
+  crashNoteEvent(line.c_str()); // Ostatnie zdarzenia do post-mortem
+  logEventSeq++;
+  ssePublish("log", line.c_str()); // Otwarte strony dopisują wpis od razu
+  sseMarkDirty();
+  content += line + "\n";
 
   int lineCount = 0;
   for (unsigned int i = 0; i < content.length(); i++)
@@ -316,6 +295,12 @@ void logEvent(String msg)
   }
 }
 
+// Token z ciasteczka bieżącego żądania - nagłówek parsowany raz, do bufora na stosie
+bool requestSessionToken(char *out, size_t outSize)
+{
+  return server.hasHeader("Cookie") && sessionTokenFromCookie(server.header("Cookie").c_str(), out, outSize);
+}
+
 bool checkAuth(bool quiet)
 {
   // === DEBUG: Przełącznik wyłączający autoryzację ===
@@ -325,98 +310,26 @@ bool checkAuth(bool quiet)
     {
       DIAG_PRINTLN("[AUTH] ⚠️ DEBUG MODE - Autoryzacja wyłączona (DEBUG_SKIP_AUTH=true)");
     }
-    isSessionActive = true; // Symuluj aktywną sesję
-    lastSessionActivity = millis();
     return true; // Zawsze zwróć true - pomiń logowanie
   }
 
-  if (!quiet)
-  {
-    DIAG_PRINTLN("\n---------- checkAuth() START ----------");
-    DIAG_PRINT("[AUTH] isSessionActive: ");
-    DIAG_PRINTLN(isSessionActive ? "TRUE" : "FALSE");
-  }
+  char token[SESSION_TOKEN_LENGTH + 1];
+  SessionCheck result = SESSION_NONE;
+  if (requestSessionToken(token, sizeof(token)))
+    result = sessionCheck(token, millis()); // Ważna sesja ma odświeżony czas aktywności
 
-  // 1. Sprawdź czy przeglądarka wysłała ciasteczko
-  if (server.hasHeader("Cookie"))
-  {
-    String cookie = server.header("Cookie");
-    if (!quiet)
-    {
-      DIAG_PRINT("[AUTH] Cookie header: ");
-      DIAG_PRINTLN(cookie);
-    }
+  if (result == SESSION_VALID)
+    return true;
 
-    // Sprawdź czy zawiera nasz token sesji
-    String expectedCookie = String(COOKIE_NAME) + "=" + sessionToken;
-    if (sessionToken.length() > 0 && cookie.indexOf(expectedCookie) != -1)
-    {
-      if (!quiet)
-      {
-        DIAG_PRINTLN("[AUTH] ✓ Valid session cookie found");
-      }
-
-      // Sprawdź timeout sesji
-      unsigned long timeSinceActivity = millis() - lastSessionActivity;
-      if (timeSinceActivity > SESSION_TIMEOUT_MS)
-      {
-        if (!quiet)
-        {
-          DIAG_PRINT("[AUTH] ✗ Session EXPIRED (");
-          DIAG_PRINT(timeSinceActivity);
-          DIAG_PRINTLN(" ms > timeout)");
-        }
-        isSessionActive = false;
-        sessionToken = "";
-        server.sendHeader("Location", "/login");
-        server.sendHeader("Cache-Control", "no-cache");
-        server.send(303);
-        if (!quiet)
-        {
-          DIAG_PRINTLN("---------- checkAuth() END (expired) ----------\n");
-        }
-        return false;
-      }
-
-      // Sesja ważna - odśwież czas
-      isSessionActive = true;
-      lastSessionActivity = millis();
-      if (!quiet)
-      {
-        DIAG_PRINTLN("[AUTH] Session refreshed");
-        DIAG_PRINTLN("---------- checkAuth() END (valid) ----------\n");
-      }
-      return true;
-    }
-    else
-    {
-      if (!quiet)
-      {
-        DIAG_PRINTLN("[AUTH] ✗ Invalid or missing session token in cookie");
-      }
-    }
-  }
-  else
-  {
-    if (!quiet)
-    {
-      DIAG_PRINTLN("[AUTH] No Cookie header found");
-    }
-  }
-
-  // 2. Brak ciasteczka lub niepoprawne - przekieruj na /login
+  // Brak ciasteczka, nieznany token lub sesja wygasła - przekieruj na /login
   if (!quiet)
   {
-    DIAG_PRINTLN("[AUTH] Redirecting to /login");
+    DIAG_PRINTLN(result == SESSION_EXPIRED ? "[AUTH] ✗ Session EXPIRED - redirecting to /login"
+                                           : "[AUTH] ✗ No valid session cookie - redirecting to /login");
   }
-  isSessionActive = false;
   server.sendHeader("Location", "/login");
   server.sendHeader("Cache-Control", "no-cache");
   server.send(303);
-  if (!quiet)
-  {
-    DIAG_PRINTLN("---------- checkAuth() END (redirect) ----------\n");
-  }
   return false;
 }
 
@@ -448,7 +361,14 @@ static void handleSleepScheduler()
     return;
   }
 
-  // 3. Problem z internetem - watchdog musi działać!
+  // 3. Trwa cykl zasilania routera
+  if (routerCycleBusy())
+  {
+    wakeCycleStartMs = millis();
+    return;
+  }
+
+  // 4. Problem z internetem - watchdog musi działać!
   if (failCount > 0)
   {
     wakeCycleStartMs = millis();
@@ -456,7 +376,7 @@ static void handleSleepScheduler()
     return;
   }
 
-  // 4. WiFi nie połączone - nie śpij podczas próby reconnect
+  // 5. WiFi nie połączone - nie śpij podczas próby reconnect
   if (WiFi.status() != WL_CONNECTED)
   {
     wakeCycleStartMs = millis();
@@ -464,14 +384,14 @@ static void handleSleepScheduler()
     return;
   }
 
-  // 5. Minimum 2 cykle ping przed snem (upewnij się że internet działa)
+  // 6. Minimum 2 cykle ping przed snem (upewnij się że internet działa)
   if (millis() - lastPingTime < config.pingInterval * 2)
   {
     // Za wcześnie - poczekaj na potwierdzenie stabilności internetu
     return;
   }
 
-  // 6. Sprawdź czy scheduled reset nie przypadnie podczas snu
+  // 7. Sprawdź czy scheduled reset nie przypadnie podczas snu
   if (config.scheduledResetsEnabled)
   {
     time_t now = time(nullptr);
@@ -520,6 +440,8 @@ static void handleSleepScheduler()
     logEvent("Tryb przerywany: usypiam na " + String(config.sleepWindowMs / 1000) + "s (internet OK, watchdog zawieszony)");
     Serial.println("[SLEEP] Going to deep sleep for " + String(config.sleepWindowMs / 1000) + "s");
     ESP.wdtFeed();
+    historyFlush();
+    incidentsFlush();
     ESP.deepSleep((uint64_t)config.sleepWindowMs * 1000ULL, WAKE_RF_DEFAULT);
   }
 }
@@ -567,7 +489,12 @@ void setup()
   Serial.println(config.ledBrightness);
   // Ustawienie zmiennych globalnych z config
 
+  crashLogBegin(); // Rekord awarii z .noinit -> /crash.log (przed pierwszym logEvent)
   recordResetDiagnostics();
+  historyBegin();   // Prealokacja plików archiwum (tylko przy pierwszym starcie)
+  incidentsBegin(); // Rejestr awarii + kontynuacja awarii sprzed restartu ESP
+  bootModelBegin(); // Pomiary rozruchu routera (strojenie baseBootTime)
+  heapStatsBegin(); // Pierwsza próbka sterty
 
   // === BOOT LOOP DETECTION (Safety Mode) ===
   // Śledzi nieplanowane resety ESP (WDT, Exception) - planowane resety (SOFT_RESTART) są ignorowane
@@ -698,28 +625,17 @@ void setup()
   failCount = config.failCount;
   noWiFiStartTime = config.noWiFiStartTime;
 
-  // --- DODATEK: Oczekiwanie na przerwę bezpieczeństwa (Backoff) przy starcie ---
+  // --- Okno ochronne (Backoff) po restarcie w trakcie cyklu awarii ---
   // Jeśli mamy zarejestrowane resety, to znaczy że jesteśmy w trakcie cyklu awarii.
-  // Jeśli nextResetDelay jest duże (np. 15 min), a my właśnie wstaliśmy,
-  // to znaczy że ruter był wyłączony, włączony i teraz musimy przeczekać okno ochronne.
-
+  // Jeśli nextResetDelay jest duże (np. 15 min), a my właśnie wstaliśmy, kolejny reset
+  // routera musi poczekać do końca okna. Urządzenie startuje normalnie (WiFi, WWW, NTP),
+  // a watchdog wstrzymuje tylko automatyczne resety do resetBackoffUntil.
   if (totalResets > 0 && nextResetDelay > FIVE_MINUTES_MS)
   {
-    Serial.print("Wykryto cykl awarii. Czekam na koniec okna ochronnego: ");
+    resetBackoffUntil = millis() + nextResetDelay;
+    Serial.print("Wykryto cykl awarii. Okno ochronne: ");
     Serial.print(nextResetDelay / 1000);
-    Serial.println(" sekund.");
-
-    // Miganie podczas okna ochronnego
-    elapsedMillis backoffTimer;
-    while (backoffTimer < nextResetDelay)
-    {
-      ESP.wdtFeed();
-      delay(100); // Krótki delay w pętli - OK (pętla ma wyjście, karmi WDT)
-      if ((millis() / 1000) % 2 == 0)
-        ledBlue();
-      else
-        ledOK();
-    }
+    Serial.println(" sekund (resety wstrzymane).");
   }
 
   pinMode(config.pinRelay, OUTPUT);
@@ -728,7 +644,8 @@ void setup()
   pinMode(config.pinGreen, OUTPUT);
   pinMode(config.pinBlue, OUTPUT);
   analogWriteRange(1023);                                                   // Ujednolicenie skali PWM
-  pinMode(config.pinButton, INPUT_PULLUP);                                  // Przycisk z pull-up
+  ledPatternBegin();                                                        // Wzorce diody RGB (Ticker)
+  buttonBegin(config.pinButton);                                            // Przycisk z pull-up + przerwanie
   digitalWrite(config.pinRelay, LOW);                                       // NC
   digitalWrite(config.pinRelayBackup, config.relayActiveHigh ? LOW : HIGH); // Zabezpieczenie: backup wyłączony przy starcie
 
@@ -742,7 +659,8 @@ void setup()
   logEvent("Start systemu");
   odczytajTabliceZPliku(WIFI_CONFIG_FILES);
   knownNetworksCount = liczbaZajetychMiejscTablicy(tablica, wielkoscTablicy);
-  PolaczZWiFi(tablica, toggleBlue);
+  ledSetPattern(PATTERN_WIFI_CONNECTING);
+  PolaczZWiFi(tablica);
 
   if (WiFi.status() != WL_CONNECTED)
   {
@@ -752,67 +670,84 @@ void setup()
   else
   {
     // PolaczZWiFi już zalogował szczegóły i uruchomił mDNS
-    syncTimeOnStartup();
-    lastPingTime = 0; // Wymuś ping natychmiast aby ustawić prawidłową diodę
+    syncTimeOnStartup(); // Pierwszy ping zaraz po włączeniu zadania "ping" (taskMode)
   }
 
-  // Konfiguracja zbierania nagłówków Cookie (wymagane dla session cookie)
-  const char *headerkeys[] = {"Cookie"};
+  // Konfiguracja zbierania nagłówków: Cookie (session cookie), If-None-Match (ETag zasobów /static)
+  const char *headerkeys[] = {"Cookie", "If-None-Match"};
   size_t headerkeyssize = sizeof(headerkeys) / sizeof(char *);
   server.collectHeaders(headerkeys, headerkeyssize);
   DIAG_PRINTLN("[SETUP] Cookie headers collection enabled");
 
   setupWebServer(); // Konfiguracja serwera WWW z webserver.cpp
+  setupTasks();     // Harmonogram zadań loop()
 
   wakeCycleStartMs = millis();
 }
 
-void loop()
-{
-  ESP.wdtFeed();
+// ============================================================================
+// ZADANIA loop() - uruchamiane przez harmonogram (scheduler)
+// ============================================================================
+
+#define TASK_MODE_PERIOD_MS 1000 // Stan WiFi/AP, grace period, zaplanowane resety (dokładność minuty)
+
+static int8_t taskPingId = -1;
+static int8_t taskApRetryId = -1;
 
+static void taskSerial()
+{
   // Obsługa poleceń z Serial Monitor
   handleSerialCommands();
+}
 
-  // === SAFE MODE - Boot Loop Protection ===
-  if (safeMode)
-  {
-    // Tryb bezpieczeństwa: ESP jest chronione przed boot loop
-    // - Włączamy AP mode (user może konfigurować)
-    // - NIE testujemy internetu
-    // - NIE resetujemy routera
-    // - Przekaźnik zablokowany (router bezpieczny)
+static void taskMdns()
+{
+  updateMDNS();
+}
 
-    // Ustaw AP mode
-    if (WiFi.getMode() != WIFI_AP)
-    {
-      WiFi.mode(WIFI_AP);
-      Serial.println("[SAFE_MODE] Forcing AP mode");
-    }
+static void taskWeb()
+{
+  server.handleClient();
+}
 
-    // Migająca czerwona dioda (alarm)
-    if ((millis() / 500) % 2 == 0)
-      digitalWrite(config.pinRed, HIGH);
-    else
-      digitalWrite(config.pinRed, LOW);
+#if HTTP_ASYNC_ENABLED
+static void taskHttpAsync()
+{
+  asyncHttpLoop(); // Jedno żądanie na obieg; odbiór nagłówków w wywołaniach lwIP
+}
+#endif
 
-    // Obsługa AP i web servera
-    updateMDNS();
-    server.handleClient();
-    handleButtonPress();
+static void taskButton()
+{
+  handleButtonPress();
+}
 
-    statusMsg = "⚠️ SAFE MODE - Boot loop detected! Configure and reboot.";
-    logEvent("SAFE_MODE: Running - no internet tests, router locked");
+static void taskRouterCycle()
+{
+  routerCycleLoop(); // Cykl zasilania routera (reset bez blokowania pętli)
+}
 
-    delay(100);
-    return; // Pomiń resztę loop'a - nie testuj internetu, nie resetuj routera
-  }
+static void taskStorage()
+{
+  HEAP_SCOPE("storage");
+  historyLoop(); // Okresowy zapis archiwum historii na Flash
+  incidentsLoop();
+}
 
-  // Normalny tryb - testuj internet i resetuj routera
-  updateMDNS();
-  server.handleClient();
+static void taskHeap()
+{
+  heapStatsLoop(); // Próbka sterty co HEAP_SAMPLE_MS
+}
+
+static void taskLive()
+{
+  webLiveLoop(); // Zmiany stanu do otwartych paneli, bez odpytywania
+}
+
+static void taskSimExpiry()
+{
   // Wyłącz symulacje po wygaśnięciu sesji
-  if (!isSessionActive && (simPingFail || simNoWiFi || simHighPing))
+  if (sessionActiveCount(millis()) == 0 && (simPingFail || simNoWiFi || simHighPing))
   {
     simPingFail = false;
     simNoWiFi = false;
@@ -822,112 +757,209 @@ void loop()
     Serial.println("Symulacje wyłączone z powodu wygaśnięcia sesji.");
     logEvent("SYMULACJE WYLACZONE (Wygasniecie sesji)");
   }
-  handleButtonPress();
+}
 
-  // Obsługa trybów pracy
-  if (WiFi.getMode() == WIFI_AP)
+// === SAFE MODE - Boot Loop Protection ===
+static void taskSafeMode()
+{
+  // Tryb bezpieczeństwa: ESP jest chronione przed boot loop
+  // - Włączamy AP mode (user może konfigurować)
+  // - NIE testujemy internetu
+  // - NIE resetujemy routera
+  // - Przekaźnik zablokowany (router bezpieczny)
+  static bool logged = false;
+
+  // Ustaw AP mode
+  if (WiFi.getMode() != WIFI_AP)
   {
-    // Tryb AP (Konfiguracyjny)
-    ledBlue(); // Niebieska dioda dla trybu AP
-    failCount = 0;
-    statusMsg = "Tryb konfiguracyjny - brak internetu";
+    WiFi.mode(WIFI_AP);
+    Serial.println("[SAFE_MODE] Forcing AP mode");
+  }
 
-    // Sprawdź ile sieci jest zapisanych (czy to pierwsze uruchomienie)
-    int currentKnown = liczbaZajetychMiejscTablicy(tablica, wielkoscTablicy);
-    knownNetworksCount = currentKnown;
+  // Migająca czerwona dioda (alarm)
+  ledSetPattern(PATTERN_SAFE_MODE);
 
-    // Pierwsze uruchomienie: brak zapisanych sieci -> brak odliczania i brak resetów
-    if (currentKnown == 0)
-    {
-      statusMsg = "Tryb konfiguracyjny (pierwsze uruchomienie) - brak zapisanych sieci";
-      apModeAttempts = 0;
-      apModeStartTime = 0;
+  statusMsg = "⚠️ SAFE MODE - Boot loop detected! Configure and reboot.";
+  if (!logged)
+  {
+    logEvent("SAFE_MODE: Running - no internet tests, router locked");
+    logged = true;
+  }
+}
 
-      // Od czasu do czasu wczytaj plik, by wykryć nowe dane dodane przez użytkownika
-      if (millis() - lastAPCheckTime > config.apConfigTimeout)
-      {
-        lastAPCheckTime = millis();
-        odczytajTabliceZPliku(WIFI_CONFIG_FILES);
-      }
-      return; // Zostań w AP bez resetów
-    }
+// Stan trybu AP - terminy kolejnych prób wyjścia z AP wyznacza zadanie "apretry"
+static void handleApMode()
+{
+  // Tryb AP (Konfiguracyjny)
+  ledBlue(); // Niebieska dioda dla trybu AP
+  failCount = 0;
+  statusMsg = "Tryb konfiguracyjny - brak internetu";
 
-    // Śledź czas wejścia w AP mode
-    if (apModeStartTime == 0)
-    {
-      apModeStartTime = millis();
-      apModeAttempts = 0;
-      logEvent("Wejscie w AP mode - licznik prob: 0");
-    }
+  // Sprawdź ile sieci jest zapisanych (czy to pierwsze uruchomienie)
+  int currentKnown = liczbaZajetychMiejscTablicy(tablica, wielkoscTablicy);
+  knownNetworksCount = currentKnown;
 
-    // Sprawdzaj co apConfigTimeout czy wyjść z AP
-    if (millis() - lastAPCheckTime > config.apConfigTimeout)
-    {
-      // Sprawdź czy jesteśmy w backoff
-      if (apModeBackoffUntil > millis())
-      {
-        // Jesteśmy w backoff, nie rób nic, czekaj
-        statusMsg = "AP backoff: " + String((apModeBackoffUntil - millis()) / 60000) + " min do następnej próby";
-        return;
-      }
+  // Pierwsze uruchomienie: brak zapisanych sieci -> brak odliczania i brak resetów
+  if (currentKnown == 0)
+  {
+    statusMsg = "Tryb konfiguracyjny (pierwsze uruchomienie) - brak zapisanych sieci";
+    apModeAttempts = 0;
+    apModeStartTime = 0;
+    return; // Zostań w AP bez resetów
+  }
 
-      lastAPCheckTime = millis();
-      apModeAttempts++;
-      Serial.println("Proba wyjscia z trybu AP (Licznik: " + String(apModeAttempts) + ")");
-      logEvent("Proba wyjscia z AP #" + String(apModeAttempts));
+  // Śledź czas wejścia w AP mode
+  if (apModeStartTime == 0)
+  {
+    apModeStartTime = millis();
+    apModeAttempts = 0;
+    logEvent("Wejscie w AP mode - licznik prob: 0");
+  }
 
-      // Detektuj problemy: brak radia czy brak IP
-      int wifiStatus = WiFi.status();
-      IPAddress localIP = WiFi.localIP();
-      String failureReason = "";
+  if (apModeBackoffUntil != 0 && (long)(apModeBackoffUntil - millis()) > 0)
+    statusMsg = "AP backoff: " + String((apModeBackoffUntil - millis()) / 60000) + " min do następnej próby";
+}
 
-      if (wifiStatus != WL_CONNECTED)
-      {
-        if (wifiStatus == WL_NO_SSID_AVAIL)
-          failureReason = "Brak sieci (radio martwe)";
-        else if (wifiStatus == WL_CONNECT_FAILED)
-          failureReason = "Połączenie odrzucone";
-        else
-          failureReason = "Brak WiFi (status=" + String(wifiStatus) + ")";
-      }
-      else if (localIP[0] == 0 && localIP[1] == 0 && localIP[2] == 0 && localIP[3] == 0)
-      {
-        failureReason = "Brak adresu IP (problem DHCP)";
-      }
+// Próba wyjścia z AP - wybudzenie co apConfigTimeout od wejścia w AP, po serii prób po backoffie
+static void taskApRetry()
+{
+  HEAP_SCOPE("wd.apmode");
+  schedWakeIn(taskApRetryId, config.apConfigTimeout);
 
-      if (failureReason.length() > 0)
-      {
-        logEvent("Proba #" + String(apModeAttempts) + " nieudana: " + failureReason);
-      }
+  // Pierwsze uruchomienie: od czasu do czasu wczytaj plik, by wykryć nowe dane dodane przez użytkownika
+  if (liczbaZajetychMiejscTablicy(tablica, wielkoscTablicy) == 0)
+  {
+    odczytajTabliceZPliku(WIFI_CONFIG_FILES);
+    return;
+  }
 
-      odczytajTabliceZPliku(WIFI_CONFIG_FILES);
-      PolaczZWiFi(tablica, toggleBlue);
+  apModeAttempts++;
+  Serial.println("Proba wyjscia z trybu AP (Licznik: " + String(apModeAttempts) + ")");
+  logEvent("Proba wyjscia z AP #" + String(apModeAttempts));
 
-      // Jeśli po apMaxAttempts próbach, zresetuj router i przejdź w backoff
-      // Domyślnie: apMaxAttempts=4, apConfigTimeout=10 min -> 4 próby = 40 minut
-      if (apModeAttempts >= config.apMaxAttempts)
-      {
-        Serial.println("RESET ROUTERA - AP mode nie zakonczyl sie po " + String(config.apMaxAttempts) + " probach");
-        logEvent("RESET ROUTERA - AP mode trwa zbyt dlugo (" + String(config.apMaxAttempts) + "+ probe), backoff: " + String(config.apBackoffMs / 60000) + "min");
+  // Detektuj problemy: brak radia czy brak IP
+  int wifiStatus = WiFi.status();
+  IPAddress localIP = WiFi.localIP();
+  String failureReason = "";
 
-        apModeBackoffUntil = millis() + config.apBackoffMs; // Ustaw backoff na config.apBackoffMs
-        apModeAttempts = 0;                                 // Reset licznika
-        lastAPCheckTime = millis();                         // Zapamiętaj czas
+  if (wifiStatus != WL_CONNECTED)
+  {
+    if (wifiStatus == WL_NO_SSID_AVAIL)
+      failureReason = "Brak sieci (radio martwe)";
+    else if (wifiStatus == WL_CONNECT_FAILED)
+      failureReason = "Połączenie odrzucone";
+    else
+      failureReason = "Brak WiFi (status=" + String(wifiStatus) + ")";
+  }
+  else if (localIP[0] == 0 && localIP[1] == 0 && localIP[2] == 0 && localIP[3] == 0)
+  {
+    failureReason = "Brak adresu IP (problem DHCP)";
+  }
 
-        // Importuj zmienne z watchdog.cpp
-        extern void wykonajReset();
-        wykonajReset();
-      }
-    }
+  if (failureReason.length() > 0)
+  {
+    logEvent("Proba #" + String(apModeAttempts) + " nieudana: " + failureReason);
   }
-  else
+
+  odczytajTabliceZPliku(WIFI_CONFIG_FILES);
+  ledSetPattern(PATTERN_WIFI_CONNECTING);
+  PolaczZWiFi(tablica);
+
+  // Jeśli po apMaxAttempts próbach, zresetuj router i przejdź w backoff
+  // Domyślnie: apMaxAttempts=4, apConfigTimeout=10 min -> 4 próby = 40 minut
+  if (apModeAttempts >= config.apMaxAttempts)
+  {
+    Serial.println("RESET ROUTERA - AP mode nie zakonczyl sie po " + String(config.apMaxAttempts) + " probach");
+    logEvent("RESET ROUTERA - AP mode trwa zbyt dlugo (" + String(config.apMaxAttempts) + "+ probe), backoff: " + String(config.apBackoffMs / 60000) + "min");
+
+    apModeBackoffUntil = millis() + config.apBackoffMs; // Ustaw backoff na config.apBackoffMs
+    apModeAttempts = 0;                                 // Reset licznika
+
+    // Kolejna próba po backoffie (nie wcześniej niż za apConfigTimeout)
+    schedWakeIn(taskApRetryId, max(config.apBackoffMs, config.apConfigTimeout));
+
+    // Importuj zmienne z watchdog.cpp
+    extern void wykonajReset();
+    wykonajReset();
+  }
+}
+
+// Obsługa trybów pracy: stan co TASK_MODE_PERIOD_MS, terminy w zadaniach "ping" i "apretry"
+static void taskMode()
+{
+  bool apMode = (WiFi.getMode() == WIFI_AP);
+  if (apMode)
+    handleApMode();
+
+  // Tryb STA (Normalna praca) - Watchdog zarządza połączeniem (Ping + WiFi Check)
+  schedEnable(taskPingId, !apMode && monitorInternetConnection());
+
+  // Wejście w AP: pierwsza próba wyjścia za apConfigTimeout; wyjście z AP: bez terminu
+  static bool apRetryArmed = false;
+  if (apMode != apRetryArmed)
   {
-    // Tryb STA (Normalna praca) - Watchdog zarządza połączeniem (Ping + WiFi Check)
-    monitorInternetConnection();
+    apRetryArmed = apMode;
+    schedEnable(taskApRetryId, apMode);
+    if (apMode)
+      schedWakeIn(taskApRetryId, config.apConfigTimeout);
   }
+}
+
+static void taskPing()
+{
+  schedWakeIn(taskPingId, watchdogPingStep());
+}
 
+static void taskSleep()
+{
   // Obsługa trybu przerywanego (uśpienia)
   handleSleepScheduler();
 }
 
+// Rejestracja zadań: nazwa, okres (ms), budżet jednego wywołania (µs)
+static void setupTasks()
+{
+  schedAdd("serial", taskSerial, 20, 5000);
+  schedAdd("mdns", taskMdns, 50, 5000);
+  schedAdd("web", taskWeb, 5, 100000);
+#if HTTP_ASYNC_ENABLED
+  schedAdd("httpasync", taskHttpAsync, 5, 100000);
+#endif
+  schedAdd("button", taskButton, 10, 2000);
+  schedAdd("router", taskRouterCycle, 50, 1000000); // Odpytywanie rozruchu: ping blokuje do ~1 s
+  schedAdd("heap", taskHeap, 1000, 1000);
+  schedAdd("live", taskLive, 100, 20000); // Migawka JSON dla subskrybentów SSE
+
+  if (safeMode)
+  {
+    // Pomiń resztę zadań - nie testuj internetu, nie resetuj routera
+    schedAdd("safemode", taskSafeMode, 1000, 5000);
+    return;
+  }
+
+  schedAdd("simexpiry", taskSimExpiry, 1000, 5000);
+  schedAdd("storage", taskStorage, 1000, 50000);
+  schedAdd("mode", taskMode, TASK_MODE_PERIOD_MS, 100000);
+  // Zadania z własnym terminem (schedWakeIn) - włączane przez taskMode
+  taskPingId = schedAdd("ping", taskPing, config.pingInterval, 1000000);              // Ping blokuje do ~1 s
+  taskApRetryId = schedAdd("apretry", taskApRetry, config.apConfigTimeout, 1000000); // Łączenie z WiFi
+  schedEnable(taskPingId, false);
+  schedEnable(taskApRetryId, false);
+  schedAdd("sleep", taskSleep, 1000, 5000);
+}
+
+void loop()
+{
+  ESP.wdtFeed();
+
+  // Zadania, których termin minął; w pozostałym czasie oddaj procesor (WiFi, modem sleep)
+  uint32_t idleMs;
+  {
+    PERF_SCOPE("loop"); // Czas pracy jednego obiegu (bez oddanego czasu)
+    idleMs = schedRun();
+  }
+  if (idleMs > 0)
+    delay(idleMs);
+}
+
 #endif // UNIT_TEST
\ No newline at end of file
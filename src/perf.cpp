@@ -0,0 +1,96 @@
+#include "perf.h"
+
+#if PERF_ENABLED
+
+static PerfSiteStats sites[PERF_MAX_SITES];
+static uint8_t siteCount = 0;
+
+int8_t perfRegister(const char *name)
+{
+    // Ta sama nazwa z kilku miejsc w kodzie = jedno miejsce pomiaru
+    for (uint8_t i = 0; i < siteCount; i++)
+    {
+        if (strcmp(sites[i].name, name) == 0)
+            return i;
+    }
+    if (siteCount >= PERF_MAX_SITES)
+        return -1;
+    memset(&sites[siteCount], 0, sizeof(PerfSiteStats));
+    sites[siteCount].name = name;
+    return siteCount++;
+}
+
+static uint8_t bucketFor(uint32_t us)
+{
+    uint8_t b = 0;
+    uint32_t upper = PERF_HIST_FIRST_US;
+    while (b < PERF_HIST_BUCKETS - 1 && us >= upper)
+    {
+        upper <<= 1;
+        b++;
+    }
+    return b;
+}
+
+void perfRecord(int8_t site, uint32_t cycles)
+{
+    if (site < 0)
+        return;
+    PerfSiteStats &s = sites[site];
+    uint32_t us = cycles / ESP.getCpuFreqMHz();
+    s.count++;
+    s.totalUs += us;
+    if (us > s.maxUs)
+        s.maxUs = us;
+    uint16_t &h = s.hist[bucketFor(us)];
+    if (h < 0xFFFF)
+        h++;
+}
+
+uint8_t perfCount()
+{
+    return siteCount;
+}
+
+bool perfStats(uint8_t index, PerfSiteStats &out)
+{
+    if (index >= siteCount)
+        return false;
+    out = sites[index];
+    return true;
+}
+
+void perfReset()
+{
+    for (uint8_t i = 0; i < siteCount; i++)
+    {
+        const char *name = sites[i].name;
+        memset(&sites[i], 0, sizeof(PerfSiteStats));
+        sites[i].name = name;
+    }
+}
+
+#else
+
+uint8_t perfCount()
+{
+    return 0;
+}
+
+bool perfStats(uint8_t, PerfSiteStats &)
+{
+    return false;
+}
+
+void perfReset()
+{
+}
+
+#endif // PERF_ENABLED
+
+uint32_t perfBucketUpperUs(uint8_t bucket)
+{
+    if (bucket >= PERF_HIST_BUCKETS - 1)
+        return 0;
+    return (uint32_t)PERF_HIST_FIRST_US << bucket;
+}
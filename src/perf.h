@@ -0,0 +1,86 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// POMIAR CZASU WYKONANIA (ESP.getCycleCount)
+// ============================================================================
+// PERF_SCOPE("nazwa") na początku bloku mierzy czas do końca bloku w cyklach
+// zegara CPU. Dla każdego miejsca pomiaru w stałej tablicy RAM trzymamy liczbę
+// wywołań, sumę, maksimum i histogram logarytmiczny (przedziały x2 od 32 µs).
+// Licznik cykli przekręca się co ~26 s (160 MHz) - dłuższe bloki nie są mierzone.
+//
+// Ustaw PERF_ENABLED na 0 (np. -DPERF_ENABLED=0 w build_flags), aby wyciąć
+// pomiary z obrazu produkcyjnego - PERF_SCOPE staje się pustym makrem.
+
+#ifndef PERF_ENABLED
+#define PERF_ENABLED 1
+#endif
+
+/** @brief Maksymalna liczba miejsc pomiaru */
+#define PERF_MAX_SITES 16
+
+/** @brief Liczba przedziałów histogramu */
+#define PERF_HIST_BUCKETS 16
+
+/** @brief Górna granica pierwszego przedziału (µs); kolejne x2, ostatni otwarty (>= ~1 s) */
+#define PERF_HIST_FIRST_US 32
+
+struct PerfSiteStats
+{
+    const char *name;
+    uint32_t count;
+    uint64_t totalUs;
+    uint32_t maxUs;
+    uint16_t hist[PERF_HIST_BUCKETS]; // Nasyca się na 65535
+};
+
+#if PERF_ENABLED
+
+/** @brief Rejestruje miejsce pomiaru (wywoływane raz - przez PERF_SCOPE) */
+int8_t perfRegister(const char *name);
+
+/** @brief Dodaje pomiar (w cyklach CPU) do miejsca */
+void perfRecord(int8_t site, uint32_t cycles);
+
+/** @brief Pomiar w zakresie bloku (RAII) */
+class PerfScope
+{
+public:
+    explicit PerfScope(int8_t site) : site(site), start(ESP.getCycleCount()) {}
+    ~PerfScope() { perfRecord(site, ESP.getCycleCount() - start); }
+
+private:
+    int8_t site;
+    uint32_t start;
+};
+
+#define PERF_CONCAT_(a, b) a##b
+#define PERF_CONCAT(a, b) PERF_CONCAT_(a, b)
+#define PERF_SCOPE(name)                                                        \
+    static const int8_t PERF_CONCAT(perfSite_, __LINE__) = perfRegister(name); \
+    PerfScope PERF_CONCAT(perfScope_, __LINE__)(PERF_CONCAT(perfSite_, __LINE__))
+
+#else
+
+#define PERF_SCOPE(name) \
+    do                   \
+    {                    \
+    } while (0)
+
+#endif // PERF_ENABLED
+
+/** @brief Liczba zarejestrowanych miejsc (0 gdy PERF_ENABLED = 0) */
+uint8_t perfCount();
+
+/** @brief Statystyki miejsca; false gdy indeks spoza zakresu */
+bool perfStats(uint8_t index, PerfSiteStats &out);
+
+/** @brief Zeruje liczniki (miejsca zostają zarejestrowane) */
+void perfReset();
+
+/** @brief Górna granica przedziału histogramu w µs (0 = ostatni, otwarty) */
+uint32_t perfBucketUpperUs(uint8_t bucket);
+
+#endif // PERF_H
@@ -0,0 +1,131 @@
+#include "probe.h"
+#include "config.h"
+#include "perf.h"
+#include <ESP8266Ping.h>
+
+enum ProbeState
+{
+    PROBE_IDLE,
+    PROBE_RUNNING
+};
+
+static ProbeState state = PROBE_IDLE;
+static ProbeResult current;
+static ProbeResult last;
+static uint8_t target = 0;      // Ile ech wysłać
+static uint16_t gap = 0;        // Odstęp między echami (ms)
+static uint8_t hostIndex = 0;   // 0 = jeszcze nie wybrany, 1 = host1, 2 = host2
+static unsigned long lastEchoMs = 0;
+static uint32_t rttSum = 0;
+
+// Jedno echo; przy pierwszym echu serii wybiera host (host1, potem host2)
+static bool sendEcho(int &rttMs)
+{
+    if (hostIndex == 0)
+    {
+        if (Ping.ping(config.host1.c_str(), 1))
+            hostIndex = 1;
+        else if (Ping.ping(config.host2.c_str(), 1))
+            hostIndex = 2;
+        else
+            return false;
+        rttMs = Ping.averageTime();
+        return true;
+    }
+
+    const String &host = (hostIndex == 1) ? config.host1 : config.host2;
+    if (!Ping.ping(host.c_str(), 1))
+        return false;
+    rttMs = Ping.averageTime();
+    return true;
+}
+
+static void finish()
+{
+    current.lossPct = (uint8_t)(((current.sent - current.received) * 100U + current.sent / 2) / current.sent);
+    if (current.received > 0)
+        current.rttAvg = (uint16_t)(rttSum / current.received);
+    else
+        current.rttMin = 0;
+    current.usedHost2 = (hostIndex == 2);
+    last = current;
+    state = PROBE_IDLE;
+}
+
+void probeStart(uint8_t count, uint16_t gapMs)
+{
+    if (count < 1)
+        count = 1;
+    if (count > PROBE_MAX_COUNT)
+        count = PROBE_MAX_COUNT;
+
+    memset(&current, 0, sizeof(current));
+    current.rttMin = 0xFFFF;
+    target = count;
+    gap = gapMs;
+    hostIndex = 0;
+    rttSum = 0;
+    lastEchoMs = 0;
+    state = PROBE_RUNNING;
+}
+
+bool probeStep()
+{
+    PERF_SCOPE("probe.step");
+    if (state != PROBE_RUNNING)
+        return false;
+
+    // Odstęp liczony od końca poprzedniego echa (timeout pingu nie skraca przerwy)
+    if (current.sent > 0 && millis() - lastEchoMs < gap)
+        return false;
+
+    int rttMs = 0;
+    bool ok = sendEcho(rttMs);
+    lastEchoMs = millis();
+
+    uint8_t i = current.sent++;
+    if (ok)
+    {
+        uint16_t rtt = (rttMs < 0) ? 0 : (rttMs >= PROBE_RTT_LOST ? PROBE_RTT_LOST - 1 : (uint16_t)rttMs);
+        current.rtt[i] = rtt;
+        current.received++;
+        rttSum += rtt;
+        if (rtt < current.rttMin)
+            current.rttMin = rtt;
+        if (rtt > current.rttMax)
+            current.rttMax = rtt;
+    }
+    else
+    {
+        current.rtt[i] = PROBE_RTT_LOST;
+    }
+
+    if (current.sent < target)
+        return false;
+
+    finish();
+    return true;
+}
+
+uint32_t probeNextStepInMs()
+{
+    if (state != PROBE_RUNNING || current.sent == 0)
+        return 0;
+    unsigned long since = millis() - lastEchoMs;
+    return since >= gap ? 0 : gap - since;
+}
+
+bool probeBusy()
+{
+    return state == PROBE_RUNNING;
+}
+
+void probeAbort()
+{
+    state = PROBE_IDLE;
+}
+
+const ProbeResult &probeResult()
+{
+    return last;
+}
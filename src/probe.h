@@ -0,0 +1,59 @@
+#ifndef PROBE_H
+#define PROBE_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// SERIA PINGÓW (BURST) - POMIAR STRATY PAKIETÓW
+// ============================================================================
+// Zamiast jednego echa seria N pingów z odstępem, z której liczymy stratę
+// i rozrzut RTT. Maszyna stanów wysyła najwyżej jedno echo na wywołanie
+// probeStep(), więc loop() (serwer WWW, przycisk) działa między pingami.
+//
+// Host wybierany jest przy pierwszym echu: host1, a gdy nie odpowie - host2.
+// Kolejne echa serii idą do tego samego hosta, aby strata dotyczyła jednej ścieżki.
+
+/** @brief Maksymalna liczba ech w serii */
+#define PROBE_MAX_COUNT 20
+
+/** @brief Wartość w probeRtt[] dla echa bez odpowiedzi */
+#define PROBE_RTT_LOST 0xFFFF
+
+struct ProbeResult
+{
+    uint8_t sent;
+    uint8_t received;
+    uint8_t lossPct;                  // 0-100
+    uint16_t rttMin;                  // ms (0 gdy brak odpowiedzi)
+    uint16_t rttAvg;                  // ms
+    uint16_t rttMax;                  // ms
+    uint16_t rtt[PROBE_MAX_COUNT];    // RTT kolejnych ech; PROBE_RTT_LOST = brak odpowiedzi
+    bool usedHost2;                   // Seria poszła do host2 (host1 nie odpowiedział)
+};
+
+/**
+ * @brief Rozpoczyna serię pingów (poprzednia niedokończona seria jest porzucana)
+ * @param count liczba ech (1..PROBE_MAX_COUNT)
+ * @param gapMs odstęp między kolejnymi echami
+ */
+void probeStart(uint8_t count, uint16_t gapMs);
+
+/**
+ * @brief Krok maszyny stanów - wywoływać w każdym obiegu loop() albo po probeNextStepInMs()
+ * @return true gdy seria właśnie się zakończyła (wynik w probeResult())
+ */
+bool probeStep();
+
+/** @brief Czas do kolejnego echa serii (ms; 0 = można wysłać teraz) - termin wybudzenia zadania */
+uint32_t probeNextStepInMs();
+
+/** @brief Czy seria jest w toku */
+bool probeBusy();
+
+/** @brief Przerywa serię (np. utrata WiFi, reset routera) */
+void probeAbort();
+
+/** @brief Wynik ostatniej zakończonej serii */
+const ProbeResult &probeResult();
+
+#endif // PROBE_H
@@ -0,0 +1,169 @@
+#include "rate_limit.h"
+
+// Pojemność kubełka (seria) i czas odnowienia jednego żetonu
+struct RateBucketSpec
+{
+    uint8_t burst;
+    uint16_t msPerToken;
+};
+
+static const RateBucketSpec SPECS[RATE_CLASS_COUNT] = {
+    {30, 200},   // RATE_PAGE: 5/s, seria na pełne załadowanie /config
+    {5, 2000},   // RATE_ACTION: 1 na 2 s
+    {5, 10000},  // RATE_LOGIN: 6/min
+};
+
+static const char *const CLASS_NAMES[RATE_CLASS_COUNT] = {"page", "action", "login"};
+
+// Żetony w tysięcznych części (odnowienie bez ułamków)
+struct RateClient
+{
+    uint32_t ip;
+    uint32_t lastMs; // Ostatnie odnowienie żetonów
+    uint32_t lockUntilMs;
+    uint16_t milliTokens[RATE_CLASS_COUNT];
+    uint8_t loginFails;
+    bool used;
+};
+
+static RateClient clients[RATE_MAX_CLIENTS];
+static RateLimitCounters counters;
+
+static bool locked(const RateClient &c, uint32_t nowMs)
+{
+    return c.lockUntilMs && (int32_t)(c.lockUntilMs - nowMs) > 0; // Odporne na przepełnienie millis()
+}
+
+static RateClient &clientFor(uint32_t ip, uint32_t nowMs)
+{
+    // Znany adres, wolne miejsce albo najdawniej widziany (blokady logowania zostają)
+    int8_t freeSlot = -1;
+    int8_t victim = -1;
+    uint32_t victimAge = 0;
+    bool victimLocked = true;
+    for (uint8_t i = 0; i < RATE_MAX_CLIENTS; i++)
+    {
+        RateClient &c = clients[i];
+        if (!c.used)
+        {
+            if (freeSlot < 0)
+                freeSlot = i;
+            continue;
+        }
+        if (c.ip == ip)
+            return c;
+        bool isLocked = locked(c, nowMs);
+        uint32_t age = nowMs - c.lastMs;
+        if (victim < 0 || (victimLocked && !isLocked) || (victimLocked == isLocked && age > victimAge))
+        {
+            victim = i;
+            victimAge = age;
+            victimLocked = isLocked;
+        }
+    }
+
+    int8_t pick = freeSlot >= 0 ? freeSlot : victim;
+    RateClient &c = clients[pick];
+    memset(&c, 0, sizeof(c));
+    c.ip = ip;
+    c.lastMs = nowMs;
+    c.used = true;
+    for (uint8_t k = 0; k < RATE_CLASS_COUNT; k++)
+        c.milliTokens[k] = SPECS[k].burst * 1000;
+    return c;
+}
+
+static void refill(RateClient &c, uint32_t nowMs)
+{
+    uint32_t elapsed = nowMs - c.lastMs;
+    if (elapsed == 0)
+        return;
+    c.lastMs = nowMs;
+    for (uint8_t k = 0; k < RATE_CLASS_COUNT; k++)
+    {
+        uint32_t full = SPECS[k].burst * 1000UL;
+        // Ograniczenie elapsed - bez przepełnienia mnożenia po długiej przerwie
+        uint32_t add = elapsed >= SPECS[k].msPerToken * (uint32_t)SPECS[k].burst
+                           ? full
+                           : elapsed * 1000UL / SPECS[k].msPerToken;
+        c.milliTokens[k] = min(full, c.milliTokens[k] + add);
+    }
+}
+
+bool rateAllow(uint32_t ip, uint8_t cls, uint32_t nowMs, uint32_t &retryAfterMs)
+{
+    retryAfterMs = 0;
+    if (cls >= RATE_CLASS_COUNT)
+        return true;
+
+    RateClient &c = clientFor(ip, nowMs);
+    if (cls == RATE_LOGIN && locked(c, nowMs))
+    {
+        retryAfterMs = c.lockUntilMs - nowMs;
+        counters.rejected[cls]++;
+        return false;
+    }
+
+    refill(c, nowMs);
+    if (c.milliTokens[cls] < 1000)
+    {
+        retryAfterMs = (1000 - c.milliTokens[cls]) * (uint32_t)SPECS[cls].msPerToken / 1000 + 1;
+        counters.rejected[cls]++;
+        return false;
+    }
+    c.milliTokens[cls] -= 1000;
+    counters.allowed[cls]++;
+    return true;
+}
+
+uint32_t rateLoginFailed(uint32_t ip, uint32_t nowMs)
+{
+    RateClient &c = clientFor(ip, nowMs);
+    if (c.loginFails < 0xFF)
+        c.loginFails++;
+    if (c.loginFails <= RATE_LOGIN_FREE_FAILS)
+        return 0;
+
+    uint8_t shift = min(c.loginFails - RATE_LOGIN_FREE_FAILS - 1, 16);
+    uint32_t lockMs = min(RATE_LOGIN_LOCK_BASE_MS << shift, RATE_LOGIN_LOCK_MAX_MS);
+    c.lockUntilMs = nowMs + lockMs;
+    if (c.lockUntilMs == 0)
+        c.lockUntilMs = 1; // 0 = brak blokady
+    counters.lockouts++;
+    return lockMs;
+}
+
+void rateLoginSucceeded(uint32_t ip)
+{
+    for (uint8_t i = 0; i < RATE_MAX_CLIENTS; i++)
+    {
+        if (clients[i].used && clients[i].ip == ip)
+        {
+            clients[i].loginFails = 0;
+            clients[i].lockUntilMs = 0;
+            return;
+        }
+    }
+}
+
+const char *rateClassName(uint8_t cls)
+{
+    return cls < RATE_CLASS_COUNT ? CLASS_NAMES[cls] : "exempt";
+}
+
+void rateCounters(RateLimitCounters &out)
+{
+    out = counters;
+    out.clients = 0;
+    for (uint8_t i = 0; i < RATE_MAX_CLIENTS; i++)
+    {
+        if (clients[i].used)
+            out.clients++;
+    }
+}
+
+void rateReset()
+{
+    memset(clients, 0, sizeof(clients));
+    memset(&counters, 0, sizeof(counters));
+}
@@ -0,0 +1,78 @@
+#ifndef RATE_LIMIT_H
+#define RATE_LIMIT_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// OGRANICZENIE LICZBY ŻĄDAŃ HTTP (TOKEN BUCKET)
+// ============================================================================
+// Każdy adres IP ma osobny kubełek dla każdej klasy tras. Żądanie zabiera
+// jeden żeton, żetony wracają w stałym tempie do pojemności kubełka (serii).
+// Żądanie bez żetonu dostaje 429 przed wywołaniem handlera - odrzucenie
+// kosztuje tyle, co krótka odpowiedź, więc skrypt czy zawieszony panel nie
+// zajmuje pętli na tyle, by opóźnić pingi i decyzje watchdoga.
+//
+// Nieudane logowania blokują adres wykładniczo: po RATE_LOGIN_FREE_FAILS
+// próbach blokada trwa RATE_LOGIN_LOCK_BASE_MS i podwaja się z każdą
+// kolejną porażką (do RATE_LOGIN_LOCK_MAX_MS). Udane logowanie zeruje licznik.
+//
+// Tablica adresów ma stały rozmiar; nowy adres zastępuje najdawniej
+// widziany, z pominięciem adresów z aktywną blokadą logowania.
+
+/** @brief Liczba śledzonych adresów IP */
+#define RATE_MAX_CLIENTS 8
+
+/** @brief Nieudane logowania bez blokady */
+#define RATE_LOGIN_FREE_FAILS 3
+
+/** @brief Pierwsza blokada logowania (ms) */
+#define RATE_LOGIN_LOCK_BASE_MS 5000UL
+
+/** @brief Najdłuższa blokada logowania (ms) */
+#define RATE_LOGIN_LOCK_MAX_MS 900000UL
+
+/** @brief Klasa trasy - osobny kubełek i limity */
+enum RateClass
+{
+    RATE_PAGE = 0, // Strony i API (odczyt, zapis konfiguracji)
+    RATE_ACTION,   // Akcje z efektem ubocznym: /test/*, reset, restart, czyszczenie
+    RATE_LOGIN,    // POST /login
+    RATE_CLASS_COUNT,
+    RATE_EXEMPT = 0xFF // Zasoby statyczne (buforowane przez przeglądarkę) - bez limitu
+};
+
+/** @brief Liczniki dla /api/perf */
+struct RateLimitCounters
+{
+    uint32_t allowed[RATE_CLASS_COUNT];
+    uint32_t rejected[RATE_CLASS_COUNT];
+    uint32_t lockouts; // Nałożone blokady logowania
+    uint8_t clients;   // Aktualnie śledzone adresy
+};
+
+/**
+ * @brief Sprawdza i zużywa żeton klasy dla adresu
+ * @param retryAfterMs przy odmowie: za ile będzie dostępny żeton (lub koniec blokady logowania)
+ * @return false = odrzuć żądanie (429)
+ */
+bool rateAllow(uint32_t ip, uint8_t cls, uint32_t nowMs, uint32_t &retryAfterMs);
+
+/**
+ * @brief Nieudane logowanie z adresu
+ * @return czas nałożonej blokady (ms), 0 = jeszcze bez blokady
+ */
+uint32_t rateLoginFailed(uint32_t ip, uint32_t nowMs);
+
+/** @brief Udane logowanie - zeruje licznik porażek adresu */
+void rateLoginSucceeded(uint32_t ip);
+
+/** @brief Nazwa klasy (do JSON) */
+const char *rateClassName(uint8_t cls);
+
+/** @brief Kopia liczników */
+void rateCounters(RateLimitCounters &out);
+
+/** @brief Czyści tablicę adresów i liczniki */
+void rateReset();
+
+#endif // RATE_LIMIT_H
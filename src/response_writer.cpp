@@ -0,0 +1,143 @@
+#include "response_writer.h"
+#include "heap_stats.h"
+
+static char sharedBuf[RESPONSE_BUF_SIZE];
+static bool sharedBusy = false;
+
+static char *claimBuffer()
+{
+    if (sharedBusy)
+        return nullptr;
+    sharedBusy = true;
+    return sharedBuf;
+}
+
+ResponseWriter::ResponseWriter(ESP8266WebServer &server) : server(&server), sink(nullptr), buf(claimBuffer()) {}
+
+ResponseWriter::ResponseWriter(Print &sink) : server(nullptr), sink(&sink), buf(claimBuffer()) {}
+
+ResponseWriter::~ResponseWriter()
+{
+    flush();
+    if (buf)
+        sharedBusy = false;
+}
+
+void ResponseWriter::begin(int code, const char *contentType)
+{
+    if (!server)
+        return;
+    server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server->send(code, contentType, "");
+}
+
+void ResponseWriter::emit(const char *data, size_t size)
+{
+    heapCheckpoint(); // Szczyt zużycia sterty zwykle tuż przed wysyłką
+    if (server)
+        server->sendContent(data, size);
+    else
+        sink->write((const uint8_t *)data, size);
+}
+
+size_t ResponseWriter::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+size_t ResponseWriter::write(const uint8_t *data, size_t size)
+{
+    totalBytes += size;
+    if (!buf)
+    {
+        emit((const char *)data, size);
+        return size;
+    }
+    size_t left = size;
+    while (left > 0)
+    {
+        if (len == RESPONSE_BUF_SIZE)
+            flush();
+        size_t n = RESPONSE_BUF_SIZE - len;
+        if (n > left)
+            n = left;
+        memcpy(buf + len, data, n);
+        len += n;
+        data += n;
+        left -= n;
+    }
+    return size;
+}
+
+void ResponseWriter::writeP(PGM_P data, size_t size)
+{
+    if (!buf)
+    {
+        // Bez własnego bufora - kopiuj przez stos małymi kawałkami
+        char tmp[64];
+        while (size > 0)
+        {
+            size_t n = size < sizeof(tmp) ? size : sizeof(tmp);
+            memcpy_P(tmp, data, n);
+            write((const uint8_t *)tmp, n);
+            data += n;
+            size -= n;
+        }
+        return;
+    }
+    totalBytes += size;
+    while (size > 0)
+    {
+        if (len == RESPONSE_BUF_SIZE)
+            flush();
+        size_t n = RESPONSE_BUF_SIZE - len;
+        if (n > size)
+            n = size;
+        memcpy_P(buf + len, data, n); // Prosto z Flash do bufora
+        len += n;
+        data += n;
+        size -= n;
+    }
+}
+
+void ResponseWriter::printEscaped(const char *text)
+{
+    for (; *text; text++)
+    {
+        switch (*text)
+        {
+        case '&':
+            print(F("&amp;"));
+            break;
+        case '<':
+            print(F("&lt;"));
+            break;
+        case '>':
+            print(F("&gt;"));
+            break;
+        case '"':
+            print(F("&quot;"));
+            break;
+        case '\'':
+            print(F("&#39;"));
+            break;
+        default:
+            write((uint8_t)*text);
+        }
+    }
+}
+
+void ResponseWriter::flush()
+{
+    if (len == 0)
+        return;
+    emit(buf, len);
+    len = 0;
+}
+
+void ResponseWriter::end()
+{
+    flush();
+    if (server)
+        server->sendContent(""); // Koniec transmisji
+}
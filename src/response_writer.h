@@ -0,0 +1,82 @@
+#ifndef RESPONSE_WRITER_H
+#define RESPONSE_WRITER_H
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+
+// ============================================================================
+// BUFOROWANY ZAPIS ODPOWIEDZI HTTP (chunked)
+// ============================================================================
+// Każde server.sendContent() to osobna porcja chunked (nagłówek z długością +
+// CRLF) i zwykle osobny segment TCP. Strona składana z kilkudziesięciu małych
+// wywołań to kilkadziesiąt pakietów - na wolnym telefonie każdy czeka na ACK.
+//
+// ResponseWriter to Print zbierający wyjście w buforze o rozmiarze jednego
+// segmentu (TCP_MSS minus ramka porcji) i wysyłający tylko pełne porcje.
+// end() wysyła resztę i kończy transmisję. Bufor jest statyczny - serwer
+// obsługuje żądania po kolei, więc nie zajmuje stosu ani sterty; writer
+// utworzony, gdy bufor jest zajęty, pisze bez buforowania.
+//
+// Przykład:
+//   ResponseWriter out(server);
+//   sendHtmlHeader(out, "Tytuł", config.darkMode);
+//   out.print(F("<p>Pingi: "));
+//   out.print(count);
+//   out.end();
+
+#ifndef TCP_MSS
+#define TCP_MSS 536 // Wariant lwIP "Lower Memory" (domyślny w PlatformIO)
+#endif
+
+/** @brief Ramka porcji chunked: długość hex (do 3 cyfr) + 2x CRLF */
+#define RESPONSE_CHUNK_OVERHEAD 7
+
+/** @brief Rozmiar bufora - jedna porcja w jednym segmencie TCP */
+#define RESPONSE_BUF_SIZE (TCP_MSS - RESPONSE_CHUNK_OVERHEAD)
+
+class ResponseWriter : public Print
+{
+public:
+    /** @brief Odpowiedź do klienta (porcje przez server.sendContent) */
+    explicit ResponseWriter(ESP8266WebServer &server);
+
+    /** @brief Wyjście do dowolnego Print (testy, pliki) */
+    explicit ResponseWriter(Print &sink);
+
+    ~ResponseWriter();
+
+    /** @brief Wysyła nagłówki odpowiedzi o nieznanej długości (chunked) */
+    void begin(int code, const char *contentType);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *data, size_t size) override;
+    using Print::write;
+
+    /** @brief Tekst z PROGMEM (kopiowany prosto do bufora) */
+    void writeP(PGM_P data, size_t size);
+    void printP(PGM_P text) { writeP(text, strlen_P(text)); }
+
+    /** @brief Tekst z zamianą znaków specjalnych HTML (&, <, >, ", ') */
+    void printEscaped(const char *text);
+    void printEscaped(const String &text) { printEscaped(text.c_str()); }
+
+    /** @brief Wysyła zawartość bufora */
+    void flush() override;
+
+    /** @brief Wysyła resztę i kończy transmisję (pusta porcja) */
+    void end();
+
+    /** @brief Łącznie wypisane bajty */
+    uint32_t total() const { return totalBytes; }
+
+private:
+    void emit(const char *data, size_t size);
+
+    ESP8266WebServer *server;
+    Print *sink;
+    char *buf; // nullptr = bez buforowania (bufor zajęty)
+    uint16_t len = 0;
+    uint32_t totalBytes = 0;
+};
+
+#endif // RESPONSE_WRITER_H
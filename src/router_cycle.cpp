@@ -0,0 +1,269 @@
+#include "router_cycle.h"
+#include "config.h"
+#include "app_globals.h" // logEvent(), symulacje
+#include "watchdog.h"    // pingGateway()
+#include "boot_model.h"  // bootModelRecord()
+#include "led_pattern.h" // ledSetPattern()
+#include "heap_stats.h"  // HEAP_SCOPE
+#include "sse.h"         // sseMarkDirty()
+#include "rtt_stats.h"   // rttStatsRestartShortWindows()
+#include <ESP8266WiFi.h>
+#include <ESP8266Ping.h>
+
+#define BOOT_TIMING_MAGIC 0x54424352UL // "RCBT"
+
+static RouterCycleState state = RC_IDLE;
+static RouterCycleKind kind = RC_KIND_AUTO;
+static RouterCycleDoneFn doneFn = nullptr;
+static unsigned long stateStartMs = 0;
+static bool aborted = false;
+
+// Pomiar rozruchu bieżącego cyklu
+static RouterBootTiming timing;
+static unsigned long lastPollMs = 0;
+static uint8_t pollHostIndex = 0; // Host internetu w kolejnej próbie: 0 = host1, 1 = host2
+
+// Ostatni pomiar - przetrwa ESP.restart() wykonywany po automatycznym resecie
+struct BootTimingNoinit
+{
+    uint32_t magic;
+    RouterBootTiming timing;
+};
+static BootTimingNoinit lastTiming __attribute__((section(".noinit")));
+
+static void enterState(RouterCycleState next)
+{
+    state = next;
+    stateStartMs = millis();
+    sseMarkDirty();
+}
+
+static void relayPowerOff()
+{
+    digitalWrite(config.pinRelay, HIGH);
+}
+
+static void relayPowerOn()
+{
+    digitalWrite(config.pinRelay, LOW);
+}
+
+// Jedna próba na wywołanie: WiFi -> brama -> internet
+// Zwraca true gdy internet potwierdzony
+static bool pollBoot(uint32_t sinceOnMs)
+{
+    bool wifiUp = (WiFi.status() == WL_CONNECTED) && !simNoWiFi;
+    if (!wifiUp)
+    {
+        // Utrata WiFi w trakcie rozruchu (router restartuje radio) - liczymy od nowa
+        timing.wifiMs = 0;
+        timing.gatewayMs = 0;
+        return false;
+    }
+    if (timing.wifiMs == 0)
+    {
+        timing.wifiMs = sinceOnMs;
+        return false; // Brama w kolejnym obiegu - nie blokujemy loop() dłużej niż jedną próbą
+    }
+    if (timing.gatewayMs == 0)
+    {
+        if (pingGateway())
+            timing.gatewayMs = millis() - stateStartMs;
+        return false;
+    }
+    if (simPingFail)
+        return false;
+    // Jeden host na obieg, na zmianę - niedostępny host1 nie podwaja czasu blokady
+    const String &host = pollHostIndex ? config.host2 : config.host1;
+    pollHostIndex ^= 1;
+    if (Ping.ping(host.c_str(), 1))
+    {
+        timing.internetMs = millis() - stateStartMs;
+        timing.confirmed = true;
+        return true;
+    }
+    return false;
+}
+
+static void logBootTiming()
+{
+    if (aborted)
+        return;
+    if (timing.confirmed)
+        logEvent("Rozruch routera: WiFi " + String(timing.wifiMs / 1000) + "s, brama " + String(timing.gatewayMs / 1000) +
+                 "s, internet " + String(timing.internetMs / 1000) + "s");
+    else
+        logEvent("Rozruch routera: brak internetu po " + String(config.baseBootTime / 1000) + "s (WiFi " +
+                 (timing.wifiMs ? String(timing.wifiMs / 1000) + "s" : String("-")) + ", brama " +
+                 (timing.gatewayMs ? String(timing.gatewayMs / 1000) + "s" : String("-")) + ")");
+
+    lastTiming.timing = timing;
+    lastTiming.magic = BOOT_TIMING_MAGIC;
+
+    // Przy sieci rezerwowej WiFi/brama należą do innego routera - pomiar nie opisuje resetowanego
+    if (!config.backupNetworkActive)
+        bootModelRecord(timing, config.baseBootTime);
+}
+
+bool routerCycleStart(RouterCycleKind k, RouterCycleDoneFn onDone)
+{
+    if (state != RC_IDLE)
+        return false;
+
+    kind = k;
+    doneFn = onDone;
+    aborted = false;
+    memset(&timing, 0, sizeof(timing));
+    enterState(RC_RELAY_OFF);
+    return true;
+}
+
+void routerCycleLoop()
+{
+    HEAP_SCOPE("wd.routercycle");
+    unsigned long elapsed = millis() - stateStartMs;
+
+    switch (state)
+    {
+    case RC_IDLE:
+        return;
+
+    case RC_RELAY_OFF:
+        Serial.println(F("[ROUTER] Odcinam zasilanie"));
+        relayPowerOff();
+        ledSetPattern(PATTERN_RESETTING); // Miga do końca cyklu (potem stan ustawia watchdog)
+        enterState(RC_WAIT_OFF);
+        break;
+
+    case RC_WAIT_OFF:
+        if (elapsed >= config.routerOffTime)
+            enterState(RC_RELAY_ON);
+        break;
+
+    case RC_RELAY_ON:
+        Serial.println(F("[ROUTER] Przywracam zasilanie - rozruch"));
+        relayPowerOn();
+        memset(&timing, 0, sizeof(timing));
+        lastPollMs = 0;
+        pollHostIndex = 0;
+        enterState(RC_WAIT_BOOT);
+        break;
+
+    case RC_WAIT_BOOT:
+        // Aktywne odpytywanie - koniec rozruchu, gdy tylko internet odpowie
+        if (elapsed >= ROUTER_BOOT_POLL_MIN_MS && millis() - lastPollMs >= ROUTER_BOOT_POLL_INTERVAL_MS)
+        {
+            lastPollMs = millis();
+            if (pollBoot(elapsed))
+            {
+                enterState(RC_VERIFY);
+                break;
+            }
+        }
+        if (millis() - stateStartMs >= (unsigned long)config.baseBootTime)
+            enterState(RC_VERIFY);
+        break;
+
+    case RC_VERIFY:
+    {
+        logBootTiming();
+        // Router wstał od nowa - opóźnienia sprzed cyklu nie opisują nowego połączenia
+        rttStatsRestartShortWindows();
+        RouterCycleDoneFn fn = doneFn;
+        bool completed = !aborted;
+        state = RC_IDLE;
+        doneFn = nullptr;
+        if (fn)
+            fn(kind, completed); // Może zrestartować ESP
+        break;
+    }
+    }
+}
+
+bool routerCycleAbort()
+{
+    if (state == RC_IDLE)
+        return false;
+
+    Serial.println(F("[ROUTER] Cykl przerwany - przywracam zasilanie"));
+    relayPowerOn();
+    aborted = true;
+    enterState(RC_VERIFY);
+    return true;
+}
+
+bool routerCycleBusy()
+{
+    return state != RC_IDLE;
+}
+
+RouterCycleState routerCycleState()
+{
+    return state;
+}
+
+const char *routerCycleStateName(RouterCycleState s)
+{
+    switch (s)
+    {
+    case RC_IDLE:
+        return "bezczynny";
+    case RC_RELAY_OFF:
+        return "odcinanie zasilania";
+    case RC_WAIT_OFF:
+        return "router wyłączony";
+    case RC_RELAY_ON:
+        return "włączanie zasilania";
+    case RC_WAIT_BOOT:
+        return "rozruch routera";
+    case RC_VERIFY:
+        return "weryfikacja";
+    default:
+        return "?";
+    }
+}
+
+unsigned long routerCycleRemainingMs()
+{
+    unsigned long elapsed = millis() - stateStartMs;
+    unsigned long offMs = config.routerOffTime;
+    unsigned long bootMs = (unsigned long)config.baseBootTime;
+
+    switch (state)
+    {
+    case RC_RELAY_OFF:
+        return offMs + bootMs;
+    case RC_WAIT_OFF:
+        return (elapsed < offMs ? offMs - elapsed : 0) + bootMs;
+    case RC_RELAY_ON:
+        return bootMs;
+    case RC_WAIT_BOOT:
+        return elapsed < bootMs ? bootMs - elapsed : 0;
+    default:
+        return 0;
+    }
+}
+
+uint8_t routerCycleProgressPct()
+{
+    if (state == RC_IDLE)
+        return 0;
+    unsigned long total = config.routerOffTime + (unsigned long)config.baseBootTime;
+    if (total == 0 || state == RC_VERIFY)
+        return 100;
+    unsigned long remaining = routerCycleRemainingMs();
+    return (uint8_t)(100UL - (remaining >= total ? 100UL : remaining * 100UL / total));
+}
+
+bool routerCycleLastTiming(RouterBootTiming &out)
+{
+    if (lastTiming.magic != BOOT_TIMING_MAGIC)
+        return false;
+    out = lastTiming.timing;
+    return true;
+}
+
+const RouterBootTiming &routerCycleCurrentTiming()
+{
+    return timing;
+}
@@ -0,0 +1,98 @@
+#ifndef ROUTER_CYCLE_H
+#define ROUTER_CYCLE_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// CYKL ZASILANIA ROUTERA - MASZYNA STANÓW (BEZ BLOKOWANIA loop())
+// ============================================================================
+// RELAY_OFF -> WAIT_OFF -> RELAY_ON -> WAIT_BOOT -> VERIFY -> IDLE
+//
+// Każdy stan trwa tylko tyle, ile jedno wywołanie routerCycleLoop() - odliczanie
+// odbywa się na millis(), więc serwer WWW, mDNS, Serial i przycisk działają
+// przez cały reset. Cykl można przerwać (routerCycleAbort) - zasilanie routera
+// wraca natychmiast, a watchdog przechodzi w zwykły grace period.
+//
+// W WAIT_BOOT router jest aktywnie odpytywany: najpierw WiFi, potem brama,
+// potem internet (jedna próba na obieg, co ROUTER_BOOT_POLL_INTERVAL_MS;
+// hosty internetu na zmianę - jeden ping na obieg).
+// Potwierdzenie internetu kończy rozruch od razu; baseBootTime to już tylko
+// górny limit. Zmierzone czasy są zapisywane dla każdego resetu.
+
+/** @brief Odpytywanie zaczyna się po tym czasie od włączenia zasilania (stan WiFi bywa nieaktualny) */
+#define ROUTER_BOOT_POLL_MIN_MS 5000
+
+/** @brief Odstęp między kolejnymi próbami w trakcie rozruchu */
+#define ROUTER_BOOT_POLL_INTERVAL_MS 2000
+
+/** @brief Zmierzone czasy rozruchu routera (ms od przywrócenia zasilania; 0 = nie osiągnięto) */
+struct RouterBootTiming
+{
+    uint32_t wifiMs;
+    uint32_t gatewayMs;
+    uint32_t internetMs;
+    bool confirmed; // Internet potwierdzony przed upływem baseBootTime
+};
+
+enum RouterCycleState
+{
+    RC_IDLE = 0,
+    RC_RELAY_OFF, // Odcięcie zasilania routera
+    RC_WAIT_OFF,  // Router bez zasilania przez routerOffTime
+    RC_RELAY_ON,  // Przywrócenie zasilania
+    RC_WAIT_BOOT, // Rozruch routera przez baseBootTime
+    RC_VERIFY     // Zakończenie cyklu i przekazanie sterowania watchdogowi
+};
+
+enum RouterCycleKind
+{
+    RC_KIND_AUTO = 0, // Reset z watchdoga (po zakończeniu restart ESP)
+    RC_KIND_MANUAL    // Reset z przycisku WWW (bez restartu ESP)
+};
+
+/**
+ * @brief Wywoływana raz po zakończeniu cyklu
+ * @param completed true = cykl przeszedł wszystkie etapy, false = przerwany
+ */
+typedef void (*RouterCycleDoneFn)(RouterCycleKind kind, bool completed);
+
+/**
+ * @brief Rozpoczyna cykl zasilania routera
+ * @return false gdy cykl już trwa
+ */
+bool routerCycleStart(RouterCycleKind kind, RouterCycleDoneFn onDone);
+
+/** @brief Krok maszyny stanów - wywoływać w każdym obiegu loop() */
+void routerCycleLoop();
+
+/**
+ * @brief Przerywa cykl: przywraca zasilanie routera i kończy odliczanie
+ * @return false gdy nie było aktywnego cyklu
+ */
+bool routerCycleAbort();
+
+/** @brief Czy cykl trwa */
+bool routerCycleBusy();
+
+/** @brief Bieżący stan */
+RouterCycleState routerCycleState();
+
+/** @brief Nazwa stanu (do UI) */
+const char *routerCycleStateName(RouterCycleState state);
+
+/** @brief Postęp całego cyklu 0-100 % (wyłączenie + rozruch) */
+uint8_t routerCycleProgressPct();
+
+/** @brief Szacowany czas do końca cyklu (ms) */
+unsigned long routerCycleRemainingMs();
+
+/**
+ * @brief Czasy rozruchu z ostatniego zakończonego cyklu (przetrwają restart ESP)
+ * @return false gdy brak pomiaru
+ */
+bool routerCycleLastTiming(RouterBootTiming &out);
+
+/** @brief Postęp rozruchu w bieżącym cyklu (do UI) */
+const RouterBootTiming &routerCycleCurrentTiming();
+
+#endif // ROUTER_CYCLE_H
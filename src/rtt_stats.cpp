@@ -0,0 +1,243 @@
+#include "rtt_stats.h"
+
+// Górne granice przedziałów histogramu (ms). Ostatni przedział jest otwarty -
+// do interpolacji przyjmujemy jako górną granicę maksimum zaobserwowane w oknie.
+static const uint16_t RTT_BIN_UPPER[RTT_HIST_BINS] PROGMEM = {
+    5, 10, 15, 20, 30, 40, 60, 80, 120, 160, 250, 400, 650, 1000, 2000, 65535};
+
+struct RttSlot
+{
+    uint32_t id; // Numer slotu (sekundy pracy / długość slotu); 0 = pusty
+    uint16_t bins[RTT_HIST_BINS];
+    uint16_t lost;
+    uint16_t minMs;
+    uint16_t maxMs;
+};
+
+struct RttWindowDef
+{
+    uint8_t slotCount;
+    uint16_t slotSeconds;
+    uint8_t firstSlot; // Indeks pierwszego slotu w tablicy rttSlots
+};
+
+static const RttWindowDef RTT_WINDOWS[RTT_WIN_COUNT] = {
+    {4, 15, 0},    // 1 min
+    {5, 180, 4},   // 15 min
+    {24, 3600, 9}, // 24 h
+};
+
+static const uint8_t RTT_TOTAL_SLOTS = 4 + 5 + 24;
+
+static RttSlot rttSlots[RTT_TOTAL_SLOTS];
+static float ewmaMs = 0;
+static float jitterMs = 0;
+static int lastRttMs = -1;
+
+// Monotoniczny licznik sekund pracy (odporny na przepełnienie millis() po ~49 dniach)
+static uint32_t uptimeSeconds()
+{
+    static uint32_t seconds = 0;
+    static unsigned long lastMs = 0;
+    unsigned long now = millis();
+    unsigned long delta = now - lastMs;
+    if (delta >= 1000)
+    {
+        seconds += delta / 1000;
+        lastMs = now - (delta % 1000);
+    }
+    return seconds;
+}
+
+static uint8_t binForRtt(uint16_t rttMs)
+{
+    for (uint8_t i = 0; i < RTT_HIST_BINS - 1; i++)
+    {
+        if (rttMs < pgm_read_word(&RTT_BIN_UPPER[i]))
+            return i;
+    }
+    return RTT_HIST_BINS - 1;
+}
+
+// Zwraca slot bieżącego pod-okna; jeśli slot w pierścieniu jest nieaktualny - czyści go
+static RttSlot &currentSlot(const RttWindowDef &def, uint32_t now)
+{
+    uint32_t id = now / def.slotSeconds + 1; // +1: id 0 zarezerwowane dla pustego slotu
+    RttSlot &slot = rttSlots[def.firstSlot + (id % def.slotCount)];
+    if (slot.id != id)
+    {
+        memset(&slot, 0, sizeof(slot));
+        slot.id = id;
+        slot.minMs = 0xFFFF;
+    }
+    return slot;
+}
+
+void rttStatsRecord(int rttMs)
+{
+    if (rttMs < 0)
+        rttMs = 0;
+    uint16_t rtt = (rttMs > 0xFFFE) ? 0xFFFE : (uint16_t)rttMs;
+
+    // EWMA (alfa 1/8) i jitter wg RFC 3550
+    if (lastRttMs < 0)
+    {
+        ewmaMs = rtt;
+    }
+    else
+    {
+        ewmaMs += ((float)rtt - ewmaMs) / 8.0f;
+        float d = fabsf((float)rtt - (float)lastRttMs);
+        jitterMs += (d - jitterMs) / 16.0f;
+    }
+    lastRttMs = rtt;
+
+    uint8_t bin = binForRtt(rtt);
+    uint32_t now = uptimeSeconds();
+    for (uint8_t w = 0; w < RTT_WIN_COUNT; w++)
+    {
+        RttSlot &slot = currentSlot(RTT_WINDOWS[w], now);
+        if (slot.bins[bin] < 0xFFFF)
+            slot.bins[bin]++;
+        if (rtt < slot.minMs)
+            slot.minMs = rtt;
+        if (rtt > slot.maxMs)
+            slot.maxMs = rtt;
+    }
+}
+
+void rttStatsRecordLoss()
+{
+    uint32_t now = uptimeSeconds();
+    for (uint8_t w = 0; w < RTT_WIN_COUNT; w++)
+    {
+        RttSlot &slot = currentSlot(RTT_WINDOWS[w], now);
+        if (slot.lost < 0xFFFF)
+            slot.lost++;
+    }
+}
+
+// Kwantyl z histogramu: interpolacja liniowa wewnątrz przedziału,
+// przycięta do zaobserwowanego min/max (dokładniej przy małej liczbie próbek)
+static uint16_t quantileFromBins(const uint32_t *bins, uint32_t total, uint16_t minMs, uint16_t maxMs, uint8_t pct)
+{
+    if (total == 0)
+        return 0;
+
+    // Ranga liczona od 1; ułamek w przedziale daje płynne przejścia
+    float rank = (float)total * pct / 100.0f;
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < RTT_HIST_BINS; i++)
+    {
+        if (bins[i] == 0)
+            continue;
+        if (cumulative + bins[i] >= rank)
+        {
+            float lower = (i == 0) ? 0 : pgm_read_word(&RTT_BIN_UPPER[i - 1]);
+            float upper = (i == RTT_HIST_BINS - 1) ? maxMs : pgm_read_word(&RTT_BIN_UPPER[i]);
+            if (lower < minMs)
+                lower = minMs;
+            if (upper > maxMs)
+                upper = maxMs;
+            if (upper < lower)
+                upper = lower;
+            float frac = (rank - cumulative) / bins[i];
+            return (uint16_t)(lower + (upper - lower) * frac + 0.5f);
+        }
+        cumulative += bins[i];
+    }
+    return maxMs;
+}
+
+bool rttStatsSummary(RttWindow w, RttWindowSummary &out)
+{
+    memset(&out, 0, sizeof(out));
+    if (w >= RTT_WIN_COUNT)
+        return false;
+
+    const RttWindowDef &def = RTT_WINDOWS[w];
+    uint32_t currentId = uptimeSeconds() / def.slotSeconds + 1;
+
+    uint32_t bins[RTT_HIST_BINS] = {0};
+    uint16_t minMs = 0xFFFF;
+    uint16_t maxMs = 0;
+
+    for (uint8_t s = 0; s < def.slotCount; s++)
+    {
+        const RttSlot &slot = rttSlots[def.firstSlot + s];
+        // Tylko sloty należące do bieżącego okna (nie starsze niż slotCount pod-okien)
+        if (slot.id == 0 || currentId - slot.id >= def.slotCount)
+            continue;
+
+        for (uint8_t i = 0; i < RTT_HIST_BINS; i++)
+        {
+            bins[i] += slot.bins[i];
+            out.samples += slot.bins[i];
+        }
+        out.lost += slot.lost;
+        if (slot.minMs < minMs)
+            minMs = slot.minMs;
+        if (slot.maxMs > maxMs)
+            maxMs = slot.maxMs;
+    }
+
+    if (out.samples == 0)
+        return out.lost > 0;
+
+    out.minMs = minMs;
+    out.maxMs = maxMs;
+    out.p50 = quantileFromBins(bins, out.samples, minMs, maxMs, 50);
+    out.p95 = quantileFromBins(bins, out.samples, minMs, maxMs, 95);
+    out.p99 = quantileFromBins(bins, out.samples, minMs, maxMs, 99);
+    return true;
+}
+
+float rttStatsEwma()
+{
+    return ewmaMs;
+}
+
+float rttStatsJitter()
+{
+    return jitterMs;
+}
+
+bool rttStatsP95Exceeds(int thresholdMs, uint16_t *p95Out)
+{
+    RttWindowSummary s;
+    rttStatsSummary(RTT_WIN_15M, s);
+    if (p95Out)
+        *p95Out = s.p95;
+    if (s.samples < RTT_P95_MIN_SAMPLES)
+        return false;
+    return s.p95 > thresholdMs;
+}
+
+const char *rttWindowName(RttWindow w)
+{
+    switch (w)
+    {
+    case RTT_WIN_1M:
+        return "1m";
+    case RTT_WIN_15M:
+        return "15m";
+    case RTT_WIN_24H:
+        return "24h";
+    default:
+        return "?";
+    }
+}
+
+void rttStatsRestartShortWindows()
+{
+    // Okna 1 min i 15 min zajmują początek tablicy - do pierwszego slotu okna 24 h
+    memset(rttSlots, 0, RTT_WINDOWS[RTT_WIN_24H].firstSlot * sizeof(RttSlot));
+}
+
+void rttStatsReset()
+{
+    memset(rttSlots, 0, sizeof(rttSlots));
+    ewmaMs = 0;
+    jitterMs = 0;
+    lastRttMs = -1;
+}
@@ -0,0 +1,87 @@
+#ifndef RTT_STATS_H
+#define RTT_STATS_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// STATYSTYKI RTT (STRUMIENIOWE, STAŁA PAMIĘĆ)
+// ============================================================================
+// Każda próbka pingu trafia do histogramu o stałych (logarytmicznych) przedziałach.
+// Okna kroczące składają się z kilku pod-okien (slotów), więc stare dane
+// wypadają całymi slotami - bez przechowywania pojedynczych próbek.
+//
+// Okna:  1 min  = 4  sloty x 15 s
+//        15 min = 5  slotów x 3 min
+//        24 h   = 24 sloty x 1 h
+// Pamięć: ~33 sloty x 44 B ≈ 1.5 KB RAM (niezależnie od liczby próbek)
+
+/** @brief Liczba przedziałów histogramu RTT */
+#define RTT_HIST_BINS 16
+
+/** @brief Minimalna liczba próbek w oknie 15 min, aby P95 mógł potwierdzić lag */
+#define RTT_P95_MIN_SAMPLES 10
+
+enum RttWindow
+{
+    RTT_WIN_1M = 0,
+    RTT_WIN_15M,
+    RTT_WIN_24H,
+    RTT_WIN_COUNT
+};
+
+/** @brief Podsumowanie jednego okna (wartości w ms) */
+struct RttWindowSummary
+{
+    uint32_t samples; // Liczba udanych pingów
+    uint32_t lost;    // Liczba utraconych pingów
+    uint16_t minMs;
+    uint16_t maxMs;
+    uint16_t p50;
+    uint16_t p95;
+    uint16_t p99;
+};
+
+/**
+ * @brief Rejestruje udany ping (RTT w ms)
+ * Aktualizuje EWMA, jitter (RFC 3550) oraz histogramy wszystkich okien.
+ */
+void rttStatsRecord(int rttMs);
+
+/**
+ * @brief Rejestruje utracony ping (brak odpowiedzi żadnego hosta)
+ */
+void rttStatsRecordLoss();
+
+/**
+ * @brief Zwraca podsumowanie okna (próbki, straty, min/max, P50/P95/P99)
+ * @return false gdy okno nie zawiera żadnych danych
+ */
+bool rttStatsSummary(RttWindow w, RttWindowSummary &out);
+
+/** @brief Wygładzony RTT (EWMA, alfa = 1/8) w ms */
+float rttStatsEwma();
+
+/** @brief Jitter międzypakietowy wg RFC 3550 (J += (|D| - J) / 16) w ms */
+float rttStatsJitter();
+
+/**
+ * @brief Sprawdza czy P95 z okna 15 min przekracza próg
+ * Wymaga co najmniej RTT_P95_MIN_SAMPLES próbek - pojedynczy spike nie wystarczy.
+ * @param p95Out (opcjonalnie) bieżąca wartość P95
+ */
+bool rttStatsP95Exceeds(int thresholdMs, uint16_t *p95Out = nullptr);
+
+/** @brief Nazwa okna do UI/JSON ("1m", "15m", "24h") */
+const char *rttWindowName(RttWindow w);
+
+/**
+ * @brief Zaczyna ocenę lagu od zera - wywoływane po cyklu zasilania routera
+ * Czyści okna 1 min i 15 min (P95 sprzed resetu nie może oblać pierwszych pingów
+ * nowego połączenia); okno 24 h, EWMA i jitter zostają jako historia.
+ */
+void rttStatsRestartShortWindows();
+
+/** @brief Czyści wszystkie statystyki */
+void rttStatsReset();
+
+#endif // RTT_STATS_H
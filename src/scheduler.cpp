@@ -0,0 +1,255 @@
+#include "scheduler.h"
+#include "crash_log.h"
+
+struct SchedTask
+{
+    const char *name;
+    SchedTaskFn fn;
+    uint32_t periodMs;
+    uint32_t budgetUs;
+    unsigned long nextMs;
+    bool enabled;
+    bool wakeSet; // Zadanie samo ustawiło termin w trakcie wywołania
+    bool queued;  // Leży w kole czasowym
+    uint8_t slot;
+    int8_t nextInSlot; // Następne zadanie w tej samej przegródce (-1 = koniec listy)
+    uint32_t runs;
+    uint32_t overruns;
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint32_t totalUs; // Reszta poniżej 1 ms (pełne ms trafiają do totalMs)
+    uint32_t totalMs;
+    uint32_t lateMaxMs;
+    uint32_t lateTotalMs;
+};
+
+#define WHEEL_MASK (SCHED_WHEEL_SLOTS - 1)
+#define WHEEL_NONE (-1)
+
+static SchedTask tasks[SCHED_MAX_TASKS];
+static uint8_t taskCount = 0;
+static int8_t runningId = -1;
+
+static int8_t wheel[SCHED_WHEEL_SLOTS]; // Pierwsze zadanie każdej przegródki
+static unsigned long wheelCursor = 0;   // Pierwszy jeszcze nieodwiedzony ms
+
+static bool due(const SchedTask &t, unsigned long now)
+{
+    return (long)(now - t.nextMs) >= 0; // Odporne na przepełnienie millis()
+}
+
+static void wheelInsert(int8_t id)
+{
+    SchedTask &t = tasks[id];
+    // Termin już minął - przegródka kursora, inaczej czekałby pełny obrót koła
+    unsigned long at = due(t, wheelCursor) ? wheelCursor : t.nextMs;
+    t.slot = at & WHEEL_MASK;
+    t.nextInSlot = wheel[t.slot];
+    wheel[t.slot] = id;
+    t.queued = true;
+}
+
+static void wheelRemove(int8_t id)
+{
+    SchedTask &t = tasks[id];
+    if (!t.queued)
+        return;
+    for (int8_t *link = &wheel[t.slot]; *link != WHEEL_NONE; link = &tasks[*link].nextInSlot)
+    {
+        if (*link == id)
+        {
+            *link = t.nextInSlot;
+            break;
+        }
+    }
+    t.queued = false;
+}
+
+// Zmiana terminu; zadanie w trakcie wywołania wraca do koła dopiero po powrocie (runTask)
+static void reschedule(int8_t id, unsigned long nextMs)
+{
+    SchedTask &t = tasks[id];
+    t.nextMs = nextMs;
+    if (id == runningId)
+    {
+        t.wakeSet = true; // Nie nadpisuj okresem po powrocie z zadania
+        return;
+    }
+    wheelRemove(id);
+    if (t.enabled)
+        wheelInsert(id);
+}
+
+int8_t schedAdd(const char *name, SchedTaskFn fn, uint32_t periodMs, uint32_t budgetUs)
+{
+    if (taskCount >= SCHED_MAX_TASKS || !fn)
+        return -1;
+
+    if (taskCount == 0)
+    {
+        memset(wheel, WHEEL_NONE, sizeof(wheel));
+        wheelCursor = millis();
+    }
+
+    int8_t id = taskCount++;
+    SchedTask &t = tasks[id];
+    memset(&t, 0, sizeof(t));
+    t.name = name;
+    t.fn = fn;
+    t.periodMs = periodMs;
+    t.budgetUs = budgetUs;
+    t.nextMs = millis();
+    t.enabled = true;
+    wheelInsert(id);
+    return id;
+}
+
+void schedEnable(int8_t id, bool enabled)
+{
+    if (id < 0 || id >= taskCount || tasks[id].enabled == enabled)
+        return;
+    tasks[id].enabled = enabled;
+    if (enabled)
+        reschedule(id, millis());
+    else
+        wheelRemove(id);
+}
+
+void schedWakeIn(int8_t id, uint32_t delayMs)
+{
+    if (id < 0 || id >= taskCount)
+        return;
+    reschedule(id, millis() + delayMs);
+}
+
+static void runTask(int8_t id)
+{
+    SchedTask &t = tasks[id];
+    t.wakeSet = false;
+    uint32_t lateMs = millis() - t.nextMs; // Termin już minął (due)
+    runningId = id;
+    crashTaskBegin(t.name); // Przy awarii wiadomo, które zadanie pracowało
+    uint32_t startUs = micros();
+    t.fn();
+    uint32_t us = micros() - startUs;
+    crashTaskEnd();
+    runningId = -1;
+
+    t.runs++;
+    t.lateTotalMs += lateMs;
+    if (lateMs > t.lateMaxMs)
+        t.lateMaxMs = lateMs;
+    t.lastUs = us;
+    t.totalUs += us;
+    t.totalMs += t.totalUs / 1000;
+    t.totalUs %= 1000;
+    if (t.budgetUs && us > t.budgetUs)
+    {
+        t.overruns++;
+        // Log tylko przy nowym rekordzie - bez zalewania Serial przy stałym przekroczeniu
+        if (us > t.maxUs)
+            Serial.printf("[SCHED] %s: %lu us (budżet %lu us)\n", t.name, (unsigned long)us, (unsigned long)t.budgetUs);
+    }
+    if (us > t.maxUs)
+        t.maxUs = us;
+
+    if (!t.wakeSet)
+    {
+        // Okres liczony od planowanego terminu, a po dużym opóźnieniu - od teraz (bez serii nadrabiania)
+        t.nextMs += t.periodMs;
+        if (due(t, millis()))
+            t.nextMs = millis() + t.periodMs;
+    }
+    if (t.enabled)
+        wheelInsert(id);
+}
+
+uint32_t schedRun()
+{
+    // Przegródki od poprzedniego obiegu do teraz; po długiej przerwie wystarczy jeden obrót
+    unsigned long now = millis();
+    long behind = (long)(now - wheelCursor);
+    uint32_t visit = (behind < 0) ? 0 : (behind >= SCHED_WHEEL_SLOTS ? SCHED_WHEEL_SLOTS : behind + 1);
+    uint16_t ready = 0;
+    for (uint32_t k = 0; k < visit; k++)
+    {
+        int8_t *link = &wheel[(wheelCursor + k) & WHEEL_MASK];
+        while (*link != WHEEL_NONE)
+        {
+            SchedTask &t = tasks[*link];
+            if (!due(t, now))
+            {
+                link = &t.nextInSlot; // Termin w kolejnym obrocie
+                continue;
+            }
+            ready |= 1U << *link;
+            t.queued = false;
+            *link = t.nextInSlot;
+        }
+    }
+    if (behind >= 0)
+        wheelCursor = now + 1;
+
+    // Kolejność rejestracji = priorytet. Zadanie wyłączone albo przesunięte przez
+    // wcześniejsze zadanie w tym obiegu już nie jest gotowe.
+    for (int8_t i = 0; i < taskCount; i++)
+    {
+        if ((ready & (1U << i)) && tasks[i].enabled && !tasks[i].queued)
+            runTask(i);
+    }
+
+    // Czas do najbliższego terminu: przegródki do teraz (zadania mogły trwać) i kolejne SCHED_MAX_IDLE_MS
+    now = millis();
+    behind = (long)(now - wheelCursor);
+    uint32_t scan = SCHED_MAX_IDLE_MS + (behind < 0 ? 0 : behind + 1);
+    if (scan > SCHED_WHEEL_SLOTS)
+        scan = SCHED_WHEEL_SLOTS;
+    uint32_t idle = SCHED_MAX_IDLE_MS;
+    for (uint32_t k = 0; k < scan; k++)
+    {
+        for (int8_t id = wheel[(wheelCursor + k) & WHEEL_MASK]; id != WHEEL_NONE; id = tasks[id].nextInSlot)
+        {
+            long left = (long)(tasks[id].nextMs - now);
+            if (left <= 0)
+                return 0;
+            if ((uint32_t)left < idle)
+                idle = left;
+        }
+    }
+    return idle;
+}
+
+uint8_t schedCount()
+{
+    return taskCount;
+}
+
+bool schedStats(uint8_t id, SchedTaskStats &out)
+{
+    if (id >= taskCount)
+        return false;
+    const SchedTask &t = tasks[id];
+    out.name = t.name;
+    out.periodMs = t.periodMs;
+    out.budgetUs = t.budgetUs;
+    out.runs = t.runs;
+    out.overruns = t.overruns;
+    out.lastUs = t.lastUs;
+    out.maxUs = t.maxUs;
+    out.totalMs = t.totalMs;
+    out.lateMaxMs = t.lateMaxMs;
+    out.lateTotalMs = t.lateTotalMs;
+    out.enabled = t.enabled;
+    return true;
+}
+
+void schedResetStats()
+{
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        SchedTask &t = tasks[i];
+        t.runs = t.overruns = 0;
+        t.lastUs = t.maxUs = t.totalUs = t.totalMs = 0;
+        t.lateMaxMs = t.lateTotalMs = 0;
+    }
+}
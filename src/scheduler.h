@@ -0,0 +1,87 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// KOOPERACYJNY HARMONOGRAM ZADAŃ DLA loop()
+// ============================================================================
+// Każde zadanie ma okres (co ile uruchamiać) i budżet czasu wykonania (µs).
+// schedRun() uruchamia zadania, których termin minął, mierzy czas każdego
+// wywołania i liczy przekroczenia budżetu. Zwraca czas do najbliższego terminu,
+// dzięki czemu loop() może oddać procesor (delay -> yield + modem sleep SDK)
+// zamiast kręcić się w pustej pętli.
+//
+// Zadanie może przesunąć swój termin (schedWakeIn) - np. gdy wie, że przez
+// najbliższe sekundy nie ma nic do zrobienia, albo wymusić szybsze wybudzenie.
+// Terminy typu "za 10 minut" (następny ping, kolejna próba wyjścia z AP, koniec
+// backoffu) są więc zaplanowanym wybudzeniem zadania, a nie sprawdzaniem millis()
+// w każdym obiegu.
+//
+// Terminy trzyma koło czasowe: SCHED_WHEEL_SLOTS przegródek po 1 ms, zadanie
+// leży w przegródce (termin mod liczba przegródek). schedRun() odwiedza tylko
+// przegródki od poprzedniego obiegu, a czas bezczynności wynika z najbliższych
+// SCHED_MAX_IDLE_MS przegródek. Terminy dalsze niż jeden obrót czekają kolejne
+// obroty - przy odwiedzeniu przegródki porównywany jest pełny termin.
+//
+// Opóźnienie startu (termin -> faktyczne uruchomienie) mówi, ile zadanie
+// czekało na inne - np. jak długo obsługa żądania HTTP wstrzymała decyzje
+// watchdoga (zadania "ping" i "mode"). To główna miara pod obciążeniem serwera WWW.
+
+/** @brief Maksymalna liczba zadań (najwyżej 16 - maska gotowych zadań w schedRun()) */
+#define SCHED_MAX_TASKS 16
+
+/** @brief Liczba przegródek koła czasowego (1 ms każda, potęga 2, więcej niż SCHED_MAX_IDLE_MS) */
+#define SCHED_WHEEL_SLOTS 32
+
+/** @brief Maksymalny czas oddania procesora w jednym obiegu loop() (ms) */
+#define SCHED_MAX_IDLE_MS 10
+
+typedef void (*SchedTaskFn)();
+
+struct SchedTaskStats
+{
+    const char *name;
+    uint32_t periodMs;
+    uint32_t budgetUs;
+    uint32_t runs;
+    uint32_t overruns; // Wywołania dłuższe niż budżet
+    uint32_t lastUs;
+    uint32_t maxUs;
+    uint32_t totalMs; // Łączny czas wykonania (ms)
+    uint32_t lateMaxMs;   // Największe opóźnienie startu względem terminu
+    uint32_t lateTotalMs; // Suma opóźnień (średnia = lateTotalMs / runs)
+    bool enabled;
+};
+
+/**
+ * @brief Rejestruje zadanie (pierwsze uruchomienie w najbliższym obiegu)
+ * @param name nazwa (literał - nie jest kopiowana)
+ * @param periodMs okres; 0 = w każdym obiegu
+ * @param budgetUs budżet czasu jednego wywołania; 0 = bez kontroli
+ * @return identyfikator zadania lub -1 gdy brak miejsca
+ */
+int8_t schedAdd(const char *name, SchedTaskFn fn, uint32_t periodMs, uint32_t budgetUs);
+
+/** @brief Włącza/wyłącza zadanie (włączone rusza w najbliższym obiegu; wyłączone nie ma terminu) */
+void schedEnable(int8_t id, bool enabled);
+
+/** @brief Ustawia najbliższy termin zadania na teraz + delayMs (także z wnętrza zadania) */
+void schedWakeIn(int8_t id, uint32_t delayMs);
+
+/**
+ * @brief Uruchamia zadania, których termin minął
+ * @return czas do najbliższego terminu (ms), najwyżej SCHED_MAX_IDLE_MS
+ */
+uint32_t schedRun();
+
+/** @brief Liczba zarejestrowanych zadań */
+uint8_t schedCount();
+
+/** @brief Statystyki zadania; false gdy id spoza zakresu */
+bool schedStats(uint8_t id, SchedTaskStats &out);
+
+/** @brief Zeruje liczniki zadań (okresy i terminy bez zmian) */
+void schedResetStats();
+
+#endif // SCHEDULER_H
@@ -0,0 +1,125 @@
+#include "session_store.h"
+
+struct SessionSlot
+{
+    char token[SESSION_TOKEN_LENGTH + 1];
+    uint32_t lastActivityMs;
+    bool used;
+};
+
+static SessionSlot slots[SESSION_MAX];
+
+static bool expired(const SessionSlot &s, uint32_t nowMs)
+{
+    return nowMs - s.lastActivityMs > SESSION_TIMEOUT_MS; // Odporne na przepełnienie millis()
+}
+
+// Pozycja w tablicy z pierwszego znaku tokenu ('0'..)
+static int8_t slotOf(const char *token)
+{
+    if (!token || strnlen(token, SESSION_TOKEN_LENGTH + 1) != SESSION_TOKEN_LENGTH)
+        return -1;
+    uint8_t i = (uint8_t)(token[0] - '0');
+    return i < SESSION_MAX ? i : -1;
+}
+
+// Porównanie na pełnej długości - bez wczesnego wyjścia przy pierwszej różnicy
+static bool tokenEquals(const char *a, const char *b)
+{
+    uint8_t diff = 0;
+    for (uint8_t i = 0; i < SESSION_TOKEN_LENGTH; i++)
+        diff |= (uint8_t)a[i] ^ (uint8_t)b[i];
+    return diff == 0;
+}
+
+bool sessionTokenFromCookie(const char *cookieHeader, char *out, size_t outSize)
+{
+    const size_t nameLen = sizeof(COOKIE_NAME) - 1;
+    if (!cookieHeader || outSize < SESSION_TOKEN_LENGTH + 1)
+        return false;
+
+    const char *p = cookieHeader;
+    while (*p)
+    {
+        while (*p == ' ' || *p == ';')
+            p++;
+        const char *end = strchr(p, ';');
+        size_t len = end ? (size_t)(end - p) : strlen(p);
+        if (len == nameLen + 1 + SESSION_TOKEN_LENGTH && strncmp(p, COOKIE_NAME, nameLen) == 0 && p[nameLen] == '=')
+        {
+            memcpy(out, p + nameLen + 1, SESSION_TOKEN_LENGTH);
+            out[SESSION_TOKEN_LENGTH] = '\0';
+            return true;
+        }
+        p += len;
+    }
+    return false;
+}
+
+const char *sessionCreate(uint32_t nowMs)
+{
+    // Wolne lub wygasłe miejsce, a w ostateczności najdawniej używane
+    uint8_t pick = 0;
+    uint32_t oldestAge = 0;
+    for (uint8_t i = 0; i < SESSION_MAX; i++)
+    {
+        if (!slots[i].used || expired(slots[i], nowMs))
+        {
+            pick = i;
+            break;
+        }
+        uint32_t age = nowMs - slots[i].lastActivityMs;
+        if (age >= oldestAge)
+        {
+            oldestAge = age;
+            pick = i;
+        }
+    }
+
+    static const char alphanum[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    SessionSlot &s = slots[pick];
+    s.token[0] = '0' + pick;
+    for (uint8_t i = 1; i < SESSION_TOKEN_LENGTH; i++)
+        s.token[i] = alphanum[ESP.random() % 62]; // Sprzętowy generator liczb losowych
+    s.token[SESSION_TOKEN_LENGTH] = '\0';
+    s.lastActivityMs = nowMs;
+    s.used = true;
+    return s.token;
+}
+
+SessionCheck sessionCheck(const char *token, uint32_t nowMs)
+{
+    int8_t i = slotOf(token);
+    if (i < 0 || !slots[i].used || !tokenEquals(slots[i].token, token))
+        return SESSION_NONE;
+    if (expired(slots[i], nowMs))
+    {
+        slots[i].used = false;
+        return SESSION_EXPIRED;
+    }
+    slots[i].lastActivityMs = nowMs;
+    return SESSION_VALID;
+}
+
+void sessionEnd(const char *token)
+{
+    int8_t i = slotOf(token);
+    if (i >= 0 && slots[i].used && tokenEquals(slots[i].token, token))
+        slots[i].used = false;
+}
+
+uint8_t sessionActiveCount(uint32_t nowMs)
+{
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < SESSION_MAX; i++)
+    {
+        if (slots[i].used && !expired(slots[i], nowMs))
+            n++;
+    }
+    return n;
+}
+
+void sessionClearAll()
+{
+    memset(slots, 0, sizeof(slots));
+}
@@ -0,0 +1,54 @@
+#ifndef SESSION_STORE_H
+#define SESSION_STORE_H
+
+#include <Arduino.h>
+#include "constants.h"
+
+// ============================================================================
+// SESJE PANELU (STAŁA TABLICA, BEZ ALOKACJI)
+// ============================================================================
+// Kilka jednoczesnych sesji - zalogowanie drugiej osoby nie wylogowuje
+// pierwszej. Każda sesja wygasa osobno po SESSION_TIMEOUT_MS bezczynności;
+// gdy brak wolnego miejsca, nowa sesja zastępuje najdawniej używaną (LRU).
+//
+// Pierwszy znak tokenu to numer miejsca w tablicy - sprawdzenie żądania
+// porównuje tylko jedną pozycję, zawsze na pełnej długości tokenu
+// (czas porównania nie zależy od liczby zgodnych znaków).
+
+/** @brief Liczba jednoczesnych sesji */
+#define SESSION_MAX 4
+
+/** @brief Wynik sprawdzenia tokenu */
+enum SessionCheck
+{
+    SESSION_NONE = 0, // Brak tokenu lub nieznany token
+    SESSION_VALID,    // Sesja ważna (czas aktywności odświeżony)
+    SESSION_EXPIRED   // Sesja wygasła - miejsce zwolnione
+};
+
+/**
+ * @brief Wyciąga token z nagłówka Cookie (ciasteczko COOKIE_NAME)
+ * @param out bufor co najmniej SESSION_TOKEN_LENGTH + 1
+ * @return false gdy brak ciasteczka lub wartość ma złą długość
+ */
+bool sessionTokenFromCookie(const char *cookieHeader, char *out, size_t outSize);
+
+/**
+ * @brief Tworzy sesję (zajmuje wolne, wygasłe lub najdawniej używane miejsce)
+ * @return token (ważny do zakończenia lub zastąpienia sesji)
+ */
+const char *sessionCreate(uint32_t nowMs);
+
+/** @brief Sprawdza token; ważna sesja ma odświeżony czas aktywności */
+SessionCheck sessionCheck(const char *token, uint32_t nowMs);
+
+/** @brief Kończy sesję o danym tokenie (wylogowanie) */
+void sessionEnd(const char *token);
+
+/** @brief Liczba sesji, które jeszcze nie wygasły */
+uint8_t sessionActiveCount(uint32_t nowMs);
+
+/** @brief Usuwa wszystkie sesje */
+void sessionClearAll();
+
+#endif // SESSION_STORE_H
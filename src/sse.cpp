@@ -0,0 +1,281 @@
+#include "sse.h"
+#include "diag.h"
+
+struct SseClient
+{
+    WiFiClient conn;
+    String queue;             // Zdarzenia czekające na miejsce w buforze nadawczym
+    size_t offset;            // Ile bajtów kolejki już trafiło do gniazda
+    unsigned long progressMs; // Ostatni postęp wysyłki (albo chwila, gdy kolejka była pusta)
+    bool needFull;            // Nowy subskrybent - najbliższa migawka w całości
+};
+
+// Skrót pola najwyższego poziomu z ostatniej opublikowanej migawki (baza dla "delta")
+struct SnapshotKey
+{
+    char name[16];
+    uint32_t hash;
+    bool seen;
+};
+
+static SseClient clients[SSE_MAX_CLIENTS];
+static SnapshotKey snapshotKeys[SSE_SNAPSHOT_KEYS_MAX];
+static uint8_t snapshotKeyCount = 0;
+static bool dirty = true;
+static unsigned long lastSnapshotMs = 0;
+static uint32_t publishedCount = 0;
+static uint32_t rejectedCount = 0;
+static uint32_t droppedCount = 0;
+
+// FNV-1a liczony w trakcie serializacji pola - bez bufora na jego tekst
+class HashPrint : public Print
+{
+public:
+    uint32_t hash = 2166136261UL;
+    size_t write(uint8_t c) override
+    {
+        hash = (hash ^ c) * 16777619UL;
+        return 1;
+    }
+};
+
+static void dropClient(uint8_t i)
+{
+    SseClient &c = clients[i];
+    c.conn.stop();
+    c.conn = WiFiClient();
+    c.queue = String(); // Zwolnij bufor kolejki
+    c.offset = 0;
+    c.needFull = false;
+}
+
+// Wysyła z kolejki tyle, ile mieści się w buforze nadawczym; false = subskrybent rozłączony
+static bool flushClient(uint8_t i, unsigned long now)
+{
+    SseClient &c = clients[i];
+    size_t pending = c.queue.length() - c.offset;
+    if (pending == 0)
+    {
+        c.progressMs = now;
+        return true;
+    }
+
+    size_t room = c.conn.availableForWrite();
+    if (room > 0)
+    {
+        size_t n = c.conn.write((const uint8_t *)c.queue.c_str() + c.offset, room < pending ? room : pending);
+        if (n > 0)
+        {
+            c.offset += n;
+            c.progressMs = now;
+        }
+        if (c.offset >= c.queue.length())
+        {
+            c.queue = String();
+            c.offset = 0;
+            return true;
+        }
+    }
+
+    if (now - c.progressMs >= SSE_STALL_MS)
+    {
+        DIAG_PRINTF("[SSE] Subskrybent %u bez postępu od %lu ms - rozłączam\n", i, now - c.progressMs);
+        dropClient(i);
+        droppedCount++;
+        return false;
+    }
+    return true;
+}
+
+static void enqueue(uint8_t i, const char *event, const char *data)
+{
+    SseClient &c = clients[i];
+    size_t add = strlen(event) + strlen(data) + 16;
+    if (c.queue.length() - c.offset + add > SSE_QUEUE_MAX)
+    {
+        // Zdarzenia "delta" nie można pominąć - klient bez nich ma zły stan
+        DIAG_PRINTF("[SSE] Subskrybent %u: kolejka pełna - rozłączam\n", i);
+        dropClient(i);
+        droppedCount++;
+        return;
+    }
+
+    // Wysłany początek kolejki nie jest już potrzebny
+    if (c.offset > 0)
+    {
+        c.queue.remove(0, c.offset);
+        c.offset = 0;
+    }
+    c.queue.reserve(c.queue.length() + add);
+    c.queue += F("event: ");
+    c.queue += event;
+    c.queue += F("\ndata: ");
+    c.queue += data;
+    c.queue += F("\n\n");
+    flushClient(i, millis());
+}
+
+static SnapshotKey *findSnapshotKey(const char *name)
+{
+    for (uint8_t k = 0; k < snapshotKeyCount; k++)
+    {
+        if (strcmp(snapshotKeys[k].name, name) == 0)
+            return &snapshotKeys[k];
+    }
+    if (snapshotKeyCount >= SSE_SNAPSHOT_KEYS_MAX || strlen(name) >= sizeof(snapshotKeys[0].name))
+        return nullptr; // Pole bez śledzenia - zawsze w "delta"
+    SnapshotKey &entry = snapshotKeys[snapshotKeyCount++];
+    strcpy(entry.name, name);
+    entry.hash = 0; // Nowe pole - różni się od każdej migawki
+    return &entry;
+}
+
+// Zmienione pola względem poprzedniej migawki; pola, które zniknęły, jako null
+static void buildDelta(JsonDocument &doc, JsonDocument &delta)
+{
+    for (uint8_t k = 0; k < snapshotKeyCount; k++)
+        snapshotKeys[k].seen = false;
+
+    for (JsonPair kv : doc.as<JsonObject>())
+    {
+        HashPrint h;
+        serializeJson(kv.value(), h);
+        SnapshotKey *entry = findSnapshotKey(kv.key().c_str());
+        if (!entry || entry->hash != h.hash)
+            delta[kv.key()] = kv.value();
+        if (entry)
+        {
+            entry->hash = h.hash;
+            entry->seen = true;
+        }
+    }
+
+    for (uint8_t k = 0; k < snapshotKeyCount;)
+    {
+        if (snapshotKeys[k].seen)
+        {
+            k++;
+            continue;
+        }
+        delta[snapshotKeys[k].name] = nullptr;
+        snapshotKeys[k] = snapshotKeys[--snapshotKeyCount];
+    }
+}
+
+bool sseAccept(WiFiClient &client)
+{
+    sseLoop(); // Zwolnij miejsca po zamkniętych kartach
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++)
+    {
+        SseClient &c = clients[i];
+        if (c.conn.connected())
+            continue;
+        c.conn = client; // Kopia trzyma połączenie po powrocie z handlera
+        c.conn.setNoDelay(true);
+        c.queue = String();
+        c.offset = 0;
+        c.progressMs = millis();
+        c.needFull = true;
+        c.conn.print(F("HTTP/1.1 200 OK\r\n"
+                       "Content-Type: text/event-stream\r\n"
+                       "Cache-Control: no-cache\r\n"
+                       "Connection: keep-alive\r\n\r\n"));
+        c.conn.print(F("retry: "));
+        c.conn.print(SSE_RETRY_MS);
+        c.conn.print(F("\n\n"));
+        DIAG_PRINTF("[SSE] Subskrybent %u: %s\n", i, client.remoteIP().toString().c_str());
+        return true;
+    }
+    rejectedCount++;
+    return false;
+}
+
+void ssePublish(const char *event, const char *data)
+{
+    if (sseClientCount() == 0)
+        return;
+
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++)
+    {
+        if (clients[i].conn.connected())
+            enqueue(i, event, data);
+    }
+    publishedCount++;
+}
+
+void ssePublishSnapshot(JsonDocument &doc)
+{
+    if (sseClientCount() == 0)
+        return;
+
+    // Baza "delta" przesuwa się przy każdej migawce - także gdy ktoś dostaje całość
+    JsonDocument delta;
+    buildDelta(doc, delta);
+    String part;
+    serializeJson(delta, part);
+
+    String full; // Tylko gdy jest nowy subskrybent
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++)
+    {
+        SseClient &c = clients[i];
+        if (!c.conn.connected())
+            continue;
+        if (!c.needFull)
+        {
+            enqueue(i, "delta", part.c_str());
+            continue;
+        }
+        if (full.length() == 0)
+            serializeJson(doc, full);
+        c.needFull = false;
+        enqueue(i, "status", full.c_str());
+    }
+    publishedCount++;
+}
+
+void sseMarkDirty()
+{
+    dirty = true;
+}
+
+bool sseSnapshotDue()
+{
+    unsigned long now = millis();
+    if (now - lastSnapshotMs < SSE_MIN_INTERVAL_MS)
+        return false;
+    if (!dirty && now - lastSnapshotMs < SSE_KEEPALIVE_MS)
+        return false;
+    dirty = false;
+    lastSnapshotMs = now;
+    return true;
+}
+
+void sseLoop()
+{
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++)
+    {
+        if (!clients[i].conn.connected())
+            dropClient(i); // Zwalnia referencję do zamkniętego połączenia
+        else
+            flushClient(i, now);
+    }
+}
+
+uint8_t sseClientCount()
+{
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < SSE_MAX_CLIENTS; i++)
+    {
+        if (clients[i].conn.connected())
+            n++;
+    }
+    return n;
+}
+
+void sseCounters(uint32_t &published, uint32_t &rejected, uint32_t &dropped)
+{
+    published = publishedCount;
+    rejected = rejectedCount;
+    dropped = droppedCount;
+}
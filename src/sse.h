@@ -0,0 +1,85 @@
+#ifndef SSE_H
+#define SSE_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <ArduinoJson.h>
+
+// ============================================================================
+// POWIADOMIENIA NA ŻYWO (SERVER-SENT EVENTS)
+// ============================================================================
+// Przeglądarka otwiera GET /api/events (EventSource) i trzyma połączenie.
+// Zdarzenie jest formatowane raz i rozsyłane do wszystkich subskrybentów -
+// koszt nie rośnie z liczbą otwartych kart tak jak przy odpytywaniu.
+//
+// Moduły zgłaszają zmianę stanu przez sseMarkDirty() (tanie - tylko flaga);
+// migawkę stanu buduje i publikuje zadanie strony WWW, najwyżej raz na
+// SSE_MIN_INTERVAL_MS, więc seria zmian daje jedno zdarzenie.
+//
+// Migawka stanu idzie w całości ("status") tylko do nowego subskrybenta; pozostali
+// dostają "delta" - same zmienione pola najwyższego poziomu (usunięte jako null).
+// Zwykle to kilkaset bajtów, wyraźnie poniżej bufora nadawczego lwIP (TCP_SND_BUF,
+// 1072 B), więc zdarzenie mieści się nawet obok niepotwierdzonej poprzedniej porcji.
+//
+// Każdy subskrybent ma własną kolejkę: do gniazda trafia tyle, ile się mieści
+// (availableForWrite), reszta w kolejnych obiegach - bez czekania na ACK w pętli.
+// Rozłączany jest dopiero subskrybent bez postępu przez SSE_STALL_MS (uśpiony
+// telefon, zerwane łącze) albo z kolejką ponad SSE_QUEUE_MAX.
+//
+// Limit SSE_MAX_CLIENTS: lwIP ma domyślnie 5 gniazd TCP na wszystko, więc
+// część musi zostać dla zwykłych żądań. Klient ponad limit dostaje 503 i
+// przechodzi na odpytywanie.
+
+/** @brief Maksymalna liczba jednoczesnych subskrybentów */
+#define SSE_MAX_CLIENTS 3
+
+/** @brief Najkrótszy odstęp między migawkami stanu (ms) */
+#define SSE_MIN_INTERVAL_MS 250
+
+/** @brief Migawka wysyłana co najmniej tak często (keep-alive, ms) */
+#define SSE_KEEPALIVE_MS 15000
+
+/** @brief Odstęp ponownego połączenia podawany przeglądarce (ms) */
+#define SSE_RETRY_MS 5000
+
+/** @brief Subskrybent z zaległymi danymi bez postępu przez ten czas jest rozłączany (ms) */
+#define SSE_STALL_MS 8000
+
+/** @brief Największa kolejka zaległych danych jednego subskrybenta (B) */
+#define SSE_QUEUE_MAX 2048
+
+/** @brief Liczba pól najwyższego poziomu migawki śledzonych dla zdarzeń "delta" */
+#define SSE_SNAPSHOT_KEYS_MAX 24
+
+/**
+ * @brief Przyjmuje subskrybenta - wysyła nagłówki text/event-stream
+ * @return false gdy osiągnięto limit (odpowiedź wysyła wywołujący)
+ */
+bool sseAccept(WiFiClient &client);
+
+/** @brief Wysyła zdarzenie do wszystkich subskrybentów (data bez znaków nowej linii) */
+void ssePublish(const char *event, const char *data);
+
+/**
+ * @brief Publikuje migawkę stanu (obiekt JSON)
+ * Nowi subskrybenci dostają zdarzenie "status" z całością, pozostali "delta"
+ * ze zmienionymi polami najwyższego poziomu (pole usunięte = null).
+ */
+void ssePublishSnapshot(JsonDocument &doc);
+
+/** @brief Zgłasza zmianę stanu - migawka zostanie opublikowana */
+void sseMarkDirty();
+
+/** @brief Czy czas opublikować migawkę (zmiana lub keep-alive); zeruje flagę */
+bool sseSnapshotDue();
+
+/** @brief Dosyła zaległe dane i usuwa rozłączonych lub stojących subskrybentów */
+void sseLoop();
+
+/** @brief Liczba aktywnych subskrybentów */
+uint8_t sseClientCount();
+
+/** @brief Liczniki: opublikowane zdarzenia, odrzucone (limit), rozłączone (wolni klienci) */
+void sseCounters(uint32_t &published, uint32_t &rejected, uint32_t &dropped);
+
+#endif // SSE_H
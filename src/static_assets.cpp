@@ -0,0 +1,1462 @@
+// Wygenerowano przez scripts/gzip_assets.py z plików web/ - nie edytować ręcznie
+#include "static_assets.h"
+
+const uint8_t STATIC_APP_CSS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x1a, 0x6b, 0x6f, 0xdb, 0x36,
+    0xf0, 0x7b, 0x7f, 0x85, 0xb6, 0x61, 0x58, 0xbc, 0x55, 0xae, 0x9e, 0xb6, 0xe3, 0x62, 0xc0, 0xf6,
+    0x2f, 0x36, 0x0c, 0xfb, 0x40, 0x89, 0x94, 0xcd, 0x45, 0x96, 0x0c, 0x89, 0x8e, 0x93, 0x15, 0xf9,
+    0xef, 0x3b, 0x3e, 0x45, 0x52, 0x94, 0xdd, 0x14, 0x58, 0x05, 0x14, 0x32, 0x79, 0xbc, 0xf7, 0x1d,
+    0xef, 0x4e, 0xd9, 0x0f, 0x7d, 0xcf, 0xa2, 0x2f, 0x1f, 0x22, 0xf8, 0x17, 0xc7, 0xd5, 0x61, 0x1f,
+    0xfd, 0xd0, 0x14, 0xfc, 0xf9, 0xac, 0x96, 0x1a, 0xbe, 0x94, 0xe7, 0xb9, 0xfe, 0x5d, 0xa3, 0x01,
+    0x73, 0xa0, 0xa6, 0xd1, 0x2b, 0x15, 0xeb, 0x60, 0x21, 0x49, 0xb6, 0x95, 0xb3, 0x16, 0x1f, 0xfb,
+    0x67, 0x32, 0x88, 0x9d, 0x72, 0x53, 0x99, 0xf3, 0xb4, 0x3b, 0x7b, 0xc7, 0x05, 0xbe, 0xba, 0xae,
+    0xf5, 0xc2, 0x78, 0xa9, 0x6b, 0x32, 0x8e, 0x92, 0x19, 0x5c, 0x10, 0x8c, 0x91, 0xbf, 0x25, 0x98,
+    0x4a, 0xcb, 0x72, 0x9b, 0x15, 0xb3, 0x53, 0xfd, 0x80, 0x05, 0xd9, 0x3a, 0x27, 0x9b, 0xba, 0xd2,
+    0xdb, 0x18, 0x75, 0x07, 0x32, 0x28, 0x01, 0x77, 0x78, 0x3b, 0xe1, 0x54, 0x3b, 0x02, 0xe5, 0x36,
+    0x4b, 0xeb, 0x09, 0xa5, 0x3e, 0xa3, 0x31, 0x36, 0x65, 0x6d, 0x63, 0xec, 0x59, 0x7c, 0x18, 0x08,
+    0xe1, 0xc2, 0x67, 0x3b, 0xb4, 0x2d, 0x4a, 0x7b, 0x67, 0x20, 0x5c, 0x2a, 0x5c, 0xe7, 0xa5, 0xbb,
+    0x5e, 0xb5, 0x17, 0x62, 0x69, 0xeb, 0xed, 0xc3, 0x5f, 0x18, 0x31, 0x14, 0xb3, 0x23, 0x39, 0x91,
+    0x5f, 0x7f, 0xc2, 0x68, 0x78, 0xfa, 0xe9, 0x6f, 0xd7, 0x1c, 0x29, 0xe2, 0x8f, 0x63, 0x0e, 0x92,
+    0xf0, 0xc7, 0xb3, 0x48, 0x86, 0xf9, 0xe3, 0x19, 0x05, 0x6f, 0x48, 0x83, 0x83, 0x46, 0x41, 0xe5,
+    0xae, 0x46, 0xae, 0x51, 0x72, 0xc4, 0x1f, 0xd7, 0x2e, 0x45, 0x51, 0x04, 0xed, 0x92, 0xe5, 0x45,
+    0x92, 0xd5, 0x41, 0xbb, 0x54, 0x19, 0x28, 0xbe, 0x5c, 0xb4, 0x4b, 0x06, 0x6a, 0xcc, 0x83, 0x76,
+    0xc9, 0xeb, 0xb4, 0xc9, 0xf2, 0x90, 0x5d, 0x9a, 0xac, 0xda, 0x55, 0x64, 0xc9, 0x2e, 0x25, 0xca,
+    0x50, 0x9e, 0x86, 0xec, 0x52, 0xd6, 0xb8, 0xd8, 0x35, 0x73, 0xbb, 0x34, 0xc9, 0x2e, 0xdf, 0xe5,
+    0x01, 0xbb, 0x6c, 0x70, 0x95, 0x4b, 0xbb, 0x54, 0x3d, 0x7e, 0x55, 0x86, 0x68, 0xfa, 0x8e, 0xc5,
+    0x0d, 0x3a, 0xd1, 0xf6, 0x75, 0x1f, 0xfd, 0x3e, 0x50, 0xd4, 0x7e, 0x8c, 0x46, 0xd4, 0x8d, 0xf1,
+    0x48, 0x06, 0xaa, 0xb0, 0x9f, 0xd0, 0x70, 0xa0, 0x40, 0x32, 0x4b, 0xce, 0x2f, 0x72, 0xa5, 0x42,
+    0xf5, 0xd3, 0x61, 0xe8, 0x2f, 0x1d, 0x8e, 0xeb, 0xbe, 0xed, 0x81, 0xd1, 0x67, 0x34, 0x3c, 0x70,
+    0xa3, 0xae, 0x24, 0x80, 0xb3, 0xda, 0xe8, 0x55, 0x36, 0x00, 0x66, 0xca, 0x68, 0x0f, 0xc8, 0x26,
+    0x14, 0x51, 0xb2, 0xce, 0xc7, 0x8f, 0xf2, 0x88, 0x78, 0xe7, 0x2c, 0xae, 0x6b, 0x60, 0x0c, 0xd1,
+    0x8e, 0x0c, 0x8a, 0xd1, 0x13, 0x7a, 0x89, 0xaf, 0x14, 0xb3, 0xe3, 0x3e, 0xda, 0x25, 0x86, 0x11,
+    0xcd, 0x1a, 0xba, 0xb0, 0xde, 0x67, 0x4d, 0x93, 0xe7, 0x3e, 0xa4, 0x18, 0x38, 0x23, 0x8c, 0x69,
+    0x77, 0xb0, 0x45, 0x51, 0x4b, 0xa0, 0x71, 0xc6, 0xfa, 0xd3, 0x3e, 0x7a, 0x9c, 0x84, 0x14, 0x36,
+    0x88, 0x07, 0x84, 0xe9, 0x65, 0x04, 0xaa, 0xd3, 0xfa, 0x4b, 0x3c, 0x1e, 0x11, 0xee, 0xaf, 0xfb,
+    0x28, 0x81, 0x27, 0x85, 0x13, 0xd1, 0x70, 0xa8, 0xd0, 0x43, 0xf2, 0x51, 0x3c, 0xeb, 0x54, 0x93,
+    0xeb, 0xb5, 0xb4, 0x03, 0x69, 0x11, 0xa3, 0xcf, 0x84, 0x8b, 0x76, 0x4c, 0x95, 0x48, 0x0b, 0x4a,
+    0x22, 0x2f, 0x2c, 0x46, 0x2d, 0x3d, 0xc0, 0xb1, 0x9a, 0x74, 0x8c, 0x0c, 0x42, 0x1f, 0x23, 0xa9,
+    0x39, 0x2a, 0xa3, 0x0d, 0x2e, 0xb7, 0x61, 0x3a, 0x17, 0x4c, 0x5b, 0x50, 0xc7, 0x4c, 0x01, 0x2a,
+    0x21, 0x34, 0x60, 0x06, 0xac, 0x8e, 0x7d, 0x4b, 0xb1, 0x9b, 0xd4, 0x7c, 0x25, 0x94, 0x5a, 0xd6,
+    0x39, 0x8b, 0xc0, 0x7f, 0xfe, 0x7f, 0xe1, 0xb6, 0x24, 0x63, 0xfd, 0x79, 0x12, 0xab, 0xe9, 0x87,
+    0x93, 0xa2, 0x89, 0xe9, 0x78, 0x6e, 0x11, 0xf8, 0x6a, 0xd3, 0x12, 0x85, 0x87, 0xbf, 0xc5, 0x98,
+    0x0e, 0x52, 0xf4, 0x3d, 0xc7, 0x7b, 0x39, 0x75, 0xfc, 0x5c, 0x8b, 0x2a, 0xd2, 0xba, 0x1a, 0x13,
+    0x78, 0x53, 0x63, 0x63, 0xe1, 0xfe, 0x57, 0x42, 0x0f, 0x47, 0x06, 0x2e, 0xd9, 0xb7, 0x2a, 0x9f,
+    0x18, 0x2a, 0x55, 0xdb, 0xd7, 0x4f, 0x1c, 0x15, 0x64, 0x91, 0x0b, 0x83, 0xd0, 0x20, 0x2d, 0x90,
+    0x51, 0x28, 0x8d, 0x37, 0xed, 0x5c, 0x77, 0x94, 0x44, 0x4a, 0xd7, 0x8f, 0x80, 0xaa, 0xd1, 0x8f,
+    0x0a, 0x16, 0xe3, 0x96, 0x9e, 0xa7, 0x15, 0xf3, 0x30, 0xd3, 0x6a, 0x02, 0x36, 0x6e, 0x46, 0x98,
+    0x8a, 0x90, 0x34, 0x49, 0x7e, 0xb4, 0x9c, 0x95, 0xfe, 0x2b, 0xd8, 0x34, 0xf6, 0x7a, 0x59, 0x92,
+    0xb2, 0xba, 0x80, 0x8d, 0xba, 0x80, 0xc6, 0x66, 0xf1, 0x62, 0x2b, 0x71, 0x9e, 0x0d, 0x1c, 0x07,
+    0x50, 0x6b, 0xd7, 0x23, 0x65, 0xc4, 0xd5, 0x48, 0xd7, 0x77, 0xe4, 0xb6, 0x06, 0xea, 0xcb, 0x30,
+    0xf2, 0xc3, 0xe7, 0x9e, 0xea, 0x48, 0x90, 0x3c, 0xee, 0x45, 0xb2, 0xd7, 0x8e, 0x18, 0x62, 0x40,
+    0x5e, 0xcc, 0x10, 0x13, 0x57, 0xda, 0xd0, 0xb8, 0xa5, 0x23, 0x0b, 0x79, 0x42, 0xa9, 0x02, 0x47,
+    0x00, 0x01, 0x83, 0x37, 0xfc, 0xec, 0x9f, 0xcb, 0xc8, 0x68, 0xf3, 0x1a, 0xf3, 0xcc, 0x04, 0x71,
+    0xb9, 0x8f, 0xc6, 0x33, 0xaa, 0x49, 0x5c, 0x11, 0x76, 0x85, 0x8c, 0x2c, 0x61, 0x44, 0xdc, 0x0a,
+    0x3c, 0xe3, 0x14, 0xbd, 0x4b, 0x6a, 0xbb, 0xeb, 0x17, 0x5e, 0x94, 0xef, 0xee, 0xa5, 0xdf, 0xc9,
+    0x3b, 0x42, 0xfa, 0x74, 0xa4, 0x04, 0xde, 0x3b, 0xfb, 0x0a, 0xd0, 0x31, 0x50, 0x26, 0xc9, 0x14,
+    0x55, 0xc0, 0x9b, 0x77, 0xcc, 0x71, 0x90, 0x80, 0xda, 0xed, 0xa2, 0xe0, 0x6b, 0xec, 0x6e, 0xd4,
+    0xb2, 0x01, 0x25, 0xa4, 0xd9, 0x42, 0xea, 0x5d, 0x76, 0x07, 0x4b, 0x4b, 0x2d, 0x69, 0x98, 0x56,
+    0x6f, 0x80, 0xe7, 0x7b, 0x0e, 0x53, 0xef, 0x32, 0x51, 0x09, 0xc2, 0xd1, 0x4b, 0x47, 0x59, 0xec,
+    0x44, 0xba, 0x0a, 0xab, 0xad, 0x77, 0xef, 0x28, 0x9a, 0xda, 0x87, 0x18, 0x3d, 0x91, 0x98, 0xa3,
+    0x3d, 0x2f, 0x3b, 0xd1, 0xb2, 0x83, 0x04, 0xef, 0x0a, 0x1b, 0xa7, 0x48, 0x41, 0xda, 0x66, 0xda,
+    0x3a, 0x7e, 0x1e, 0x8a, 0x72, 0xe0, 0x46, 0xbc, 0x2c, 0x27, 0x25, 0x17, 0xad, 0x63, 0xd2, 0x89,
+    0x0b, 0x54, 0x81, 0x4f, 0x5e, 0x18, 0x89, 0xbe, 0xa3, 0xa7, 0x73, 0x3f, 0x30, 0xd4, 0x31, 0x89,
+    0x6e, 0x50, 0x8e, 0xa2, 0xd1, 0x4b, 0xbc, 0x3a, 0xdf, 0x88, 0x2b, 0x9e, 0xe7, 0xeb, 0xbd, 0x7c,
+    0x05, 0x51, 0xc8, 0x9f, 0x0f, 0x31, 0xec, 0xaf, 0xe6, 0x39, 0x4d, 0x40, 0x9c, 0xd1, 0x00, 0x6a,
+    0x98, 0x91, 0xb1, 0x7d, 0x65, 0xb6, 0xe9, 0x48, 0xec, 0x6f, 0xea, 0x9a, 0x20, 0x99, 0xed, 0x04,
+    0xdd, 0x47, 0xb8, 0x3f, 0xa4, 0x48, 0x28, 0x91, 0xd2, 0xdd, 0xad, 0x7b, 0x6f, 0x3d, 0x5e, 0x29,
+    0xab, 0x8f, 0xf1, 0x75, 0x40, 0xe7, 0x77, 0x64, 0x09, 0x71, 0x3d, 0x91, 0x0e, 0xdf, 0xb1, 0xbf,
+    0x17, 0xeb, 0xc6, 0x8f, 0x25, 0xd1, 0x99, 0x79, 0x26, 0x27, 0x71, 0xf8, 0xa0, 0x5d, 0x0b, 0x35,
+    0x53, 0xac, 0x12, 0xba, 0xe5, 0xba, 0xa5, 0x71, 0xdd, 0xa3, 0x8a, 0xf4, 0xac, 0x08, 0x3a, 0xb3,
+    0x4f, 0xd8, 0xf6, 0xba, 0x1e, 0x12, 0x1e, 0x65, 0x40, 0x26, 0x71, 0x70, 0x27, 0x2e, 0xe2, 0x44,
+    0x1e, 0x87, 0x84, 0x66, 0xe2, 0x6d, 0xee, 0x56, 0x37, 0x0c, 0x22, 0x1c, 0x4a, 0xe1, 0x94, 0x3c,
+    0x25, 0x8e, 0xe7, 0x25, 0xda, 0x41, 0xa4, 0xa6, 0x92, 0xc5, 0x4b, 0xc8, 0xf4, 0x5d, 0x76, 0xdd,
+    0xb9, 0x2e, 0xc6, 0x60, 0x8e, 0xc9, 0x74, 0x8e, 0x94, 0x8c, 0xef, 0x2b, 0x02, 0x5e, 0x4c, 0xee,
+    0xf1, 0xaf, 0x8d, 0xfc, 0xfd, 0xf7, 0xae, 0x0e, 0xd2, 0x8d, 0x56, 0xae, 0xbe, 0x91, 0xcd, 0x82,
+    0x14, 0x69, 0xba, 0xe3, 0x95, 0x18, 0xc5, 0x72, 0x72, 0xb7, 0x32, 0xe8, 0xd7, 0x48, 0x22, 0x62,
+    0x51, 0x55, 0x2c, 0xfb, 0xfa, 0x48, 0xea, 0x27, 0x82, 0xa3, 0x5f, 0x22, 0xd7, 0x22, 0x37, 0xee,
+    0xec, 0xc5, 0xa3, 0xae, 0x4e, 0x42, 0x91, 0xfe, 0xc7, 0x43, 0x06, 0x72, 0xca, 0x68, 0xe1, 0x1d,
+    0xd9, 0xd0, 0x5f, 0xef, 0xd4, 0x6d, 0x3c, 0x98, 0x40, 0x42, 0xf8, 0x5f, 0x2e, 0x1e, 0x90, 0x53,
+    0x9f, 0xcd, 0xa2, 0xc9, 0xaa, 0x88, 0x15, 0x81, 0xf5, 0x89, 0xc5, 0x69, 0xb2, 0x58, 0xe5, 0x69,
+    0x40, 0x10, 0xe4, 0x8b, 0x9d, 0x7c, 0xf4, 0x55, 0xa5, 0x42, 0x5d, 0x74, 0xed, 0x91, 0x02, 0x3e,
+    0xd3, 0xee, 0xc9, 0x83, 0x6e, 0x9a, 0x4d, 0xb5, 0xa9, 0x82, 0xd0, 0xaf, 0xa4, 0x6d, 0xb9, 0x9c,
+    0x1e, 0x7c, 0x9d, 0x26, 0x5b, 0x03, 0x9f, 0xc0, 0xb5, 0xaa, 0xe1, 0xfb, 0x81, 0xf7, 0x78, 0x3e,
+    0x3c, 0xde, 0x92, 0xb4, 0x08, 0xe2, 0x47, 0xa7, 0x8a, 0x9b, 0xcd, 0x43, 0xff, 0xb8, 0xe3, 0x28,
+    0x03, 0xe0, 0xa2, 0x3f, 0xf4, 0xc0, 0x55, 0x0f, 0x1f, 0x02, 0xe7, 0xcd, 0xa1, 0x07, 0xad, 0x1c,
+    0x21, 0x04, 0x5d, 0xbf, 0x22, 0x1f, 0x77, 0xba, 0x45, 0xd0, 0xc1, 0x2e, 0xb1, 0xf2, 0xea, 0x41,
+    0x6f, 0xea, 0x6d, 0xb9, 0xc5, 0x41, 0xe8, 0xf6, 0x00, 0xb0, 0x3a, 0xb3, 0xf3, 0x5a, 0x40, 0xd6,
+    0xff, 0x56, 0x82, 0x4e, 0xd7, 0x29, 0x39, 0x19, 0x78, 0x88, 0x2c, 0xe2, 0x9f, 0xe0, 0xee, 0x27,
+    0x00, 0x1a, 0x54, 0xf1, 0x3d, 0x1d, 0xb7, 0x0d, 0x7d, 0x21, 0x40, 0x55, 0x05, 0x9b, 0xc8, 0xf3,
+    0x2a, 0x9d, 0x40, 0x5f, 0xf9, 0xc0, 0x7f, 0x43, 0x03, 0x8a, 0xda, 0xfa, 0xe1, 0x01, 0x4a, 0xe7,
+    0xe7, 0x6b, 0x14, 0xcb, 0x26, 0x73, 0xf5, 0x29, 0x03, 0xf7, 0xe7, 0xdb, 0xab, 0xd5, 0x67, 0x2f,
+    0xce, 0x1e, 0x1f, 0x1f, 0x39, 0x16, 0x87, 0xbc, 0x44, 0x6c, 0x35, 0x88, 0x89, 0x2c, 0x6c, 0x36,
+    0x7e, 0x87, 0x98, 0x95, 0x80, 0x4f, 0xc7, 0x84, 0x4a, 0xda, 0x22, 0x32, 0x9c, 0x0b, 0x42, 0x39,
+    0xbb, 0x08, 0x0a, 0x81, 0xf9, 0x5f, 0x28, 0xf1, 0x30, 0xdc, 0xfc, 0x40, 0xfb, 0xf1, 0xb3, 0x49,
+    0xc7, 0xe0, 0x07, 0x2a, 0x81, 0xc6, 0xe4, 0x19, 0x8e, 0x8c, 0x7b, 0x51, 0x60, 0x59, 0x11, 0x6a,
+    0x5d, 0xc5, 0x3c, 0x2a, 0x56, 0x9f, 0xed, 0x44, 0xa2, 0xd0, 0x44, 0xeb, 0x0c, 0xba, 0x70, 0x73,
+    0x86, 0xff, 0xd4, 0x9a, 0x5c, 0x8f, 0x47, 0xe1, 0xe0, 0x9a, 0x60, 0x3a, 0x23, 0x28, 0xfa, 0xef,
+    0x30, 0xc1, 0x64, 0x25, 0xd0, 0xb0, 0x1e, 0xf1, 0x0a, 0x7c, 0x66, 0x12, 0x1e, 0xaa, 0xa2, 0xf0,
+    0x53, 0xf6, 0x90, 0xef, 0xae, 0xa0, 0x46, 0xc7, 0xbc, 0xd3, 0x4e, 0x0b, 0xa9, 0x63, 0xdb, 0x16,
+    0x9b, 0xf7, 0xa8, 0x5d, 0x55, 0x16, 0xc1, 0xb2, 0xdb, 0x16, 0x31, 0xa4, 0xa2, 0x62, 0x8c, 0x08,
+    0x1a, 0x89, 0xa3, 0x27, 0xb5, 0x36, 0x49, 0xb9, 0x3e, 0x4a, 0xcf, 0xb4, 0xec, 0x13, 0xd4, 0x4c,
+    0xbc, 0x13, 0xa6, 0xd0, 0xc7, 0xf4, 0x38, 0xc9, 0x8f, 0xc6, 0xaa, 0x4c, 0xf3, 0x29, 0x93, 0xe0,
+    0xb4, 0x41, 0xa4, 0x34, 0x0a, 0x50, 0xab, 0x79, 0x81, 0x73, 0xae, 0x29, 0x83, 0x8b, 0x0c, 0x43,
+    0xef, 0x27, 0x8d, 0xb2, 0x4a, 0x49, 0x66, 0xe7, 0x18, 0xbc, 0xc1, 0x95, 0x8f, 0x89, 0x94, 0xdb,
+    0x7c, 0x9b, 0x5b, 0x98, 0x68, 0xd7, 0xf4, 0x2e, 0x22, 0x7b, 0xac, 0xa2, 0x90, 0x4d, 0x85, 0x12,
+    0x3f, 0x38, 0x32, 0xc4, 0x2e, 0x63, 0x7c, 0x1a, 0x79, 0x44, 0xdb, 0xed, 0xc5, 0x66, 0xca, 0x59,
+    0xee, 0x09, 0xd4, 0x92, 0x81, 0xd9, 0xc1, 0x5c, 0xce, 0x8d, 0x2c, 0x96, 0xdc, 0x32, 0x49, 0xa4,
+    0xf8, 0x40, 0x23, 0x65, 0x15, 0x96, 0x13, 0xfa, 0xb8, 0x77, 0x93, 0x7a, 0x6c, 0x33, 0x32, 0x0d,
+    0x00, 0x3d, 0x99, 0xa6, 0xf1, 0xdf, 0xca, 0x53, 0x95, 0x77, 0x50, 0x6c, 0x59, 0xd2, 0xc4, 0x15,
+    0xc2, 0xcb, 0xf4, 0xcc, 0x6c, 0xd0, 0x23, 0x67, 0x26, 0x83, 0x61, 0x6a, 0xce, 0x78, 0x50, 0x12,
+    0xc3, 0x7c, 0xc6, 0xad, 0x0b, 0x0f, 0xa9, 0x37, 0x59, 0x73, 0x04, 0x75, 0x08, 0xb5, 0x81, 0x9f,
+    0x77, 0x64, 0xb1, 0xa8, 0x35, 0x2b, 0xa3, 0x50, 0x1c, 0x75, 0xc6, 0x75, 0x26, 0xb8, 0xe4, 0x88,
+    0x4e, 0x51, 0x0e, 0xdd, 0x36, 0x8a, 0x53, 0xbd, 0x69, 0xb8, 0x9c, 0xdf, 0xc1, 0x13, 0x24, 0x6c,
+    0x4d, 0x70, 0xf3, 0x2b, 0x69, 0x02, 0xe4, 0x7b, 0x12, 0xf2, 0x00, 0x97, 0xee, 0x44, 0xde, 0x8e,
+    0xfd, 0x44, 0xb4, 0xf5, 0x51, 0x90, 0x0f, 0x71, 0x4a, 0x31, 0x72, 0xf3, 0x8c, 0xe1, 0x48, 0x9c,
+    0xd0, 0x2c, 0xdd, 0x3c, 0x32, 0xf1, 0xc6, 0xfa, 0xbe, 0x65, 0xf4, 0xfc, 0xed, 0x55, 0x7b, 0xb0,
+    0x30, 0x0e, 0x0d, 0x57, 0xe6, 0x8d, 0xe8, 0xc2, 0x58, 0xcb, 0xe2, 0x4a, 0xbf, 0xf0, 0x49, 0xa3,
+    0x62, 0xf1, 0x99, 0x8e, 0xb4, 0xa2, 0xad, 0x28, 0xee, 0x21, 0x7b, 0x61, 0x3d, 0xcf, 0x50, 0xd5,
+    0x6b, 0x96, 0xdc, 0x1a, 0xf6, 0x94, 0xa5, 0xdb, 0xf1, 0x4f, 0x5f, 0x40, 0x42, 0xb3, 0x4c, 0xa7,
+    0x7f, 0x2b, 0x17, 0x3a, 0x7e, 0x53, 0x2d, 0x2f, 0x55, 0xde, 0xfa, 0x82, 0xd0, 0x3d, 0xb0, 0xe9,
+    0x9b, 0xb2, 0xf2, 0x47, 0xbb, 0xce, 0x36, 0x8d, 0xa9, 0xa3, 0x28, 0x28, 0x18, 0x8d, 0x40, 0x7e,
+    0x53, 0x63, 0x7b, 0xbd, 0xce, 0xfb, 0x72, 0x2a, 0xed, 0x77, 0x8b, 0x59, 0x50, 0xdd, 0x1d, 0x64,
+    0x79, 0xd4, 0x86, 0x46, 0xc5, 0xbc, 0x42, 0x28, 0x67, 0x57, 0xd2, 0x6a, 0xd1, 0x36, 0xfb, 0x3d,
+    0x6a, 0x98, 0xa9, 0xd8, 0x67, 0xbd, 0xc6, 0x92, 0x6a, 0x54, 0xf1, 0x9b, 0x7c, 0x8d, 0x1e, 0x7c,
+    0xfd, 0xeb, 0x6e, 0xd1, 0x5b, 0x1e, 0xd9, 0x6b, 0x0b, 0x12, 0x8b, 0xe4, 0xea, 0x6c, 0x58, 0x2e,
+    0xe0, 0x74, 0xf3, 0x0b, 0xef, 0xb6, 0xa8, 0x6a, 0x20, 0x73, 0xc7, 0x19, 0xc5, 0x7b, 0x4b, 0x3c,
+    0x53, 0x89, 0xb1, 0xd4, 0xa7, 0x9f, 0xa3, 0xdf, 0xeb, 0x1a, 0xf8, 0xe0, 0x03, 0x6f, 0xc1, 0xe1,
+    0x18, 0xfd, 0xfc, 0x09, 0xb2, 0xaf, 0x59, 0xfc, 0x72, 0x73, 0x5a, 0x66, 0x7d, 0x17, 0x78, 0xf7,
+    0x88, 0x76, 0xe3, 0xf5, 0xce, 0x6e, 0xdb, 0x2e, 0x78, 0x05, 0xe1, 0x9a, 0x96, 0x1b, 0x5e, 0xc7,
+    0xd3, 0x9b, 0xcd, 0xda, 0x78, 0x39, 0xc1, 0xd1, 0x57, 0x7f, 0x92, 0x2c, 0xab, 0xc8, 0xf2, 0xe6,
+    0xbc, 0xeb, 0xfe, 0xf4, 0x2f, 0x3c, 0x1b, 0xb6, 0x5d, 0x77, 0x9d, 0x94, 0x50, 0x49, 0x8b, 0xe5,
+    0xcb, 0xc8, 0x0d, 0x2c, 0xa6, 0x5d, 0xf6, 0x64, 0x2e, 0xfc, 0xad, 0x26, 0xd6, 0x5f, 0x69, 0x32,
+    0x15, 0x0f, 0x7c, 0xae, 0x2a, 0xdd, 0x23, 0x9e, 0xfc, 0x91, 0xc2, 0x49, 0x4c, 0xc2, 0x12, 0xdf,
+    0x99, 0xc3, 0x29, 0xbd, 0xb3, 0x6e, 0x15, 0x1a, 0x22, 0xda, 0x08, 0xff, 0xea, 0xcf, 0xa4, 0xfb,
+    0xdb, 0x53, 0xe4, 0x37, 0x8e, 0xa2, 0x27, 0xfb, 0x05, 0x1d, 0xc0, 0x26, 0xab, 0x5b, 0xd1, 0x99,
+    0xe5, 0xca, 0x7b, 0xd3, 0x59, 0xe5, 0x6f, 0x3c, 0x02, 0x50, 0x15, 0x77, 0xe8, 0xf9, 0x5b, 0x5a,
+    0xe3, 0x9d, 0xff, 0xe5, 0x4b, 0x78, 0x4c, 0xa2, 0xe6, 0x0b, 0x0a, 0xb7, 0x33, 0xd2, 0x53, 0xa3,
+    0x42, 0xfe, 0x6c, 0x8c, 0x77, 0xbe, 0x67, 0x32, 0xb9, 0xd8, 0x83, 0xcf, 0x99, 0x72, 0xa6, 0xdc,
+    0xb3, 0x79, 0xee, 0xcd, 0xf8, 0x7a, 0xf7, 0xa7, 0x8e, 0xa5, 0x88, 0x0c, 0xcf, 0x94, 0x6e, 0x7b,
+    0x73, 0x5a, 0x5a, 0x1f, 0x20, 0xc5, 0x0f, 0x3b, 0xbf, 0x4d, 0x6b, 0x56, 0x0d, 0x04, 0x2b, 0x9e,
+    0xbe, 0x5d, 0xcf, 0x76, 0xf2, 0xa3, 0xef, 0xd5, 0xf3, 0x7b, 0x61, 0xd6, 0xaa, 0xa4, 0xd9, 0xca,
+    0xc3, 0x0f, 0x3e, 0xc8, 0x6b, 0x87, 0x99, 0xa7, 0x87, 0xd0, 0xdf, 0x22, 0x1e, 0x0a, 0x02, 0x9b,
+    0x9d, 0x9c, 0x9b, 0x6e, 0xfe, 0x4d, 0xb3, 0x9c, 0xf8, 0x39, 0xa3, 0xce, 0xff, 0xae, 0x66, 0x02,
+    0x48, 0x8f, 0xd1, 0x00, 0xa7, 0xa3, 0x0a, 0xdb, 0xf8, 0xd3, 0x64, 0x2e, 0xf0, 0x41, 0xd6, 0xb3,
+    0x6b, 0x3a, 0xfb, 0xd6, 0x6b, 0xe6, 0x3a, 0xbc, 0x9e, 0x5f, 0xfc, 0x10, 0x61, 0xfd, 0x6d, 0x85,
+    0x5e, 0xd3, 0x7f, 0x54, 0x01, 0x47, 0xa1, 0x3d, 0x5a, 0x3e, 0x6b, 0xff, 0x0d, 0x85, 0x5e, 0xd3,
+    0x7f, 0x3d, 0xf1, 0xf6, 0xe1, 0xb7, 0x13, 0xc1, 0x14, 0x45, 0x0f, 0xd6, 0x07, 0xe9, 0x8d, 0x98,
+    0x15, 0x18, 0x71, 0xcd, 0xc7, 0xf5, 0x39, 0xd7, 0x7c, 0xe5, 0x4d, 0xfc, 0x3f, 0xfb, 0xc0, 0xbd,
+    0x90, 0x4d, 0xde, 0x80, 0xe4, 0x7f, 0x15, 0xef, 0xf3, 0xee, 0xc9, 0x22, 0x00, 0x00,
+};
+
+const uint8_t STATIC_APP_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x18, 0xdb, 0x6e, 0xe3, 0xc6,
+    0xf5, 0xdd, 0x5f, 0x31, 0x5e, 0xa0, 0x21, 0x95, 0xd8, 0xb2, 0x1c, 0x64, 0x8b, 0x62, 0x1d, 0x6d,
+    0x60, 0xc7, 0x76, 0xe2, 0x76, 0xed, 0x35, 0x56, 0x7b, 0x29, 0x1a, 0x04, 0xc6, 0x88, 0x1c, 0x49,
+    0x63, 0x91, 0x1c, 0x76, 0x66, 0x68, 0x8a, 0xda, 0x18, 0x48, 0x83, 0x1a, 0x7d, 0x2a, 0x8a, 0x3e,
+    0x15, 0x6d, 0x0a, 0xa4, 0x8f, 0x7d, 0xdf, 0x97, 0xa2, 0xe8, 0xdb, 0xda, 0x3f, 0x92, 0x1f, 0x68,
+    0x3e, 0xa1, 0xe7, 0x0c, 0x6f, 0x43, 0x4a, 0xbe, 0x6d, 0x90, 0x97, 0x0a, 0xb0, 0x31, 0x9c, 0x39,
+    0xf7, 0xdb, 0x9c, 0x33, 0xa3, 0x24, 0xf2, 0x34, 0x17, 0x11, 0x49, 0x62, 0x9f, 0x6a, 0xf6, 0x39,
+    0xf7, 0x7d, 0x16, 0xb9, 0xdc, 0xef, 0x90, 0xd7, 0x2b, 0x04, 0x7e, 0x67, 0x54, 0x12, 0x9f, 0xab,
+    0xf8, 0x20, 0x8a, 0x13, 0x4d, 0xfa, 0xc4, 0x17, 0x5e, 0x12, 0xb2, 0x48, 0x77, 0xc7, 0x4c, 0xef,
+    0x05, 0x0c, 0x97, 0x3b, 0xd9, 0x81, 0x0f, 0x18, 0xe4, 0x03, 0xe2, 0x9c, 0x20, 0xa8, 0xd3, 0xd9,
+    0x6a, 0xa0, 0x22, 0x56, 0x49, 0xa1, 0x7b, 0x46, 0x83, 0x84, 0xe5, 0xe7, 0x7c, 0x44, 0x5c, 0x73,
+    0xfe, 0x31, 0xe9, 0x01, 0xbb, 0x12, 0xb6, 0xb7, 0xd5, 0x06, 0xcf, 0x37, 0xcf, 0x2b, 0xa2, 0x49,
+    0xc4, 0xef, 0x20, 0x0a, 0x42, 0x39, 0x1d, 0x9b, 0xe1, 0xf5, 0x08, 0x9d, 0x8a, 0xd1, 0x21, 0xd5,
+    0x93, 0xae, 0x14, 0x49, 0xe4, 0xe7, 0xb2, 0xbd, 0x6f, 0xb8, 0x81, 0x46, 0xe7, 0x2b, 0xa3, 0xd2,
+    0x54, 0x1c, 0x76, 0x9e, 0xf3, 0x90, 0xed, 0x73, 0x16, 0x20, 0xf6, 0x1a, 0x48, 0x15, 0x1c, 0xaa,
+    0xd2, 0x64, 0x9e, 0x88, 0x94, 0x08, 0x58, 0x37, 0x10, 0x63, 0xd7, 0xf9, 0xe2, 0x97, 0x83, 0x2f,
+    0x5b, 0x08, 0x0e, 0x88, 0x97, 0xcb, 0xb8, 0x46, 0x70, 0x6d, 0x90, 0xf1, 0x93, 0x84, 0xaa, 0x53,
+    0x1a, 0xaf, 0xad, 0xec, 0x66, 0x6d, 0xb3, 0x1c, 0xfe, 0xb1, 0x31, 0x9a, 0xd9, 0x6c, 0x1e, 0xfc,
+    0x8c, 0xfc, 0xbc, 0x07, 0x3f, 0xd2, 0xef, 0x23, 0x44, 0x81, 0x6e, 0xb6, 0xb6, 0x2a, 0x68, 0x16,
+    0x28, 0xd6, 0x40, 0xd9, 0x5c, 0xc0, 0xd8, 0xac, 0x10, 0xce, 0x6f, 0x31, 0xde, 0x82, 0xb5, 0x01,
+    0x1b, 0x3f, 0xb7, 0xee, 0x82, 0x97, 0x07, 0x4c, 0x85, 0x97, 0xcb, 0xb3, 0x71, 0x27, 0xfc, 0x16,
+    0x96, 0x65, 0xb7, 0x45, 0x0f, 0xd4, 0x36, 0x3f, 0x29, 0xc2, 0x0c, 0x77, 0x5c, 0x9b, 0x5d, 0x27,
+    0xf7, 0x48, 0xa1, 0x3e, 0x1e, 0x2f, 0x7a, 0x1e, 0x08, 0x9f, 0x31, 0xa9, 0x5f, 0xc0, 0x41, 0x2b,
+    0x47, 0x72, 0x4a, 0xfd, 0xdb, 0xc5, 0xdd, 0xfa, 0xd1, 0x61, 0x8c, 0xb8, 0x11, 0x4b, 0x77, 0x73,
+    0x3d, 0x16, 0x2d, 0x86, 0x7e, 0x2d, 0xcf, 0xc1, 0xb3, 0x64, 0x35, 0xf7, 0x6b, 0x8d, 0x12, 0x53,
+    0xa9, 0xd8, 0x7e, 0x20, 0xa8, 0x2e, 0xe1, 0xba, 0x5a, 0xec, 0xf3, 0x19, 0xf3, 0xdd, 0x0f, 0x3b,
+    0x9d, 0x77, 0x71, 0x5b, 0x41, 0xa6, 0x61, 0x2b, 0xc5, 0xf4, 0x67, 0x81, 0x18, 0xd2, 0xc0, 0x58,
+    0x2b, 0xb7, 0x70, 0x6e, 0xaf, 0x8d, 0x0d, 0xf2, 0x9b, 0x90, 0xb3, 0xab, 0xdf, 0x93, 0x53, 0xe6,
+    0x47, 0x42, 0xe9, 0x29, 0x27, 0x29, 0x23, 0xa9, 0x9a, 0x67, 0xb8, 0xf6, 0x26, 0x64, 0x84, 0x89,
+    0x42, 0xbd, 0x49, 0xa5, 0xaf, 0xd9, 0x38, 0xf0, 0xd1, 0xc2, 0x5f, 0x38, 0x31, 0x8f, 0xc6, 0x07,
+    0x91, 0x66, 0x12, 0xd8, 0x63, 0x0e, 0x41, 0xba, 0xc2, 0xc7, 0xd3, 0xd1, 0x08, 0x73, 0x0c, 0x37,
+    0x86, 0x54, 0xb1, 0x1d, 0x21, 0x74, 0xf9, 0x1d, 0x89, 0x57, 0x7c, 0x9f, 0xe3, 0x17, 0x40, 0xe2,
+    0x06, 0x8d, 0x3f, 0x15, 0xd1, 0x88, 0x8f, 0xed, 0xad, 0x94, 0x4e, 0xd9, 0x2b, 0x1e, 0xf9, 0x22,
+    0x3d, 0x54, 0xb8, 0xa1, 0x02, 0xc6, 0x62, 0x7b, 0x23, 0xa4, 0xb3, 0x63, 0xe0, 0x9c, 0x7f, 0xd0,
+    0x78, 0x87, 0x7a, 0x53, 0x31, 0x1a, 0xe5, 0x9f, 0xfe, 0xc4, 0x8b, 0x0b, 0x62, 0xf9, 0xc6, 0x10,
+    0x4e, 0x93, 0xf8, 0x88, 0xe9, 0x54, 0xc8, 0xe9, 0x33, 0xa6, 0x65, 0x56, 0x49, 0xfc, 0x65, 0x6e,
+    0xe1, 0x52, 0xa5, 0xee, 0x48, 0xc8, 0x3d, 0xd0, 0x15, 0x4d, 0xdb, 0x7f, 0x6c, 0xa5, 0x74, 0x19,
+    0x23, 0x7b, 0xc1, 0x5d, 0xa3, 0x64, 0xab, 0x51, 0x0e, 0x72, 0x5c, 0xbb, 0x48, 0xe0, 0x2f, 0xdf,
+    0x5d, 0x92, 0xa8, 0xe5, 0xaf, 0x15, 0xe3, 0xf5, 0x61, 0x5e, 0x07, 0xce, 0x8b, 0x1d, 0x74, 0x22,
+    0x8d, 0xb9, 0x9a, 0x93, 0x34, 0x1b, 0x4a, 0x1a, 0x5d, 0x5e, 0x54, 0xde, 0xbc, 0xfc, 0x2b, 0x49,
+    0x49, 0x32, 0x95, 0x99, 0xce, 0x42, 0x12, 0x8b, 0x20, 0xa9, 0xdc, 0x38, 0xae, 0x02, 0xe2, 0xb6,
+    0xfb, 0xc4, 0xa9, 0x41, 0x5f, 0xa2, 0xa8, 0xa5, 0x72, 0xa8, 0x58, 0x8b, 0x8a, 0xad, 0x61, 0xeb,
+    0x68, 0x89, 0x9a, 0xe7, 0x8d, 0x18, 0x9d, 0x88, 0x74, 0x40, 0xcf, 0xd8, 0x91, 0xd0, 0xdc, 0x63,
+    0xae, 0x5d, 0xc1, 0x35, 0xa6, 0x09, 0x0d, 0x55, 0x1e, 0xdd, 0xe4, 0xc5, 0xb3, 0x27, 0x03, 0x46,
+    0xa5, 0x37, 0x39, 0x36, 0xbb, 0x6e, 0x6a, 0x02, 0x03, 0x2a, 0x8c, 0x47, 0x91, 0x52, 0x57, 0x99,
+    0x43, 0x4b, 0xc8, 0x1c, 0x1b, 0xd5, 0x72, 0x1d, 0x05, 0x2c, 0x7c, 0xa7, 0x63, 0x32, 0xd1, 0xd9,
+    0x84, 0x85, 0x64, 0x3a, 0x91, 0xd1, 0xd6, 0x8a, 0x81, 0x46, 0x21, 0x9e, 0x0b, 0xaa, 0x00, 0xf0,
+    0xfb, 0xbf, 0x5f, 0x90, 0x5f, 0x99, 0xc8, 0x4c, 0x24, 0xf5, 0x4e, 0x29, 0x99, 0xa3, 0x89, 0x69,
+    0x44, 0x4d, 0x40, 0x26, 0x9e, 0xc7, 0x94, 0x42, 0x4b, 0x94, 0x1e, 0x78, 0xa1, 0x12, 0xc8, 0x22,
+    0xc3, 0x0a, 0x42, 0x8c, 0xcc, 0x09, 0xf5, 0x25, 0x53, 0xc9, 0x1a, 0xb9, 0xfa, 0x0f, 0x1b, 0x66,
+    0x24, 0xe2, 0x0c, 0xec, 0x9f, 0x6a, 0x2a, 0xe7, 0xf4, 0xf2, 0x0f, 0xb8, 0xe4, 0xd4, 0x17, 0x90,
+    0x7a, 0x11, 0xa7, 0x86, 0xc4, 0x84, 0x2b, 0x2d, 0x64, 0xd6, 0x95, 0x2c, 0x0e, 0xa8, 0xc7, 0x06,
+    0x1a, 0x5a, 0x00, 0xf7, 0xf5, 0x39, 0x30, 0x03, 0x86, 0x6d, 0x15, 0x63, 0xb8, 0x1a, 0x23, 0x60,
+    0xd4, 0x2c, 0x89, 0xb5, 0xf4, 0x21, 0x08, 0x47, 0xc7, 0x6c, 0x8d, 0xe8, 0x2c, 0x66, 0x7d, 0x87,
+    0x47, 0x23, 0xe1, 0x34, 0x2d, 0xaa, 0x11, 0xce, 0x76, 0xba, 0x27, 0x19, 0x70, 0x2c, 0xfc, 0xee,
+    0x3a, 0x3e, 0x3f, 0x2b, 0xfd, 0x6c, 0x40, 0xbb, 0x5e, 0x40, 0x95, 0x3a, 0x02, 0x9e, 0x58, 0x91,
+    0x73, 0x6c, 0x53, 0xb7, 0x0d, 0x87, 0x7e, 0xbf, 0x32, 0x09, 0xf9, 0xa4, 0x38, 0x5e, 0xaf, 0x76,
+    0x1e, 0x91, 0x12, 0x88, 0x49, 0x29, 0xa4, 0x05, 0x52, 0x7c, 0x3f, 0x2a, 0xbf, 0x73, 0x41, 0x6d,
+    0xb6, 0x9a, 0xcd, 0x34, 0x14, 0x08, 0x0d, 0x42, 0x01, 0xe3, 0x42, 0xaf, 0x56, 0x5d, 0x1c, 0x0a,
+    0x3f, 0xeb, 0xd2, 0x38, 0x66, 0x91, 0xff, 0xe9, 0x84, 0xc3, 0xb5, 0x6e, 0x50, 0x0b, 0x32, 0x50,
+    0xfb, 0x8a, 0x6a, 0xe0, 0x42, 0x50, 0x35, 0xb2, 0xda, 0x52, 0xec, 0x09, 0x58, 0xbf, 0x4b, 0x7d,
+    0x08, 0xf6, 0x09, 0xf7, 0x99, 0x9d, 0xbe, 0x0b, 0xf8, 0x39, 0x96, 0x64, 0xa1, 0x38, 0x83, 0x30,
+    0x5d, 0x23, 0x1f, 0x3d, 0xec, 0x15, 0xe0, 0xe0, 0xac, 0xcd, 0x5f, 0xf4, 0x7a, 0x4d, 0xa7, 0x40,
+    0xd8, 0x73, 0x6c, 0xe7, 0x06, 0x58, 0xc3, 0x90, 0x92, 0x72, 0xad, 0xe2, 0xfb, 0xca, 0x9c, 0x62,
+    0x78, 0x79, 0x73, 0xaa, 0xde, 0xbe, 0x81, 0x64, 0xbd, 0xfa, 0x36, 0x36, 0x51, 0xf1, 0x88, 0x84,
+    0x3c, 0x22, 0x0f, 0xf1, 0xff, 0x1a, 0x81, 0x82, 0x07, 0x8d, 0x03, 0xae, 0x2d, 0x1f, 0x0e, 0x9e,
+    0xec, 0xed, 0x1d, 0x9f, 0x1c, 0x1e, 0x1c, 0x9d, 0x1c, 0x0e, 0xc0, 0x38, 0x0f, 0xa1, 0x43, 0x02,
+    0x98, 0xf7, 0xf3, 0x7e, 0x21, 0x97, 0x1e, 0x58, 0x18, 0x0a, 0x89, 0x5e, 0xc4, 0xdb, 0xfe, 0x75,
+    0x8e, 0x67, 0x70, 0x5a, 0x88, 0x80, 0x97, 0xb3, 0x6b, 0x20, 0x9a, 0x3a, 0x6c, 0x3a, 0xa7, 0x9b,
+    0xca, 0x45, 0xb3, 0x5a, 0x17, 0xb6, 0xb1, 0x08, 0xe0, 0xf5, 0x74, 0x3f, 0x22, 0x8d, 0x5e, 0xd6,
+    0xa2, 0x84, 0xc5, 0xe5, 0x9e, 0x94, 0xec, 0xea, 0x5c, 0x15, 0x88, 0x55, 0x4b, 0xb1, 0xaf, 0xbe,
+    0x22, 0xab, 0x2d, 0x31, 0xab, 0xad, 0x8a, 0x5f, 0x5d, 0x36, 0x2a, 0x3a, 0x01, 0xd3, 0x55, 0xe7,
+    0x61, 0x6e, 0x75, 0xb8, 0x64, 0xdc, 0x9a, 0x6e, 0x5e, 0xfe, 0x3a, 0x48, 0xab, 0xe8, 0xe5, 0x10,
+    0xc1, 0x4b, 0xa4, 0x04, 0x41, 0x5f, 0xe4, 0xed, 0x47, 0x13, 0xad, 0x62, 0x56, 0xa0, 0x5a, 0xbc,
+    0xc0, 0x3b, 0x83, 0x58, 0xd2, 0xd4, 0x9f, 0x33, 0xac, 0x2b, 0x01, 0x0f, 0xb9, 0x86, 0xd8, 0x69,
+    0xb5, 0xa5, 0x1f, 0x37, 0x02, 0xc4, 0x2e, 0xcd, 0x6d, 0xb1, 0x80, 0xb7, 0x0d, 0xba, 0xd5, 0x04,
+    0xac, 0x0c, 0x51, 0x01, 0xbb, 0x8d, 0xc8, 0xdb, 0xb0, 0xd5, 0xe8, 0x54, 0xfd, 0x8b, 0xad, 0xdb,
+    0xe3, 0xa2, 0xed, 0x85, 0xcc, 0xdf, 0x84, 0x6c, 0x6f, 0x9f, 0x6d, 0xe6, 0x47, 0x3d, 0x38, 0xea,
+    0x75, 0xac, 0xdc, 0xab, 0x16, 0x68, 0x2b, 0xf4, 0x5c, 0x51, 0x7f, 0xae, 0x21, 0xed, 0x40, 0xbc,
+    0x3a, 0xd7, 0x93, 0x77, 0x4c, 0x29, 0x72, 0x42, 0x65, 0xa7, 0x37, 0x52, 0xc6, 0xe8, 0x0a, 0x68,
+    0xf6, 0xf2, 0x3e, 0xda, 0x6d, 0x5a, 0x34, 0x68, 0x00, 0x97, 0x34, 0xdc, 0x18, 0x7f, 0xfb, 0xc7,
+    0x7f, 0xff, 0xf5, 0x27, 0x72, 0x08, 0x23, 0x46, 0x48, 0x83, 0x28, 0x33, 0x29, 0x5d, 0xe7, 0x33,
+    0x14, 0x8e, 0x32, 0x17, 0x89, 0x19, 0x3c, 0x1a, 0x6c, 0x71, 0xe6, 0x28, 0x1b, 0x5d, 0xa3, 0x25,
+    0x6c, 0x54, 0x13, 0xc8, 0x79, 0x7b, 0x4a, 0x78, 0xdc, 0xc8, 0xe1, 0xbb, 0xb9, 0xd6, 0x80, 0xde,
+    0xd9, 0xb5, 0x79, 0x71, 0xf8, 0x7f, 0x75, 0xed, 0x8d, 0xda, 0xdd, 0xe0, 0x5a, 0x3a, 0x55, 0xd9,
+    0x75, 0xbe, 0x2d, 0xeb, 0xe5, 0xbd, 0x9d, 0x6b, 0xdf, 0x16, 0x5a, 0x8c, 0xc7, 0x01, 0x7b, 0x3e,
+    0x81, 0xfa, 0xe5, 0x7a, 0x13, 0xe6, 0x4d, 0x59, 0x35, 0xda, 0x54, 0x05, 0xae, 0x5c, 0x14, 0x55,
+    0x0e, 0xfa, 0x1d, 0xbd, 0xad, 0xb5, 0xe4, 0x43, 0x68, 0xbd, 0xe1, 0xe2, 0xa6, 0x9a, 0xae, 0x6b,
+    0x24, 0x00, 0x7d, 0x43, 0x41, 0x02, 0x2d, 0xe4, 0x53, 0x39, 0x35, 0x46, 0x0a, 0xf8, 0x78, 0x52,
+    0x95, 0x40, 0xec, 0x28, 0x82, 0x01, 0x34, 0x1e, 0x70, 0xab, 0x22, 0xa1, 0x03, 0xcd, 0x42, 0xd7,
+    0xb9, 0x13, 0x7a, 0x7b, 0x0a, 0x37, 0x32, 0xdb, 0x73, 0x98, 0xc1, 0x1e, 0x8a, 0xd9, 0x4d, 0xc5,
+    0xd9, 0x70, 0x1a, 0xa4, 0x5c, 0x7b, 0x13, 0xbb, 0xad, 0x5c, 0x2d, 0x71, 0x9b, 0x85, 0x16, 0xa9,
+    0x72, 0x95, 0xcf, 0x0b, 0xc7, 0x20, 0x31, 0x7a, 0xb4, 0x84, 0x44, 0xd2, 0x96, 0x19, 0xa0, 0x93,
+    0x0f, 0xa1, 0xe5, 0xe9, 0x63, 0x9b, 0xe7, 0x19, 0x84, 0x7d, 0xb3, 0x53, 0xf3, 0xb0, 0x09, 0x75,
+    0x5a, 0xbd, 0x3e, 0x57, 0xbb, 0xa0, 0x2f, 0x86, 0x63, 0x49, 0xbd, 0x30, 0x45, 0x1d, 0x19, 0xef,
+    0xe2, 0x8e, 0x82, 0xec, 0xb5, 0xde, 0xb8, 0xdd, 0x23, 0xb7, 0x51, 0x28, 0x2a, 0x45, 0x53, 0x1b,
+    0xd3, 0xf3, 0x1a, 0xff, 0x80, 0x46, 0x0d, 0xfa, 0xe3, 0x26, 0xfd, 0xd6, 0xd4, 0x52, 0xe3, 0xb5,
+    0x27, 0x97, 0x86, 0x8d, 0x5c, 0x9b, 0x3e, 0xda, 0xdb, 0x88, 0xd6, 0x69, 0x8e, 0x32, 0x3f, 0x95,
+    0xb9, 0x4c, 0x47, 0xd0, 0x72, 0x12, 0xc8, 0x94, 0xa3, 0x5a, 0x03, 0x53, 0xdb, 0x2e, 0xf7, 0xf0,
+    0xf4, 0x4f, 0x2d, 0xfe, 0x8f, 0xf3, 0xb8, 0x35, 0x0e, 0x2e, 0x16, 0x92, 0x63, 0x68, 0x6d, 0x61,
+    0xea, 0xf5, 0x5b, 0x2f, 0x24, 0xb3, 0x9b, 0x5f, 0x47, 0xea, 0x64, 0x1b, 0xea, 0x08, 0x40, 0x67,
+    0x30, 0x6f, 0x48, 0x4b, 0xe7, 0xdf, 0x26, 0x4c, 0x66, 0x03, 0x16, 0x30, 0x0f, 0x84, 0x76, 0x1d,
+    0x50, 0x5d, 0x8b, 0xa8, 0x94, 0x67, 0xd6, 0xc5, 0x66, 0x1f, 0xc3, 0xa2, 0x5c, 0x41, 0x48, 0x3c,
+    0x88, 0x0b, 0x41, 0x1e, 0x74, 0x40, 0x93, 0x07, 0xd8, 0xd4, 0x3f, 0x00, 0x4d, 0xea, 0xed, 0x3a,
+    0x2d, 0x81, 0xa5, 0x1d, 0x6d, 0xf0, 0xd9, 0x9a, 0x01, 0x96, 0x92, 0x45, 0xaa, 0x3f, 0x7c, 0xf7,
+    0xe7, 0xdf, 0x41, 0x95, 0x36, 0x84, 0x8b, 0xf5, 0xf7, 0x5f, 0xff, 0xf1, 0x87, 0xef, 0xfe, 0xf2,
+    0x4f, 0xdc, 0xb5, 0x1f, 0xd0, 0x90, 0xcf, 0xcc, 0xe6, 0x32, 0x83, 0xc9, 0xdf, 0x4b, 0xa0, 0x33,
+    0x6f, 0x26, 0xc0, 0xac, 0xb8, 0x16, 0xdf, 0x7b, 0x8f, 0x14, 0xcb, 0x6e, 0xc0, 0xa2, 0xb1, 0x9e,
+    0xb4, 0xf3, 0x61, 0x86, 0x7e, 0xcb, 0x2d, 0x02, 0xc6, 0x7f, 0x46, 0xa3, 0x31, 0x73, 0x9b, 0x18,
+    0x6b, 0x6d, 0x0a, 0xcb, 0xbc, 0x87, 0x7d, 0x5d, 0x92, 0xd2, 0x29, 0x39, 0xa5, 0x2a, 0x12, 0x57,
+    0xdf, 0x7a, 0xfc, 0x11, 0x61, 0x3a, 0x9b, 0x72, 0xa6, 0x29, 0x11, 0x3e, 0x91, 0x74, 0x6e, 0x06,
+    0xca, 0xcb, 0x0b, 0x9f, 0x62, 0xe3, 0x17, 0xd1, 0xd3, 0x34, 0x83, 0xf9, 0xf2, 0x14, 0x9a, 0x62,
+    0xb2, 0xf3, 0xec, 0xe0, 0xb3, 0xcf, 0x9f, 0x1f, 0xed, 0x0d, 0x06, 0x27, 0x83, 0xbd, 0xa3, 0x5d,
+    0xb8, 0xe0, 0x90, 0x9e, 0x9b, 0xaa, 0xf8, 0xed, 0x1b, 0xbc, 0xb1, 0x4c, 0x97, 0x58, 0x20, 0xc3,
+    0xa4, 0xaa, 0xb4, 0x14, 0x60, 0xe9, 0x75, 0x22, 0x14, 0x8c, 0x9a, 0x78, 0x87, 0xa5, 0x54, 0x6a,
+    0x60, 0x0a, 0xd3, 0xe9, 0x9c, 0xa6, 0x6a, 0xce, 0x30, 0x44, 0x26, 0xc2, 0x9f, 0xf3, 0x15, 0x0c,
+    0x85, 0x45, 0xf2, 0xe0, 0x8b, 0x0f, 0x1f, 0x42, 0x33, 0x6b, 0x02, 0x45, 0x62, 0x4c, 0x46, 0x30,
+    0x9e, 0xe1, 0x88, 0x23, 0x71, 0x52, 0x4f, 0x82, 0xa0, 0x7d, 0x36, 0x00, 0x0f, 0x6e, 0x6b, 0xf3,
+    0x86, 0xdc, 0x3a, 0x29, 0x2f, 0xe8, 0x1c, 0x6b, 0xd4, 0x7c, 0x09, 0xdf, 0xa9, 0xc0, 0xdc, 0xa2,
+    0x8b, 0x7e, 0x7d, 0xe3, 0xc3, 0x98, 0x13, 0x30, 0x7f, 0xc7, 0x26, 0xed, 0x74, 0x5a, 0x31, 0x64,
+    0x3d, 0xe1, 0x2d, 0xca, 0xd0, 0x7a, 0x17, 0x6f, 0xa9, 0xb6, 0x78, 0x23, 0xa5, 0xd4, 0x74, 0xef,
+    0xe6, 0xb9, 0x1a, 0xe6, 0x34, 0xb7, 0xb7, 0xb6, 0xa8, 0xf2, 0x07, 0xcb, 0xec, 0xb7, 0x4e, 0x76,
+    0x41, 0xbb, 0x6e, 0x24, 0x52, 0xb7, 0x6c, 0x8d, 0x16, 0xed, 0x68, 0xcd, 0x9f, 0x0a, 0x06, 0xdc,
+    0x5a, 0xaf, 0x35, 0xc3, 0xb8, 0xf5, 0x02, 0xd0, 0x80, 0xa8, 0x6e, 0xe3, 0xeb, 0xbc, 0xd3, 0x3c,
+    0xab, 0xbc, 0x53, 0x4b, 0x55, 0x3c, 0x8f, 0x31, 0xb8, 0x9e, 0x5d, 0x67, 0x03, 0x44, 0xa9, 0xa1,
+    0x3f, 0x01, 0x33, 0xf5, 0xb1, 0xa9, 0x69, 0x19, 0xd0, 0x08, 0x84, 0x91, 0xb7, 0xed, 0x79, 0x90,
+    0x99, 0x28, 0xd5, 0x3a, 0x04, 0x54, 0x98, 0x4d, 0xe9, 0x29, 0x89, 0x45, 0x2c, 0xe7, 0xcc, 0x8f,
+    0xb8, 0x20, 0x42, 0x63, 0xbc, 0x5d, 0x5e, 0xc0, 0xd9, 0xf4, 0xea, 0x1b, 0xea, 0xe3, 0x53, 0xd5,
+    0xd8, 0xcf, 0x70, 0x5f, 0xc8, 0x79, 0x46, 0x14, 0x87, 0x0d, 0x10, 0x82, 0xae, 0x54, 0x6e, 0x86,
+    0xf9, 0x7c, 0xef, 0x0c, 0x16, 0x38, 0xac, 0xb3, 0x88, 0x41, 0xe9, 0xd9, 0x7d, 0x7a, 0x58, 0x38,
+    0xf5, 0x89, 0xa0, 0x3e, 0xf3, 0xa1, 0x5e, 0x96, 0xb6, 0x68, 0xbd, 0x20, 0xd1, 0x52, 0x9a, 0xc6,
+    0xcb, 0x70, 0xa3, 0x92, 0x6d, 0x07, 0x81, 0xeb, 0x74, 0x2b, 0xc0, 0x35, 0x02, 0x49, 0x6d, 0x48,
+    0xd5, 0x7b, 0x65, 0x91, 0xab, 0xa9, 0x55, 0x4f, 0x86, 0xd5, 0x56, 0xf3, 0x8d, 0xa1, 0x98, 0x56,
+    0x93, 0x30, 0xa4, 0x32, 0x03, 0xd6, 0x15, 0x58, 0xbb, 0x8a, 0x16, 0x20, 0x0b, 0x77, 0x70, 0xbe,
+    0xdd, 0x2e, 0x38, 0xc5, 0xf6, 0x12, 0x93, 0x78, 0x01, 0xf7, 0xa6, 0xcb, 0xec, 0xd0, 0x7a, 0x58,
+    0x04, 0xa9, 0x52, 0xaa, 0x9e, 0xc6, 0x2c, 0x6a, 0x48, 0x35, 0xa1, 0xca, 0xba, 0xcf, 0x04, 0x1c,
+    0xb7, 0xaf, 0xab, 0x1a, 0x1f, 0xfe, 0x6b, 0xca, 0x23, 0x13, 0x50, 0x35, 0x85, 0xc6, 0x5d, 0x81,
+    0xf3, 0x6e, 0x75, 0x74, 0x1d, 0x1d, 0x1a, 0x04, 0xdb, 0xb6, 0x7b, 0x2a, 0xba, 0xef, 0xec, 0x1f,
+    0xfb, 0xd7, 0xa0, 0x5e, 0xb9, 0x4b, 0xc0, 0xfd, 0x2a, 0x9b, 0xae, 0xb2, 0x7f, 0x68, 0xfa, 0x1c,
+    0x04, 0x1f, 0x0a, 0x2b, 0xfa, 0x9d, 0x6b, 0xc0, 0xf1, 0x67, 0xc0, 0x8b, 0x77, 0xa1, 0x3b, 0x98,
+    0xb0, 0xae, 0xfc, 0x8d, 0x9d, 0x25, 0x90, 0x90, 0x4b, 0xc7, 0x90, 0x35, 0x29, 0x87, 0xaa, 0xed,
+    0x97, 0x89, 0x03, 0x35, 0x5f, 0xb1, 0xa9, 0x77, 0xca, 0x89, 0x1b, 0x0b, 0x32, 0x95, 0x6f, 0xdf,
+    0xe8, 0x29, 0x0f, 0x89, 0x80, 0x62, 0x7f, 0xf5, 0xef, 0x08, 0x87, 0x92, 0x84, 0xd0, 0x61, 0x56,
+    0x8b, 0x9e, 0x27, 0x94, 0x14, 0xf3, 0x94, 0x47, 0x97, 0x17, 0x57, 0xdf, 0x74, 0x56, 0x96, 0xe9,
+    0xbc, 0x5a, 0xc4, 0xc4, 0x75, 0x8a, 0xde, 0xf0, 0x9a, 0xb6, 0x60, 0xf7, 0x2a, 0x22, 0x94, 0x27,
+    0x45, 0x10, 0x1c, 0x44, 0x5a, 0xbc, 0xe4, 0x2c, 0x75, 0x5f, 0x93, 0x21, 0x9b, 0xd0, 0x33, 0x2e,
+    0x24, 0xf4, 0x32, 0x2a, 0x14, 0x60, 0x38, 0x88, 0xd7, 0x21, 0xb4, 0x41, 0x53, 0xdc, 0xd0, 0xa0,
+    0x9d, 0xb3, 0xd4, 0x10, 0xe5, 0x1b, 0x5b, 0xaf, 0xb7, 0xe4, 0xb0, 0x69, 0xcb, 0xf3, 0xa5, 0x8f,
+    0xe5, 0xf8, 0xf7, 0x3f, 0xcc, 0x83, 0xef, 0x55, 0x66, 0x1d, 0x00, 0x00,
+};
+
+const uint8_t STATIC_ICON_SVG_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x15, 0x8d, 0xcb, 0x0a, 0xc2, 0x30,
+    0x10, 0x45, 0xf7, 0x7e, 0xc5, 0x30, 0xae, 0x33, 0x99, 0xa4, 0x99, 0x68, 0xa5, 0xe9, 0xc2, 0xb5,
+    0x6e, 0xdd, 0xfb, 0xea, 0x03, 0xa2, 0x2d, 0xb6, 0x34, 0xc5, 0xaf, 0x37, 0xc2, 0x85, 0xb3, 0x38,
+    0x07, 0x6e, 0x35, 0x2d, 0x2d, 0xac, 0xaf, 0xf8, 0x9e, 0x02, 0x76, 0xf3, 0x3c, 0x1e, 0xb4, 0x4e,
+    0x29, 0x51, 0x2a, 0x68, 0xf8, 0xb4, 0xda, 0x32, 0xb3, 0xce, 0x05, 0xc2, 0xd2, 0x3f, 0xd3, 0x71,
+    0x58, 0x03, 0x32, 0x30, 0x58, 0x97, 0x87, 0x75, 0x35, 0x5e, 0xe7, 0x0e, 0x9a, 0x3e, 0xc6, 0x80,
+    0x5b, 0xe6, 0xdd, 0xad, 0x69, 0x10, 0x1e, 0x01, 0xcf, 0xc6, 0x82, 0x39, 0x15, 0x20, 0x8b, 0xbf,
+    0x33, 0x08, 0x89, 0x40, 0x41, 0x7b, 0x07, 0x86, 0x69, 0xe7, 0xa0, 0x84, 0xac, 0x85, 0x8c, 0x57,
+    0x86, 0xac, 0x87, 0x52, 0x79, 0x72, 0x92, 0x61, 0xec, 0x45, 0xa2, 0x2a, 0x95, 0xfb, 0xa2, 0xae,
+    0xab, 0xff, 0x6b, 0xbd, 0xf9, 0x01, 0x2c, 0xd9, 0x05, 0xd8, 0x9e, 0x00, 0x00, 0x00,
+};
+
+const uint8_t STATIC_DASHBOARD_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x3a, 0xed, 0x72, 0xdc, 0x36,
+    0x92, 0xff, 0xf5, 0x14, 0x88, 0x5d, 0xbb, 0x43, 0x6e, 0x46, 0xd4, 0x8c, 0x64, 0x29, 0x8e, 0xe4,
+    0x8f, 0x92, 0x64, 0x65, 0xe3, 0xac, 0xbe, 0xca, 0xa3, 0xc4, 0x71, 0x52, 0xae, 0x14, 0x48, 0x62,
+    0x66, 0xa0, 0x21, 0x09, 0x2e, 0x08, 0x0e, 0xc5, 0xd9, 0x75, 0xd5, 0x95, 0x2b, 0xae, 0x7b, 0x85,
+    0x4d, 0xed, 0xff, 0x7b, 0x81, 0xfb, 0x9b, 0x7f, 0x27, 0xbd, 0xc8, 0x3d, 0xc9, 0x75, 0x03, 0x24,
+    0x07, 0xe4, 0x8c, 0xe4, 0xbd, 0xab, 0x53, 0xb9, 0x3c, 0x24, 0xd0, 0xdd, 0x68, 0xf4, 0x37, 0x1a,
+    0xdc, 0xda, 0x22, 0x23, 0x25, 0x45, 0x42, 0xc9, 0xe4, 0xee, 0xe3, 0x7f, 0xfd, 0x67, 0x01, 0x0f,
+    0x4e, 0xc1, 0xfc, 0x2d, 0x9e, 0x84, 0xec, 0xc6, 0x9b, 0xaa, 0x38, 0x72, 0xc9, 0x26, 0x09, 0x69,
+    0xc2, 0x48, 0x2a, 0x7c, 0xce, 0x24, 0x3e, 0x2d, 0xc8, 0xe1, 0xe5, 0xeb, 0x3e, 0xc9, 0x0c, 0x62,
+    0x46, 0x63, 0x4a, 0xae, 0x59, 0xa6, 0x60, 0x80, 0xaa, 0x32, 0x58, 0x24, 0x74, 0x63, 0x6b, 0x8b,
+    0x70, 0xe2, 0xe7, 0x63, 0x21, 0x45, 0x41, 0x01, 0x26, 0x95, 0x0b, 0xb6, 0xd0, 0xff, 0x4f, 0xa2,
+    0xdb, 0x4f, 0x21, 0x95, 0xb3, 0xdb, 0xdf, 0x3c, 0x72, 0x09, 0xf4, 0x8a, 0x6c, 0x51, 0x22, 0x62,
+    0x02, 0x54, 0xb7, 0x68, 0xca, 0xb7, 0x90, 0x48, 0x9e, 0xf5, 0x61, 0x39, 0xc5, 0x62, 0xb2, 0x88,
+    0x39, 0x4d, 0x4a, 0xa4, 0x07, 0xc8, 0x65, 0x30, 0x15, 0xe1, 0xe2, 0xf6, 0x53, 0x45, 0x4e, 0x83,
+    0xb3, 0x39, 0x4b, 0x54, 0x46, 0x9c, 0x13, 0xfc, 0x1d, 0x89, 0x5c, 0x06, 0xcc, 0xf5, 0xc8, 0x11,
+    0x4c, 0x5b, 0x23, 0x84, 0x46, 0xbe, 0x00, 0x8a, 0x44, 0x84, 0xb1, 0x28, 0x38, 0x43, 0x7a, 0x4e,
+    0xc4, 0x63, 0x0e, 0x3c, 0xe7, 0x7e, 0x36, 0x93, 0xa5, 0x0f, 0xb0, 0xb0, 0x7d, 0xdc, 0xac, 0x08,
+    0xd3, 0x52, 0x95, 0xc0, 0x36, 0x67, 0x24, 0x10, 0x64, 0x74, 0x75, 0x78, 0xf5, 0xfd, 0xe8, 0x97,
+    0xcb, 0x8b, 0xd3, 0xd3, 0x5f, 0xce, 0x46, 0x1e, 0xf9, 0x0b, 0x95, 0x8a, 0x92, 0x82, 0xa8, 0x88,
+    0x11, 0x04, 0x01, 0xe0, 0x6a, 0xbf, 0xf8, 0xa6, 0x80, 0x4b, 0x10, 0x47, 0x2a, 0xee, 0x3e, 0xde,
+    0x7e, 0x0a, 0x16, 0x2c, 0xe1, 0xf4, 0x80, 0x44, 0x1c, 0x36, 0x45, 0x16, 0xb0, 0xed, 0x05, 0xbb,
+    0xfb, 0x75, 0xb9, 0x13, 0x4e, 0x54, 0x19, 0xcd, 0x44, 0x9f, 0x4c, 0xc2, 0x12, 0x28, 0x46, 0x62,
+    0x92, 0xeb, 0x49, 0xbf, 0xbc, 0xfb, 0x28, 0x48, 0x91, 0xf2, 0x0c, 0x58, 0xf2, 0x36, 0x36, 0xe6,
+    0x54, 0x76, 0xd8, 0x20, 0xcf, 0xc9, 0xee, 0x60, 0x30, 0x38, 0xd0, 0x53, 0x27, 0x3f, 0x9c, 0x9c,
+    0x5f, 0x8d, 0x7e, 0x39, 0x3b, 0xfc, 0x11, 0x86, 0x9f, 0x1e, 0x10, 0x60, 0xe6, 0x3b, 0x3a, 0xab,
+    0x31, 0xac, 0xd9, 0x02, 0xf6, 0x93, 0xa0, 0xac, 0x55, 0xe6, 0x4d, 0x35, 0xaa, 0x96, 0xde, 0x88,
+    0xfd, 0x15, 0x10, 0x37, 0x87, 0x1a, 0xf3, 0x2d, 0x93, 0xd9, 0x35, 0xd5, 0x2c, 0x97, 0x0d, 0xcb,
+    0x7d, 0x32, 0x03, 0xe9, 0x48, 0x90, 0xfc, 0x75, 0x7e, 0xf7, 0x3b, 0x89, 0x69, 0x5c, 0x12, 0x67,
+    0x73, 0x08, 0x58, 0x77, 0xbf, 0xd3, 0x30, 0xa1, 0xae, 0x26, 0x96, 0x8a, 0x28, 0xba, 0xe2, 0x31,
+    0x93, 0x30, 0x9e, 0xe4, 0x51, 0x64, 0xb8, 0x8b, 0xf8, 0x9c, 0xd5, 0x03, 0xb8, 0x80, 0xa5, 0x16,
+    0xb3, 0xf1, 0x34, 0xcf, 0xa6, 0x04, 0x84, 0x41, 0xef, 0x3e, 0xd2, 0x06, 0x63, 0x04, 0x56, 0xd0,
+    0x42, 0xbb, 0x40, 0xbb, 0x00, 0x69, 0x92, 0x94, 0xdd, 0x7d, 0x04, 0x8b, 0x8a, 0xf9, 0x84, 0x16,
+    0x33, 0x90, 0xaa, 0xc6, 0xef, 0x93, 0x7c, 0x91, 0xeb, 0x19, 0x8e, 0xe6, 0x66, 0xf8, 0x86, 0xe7,
+    0x98, 0x93, 0x47, 0x21, 0x8b, 0x14, 0x7d, 0xd4, 0x50, 0x7e, 0xc3, 0xc6, 0x79, 0xc6, 0x42, 0xa0,
+    0x3d, 0xa6, 0x51, 0xc6, 0x34, 0xf1, 0x11, 0xd8, 0x21, 0xb0, 0x0d, 0xd6, 0x01, 0x02, 0xe7, 0x77,
+    0x1f, 0xd1, 0xe4, 0x85, 0xb6, 0x32, 0xe0, 0x29, 0x44, 0x13, 0x86, 0x85, 0xb5, 0xb9, 0x97, 0x46,
+    0x65, 0xb6, 0x91, 0x6c, 0x6c, 0x8c, 0xf3, 0x24, 0x50, 0x5c, 0x24, 0xc4, 0x2f, 0x5f, 0x87, 0x0e,
+    0x0f, 0x5d, 0xf2, 0x37, 0x22, 0x99, 0xca, 0x65, 0x02, 0x64, 0x82, 0x3c, 0x86, 0x0d, 0x7b, 0x13,
+    0xa6, 0x4e, 0x22, 0x86, 0x8f, 0x47, 0x15, 0xd0, 0x01, 0xf9, 0xb0, 0xc4, 0xcc, 0xa6, 0xa2, 0x80,
+    0xc1, 0x3e, 0x11, 0x09, 0x62, 0xd7, 0x84, 0x3c, 0xd0, 0x42, 0xc4, 0xbc, 0x90, 0x67, 0x69, 0x44,
+    0x4b, 0xe0, 0x19, 0x40, 0x5f, 0x92, 0x5e, 0x8f, 0xec, 0x93, 0x5e, 0x22, 0x12, 0xd6, 0x6b, 0x13,
+    0x61, 0xea, 0x8a, 0xdd, 0x28, 0x4d, 0x47, 0xc1, 0x43, 0x8b, 0x12, 0x0e, 0x1c, 0x8b, 0x44, 0x01,
+    0x07, 0x40, 0x07, 0xdf, 0x10, 0x17, 0x2d, 0xf7, 0x78, 0x41, 0x33, 0x30, 0x5c, 0xb3, 0x4b, 0xb0,
+    0x91, 0x45, 0xa9, 0x58, 0x94, 0xb0, 0x6b, 0x50, 0x28, 0x08, 0x3d, 0xe0, 0xc4, 0xb9, 0x06, 0x73,
+    0x02, 0x5f, 0x8e, 0xa9, 0x7a, 0x95, 0x4b, 0x8a, 0x6b, 0x8d, 0x58, 0x00, 0xa0, 0x63, 0x2e, 0xe3,
+    0x82, 0x4a, 0xe6, 0x2e, 0x79, 0x18, 0xc7, 0x08, 0xe3, 0x64, 0x2c, 0x80, 0xd5, 0x37, 0x08, 0xfc,
+    0x69, 0xd3, 0xd8, 0x46, 0x79, 0xd7, 0x30, 0x4e, 0x62, 0x49, 0xc8, 0x49, 0xc8, 0x33, 0x32, 0x1c,
+    0xe0, 0xb6, 0x06, 0x7a, 0x5f, 0x3d, 0x97, 0x7c, 0x49, 0x12, 0x60, 0xee, 0x40, 0xa3, 0xf3, 0x31,
+    0x41, 0x6a, 0xe4, 0x05, 0xd8, 0xf6, 0xde, 0x93, 0xc1, 0xc0, 0xad, 0x11, 0xcf, 0xa8, 0x9a, 0x7a,
+    0xe3, 0x48, 0x08, 0xbd, 0x1a, 0xd9, 0xaa, 0xa7, 0xbf, 0x24, 0xbd, 0x90, 0xf4, 0xe0, 0xa7, 0x03,
+    0xf0, 0x07, 0x03, 0x00, 0x80, 0x3b, 0x7b, 0x15, 0xdc, 0xb4, 0xb7, 0xb2, 0x86, 0x99, 0xbb, 0x6f,
+    0x89, 0x25, 0xa6, 0x5e, 0x21, 0xdd, 0x76, 0x56, 0x16, 0x41, 0x10, 0x80, 0xdc, 0x1b, 0xb8, 0x1a,
+    0x30, 0x5e, 0x5d, 0x62, 0xef, 0x81, 0x05, 0xf6, 0x0c, 0xf9, 0xb8, 0x26, 0x6f, 0x68, 0x56, 0xa3,
+    0x59, 0x45, 0xab, 0x42, 0xc6, 0xb9, 0x6a, 0xf4, 0x83, 0x65, 0x84, 0x8a, 0xfa, 0x11, 0x7b, 0x03,
+    0xe6, 0x14, 0xb0, 0x28, 0xca, 0x6c, 0x2d, 0x28, 0xf4, 0xcc, 0xc6, 0x22, 0x03, 0xc9, 0xc0, 0xc7,
+    0x2a, 0xa3, 0x74, 0x7a, 0x4a, 0xf6, 0x5c, 0x43, 0x5e, 0xe3, 0x79, 0xa0, 0xef, 0x13, 0x1a, 0x4c,
+    0x9d, 0xa5, 0xd6, 0x1a, 0x8d, 0x36, 0xf4, 0xc2, 0x87, 0xe8, 0x85, 0x35, 0x3d, 0xfc, 0x53, 0x61,
+    0xc7, 0x00, 0x03, 0x6b, 0x4e, 0x7a, 0x34, 0x4d, 0x59, 0x12, 0x1e, 0x4f, 0x79, 0x14, 0x3a, 0x2a,
+    0xac, 0xf0, 0x3e, 0xb8, 0xad, 0xed, 0x2a, 0xd9, 0xde, 0x27, 0xe0, 0x44, 0xe5, 0x2b, 0x36, 0xa6,
+    0x79, 0xa4, 0xae, 0xa6, 0xb0, 0xaa, 0x83, 0x79, 0xa5, 0xe6, 0x11, 0xec, 0xfa, 0x4c, 0x80, 0x87,
+    0x42, 0x80, 0x98, 0x89, 0x64, 0xcc, 0x27, 0x60, 0xb8, 0xc1, 0x75, 0x2b, 0xe2, 0x42, 0x28, 0x2b,
+    0xd5, 0x4c, 0x14, 0x09, 0x9f, 0xe9, 0xd8, 0x5d, 0x94, 0xbe, 0x84, 0x20, 0x44, 0x0a, 0x70, 0xfa,
+    0x2c, 0x61, 0x13, 0x81, 0x51, 0x1e, 0xdd, 0x60, 0x99, 0xb6, 0x02, 0xd6, 0x28, 0x33, 0x12, 0x01,
+    0x8d, 0x46, 0x4a, 0x48, 0x3a, 0x61, 0xe8, 0xdd, 0xaf, 0x21, 0x5d, 0xc1, 0xae, 0x91, 0x91, 0x9e,
+    0x5b, 0x2b, 0xd8, 0x6c, 0xa0, 0x11, 0x51, 0xfd, 0x50, 0x09, 0xc9, 0x03, 0x87, 0x3d, 0x54, 0x4a,
+    0x72, 0x3f, 0x57, 0xcc, 0xe9, 0x85, 0x54, 0xd1, 0x4d, 0x43, 0xa0, 0x4f, 0x70, 0x2f, 0xe8, 0x13,
+    0xf8, 0xab, 0xdd, 0x22, 0xe2, 0x93, 0xa9, 0xaa, 0x45, 0xaa, 0xbd, 0xda, 0x2c, 0x36, 0x2a, 0xb8,
+    0x0a, 0xa6, 0x3d, 0xd7, 0x0b, 0xa6, 0x2c, 0x98, 0xe9, 0xc0, 0x86, 0x38, 0x6d, 0x59, 0xe9, 0x38,
+    0x7f, 0xca, 0x13, 0x06, 0x59, 0x2f, 0x61, 0xb6, 0x4d, 0x3c, 0xa4, 0xc2, 0x90, 0xcf, 0x7b, 0x6e,
+    0x9f, 0x44, 0x00, 0x82, 0x68, 0x9e, 0x12, 0xa7, 0x02, 0xe2, 0xe4, 0x31, 0xcd, 0x98, 0x53, 0x31,
+    0x12, 0x56, 0x11, 0x2a, 0xc8, 0x32, 0x0c, 0x3d, 0x00, 0xd9, 0x4b, 0x69, 0x18, 0xf2, 0x64, 0xb2,
+    0x4f, 0xb6, 0xd3, 0x9b, 0x03, 0xe2, 0x0b, 0x19, 0x32, 0xb9, 0xe9, 0x0b, 0xa5, 0x44, 0xbc, 0x4f,
+    0x86, 0xe9, 0x0d, 0xc9, 0x44, 0xc4, 0x43, 0xf2, 0x98, 0x31, 0x76, 0x60, 0x39, 0x47, 0xe4, 0xe9,
+    0x9a, 0xe3, 0x62, 0xec, 0xf4, 0xfc, 0x88, 0x82, 0xf1, 0xa0, 0xab, 0x0c, 0xc8, 0xdf, 0xff, 0x4e,
+    0xac, 0x19, 0xc9, 0x40, 0x64, 0xeb, 0xa7, 0x40, 0x77, 0xb3, 0xf5, 0x33, 0x42, 0xd1, 0x6a, 0xc2,
+    0x6d, 0x6c, 0xae, 0xcb, 0xf7, 0x97, 0xc0, 0x78, 0x20, 0x22, 0x21, 0xf7, 0x1f, 0x87, 0xc1, 0xce,
+    0xee, 0x93, 0xdd, 0x03, 0x08, 0x78, 0x89, 0xda, 0x2c, 0x18, 0x8a, 0x7d, 0xdf, 0x17, 0x51, 0x58,
+    0x33, 0xdb, 0xb5, 0x64, 0x14, 0x4d, 0xcb, 0x50, 0x43, 0x2d, 0x7b, 0x30, 0xc0, 0x73, 0x51, 0x94,
+    0x3a, 0x8d, 0x9b, 0xd4, 0xde, 0xae, 0x58, 0x30, 0xc5, 0xc0, 0x14, 0x54, 0x37, 0x04, 0x32, 0xd6,
+    0x4c, 0xdc, 0xfd, 0x1a, 0xe4, 0x7d, 0x78, 0xbc, 0x86, 0x98, 0x2b, 0xb1, 0x28, 0x2a, 0x4a, 0x90,
+    0x24, 0x6d, 0xd9, 0x3b, 0xf8, 0x88, 0x4e, 0x9f, 0x2b, 0x5a, 0x64, 0x73, 0x60, 0xc4, 0x18, 0x85,
+    0x21, 0x5f, 0x1b, 0x0a, 0x4a, 0xf6, 0x0b, 0x36, 0xf7, 0x20, 0x52, 0x67, 0xb5, 0xd9, 0x69, 0x37,
+    0x73, 0x01, 0xa7, 0xb3, 0x91, 0x5e, 0x4f, 0x27, 0xc3, 0x47, 0x47, 0x20, 0x49, 0xe4, 0x18, 0x8b,
+    0x8f, 0x47, 0x9a, 0x0a, 0x80, 0xda, 0x1e, 0xda, 0xb1, 0xa6, 0x6a, 0xa9, 0x02, 0xe6, 0x18, 0x81,
+    0x49, 0xb0, 0x44, 0x80, 0x92, 0x2c, 0xf1, 0x22, 0x96, 0x4c, 0xd4, 0x94, 0xbc, 0xb0, 0x4a, 0x14,
+    0xbd, 0xae, 0x64, 0xb1, 0x98, 0xb3, 0x9a, 0xd8, 0x1a, 0xe6, 0xda, 0xd6, 0x0b, 0xa4, 0xc0, 0x86,
+    0x46, 0xba, 0x30, 0x74, 0x5a, 0x11, 0x8d, 0x36, 0xdb, 0xce, 0xd4, 0x61, 0xc4, 0xa4, 0xb2, 0xf7,
+    0x0d, 0x31, 0x8c, 0xf2, 0xe8, 0x58, 0xe4, 0xb8, 0x3b, 0xd4, 0xbe, 0x15, 0xbe, 0xa8, 0x17, 0x44,
+    0x34, 0xcb, 0xce, 0x69, 0x8c, 0x55, 0x46, 0x8f, 0x22, 0x2e, 0xd1, 0xff, 0x6f, 0x8a, 0x59, 0xef,
+    0xc0, 0x82, 0xe3, 0x49, 0xc2, 0xe4, 0xb7, 0x57, 0x67, 0xa7, 0x08, 0xf7, 0xcc, 0x7f, 0xf1, 0xfa,
+    0xfc, 0xea, 0xe4, 0xcd, 0xf9, 0xc9, 0x15, 0x79, 0x75, 0x31, 0xba, 0xba, 0xfd, 0xc7, 0xe5, 0xf9,
+    0xbb, 0x67, 0x5b, 0xfe, 0x8b, 0x0a, 0xe5, 0x03, 0x61, 0x50, 0x53, 0xfc, 0x6b, 0xeb, 0xf8, 0x60,
+    0xe4, 0x0f, 0x2d, 0x64, 0x91, 0x35, 0x00, 0x5a, 0x4c, 0x5a, 0x3e, 0x5d, 0xc5, 0x5d, 0xbe, 0xb9,
+    0x38, 0x3a, 0x3d, 0x39, 0x7b, 0x47, 0x7e, 0x22, 0xa3, 0xd7, 0x27, 0xc7, 0xaf, 0x6f, 0x7f, 0x25,
+    0x0e, 0x26, 0x10, 0x5b, 0x02, 0x90, 0x29, 0xb6, 0x96, 0x63, 0xa7, 0xba, 0xf8, 0x85, 0x31, 0xb7,
+    0xe6, 0x7c, 0x43, 0xff, 0xe8, 0x3a, 0x04, 0x84, 0x79, 0x44, 0x83, 0x99, 0x18, 0x8f, 0x21, 0x10,
+    0x65, 0x9e, 0x6f, 0x9e, 0x31, 0xe5, 0xbf, 0x00, 0x29, 0x1a, 0xf8, 0xba, 0xd6, 0x58, 0xc2, 0x62,
+    0xe9, 0x07, 0xf0, 0x75, 0x01, 0x60, 0xa1, 0xa1, 0x85, 0xb4, 0xa8, 0x1f, 0x97, 0x41, 0x84, 0xb0,
+    0x5f, 0x7c, 0x91, 0x79, 0x52, 0x40, 0xf0, 0x93, 0x2d, 0xb5, 0x55, 0x43, 0x96, 0x18, 0xad, 0xd5,
+    0x34, 0xae, 0x2e, 0x0f, 0x35, 0x73, 0x06, 0xd6, 0xc3, 0xea, 0x90, 0x59, 0xf9, 0xa6, 0x8b, 0x70,
+    0xca, 0xc6, 0xca, 0x86, 0x07, 0x0b, 0xa4, 0x3c, 0x81, 0x30, 0x85, 0xec, 0x2d, 0xd1, 0x6a, 0x5b,
+    0xd2, 0x38, 0x47, 0x14, 0x52, 0x62, 0x15, 0x27, 0x0a, 0x1e, 0x82, 0x21, 0x3f, 0x5f, 0x12, 0x48,
+    0xa5, 0x98, 0x40, 0x34, 0xca, 0x2e, 0x03, 0x2d, 0xc6, 0x3f, 0x58, 0x9a, 0x6a, 0xed, 0xf2, 0x48,
+    0x88, 0xd6, 0xc2, 0x05, 0xe5, 0x0a, 0xc7, 0xd6, 0xf3, 0x8a, 0x33, 0x6f, 0xf9, 0x98, 0xb7, 0x30,
+    0xe0, 0x1d, 0x65, 0xff, 0x72, 0x75, 0x08, 0x16, 0x26, 0x99, 0xce, 0x0e, 0xff, 0xfd, 0x6f, 0xff,
+    0xd1, 0xbb, 0x9f, 0xe4, 0x9f, 0x0b, 0x9b, 0xe0, 0x04, 0x44, 0x55, 0xd0, 0xb2, 0x43, 0xd3, 0x1a,
+    0x5d, 0x4b, 0xb6, 0x63, 0x20, 0xa7, 0xd4, 0x90, 0xae, 0xb4, 0x18, 0x55, 0xaf, 0x2d, 0x3d, 0x36,
+    0x83, 0x9d, 0xba, 0xc1, 0xd7, 0x82, 0xac, 0x67, 0xd7, 0x72, 0x5d, 0x93, 0xff, 0x81, 0x46, 0xb0,
+    0x82, 0xef, 0x05, 0x98, 0xc3, 0x65, 0x0c, 0xe9, 0xed, 0x25, 0xbc, 0x71, 0xb0, 0x7c, 0x99, 0x30,
+    0xd5, 0x66, 0xb6, 0x1e, 0xc5, 0x64, 0x0e, 0xa7, 0x47, 0x38, 0xe7, 0xc9, 0x70, 0x01, 0x25, 0xfb,
+    0x3d, 0x82, 0xa9, 0x97, 0x78, 0x9d, 0x8c, 0xc5, 0xca, 0x1a, 0x3d, 0xe7, 0x2d, 0xff, 0x86, 0xeb,
+    0x2a, 0xcc, 0x6f, 0x8b, 0x1b, 0x20, 0x25, 0x9e, 0x78, 0xcd, 0x54, 0x57, 0x6a, 0xae, 0xe6, 0xa4,
+    0x3a, 0x5b, 0x1a, 0x10, 0xfd, 0x6c, 0x01, 0x74, 0xe4, 0xb9, 0x64, 0xe8, 0x12, 0xcc, 0x51, 0xeb,
+    0x09, 0x25, 0x83, 0x2f, 0x67, 0xd9, 0xaa, 0xb3, 0x9d, 0x14, 0x31, 0xd5, 0x40, 0x0c, 0x1e, 0xce,
+    0x32, 0xc8, 0xc9, 0xdf, 0xf0, 0x1b, 0x16, 0x3a, 0x43, 0x77, 0x15, 0xf6, 0x3b, 0xae, 0x40, 0x22,
+    0x1a, 0xfa, 0x5a, 0x3f, 0xae, 0x85, 0xaf, 0x3d, 0x3e, 0x87, 0xe8, 0x52, 0x69, 0xd3, 0xc7, 0xe7,
+    0x96, 0x2a, 0xcd, 0xc8, 0x7a, 0x8f, 0x3c, 0x15, 0x59, 0x66, 0x02, 0x05, 0x02, 0x79, 0x91, 0xd0,
+    0x5e, 0x71, 0x8f, 0xd0, 0x45, 0xa6, 0xda, 0xb0, 0x76, 0x64, 0x32, 0x83, 0x19, 0x44, 0xb5, 0x46,
+    0x48, 0x1d, 0xfc, 0x37, 0x58, 0x00, 0x98, 0xd5, 0x14, 0xe4, 0xf5, 0xc8, 0xbc, 0xaf, 0x6e, 0xfd,
+    0x2c, 0x33, 0xa2, 0x8c, 0xb3, 0xc9, 0xea, 0xe4, 0xf7, 0xa9, 0x32, 0xb1, 0xca, 0x2e, 0xbf, 0xbd,
+    0x5c, 0x8f, 0x8e, 0xea, 0x32, 0xbc, 0x1b, 0xb3, 0x30, 0xca, 0xe5, 0x69, 0x2d, 0x20, 0xfd, 0xd2,
+    0x95, 0xa0, 0x1e, 0x3c, 0x91, 0x52, 0x03, 0x39, 0x35, 0x14, 0xf9, 0xe3, 0x1f, 0x49, 0xfd, 0xec,
+    0x51, 0xc8, 0x68, 0xf3, 0x26, 0x65, 0x56, 0xb2, 0x35, 0xc4, 0x3a, 0x4e, 0x92, 0x29, 0x2b, 0xb7,
+    0x19, 0xd2, 0x26, 0xea, 0xd9, 0x82, 0x55, 0x9d, 0x4c, 0xd0, 0x59, 0x07, 0x0d, 0xf9, 0xf0, 0x2f,
+    0x57, 0xef, 0xde, 0x9e, 0x1f, 0x12, 0xc7, 0xd0, 0x30, 0x06, 0xfa, 0xb6, 0x34, 0xfd, 0x09, 0xec,
+    0xdf, 0x38, 0x7f, 0xae, 0x3a, 0x3f, 0x6e, 0xaf, 0x45, 0xb9, 0x2a, 0x90, 0xb0, 0x28, 0x5a, 0x4f,
+    0xf9, 0xf1, 0x78, 0xfc, 0xf5, 0xd3, 0x81, 0x39, 0xb4, 0x3d, 0x7e, 0x12, 0xd0, 0xf1, 0xee, 0xa0,
+    0xb7, 0x3e, 0x04, 0x69, 0xcc, 0x6f, 0x20, 0xed, 0x64, 0x4d, 0x42, 0x01, 0x4a, 0xeb, 0x72, 0x93,
+    0x35, 0xa5, 0x53, 0x54, 0xdb, 0x59, 0x50, 0x2e, 0x52, 0x2d, 0x05, 0x03, 0xcf, 0x47, 0x22, 0x6c,
+    0x1c, 0x1c, 0x5e, 0x57, 0x4b, 0x1a, 0xa3, 0x22, 0x0f, 0xe7, 0x56, 0x8f, 0x34, 0x85, 0x2d, 0x75,
+    0x5d, 0x2b, 0x15, 0x5e, 0x46, 0xe3, 0x34, 0x62, 0x19, 0xaa, 0x0d, 0xde, 0xd0, 0x42, 0x6d, 0xa0,
+    0xd6, 0x59, 0xaa, 0x39, 0x6a, 0xfd, 0x5c, 0x40, 0x90, 0x48, 0xfa, 0x44, 0x57, 0xa1, 0xd8, 0x2e,
+    0x2b, 0xa1, 0x24, 0x7f, 0x6f, 0x69, 0xaa, 0x3a, 0xe7, 0xa0, 0x67, 0x9b, 0x0c, 0x0e, 0x72, 0x1d,
+    0xa5, 0x34, 0x01, 0x22, 0x7b, 0x6d, 0x28, 0x64, 0xb4, 0x75, 0x1c, 0x92, 0x1d, 0x32, 0xf6, 0xc9,
+    0x62, 0xe9, 0x23, 0x6b, 0x51, 0xbb, 0xec, 0x35, 0x9b, 0xc3, 0xc7, 0xca, 0x4f, 0xad, 0x88, 0x60,
+    0x12, 0x19, 0xce, 0xa5, 0xbb, 0x03, 0xfd, 0xf3, 0xf5, 0xae, 0xf9, 0xf9, 0x1a, 0x7f, 0x62, 0x7a,
+    0x73, 0x96, 0xbd, 0x77, 0xad, 0xd3, 0x59, 0xa3, 0x14, 0x9e, 0x04, 0xda, 0x46, 0xe0, 0x97, 0x87,
+    0x58, 0x7f, 0xda, 0x9e, 0x01, 0x83, 0x17, 0xc0, 0x94, 0xf6, 0x0a, 0x78, 0xf6, 0x04, 0xbc, 0x58,
+    0x0e, 0xd0, 0x0c, 0xad, 0x8b, 0x2e, 0x15, 0xee, 0x31, 0xcd, 0x33, 0x74, 0xd8, 0x1a, 0xd6, 0x0b,
+    0x70, 0x60, 0x5d, 0x88, 0xa9, 0x10, 0xda, 0xc5, 0x48, 0x83, 0x16, 0x2e, 0xdb, 0x17, 0xee, 0x03,
+    0xd8, 0x4d, 0x94, 0x69, 0x10, 0xa5, 0x1d, 0x67, 0x3a, 0x51, 0x09, 0x80, 0x0e, 0xe7, 0x60, 0xb0,
+    0x15, 0x3c, 0xc5, 0x67, 0xea, 0xf3, 0x88, 0xab, 0xd2, 0x96, 0xef, 0xce, 0x4a, 0x84, 0x06, 0xe8,
+    0x33, 0x38, 0xfe, 0x55, 0x78, 0x81, 0x76, 0x85, 0x97, 0x36, 0xcf, 0x31, 0xcc, 0x22, 0xab, 0xe8,
+    0x61, 0x9b, 0xbd, 0xb5, 0xe8, 0xfe, 0xf8, 0x21, 0x74, 0x7f, 0xfc, 0x20, 0xba, 0xf6, 0x3e, 0x1b,
+    0x7f, 0x0d, 0xcc, 0x85, 0x9f, 0x31, 0x39, 0x67, 0x61, 0x47, 0x9a, 0xd5, 0xa8, 0x25, 0x48, 0x1b,
+    0x49, 0xef, 0xb8, 0x22, 0x6c, 0x44, 0xa7, 0x47, 0xd6, 0x40, 0xb6, 0x44, 0xdd, 0x92, 0x72, 0x63,
+    0x3c, 0x57, 0x68, 0xc6, 0x35, 0x97, 0xa8, 0xf7, 0x6c, 0x79, 0xb0, 0xa8, 0xcb, 0x51, 0x6d, 0x84,
+    0x7e, 0x13, 0x18, 0x00, 0xd4, 0x0e, 0x0c, 0xdc, 0xbf, 0x27, 0x2e, 0x58, 0x24, 0xd7, 0xf7, 0x3b,
+    0x10, 0x75, 0xbd, 0x4b, 0x05, 0x5e, 0x02, 0x45, 0x7d, 0x9f, 0x54, 0x92, 0x6b, 0xa4, 0x13, 0xc0,
+    0x29, 0xbf, 0xd0, 0x06, 0x86, 0xae, 0xb2, 0x74, 0x13, 0x13, 0xeb, 0xcd, 0xe9, 0xac, 0x1b, 0xeb,
+    0xef, 0x3d, 0xbe, 0x55, 0x87, 0xaf, 0x6e, 0x90, 0x37, 0x40, 0xb5, 0x14, 0xea, 0x86, 0xa0, 0x7d,
+    0x6e, 0xb3, 0x03, 0x71, 0x0d, 0xbe, 0xba, 0xc3, 0xea, 0x18, 0xf9, 0xd9, 0xf3, 0x5d, 0xd3, 0x8a,
+    0xf9, 0x50, 0x1d, 0x07, 0x9b, 0xae, 0x71, 0x45, 0x1c, 0x5e, 0x5a, 0xe9, 0x32, 0x65, 0x72, 0x0c,
+    0x04, 0x66, 0x3a, 0xdc, 0xe3, 0x4b, 0x57, 0xf3, 0xb0, 0xdc, 0x0f, 0x4c, 0x66, 0xc0, 0x85, 0x06,
+    0x99, 0x9b, 0xe7, 0x0a, 0x6a, 0xb5, 0xb3, 0x93, 0x79, 0xd8, 0xd3, 0x38, 0x13, 0x21, 0xeb, 0x1c,
+    0x0d, 0x23, 0x41, 0xc3, 0xea, 0x60, 0x58, 0x0b, 0x15, 0x8a, 0x6e, 0x2a, 0xd1, 0xff, 0xa1, 0xae,
+    0x75, 0x9a, 0x9e, 0x74, 0x45, 0x7a, 0xcc, 0x14, 0x48, 0xa0, 0x67, 0xdd, 0x34, 0xbc, 0x64, 0xf3,
+    0xe7, 0x98, 0x7b, 0xea, 0x7d, 0xf4, 0x41, 0x1e, 0x01, 0x88, 0x89, 0xe9, 0x16, 0xeb, 0x66, 0xa6,
+    0x84, 0x64, 0x3d, 0x10, 0x40, 0x23, 0x4f, 0x4f, 0x4d, 0x59, 0x62, 0x09, 0x51, 0x6a, 0x33, 0xc1,
+    0xdc, 0x21, 0x3d, 0x31, 0x73, 0x89, 0x9a, 0x4a, 0x51, 0x90, 0x84, 0x15, 0x04, 0x4a, 0x01, 0xa8,
+    0x2c, 0xcc, 0xe1, 0x24, 0x07, 0xb3, 0xae, 0x1b, 0x04, 0xd2, 0xbb, 0xce, 0x44, 0xe2, 0x68, 0xb9,
+    0x76, 0xc8, 0xda, 0x47, 0x5d, 0x6b, 0x2e, 0xa0, 0xaa, 0xa5, 0xb8, 0x75, 0x19, 0xe9, 0xde, 0xb3,
+    0xf0, 0xff, 0xfa, 0x2c, 0x6a, 0x80, 0x3b, 0x1e, 0xa3, 0xad, 0xcb, 0xbe, 0xd7, 0x20, 0x0b, 0x92,
+    0xcb, 0xc5, 0xed, 0xa7, 0x10, 0xdf, 0x58, 0x6c, 0xe1, 0x3f, 0x20, 0xac, 0x2e, 0xe3, 0x5a, 0x6e,
+    0x4d, 0xff, 0x69, 0xca, 0x43, 0xc8, 0x1e, 0x3a, 0xf3, 0x62, 0x17, 0x04, 0x6c, 0x70, 0xce, 0x1c,
+    0xd7, 0x6d, 0xdd, 0x2c, 0xa0, 0x09, 0x55, 0xca, 0x5d, 0x2a, 0xbf, 0xdf, 0xb9, 0x1f, 0x71, 0x6d,
+    0x66, 0xea, 0x76, 0xcc, 0x4f, 0x85, 0xa4, 0x01, 0x85, 0x34, 0x9c, 0xaf, 0xb9, 0x79, 0x20, 0x8e,
+    0x7d, 0xef, 0x63, 0x4e, 0x10, 0x72, 0xc1, 0xfc, 0xc4, 0x6e, 0x6e, 0x5b, 0x4c, 0x55, 0xfb, 0xd0,
+    0x9d, 0x2b, 0xac, 0xe8, 0x96, 0x5d, 0xca, 0x9c, 0x59, 0xad, 0x17, 0x48, 0xbb, 0x10, 0x0e, 0x3c,
+    0xfb, 0x2e, 0x0a, 0x9b, 0x53, 0xcb, 0x7b, 0x88, 0x06, 0xd1, 0xdc, 0x46, 0x68, 0xcc, 0xfa, 0xca,
+    0x04, 0x4d, 0x68, 0x89, 0x58, 0x59, 0x6d, 0x3b, 0x40, 0xc0, 0xb6, 0x2e, 0x05, 0x01, 0x33, 0x4f,
+    0x20, 0xe8, 0x94, 0xb1, 0x6b, 0x6b, 0x28, 0xef, 0xde, 0x95, 0x3c, 0x32, 0x86, 0xf8, 0xa8, 0xbe,
+    0x5c, 0xab, 0xae, 0x46, 0xc8, 0x66, 0x75, 0xa9, 0xb1, 0x88, 0x39, 0xa0, 0x09, 0x7d, 0xd7, 0x17,
+    0x81, 0x44, 0xf0, 0xf2, 0x05, 0xf8, 0xc8, 0xb3, 0x3c, 0xe1, 0xb7, 0xbf, 0xc1, 0xf9, 0xba, 0xe1,
+    0xce, 0xa3, 0xa1, 0xe9, 0x44, 0x9d, 0xf2, 0x0c, 0x0c, 0x84, 0x49, 0x34, 0x3a, 0xa4, 0x8d, 0x59,
+    0xa2, 0x51, 0x36, 0xb3, 0xb5, 0x6d, 0xdf, 0xea, 0x7c, 0x37, 0xba, 0x38, 0xf7, 0x52, 0x2a, 0x33,
+    0xe6, 0x30, 0x0f, 0xdb, 0x9e, 0x96, 0xbe, 0x5a, 0xcd, 0x9e, 0x06, 0xa9, 0xd3, 0x12, 0xbe, 0x87,
+    0x07, 0xbd, 0x9f, 0xfb, 0x59, 0xd0, 0x1a, 0x59, 0x92, 0x5c, 0xa9, 0xa4, 0xea, 0x7e, 0xe8, 0x43,
+    0xec, 0x5d, 0xf8, 0xd7, 0x0c, 0x92, 0xfa, 0x8c, 0x95, 0x99, 0x13, 0xba, 0x6b, 0x62, 0xea, 0x6c,
+    0x9d, 0x89, 0x87, 0x3f, 0xcf, 0xde, 0x93, 0xe7, 0xcf, 0xcd, 0x7d, 0x96, 0x4b, 0x80, 0x4f, 0x06,
+    0x82, 0x68, 0x58, 0x81, 0xd9, 0xb6, 0xf7, 0xe9, 0x2e, 0x92, 0x3d, 0x8d, 0x5d, 0xda, 0x16, 0xd4,
+    0x87, 0xff, 0x27, 0x91, 0x41, 0xbe, 0x58, 0x11, 0x58, 0xab, 0xd5, 0x58, 0x4b, 0xa0, 0x4d, 0x08,
+    0x8c, 0x04, 0x83, 0x5b, 0xeb, 0x56, 0xc7, 0xde, 0x38, 0xba, 0x1b, 0xc3, 0x2b, 0x25, 0x66, 0x5b,
+    0x24, 0x6b, 0x5d, 0x01, 0x53, 0x52, 0x2c, 0x12, 0x5a, 0x70, 0x73, 0x85, 0x7c, 0x40, 0x8e, 0x4f,
+    0x2f, 0x46, 0x27, 0xaf, 0xf0, 0x92, 0x0b, 0x6f, 0x69, 0xc1, 0xfe, 0x76, 0x07, 0x3b, 0x78, 0x21,
+    0xab, 0xdd, 0x36, 0x2e, 0xf1, 0x4a, 0x6e, 0xe9, 0xa3, 0xb4, 0xa5, 0x55, 0xcd, 0x93, 0x64, 0x34,
+    0x2c, 0x8d, 0x89, 0x7d, 0x01, 0xa2, 0xb6, 0x5c, 0xc7, 0x33, 0xa4, 0x57, 0x35, 0x6e, 0x5f, 0x4e,
+    0xb6, 0x06, 0x97, 0xb7, 0x84, 0x4b, 0x87, 0xc6, 0xbf, 0xff, 0x6b, 0x24, 0xfa, 0xd0, 0xb9, 0xca,
+    0x40, 0x9a, 0x76, 0x1e, 0x83, 0x34, 0x93, 0xde, 0x13, 0x58, 0xf4, 0xde, 0x02, 0xa8, 0xd6, 0x9b,
+    0xa6, 0xfb, 0x0a, 0xd7, 0x2b, 0x37, 0xa6, 0x48, 0xbb, 0x89, 0xaa, 0xab, 0x4a, 0x9f, 0xf3, 0x8c,
+    0x9b, 0x02, 0x35, 0x98, 0xd2, 0x64, 0xc2, 0x5a, 0x16, 0x60, 0x73, 0xd0, 0x89, 0xcc, 0xb6, 0x86,
+    0x1f, 0x4c, 0xb3, 0xe6, 0x08, 0x59, 0x6f, 0x49, 0xb7, 0x95, 0x7f, 0x2a, 0x44, 0x94, 0xf0, 0x6b,
+    0x08, 0x46, 0xec, 0x3a, 0x83, 0x30, 0x68, 0x5d, 0xbc, 0x53, 0xec, 0x80, 0x2f, 0x73, 0x49, 0x6e,
+    0xb7, 0x52, 0xed, 0x04, 0xaf, 0xe9, 0x5c, 0x62, 0x4c, 0x6b, 0x3e, 0x19, 0xc0, 0x7b, 0xea, 0xdb,
+    0x4f, 0xd6, 0x45, 0xb5, 0x89, 0x6c, 0x26, 0x1e, 0xa2, 0xbd, 0x41, 0x88, 0xdf, 0xd0, 0x35, 0x18,
+    0xde, 0x6d, 0x97, 0x33, 0xa8, 0x30, 0xc9, 0x94, 0x63, 0x52, 0xe7, 0x7c, 0xbf, 0x63, 0x8d, 0xd5,
+    0x07, 0x0e, 0xc4, 0xe7, 0x09, 0x95, 0xb0, 0xc4, 0x42, 0x2e, 0x72, 0x48, 0x90, 0x32, 0x98, 0xf2,
+    0x22, 0x8f, 0xeb, 0xf6, 0xbd, 0xc1, 0x2e, 0xcd, 0x95, 0xbf, 0xfe, 0xf6, 0x61, 0x22, 0xc0, 0xa1,
+    0x67, 0x22, 0xcc, 0xaf, 0x19, 0x71, 0x5e, 0x81, 0xb3, 0xfc, 0xc0, 0x59, 0xd1, 0x07, 0xd6, 0x94,
+    0x8a, 0xd8, 0x26, 0x38, 0x12, 0xa7, 0x20, 0x39, 0x21, 0xe9, 0x82, 0xc8, 0x32, 0x03, 0x28, 0x0f,
+    0x90, 0x11, 0xff, 0x1b, 0x7d, 0xa5, 0x8a, 0x46, 0x8d, 0x1f, 0x25, 0xe0, 0xf7, 0x00, 0xf6, 0x0a,
+    0xfb, 0x08, 0x42, 0x40, 0x34, 0xe6, 0xcb, 0x0c, 0x36, 0x23, 0xc3, 0x3d, 0x72, 0xb4, 0x4f, 0x1e,
+    0xbd, 0x79, 0xf3, 0x6a, 0x08, 0x31, 0x1c, 0x6a, 0x26, 0x92, 0x3f, 0xed, 0x13, 0x29, 0xf0, 0x23,
+    0x09, 0x49, 0x66, 0xb9, 0x0f, 0xa2, 0x81, 0x7d, 0xe0, 0x60, 0x78, 0xf7, 0x31, 0x9f, 0x88, 0xbb,
+    0x7f, 0xde, 0xfe, 0xfb, 0x72, 0x3c, 0x23, 0xf9, 0x70, 0xaf, 0x6f, 0xa8, 0x76, 0xfe, 0x22, 0x1e,
+    0x2c, 0x7c, 0x5a, 0x83, 0xc2, 0x6a, 0x1a, 0x94, 0x2c, 0xa8, 0x64, 0x0b, 0x70, 0x63, 0xa1, 0x1d,
+    0x59, 0x0f, 0x81, 0x88, 0xee, 0x7e, 0x07, 0x77, 0x2e, 0x09, 0x64, 0xc8, 0x60, 0x4a, 0xf2, 0x9d,
+    0x6d, 0x43, 0xb1, 0xc2, 0xe5, 0x15, 0x97, 0x26, 0x57, 0xe2, 0x74, 0x1f, 0xcf, 0xa5, 0x67, 0x3c,
+    0x31, 0xf8, 0xf0, 0x7c, 0x38, 0x9f, 0x34, 0xcf, 0x67, 0xf4, 0xe6, 0x7e, 0xae, 0xf2, 0x14, 0xca,
+    0x68, 0x91, 0x84, 0x86, 0x71, 0x52, 0xd5, 0xd5, 0xcb, 0x81, 0xea, 0x04, 0xab, 0x37, 0x9c, 0x4a,
+    0xe1, 0x83, 0x6e, 0xf3, 0xa7, 0xed, 0xda, 0xf0, 0x5b, 0x23, 0x4b, 0xc7, 0xbe, 0x34, 0x40, 0x1b,
+    0x78, 0x7e, 0xef, 0xcd, 0x7c, 0x0f, 0xc5, 0x0f, 0xa7, 0x92, 0x9e, 0xeb, 0xcd, 0x69, 0x54, 0xfb,
+    0xbe, 0x5d, 0x37, 0x56, 0xfa, 0x79, 0x09, 0x74, 0x74, 0xe5, 0x08, 0xbf, 0xee, 0xda, 0xa2, 0xb0,
+    0x29, 0xf7, 0xa8, 0x94, 0xb4, 0x3c, 0xca, 0xc7, 0x63, 0x70, 0x3e, 0x1d, 0x49, 0x0d, 0x78, 0x28,
+    0x69, 0x51, 0x31, 0xf8, 0x70, 0xad, 0xf7, 0x30, 0xb3, 0xba, 0x81, 0xe9, 0xae, 0xad, 0xd7, 0x4c,
+    0x27, 0xa2, 0xb1, 0xf8, 0xde, 0x41, 0x55, 0x0e, 0x35, 0xd4, 0x2d, 0x16, 0x1c, 0x3f, 0x1f, 0xdb,
+    0x62, 0x9a, 0x57, 0x25, 0x48, 0x6d, 0xd1, 0x7a, 0x1e, 0x4f, 0x61, 0x63, 0xf1, 0x39, 0xf1, 0x19,
+    0x8e, 0x96, 0x65, 0x10, 0x60, 0x7a, 0x7e, 0xa9, 0xd8, 0xa9, 0x39, 0xb0, 0x3c, 0x43, 0x1b, 0x81,
+    0x32, 0x68, 0x8e, 0xc8, 0xdf, 0xf3, 0x44, 0x3d, 0x75, 0x06, 0x2e, 0xc4, 0x6c, 0xf2, 0x74, 0xbb,
+    0x33, 0xbc, 0xa3, 0x87, 0x9f, 0x7c, 0xad, 0x4b, 0x6c, 0x20, 0xda, 0xdd, 0xe4, 0x39, 0xd6, 0x69,
+    0x29, 0xec, 0x01, 0xdc, 0xd5, 0x7c, 0xa0, 0xd0, 0xab, 0xab, 0xec, 0x83, 0xea, 0xb0, 0xa2, 0x1b,
+    0xce, 0xd9, 0x02, 0xa0, 0x2d, 0xba, 0xbb, 0x2e, 0x7e, 0xbe, 0xc4, 0x52, 0x7b, 0x74, 0xb8, 0xe7,
+    0x80, 0x4d, 0x61, 0x68, 0x86, 0xc9, 0x40, 0xd3, 0xb7, 0xe7, 0x9e, 0x36, 0x73, 0x10, 0x5a, 0xec,
+    0xb9, 0x9d, 0x6d, 0x67, 0xb8, 0x5d, 0x4d, 0x2e, 0x0f, 0xa3, 0xa9, 0x42, 0x23, 0xfb, 0xf9, 0x7d,
+    0x1f, 0xac, 0x18, 0x1e, 0x06, 0xc6, 0x7c, 0xcd, 0x53, 0x4c, 0x6f, 0xde, 0xe8, 0x2e, 0xd6, 0xb0,
+    0x32, 0x2e, 0x48, 0xa4, 0x0e, 0x22, 0x89, 0xf1, 0x18, 0x47, 0xf7, 0x0e, 0xf4, 0xd3, 0x97, 0x9a,
+    0xef, 0x67, 0xcf, 0x49, 0x5b, 0x7c, 0xd5, 0xe4, 0x73, 0x9c, 0x5d, 0x69, 0x1a, 0x76, 0x18, 0x03,
+    0xc8, 0x16, 0x67, 0x4d, 0x15, 0x94, 0xa1, 0xa0, 0x1d, 0xdc, 0x09, 0x14, 0xdb, 0x4e, 0x06, 0x27,
+    0x69, 0x7c, 0x86, 0x31, 0xfc, 0xd9, 0x04, 0x3a, 0x2f, 0x9e, 0x6b, 0x19, 0xfc, 0x49, 0x8b, 0xc9,
+    0x85, 0x1a, 0x1c, 0xfc, 0x4e, 0xf1, 0xc4, 0xce, 0x85, 0x7a, 0x9b, 0xb0, 0xe0, 0xdf, 0x48, 0xb6,
+    0x8f, 0x7d, 0xf1, 0x38, 0xd9, 0x6f, 0x49, 0xcc, 0xec, 0xe1, 0x49, 0x23, 0x37, 0x3a, 0x5f, 0x37,
+    0xbf, 0x94, 0x79, 0x7c, 0xb3, 0x6e, 0xbe, 0x91, 0xfb, 0xc6, 0xba, 0x00, 0xb1, 0x0e, 0x63, 0x38,
+    0x68, 0x48, 0x86, 0x6b, 0x59, 0x6a, 0xd4, 0x65, 0x42, 0xc8, 0xbe, 0x6d, 0x19, 0x15, 0xc4, 0x13,
+    0xb7, 0x4e, 0xd9, 0x66, 0x1d, 0x94, 0x77, 0xea, 0xe5, 0xe9, 0x81, 0x51, 0xa3, 0x7e, 0x0b, 0x93,
+    0xb6, 0x50, 0x53, 0x8f, 0xce, 0xd1, 0x5c, 0xf7, 0x76, 0x77, 0x77, 0x76, 0x51, 0xae, 0xa9, 0x17,
+    0xdf, 0x80, 0x64, 0x8d, 0xba, 0xdd, 0xa5, 0xda, 0x71, 0xdc, 0x2a, 0x29, 0xe0, 0x68, 0x8e, 0x69,
+    0xca, 0x49, 0x5b, 0x87, 0x6c, 0x1c, 0xce, 0x84, 0x54, 0x56, 0x24, 0xa0, 0x10, 0x7e, 0xad, 0xb8,
+    0x42, 0x3d, 0xbc, 0x45, 0xf6, 0xbd, 0x6c, 0x59, 0x9b, 0xa1, 0x4a, 0x82, 0xcf, 0x79, 0xe7, 0xf1,
+    0x94, 0xe2, 0xe1, 0x10, 0x8c, 0x5c, 0xdd, 0xe0, 0x97, 0x18, 0x08, 0xa4, 0x7d, 0x0a, 0x0f, 0xe6,
+    0xdb, 0xcd, 0x67, 0x1b, 0x41, 0x73, 0xe9, 0x15, 0x40, 0xf9, 0x01, 0x27, 0x03, 0xf5, 0x16, 0xdf,
+    0x97, 0x0b, 0xbd, 0xd5, 0x53, 0x1a, 0xa8, 0x4f, 0xbe, 0xd5, 0x2f, 0x53, 0x7d, 0x5d, 0x0e, 0x6c,
+    0x52, 0x89, 0x03, 0xa8, 0x89, 0x34, 0x12, 0x0a, 0x9f, 0xbf, 0x45, 0x5e, 0x71, 0x78, 0x13, 0x0d,
+    0xbc, 0x21, 0x32, 0x9e, 0xc0, 0x9c, 0x66, 0x20, 0x4e, 0x73, 0xc5, 0x20, 0xd7, 0x97, 0x11, 0x5b,
+    0xd6, 0x1d, 0xbe, 0x08, 0x4b, 0xd7, 0x34, 0xa1, 0x2b, 0xae, 0xd4, 0x8d, 0xa7, 0x4b, 0x8f, 0x37,
+    0x50, 0x86, 0x3b, 0x40, 0x1f, 0xfe, 0xbd, 0x85, 0xe5, 0x2d, 0x01, 0x28, 0xfc, 0x30, 0xad, 0x32,
+    0x67, 0x27, 0xb5, 0xfb, 0x24, 0xf0, 0xf2, 0xb3, 0x35, 0x00, 0x9c, 0xbc, 0x07, 0x19, 0xee, 0x93,
+    0x01, 0x08, 0x43, 0x0d, 0xb0, 0xd8, 0x1b, 0xc2, 0xe0, 0xd2, 0xee, 0x97, 0x34, 0x7f, 0x6c, 0x55,
+    0xba, 0xca, 0xfe, 0x7e, 0x49, 0xe1, 0xf9, 0x09, 0xe2, 0xd7, 0x16, 0x71, 0x2c, 0x8f, 0x81, 0xdf,
+    0xb7, 0xcd, 0x37, 0x4c, 0x48, 0xe1, 0x5d, 0x8b, 0x42, 0x9c, 0x59, 0x24, 0x8c, 0x88, 0x36, 0x49,
+    0x9c, 0x01, 0x91, 0xca, 0x4a, 0xfe, 0x04, 0xac, 0x57, 0xc3, 0x4f, 0xdc, 0x16, 0x21, 0x1f, 0xa3,
+    0x8f, 0xbe, 0xb9, 0x00, 0x50, 0x67, 0x08, 0xdb, 0x07, 0xac, 0xa0, 0xe9, 0xdd, 0xa5, 0x6b, 0x3b,
+    0x3d, 0x2b, 0xd7, 0x0b, 0xa8, 0xf9, 0x1f, 0xc1, 0x64, 0x33, 0xf7, 0x01, 0x23, 0xee, 0x1e, 0x65,
+    0x50, 0xf8, 0x63, 0x1e, 0x45, 0x5a, 0x49, 0x18, 0x7f, 0xe5, 0xc4, 0xa7, 0xa0, 0x84, 0xe1, 0xf6,
+    0x4e, 0x7f, 0x7b, 0x77, 0xb7, 0x3f, 0xf0, 0xb6, 0x77, 0xdd, 0x4e, 0x23, 0xa1, 0xc6, 0xd1, 0xfa,
+    0xba, 0xe9, 0x93, 0x77, 0x0e, 0x9a, 0x3f, 0x08, 0xdc, 0x2f, 0xfa, 0xad, 0x6d, 0xe8, 0x89, 0x04,
+    0x0b, 0xfe, 0x0a, 0xc4, 0x75, 0x0f, 0x1e, 0x5e, 0xfd, 0xf1, 0x60, 0xf0, 0x95, 0x3f, 0x1e, 0xff,
+    0x0b, 0x0b, 0xd2, 0x39, 0xd2, 0x1d, 0x9a, 0x45, 0xb7, 0xdd, 0x75, 0xcd, 0x73, 0xb3, 0x79, 0xf4,
+    0x74, 0xed, 0xda, 0xba, 0xb7, 0xf8, 0x99, 0xed, 0x6b, 0x38, 0xfc, 0xb2, 0x40, 0xdf, 0x86, 0x6c,
+    0x3f, 0xa5, 0x5f, 0x3d, 0xd9, 0xc5, 0x4e, 0x9c, 0xa1, 0xd3, 0x4c, 0x98, 0x0f, 0x4a, 0xcc, 0x35,
+    0xc9, 0x78, 0x1c, 0x0c, 0x07, 0x5f, 0xf5, 0xdc, 0x87, 0x59, 0xae, 0x7d, 0xc5, 0xf0, 0x8b, 0x4f,
+    0x2b, 0x2c, 0xd7, 0x1e, 0xdf, 0xe5, 0x69, 0x3c, 0x39, 0x30, 0x63, 0xc2, 0x64, 0xc8, 0x21, 0x7e,
+    0x71, 0x73, 0x28, 0x39, 0x8d, 0x7a, 0x6d, 0x04, 0xdd, 0x87, 0xab, 0x8c, 0x0d, 0x6f, 0x26, 0x63,
+    0x3c, 0xbb, 0x43, 0x60, 0x1c, 0x0e, 0xdc, 0x35, 0x80, 0xbd, 0x81, 0x99, 0xd5, 0x36, 0x69, 0xf9,
+    0x9a, 0x6e, 0x76, 0xc3, 0x3a, 0x8e, 0x16, 0x1c, 0xc6, 0x46, 0x17, 0xf6, 0xec, 0x0c, 0x07, 0x03,
+    0xb0, 0x60, 0x18, 0xdb, 0xb2, 0x67, 0x5c, 0xab, 0x17, 0x6e, 0xee, 0x1a, 0x4c, 0x67, 0xba, 0xee,
+    0xc5, 0xae, 0xe6, 0xf7, 0x57, 0x02, 0xca, 0xfb, 0xdf, 0xd2, 0x44, 0x57, 0xb2, 0xfb, 0xfa, 0x42,
+    0xd5, 0xac, 0x88, 0x1c, 0x3b, 0xcb, 0x72, 0xd5, 0x4c, 0x59, 0xae, 0x5d, 0x7d, 0xd9, 0xf0, 0xc1,
+    0x7c, 0x3c, 0x9b, 0xd1, 0x39, 0x0b, 0x75, 0x27, 0x11, 0xbf, 0xd7, 0x79, 0xe8, 0xc3, 0xad, 0x83,
+    0x0d, 0xdd, 0xa7, 0x6d, 0xe0, 0xdd, 0xcf, 0x7c, 0x6a, 0xe5, 0xd8, 0xa4, 0x41, 0xe3, 0xe6, 0x7b,
+    0x2d, 0x20, 0xd3, 0x3a, 0xb7, 0x6c, 0xb4, 0x4a, 0xd1, 0x83, 0x8d, 0xff, 0x01, 0x6c, 0xb9, 0x24,
+    0x9f, 0x76, 0x2d, 0x00, 0x00,
+};
+
+const uint8_t STATIC_INDEX_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x95, 0x58, 0xcb, 0x72, 0xdb, 0x46,
+    0x16, 0xdd, 0xfb, 0x2b, 0x7a, 0x92, 0x72, 0x40, 0xd6, 0x04, 0x7c, 0x59, 0xd4, 0x83, 0xaf, 0x94,
+    0xa4, 0x48, 0x33, 0x4e, 0xa4, 0x91, 0xcb, 0x66, 0xa2, 0x9a, 0xe5, 0x05, 0xd0, 0x24, 0x5b, 0x04,
+    0xba, 0x51, 0xdd, 0x0d, 0x52, 0x60, 0x65, 0x91, 0xb8, 0x2a, 0x95, 0x0f, 0xc8, 0x2a, 0xe5, 0xfd,
+    0xfc, 0x80, 0x77, 0x53, 0xd9, 0x59, 0xfc, 0x91, 0x7c, 0xc9, 0xdc, 0x6e, 0x00, 0x24, 0xf8, 0x1a,
+    0xdb, 0x1b, 0x09, 0x40, 0xdf, 0xbe, 0xef, 0x3e, 0xf7, 0x34, 0x7b, 0x7f, 0xfb, 0xf6, 0xee, 0x72,
+    0xf8, 0xef, 0x57, 0x57, 0x64, 0xa2, 0xa3, 0x70, 0xf0, 0xac, 0x67, 0xfe, 0x91, 0x10, 0xf8, 0xb8,
+    0xef, 0xc4, 0xa1, 0x63, 0x3e, 0x50, 0x08, 0xf0, 0x5f, 0x44, 0x35, 0x10, 0x7f, 0x02, 0x52, 0x51,
+    0xdd, 0x77, 0x7e, 0x18, 0x5e, 0xbb, 0xa7, 0x4e, 0xf1, 0x99, 0x43, 0x44, 0xfb, 0xce, 0x8c, 0xd1,
+    0x79, 0x2c, 0xa4, 0x76, 0x88, 0x2f, 0xb8, 0xa6, 0x1c, 0xc5, 0xe6, 0x2c, 0xd0, 0x93, 0x7e, 0x40,
+    0x67, 0xcc, 0xa7, 0xae, 0x7d, 0xf9, 0x9a, 0x30, 0xce, 0x34, 0x83, 0xd0, 0x55, 0x3e, 0x84, 0xb4,
+    0xdf, 0xac, 0x35, 0x8c, 0x1a, 0xcd, 0x74, 0x48, 0x07, 0x6f, 0xb4, 0x84, 0xe5, 0x9f, 0x9c, 0x4d,
+    0xc9, 0x4b, 0x54, 0x20, 0x39, 0xd5, 0x49, 0xaf, 0x9e, 0x2d, 0x3d, 0xeb, 0x85, 0x8c, 0x4f, 0x89,
+    0xa4, 0x61, 0xdf, 0x61, 0xa8, 0xdf, 0x21, 0x3a, 0x8d, 0xd1, 0x28, 0x8b, 0x60, 0x4c, 0xeb, 0x6a,
+    0x36, 0xfe, 0xfb, 0x63, 0x14, 0x3a, 0x64, 0x22, 0xe9, 0xa8, 0xef, 0xd4, 0x95, 0x06, 0xcd, 0xfc,
+    0xba, 0x11, 0xac, 0xe1, 0xda, 0x37, 0xb3, 0xfe, 0x59, 0xeb, 0xb4, 0xed, 0xbd, 0x38, 0x69, 0x3a,
+    0x1b, 0x9a, 0x94, 0x4e, 0x43, 0xaa, 0x26, 0x94, 0xea, 0xed, 0xad, 0x10, 0xc7, 0x35, 0x5f, 0x29,
+    0xdc, 0x79, 0x3c, 0xf2, 0x9b, 0x2f, 0x1a, 0x9e, 0x8d, 0x56, 0xf9, 0x92, 0xc5, 0x9a, 0x28, 0xe9,
+    0x6f, 0x4a, 0x3e, 0x18, 0xc1, 0x46, 0xfb, 0x8c, 0x1e, 0xd1, 0xe3, 0x23, 0x67, 0xd0, 0xab, 0x67,
+    0x82, 0xab, 0x1d, 0x83, 0x40, 0xf8, 0x49, 0x84, 0x29, 0xa9, 0x15, 0x0f, 0x57, 0x21, 0xb5, 0xef,
+    0x98, 0xcd, 0x73, 0xad, 0x25, 0xf3, 0x12, 0x4d, 0x2b, 0x4e, 0x00, 0x1a, 0x5c, 0x3d, 0xc1, 0x25,
+    0xe7, 0x6b, 0x12, 0x0a, 0xcc, 0xd0, 0x1b, 0x2d, 0x24, 0x46, 0x58, 0x1b, 0x53, 0xfd, 0x52, 0xd3,
+    0xa8, 0xe2, 0x64, 0xab, 0x55, 0xf2, 0xd3, 0x4f, 0xc4, 0x09, 0xd9, 0x78, 0xa2, 0x9d, 0x6a, 0xb7,
+    0x64, 0xaf, 0x9e, 0x97, 0xcb, 0x13, 0x41, 0x3a, 0xe8, 0x05, 0x6c, 0x46, 0xfc, 0x10, 0x94, 0xea,
+    0x3b, 0xa6, 0x26, 0xc0, 0x38, 0x95, 0x18, 0xc7, 0x33, 0xbb, 0x60, 0x83, 0xef, 0x3b, 0x01, 0x53,
+    0x71, 0x08, 0x69, 0x67, 0x14, 0xd2, 0xc7, 0x2e, 0x79, 0x48, 0x94, 0x66, 0xa3, 0xd4, 0xcd, 0x4b,
+    0x68, 0xbf, 0xba, 0x94, 0x07, 0x5d, 0x02, 0x68, 0x8d, 0xbb, 0x0c, 0x9d, 0x50, 0x1d, 0x9f, 0x9a,
+    0xfa, 0x74, 0xc9, 0x18, 0xe2, 0x4e, 0xab, 0x11, 0x3f, 0x76, 0x4d, 0x72, 0x4a, 0xc6, 0xd4, 0x9c,
+    0x69, 0x7f, 0xe2, 0xce, 0x25, 0xc4, 0x98, 0x0d, 0x15, 0x03, 0x1f, 0x0c, 0x65, 0xea, 0x11, 0x9f,
+    0xd1, 0x88, 0xa7, 0xe8, 0xae, 0xf9, 0xd2, 0x0b, 0xc1, 0xa3, 0xe1, 0xe6, 0x16, 0x94, 0x66, 0x3c,
+    0x4e, 0x74, 0x5e, 0x5d, 0x7f, 0x42, 0xfd, 0xa9, 0x27, 0x1e, 0x1d, 0xc2, 0x82, 0x7e, 0x16, 0xfa,
+    0x9b, 0x4c, 0x8e, 0x08, 0x8e, 0xcd, 0xc8, 0xc7, 0x28, 0xa4, 0xc5, 0x78, 0x1c, 0xd2, 0xa1, 0x59,
+    0xac, 0xe8, 0x09, 0x53, 0x35, 0xbb, 0x8b, 0x06, 0xd5, 0xdc, 0xf4, 0xca, 0x42, 0xc8, 0x02, 0x13,
+    0x7e, 0x61, 0xbe, 0x6e, 0xed, 0xe3, 0x7f, 0x74, 0x3c, 0xff, 0x8b, 0x99, 0x99, 0x34, 0xf7, 0xb7,
+    0x21, 0x7e, 0x7f, 0xb6, 0x19, 0x23, 0xf5, 0x35, 0xc3, 0x46, 0x1c, 0xf4, 0x26, 0x2d, 0xdc, 0x02,
+    0x3a, 0x51, 0x28, 0xd5, 0xca, 0x13, 0x61, 0xfc, 0x55, 0xfa, 0x3c, 0xa4, 0xf6, 0x3c, 0x64, 0x3b,
+    0xc0, 0xbe, 0x0d, 0x96, 0xbf, 0x40, 0x20, 0xe6, 0xc0, 0x19, 0xfd, 0xeb, 0xe7, 0xff, 0xe4, 0x76,
+    0x4b, 0x7b, 0x2e, 0xc0, 0x9f, 0x8a, 0xd1, 0x68, 0x73, 0x17, 0xb1, 0x7f, 0x5d, 0x0f, 0x02, 0x67,
+    0xbb, 0x6e, 0x5c, 0x70, 0x8a, 0xf9, 0xbf, 0x9b, 0x72, 0x41, 0x84, 0x3f, 0x91, 0x82, 0x73, 0x4a,
+    0x62, 0x81, 0x0d, 0x8e, 0x1e, 0x32, 0xda, 0x21, 0x90, 0x68, 0x11, 0x81, 0x4e, 0xfd, 0x05, 0x2e,
+    0x98, 0xaf, 0x3a, 0x25, 0x73, 0xa5, 0xe5, 0x22, 0x8d, 0x00, 0xbf, 0x3c, 0x50, 0xb5, 0xf0, 0x17,
+    0xb8, 0x45, 0x2e, 0xe8, 0x82, 0xf4, 0xbc, 0x4d, 0x37, 0x86, 0x0c, 0xbb, 0x0d, 0xb3, 0xe3, 0x0d,
+    0x76, 0x3d, 0xbd, 0x4c, 0xfd, 0x90, 0x7e, 0xae, 0x9f, 0xaf, 0x8d, 0x03, 0x44, 0x0a, 0xec, 0x77,
+    0x09, 0x9d, 0xb5, 0x3d, 0xab, 0xcc, 0xa4, 0x31, 0x37, 0x47, 0xfe, 0xfa, 0xf9, 0x77, 0x0c, 0x63,
+    0x21, 0xf0, 0x98, 0x2d, 0xdf, 0x62, 0x68, 0xd3, 0x1a, 0xc9, 0xca, 0x59, 0x92, 0xbf, 0xa1, 0x23,
+    0xbd, 0x2a, 0x28, 0x51, 0x1b, 0x7d, 0xed, 0x61, 0x00, 0x63, 0xb4, 0xc3, 0x83, 0xce, 0x0c, 0x64,
+    0xc5, 0x75, 0x3d, 0x19, 0x54, 0xbb, 0xc4, 0x13, 0x12, 0xbb, 0xc0, 0x95, 0x10, 0xb0, 0x44, 0x75,
+    0x8e, 0xb0, 0x77, 0xc9, 0x84, 0x9a, 0x73, 0xd4, 0x39, 0x35, 0xcf, 0x11, 0xc8, 0x31, 0xe3, 0xe6,
+    0x99, 0x34, 0xd0, 0xdb, 0xed, 0x68, 0x2f, 0x40, 0x3a, 0x7b, 0x0c, 0x7c, 0xd9, 0x68, 0x9c, 0x78,
+    0xa3, 0xd1, 0x47, 0xb5, 0x5b, 0x08, 0xec, 0x34, 0x9e, 0x1b, 0xcd, 0xe5, 0xb6, 0xeb, 0xc5, 0x1b,
+    0x46, 0x84, 0xd0, 0x87, 0xd2, 0x77, 0xcf, 0xae, 0x59, 0x29, 0x6b, 0x46, 0xf4, 0x9e, 0x8d, 0x58,
+    0x9e, 0xb3, 0xaf, 0xb8, 0xa7, 0xe2, 0x2e, 0xb9, 0x90, 0x10, 0xc1, 0x96, 0xd4, 0x3f, 0xe6, 0x9b,
+    0x32, 0x45, 0x6b, 0x1b, 0xb1, 0x81, 0x6d, 0x44, 0x53, 0xe2, 0x18, 0x7d, 0x81, 0x02, 0x0a, 0x6d,
+    0xaf, 0xd4, 0xc1, 0xb3, 0x98, 0x8e, 0xe7, 0x2d, 0x64, 0xfe, 0xb4, 0xff, 0x85, 0xc4, 0xe3, 0x20,
+    0xb9, 0xc1, 0xf8, 0x11, 0x93, 0x08, 0x48, 0xaf, 0xb0, 0x6f, 0xe4, 0x1c, 0x9e, 0x7e, 0xcb, 0x7a,
+    0x8b, 0x30, 0x22, 0x02, 0x22, 0x61, 0x91, 0x90, 0xf9, 0xf2, 0xed, 0xd3, 0xaf, 0xfe, 0x22, 0x35,
+    0x4b, 0xb6, 0xde, 0xdf, 0x38, 0xd5, 0x2f, 0x06, 0x3d, 0x84, 0x3a, 0x2d, 0x78, 0x7e, 0xc2, 0xb3,
+    0x97, 0x55, 0x13, 0x79, 0x9a, 0xbb, 0x63, 0x49, 0x53, 0x67, 0x90, 0xa9, 0x65, 0x0f, 0x99, 0x56,
+    0xf4, 0xce, 0x0a, 0xa2, 0x8b, 0xb0, 0x93, 0xb4, 0x1b, 0xc8, 0x42, 0x3c, 0x78, 0x34, 0x0c, 0x52,
+    0x73, 0x86, 0x4e, 0x2c, 0x64, 0xe2, 0x4f, 0xf6, 0x34, 0x5f, 0xa1, 0xe1, 0x47, 0x08, 0xf3, 0x2c,
+    0x95, 0x5b, 0xad, 0x58, 0x7d, 0xc9, 0x47, 0xa2, 0x04, 0x1f, 0x26, 0x57, 0xf1, 0x4a, 0xf9, 0x2b,
+    0xc6, 0xc7, 0x36, 0x97, 0xe5, 0x9d, 0xe6, 0xa3, 0x33, 0x70, 0x8b, 0x06, 0x8d, 0xd4, 0x3a, 0xcb,
+    0xf1, 0xc0, 0x2c, 0x92, 0x79, 0x3a, 0x5e, 0xbe, 0x85, 0x60, 0x21, 0x78, 0x4a, 0x2a, 0x57, 0xf7,
+    0xb7, 0xe7, 0xd5, 0x1d, 0x25, 0x57, 0xf3, 0x08, 0x76, 0x94, 0x14, 0x65, 0xfc, 0x8e, 0x69, 0x8c,
+    0x65, 0x67, 0x4f, 0xf6, 0xf9, 0x90, 0xe9, 0xa2, 0x2d, 0x12, 0xa9, 0x0e, 0x26, 0xcd, 0x80, 0x20,
+    0x8e, 0xf6, 0x18, 0xa6, 0x8c, 0xea, 0x0f, 0xef, 0xe7, 0xa4, 0x22, 0xb2, 0x48, 0x81, 0x28, 0x2a,
+    0x19, 0xec, 0xfa, 0x79, 0x23, 0x94, 0x5a, 0xa5, 0xe7, 0xb9, 0x75, 0xb2, 0xb2, 0xb5, 0xbe, 0x3e,
+    0xac, 0xd5, 0x22, 0x0b, 0x37, 0xcc, 0x5f, 0x78, 0x90, 0x55, 0xd9, 0x98, 0xd9, 0x2d, 0x8e, 0x45,
+    0x0c, 0x65, 0x63, 0x59, 0x27, 0xef, 0x7b, 0x11, 0x25, 0x88, 0xd0, 0x60, 0xfa, 0x77, 0x03, 0xe4,
+    0x2d, 0x10, 0xbb, 0x91, 0x1a, 0x3b, 0xf9, 0xf6, 0x5b, 0x7c, 0xdc, 0x2e, 0xda, 0xe5, 0x02, 0x14,
+    0x02, 0x1e, 0xf8, 0x98, 0xf4, 0x1f, 0x62, 0x8d, 0x18, 0xb7, 0x1b, 0x4e, 0xf6, 0xbd, 0x9c, 0x42,
+    0xc6, 0xf7, 0xe4, 0x10, 0x41, 0x20, 0x89, 0x0f, 0x26, 0x91, 0x51, 0x7b, 0x2e, 0x4c, 0x2b, 0x23,
+    0xe4, 0x77, 0x36, 0xe1, 0x35, 0x89, 0x4b, 0x78, 0xb7, 0x4f, 0xed, 0x95, 0x94, 0x87, 0x34, 0x5f,
+    0xe0, 0xd9, 0xfa, 0x23, 0x48, 0x89, 0x67, 0x05, 0x93, 0x1d, 0xcd, 0xd7, 0xc0, 0x42, 0x55, 0xd6,
+    0x5c, 0xcc, 0xb7, 0x43, 0x13, 0xec, 0x2e, 0xfe, 0xf0, 0x7e, 0xf9, 0x5f, 0x1c, 0x4a, 0xa6, 0xc2,
+    0x95, 0xd7, 0xc3, 0x61, 0x35, 0x9f, 0x66, 0x1a, 0xbc, 0x90, 0x16, 0x5e, 0x64, 0x00, 0xd6, 0x6c,
+    0x20, 0x84, 0x11, 0x4d, 0x1f, 0xb5, 0x6b, 0x59, 0x41, 0xc1, 0x07, 0x50, 0x93, 0xb6, 0xfc, 0xa3,
+    0xa7, 0xa5, 0x79, 0xb4, 0x43, 0x09, 0x19, 0xdc, 0xc4, 0xbe, 0xbc, 0x92, 0x1f, 0xde, 0x7b, 0x53,
+    0xb6, 0x7a, 0xcf, 0x3a, 0x6c, 0xbd, 0xdc, 0x6e, 0xac, 0x9f, 0xcf, 0xda, 0xa5, 0xe7, 0xb3, 0xd5,
+    0xf3, 0x2d, 0x3c, 0x66, 0xcf, 0x75, 0x63, 0xa0, 0xae, 0x73, 0xb2, 0xa3, 0x0d, 0xdb, 0xb1, 0xe1,
+    0x4b, 0x8d, 0x27, 0x35, 0x48, 0x4d, 0xe0, 0x3a, 0xa3, 0x40, 0x75, 0xeb, 0xff, 0xe0, 0xa3, 0xf1,
+    0xff, 0x93, 0x29, 0xa4, 0x5a, 0x0c, 0x4a, 0x33, 0x7c, 0x2f, 0x41, 0x32, 0x94, 0xc7, 0x62, 0xf9,
+    0x67, 0x31, 0x25, 0x4b, 0x1e, 0x8b, 0xde, 0x42, 0x8e, 0x92, 0x61, 0x49, 0x61, 0x21, 0x1b, 0x3a,
+    0xae, 0xb4, 0x83, 0xc2, 0x8c, 0xeb, 0x2e, 0x19, 0xa1, 0x56, 0x57, 0xb1, 0x05, 0xed, 0x34, 0x6a,
+    0x67, 0x34, 0xea, 0xae, 0x5a, 0x18, 0xf5, 0xd0, 0x10, 0x1d, 0x5f, 0x69, 0xc2, 0xe3, 0x51, 0x66,
+    0x43, 0xa1, 0x80, 0x20, 0x8b, 0x25, 0xad, 0x54, 0x9d, 0xcd, 0xba, 0x59, 0xd5, 0xc6, 0x15, 0x11,
+    0x9b, 0xc0, 0xc9, 0x0c, 0xc2, 0x04, 0x17, 0x9b, 0x91, 0x33, 0x68, 0x1d, 0x91, 0x09, 0xa9, 0x34,
+    0x4d, 0x93, 0x63, 0xe1, 0xb3, 0xf5, 0x5d, 0xc1, 0x36, 0x4a, 0x9e, 0x90, 0x00, 0xe1, 0xae, 0xd2,
+    0x6c, 0x7f, 0x44, 0x16, 0xb9, 0xdc, 0x59, 0x23, 0x97, 0x25, 0x93, 0xb2, 0x60, 0x3d, 0x8b, 0x60,
+    0x85, 0xe3, 0x3e, 0xf0, 0x19, 0x9e, 0xc7, 0x22, 0xa0, 0x4b, 0xbc, 0x64, 0x18, 0x3e, 0x6e, 0xe7,
+    0x66, 0xdf, 0x69, 0xb5, 0x1a, 0xce, 0xbe, 0xf6, 0xcb, 0x93, 0xa6, 0x45, 0x56, 0x0f, 0x93, 0xa0,
+    0x4c, 0xd1, 0x66, 0xf5, 0xca, 0x89, 0x3c, 0x6d, 0x67, 0x99, 0xb4, 0x95, 0xc8, 0xd7, 0x7d, 0x11,
+    0x0a, 0xb9, 0x1a, 0xe0, 0xce, 0xe0, 0xab, 0x2f, 0xcf, 0x8e, 0x5f, 0xb4, 0xba, 0xc5, 0xa1, 0xc7,
+    0x83, 0x40, 0x96, 0xef, 0x64, 0x8d, 0x54, 0x62, 0x50, 0x91, 0x30, 0x31, 0x23, 0x31, 0x89, 0xe0,
+    0xb1, 0x5a, 0x20, 0xf0, 0x3e, 0x6d, 0xad, 0x53, 0x38, 0x39, 0x6a, 0xef, 0x68, 0xab, 0xef, 0x93,
+    0x0d, 0xfc, 0x17, 0xed, 0x3d, 0xb2, 0x24, 0x40, 0xb8, 0x7c, 0xfa, 0x23, 0xe6, 0x62, 0xf9, 0xee,
+    0xe9, 0xb7, 0x22, 0x55, 0x1f, 0xeb, 0xe2, 0xf3, 0x39, 0x48, 0x46, 0xb7, 0x78, 0x28, 0xe3, 0xfe,
+    0x5d, 0x4c, 0xf9, 0xe7, 0x32, 0xb5, 0x21, 0x4e, 0x75, 0x02, 0x46, 0xe1, 0x1a, 0xb8, 0x72, 0x55,
+    0x97, 0x90, 0xa8, 0x82, 0xa7, 0xe1, 0xb4, 0x5f, 0xb7, 0x76, 0xbe, 0x5e, 0xb0, 0xc6, 0x2c, 0x92,
+    0x4a, 0x46, 0x3a, 0x3b, 0xbb, 0x72, 0x05, 0xb4, 0xaf, 0x87, 0x42, 0x3e, 0xd9, 0x07, 0xdf, 0x96,
+    0xa3, 0xdf, 0xc2, 0x66, 0xdc, 0x7c, 0x3e, 0x43, 0x7c, 0x5b, 0x63, 0xf3, 0xf3, 0xf2, 0x48, 0xbc,
+    0x1d, 0x0e, 0x5f, 0x97, 0x1d, 0xbe, 0xc5, 0xfb, 0x55, 0x3e, 0x3d, 0xd6, 0x22, 0x17, 0xd7, 0x9b,
+    0x22, 0xde, 0x68, 0x6b, 0xc0, 0x64, 0x99, 0x2c, 0x0b, 0x5d, 0x22, 0xd5, 0xd3, 0x85, 0xa2, 0x39,
+    0xde, 0x65, 0x9e, 0x7e, 0x1d, 0x27, 0x5b, 0x31, 0x79, 0x38, 0x1b, 0x67, 0x34, 0x28, 0x4d, 0x8d,
+    0xdc, 0xe2, 0xbf, 0x00, 0xc7, 0xcd, 0x1c, 0xeb, 0x94, 0x53, 0x70, 0x1a, 0x95, 0x55, 0x5f, 0xb3,
+    0xc7, 0x7c, 0x93, 0x57, 0xa4, 0x0b, 0x67, 0xe1, 0x56, 0xc2, 0x4a, 0x73, 0xb0, 0x3c, 0x42, 0x33,
+    0x7c, 0xce, 0x65, 0x86, 0xe6, 0xc5, 0xf9, 0x34, 0xb4, 0x26, 0x5b, 0xf5, 0xde, 0xc2, 0x6e, 0x24,
+    0x60, 0x78, 0x65, 0x48, 0xf9, 0x1a, 0xa1, 0xb3, 0x51, 0xbd, 0x7a, 0x5d, 0xfe, 0x62, 0xd8, 0x1d,
+    0xf2, 0x16, 0x1f, 0xa7, 0xe9, 0xff, 0x87, 0x65, 0xf4, 0x6c, 0x3f, 0x2c, 0x7f, 0xc2, 0x5c, 0xca,
+    0x58, 0x07, 0x25, 0x8b, 0x00, 0x90, 0x12, 0xf2, 0x0d, 0x84, 0x36, 0xba, 0xe9, 0x0c, 0xc3, 0x51,
+    0xce, 0x41, 0xda, 0x8f, 0xf7, 0x49, 0xa4, 0xfd, 0x31, 0x04, 0x81, 0x61, 0x68, 0x4d, 0x73, 0x5b,
+    0xcd, 0x69, 0x7a, 0xa7, 0x89, 0x2c, 0x5f, 0x09, 0xbc, 0x16, 0x92, 0xc3, 0x37, 0x84, 0x76, 0x76,
+    0x2b, 0x78, 0x74, 0x73, 0x1e, 0xdf, 0x6a, 0x58, 0x0d, 0x62, 0x46, 0xe5, 0x28, 0x14, 0x73, 0x37,
+    0x2d, 0x03, 0xf6, 0x08, 0x22, 0x16, 0xa6, 0x9d, 0x48, 0x70, 0x81, 0x25, 0xf2, 0xe9, 0x3e, 0x1c,
+    0x47, 0x72, 0x3e, 0xc5, 0xbb, 0xfd, 0x18, 0x0b, 0x5c, 0xfb, 0xe4, 0x63, 0x3d, 0xf5, 0x1f, 0xe8,
+    0xc7, 0x26, 0xd3, 0xf6, 0x40, 0x2a, 0x5f, 0xd2, 0x9b, 0xad, 0xfc, 0x92, 0xbe, 0x22, 0xf7, 0x96,
+    0xbf, 0x1b, 0x66, 0x94, 0x13, 0xeb, 0xef, 0xed, 0x7b, 0x82, 0x9c, 0xe8, 0x01, 0x36, 0xd8, 0x76,
+    0x69, 0xcf, 0x4a, 0x7a, 0x97, 0xae, 0xdf, 0x05, 0xcb, 0x77, 0x73, 0x46, 0x97, 0x7f, 0x1e, 0xda,
+    0x1b, 0x63, 0xbe, 0x32, 0x4a, 0x66, 0x9e, 0x6e, 0x18, 0x9f, 0x1e, 0xc2, 0x9d, 0x83, 0x36, 0xee,
+    0xd3, 0x00, 0x1e, 0x0a, 0x3c, 0xdc, 0xb0, 0xb2, 0x79, 0x85, 0xdf, 0x93, 0xc5, 0xc2, 0xd4, 0x9e,
+    0x53, 0x90, 0x97, 0xdb, 0xcc, 0x91, 0xfd, 0xfd, 0x90, 0xb7, 0x4e, 0x26, 0x71, 0x6c, 0x8a, 0x9f,
+    0x23, 0xf7, 0xc9, 0xc9, 0xc9, 0xbe, 0x02, 0xdf, 0x53, 0xa9, 0x1e, 0x80, 0x88, 0x58, 0x8a, 0x31,
+    0x5e, 0xc4, 0xec, 0x55, 0x7f, 0x8d, 0xa0, 0x10, 0xc7, 0x3f, 0xa2, 0x80, 0x2d, 0xad, 0x5b, 0xba,
+    0x57, 0x17, 0x4d, 0xb0, 0xf7, 0x37, 0xa6, 0x00, 0xd4, 0xc4, 0x13, 0x20, 0x83, 0xec, 0x97, 0x26,
+    0x38, 0x6e, 0x9f, 0x9e, 0xd1, 0xc0, 0xdf, 0xf8, 0xa5, 0xa9, 0x6e, 0x0f, 0x96, 0xf9, 0x05, 0xc8,
+    0xfe, 0x90, 0xf7, 0x3f, 0x3b, 0xff, 0x3b, 0x8e, 0xd9, 0x13, 0x00, 0x00,
+};
+
+const uint8_t STATIC_CONFIG_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5a, 0xdb, 0x6e, 0xdc, 0xc8,
+    0x99, 0xbe, 0xd7, 0x53, 0x94, 0x14, 0x6c, 0xc8, 0xc6, 0x48, 0x94, 0x67, 0x36, 0x1e, 0x64, 0xd4,
+    0x92, 0x06, 0x52, 0x2c, 0xc7, 0xce, 0x48, 0x96, 0x31, 0xd2, 0xcc, 0x20, 0x63, 0x18, 0x46, 0x35,
+    0x59, 0xdd, 0x5d, 0x6a, 0x92, 0xc5, 0x25, 0x8b, 0xa2, 0xd8, 0x8e, 0x73, 0x61, 0xc4, 0xc8, 0x4d,
+    0x80, 0x5c, 0xe4, 0x2a, 0x27, 0x20, 0xef, 0x90, 0x9b, 0x60, 0xe1, 0xbb, 0x58, 0x2f, 0x32, 0x2f,
+    0xb0, 0xaf, 0xb0, 0xdf, 0x5f, 0xc5, 0x63, 0x37, 0xa5, 0x99, 0x20, 0x8b, 0x15, 0x60, 0x77, 0x93,
+    0xf5, 0xd7, 0x5f, 0xff, 0xf9, 0x54, 0xbd, 0xbb, 0xcb, 0x2e, 0x74, 0xaa, 0x62, 0xce, 0x16, 0x2a,
+    0x9e, 0xca, 0x59, 0x9e, 0x72, 0xff, 0x4a, 0x32, 0xb7, 0x10, 0x93, 0x5d, 0xdf, 0xbc, 0xf1, 0xe6,
+    0x3a, 0x0a, 0x47, 0x6c, 0x87, 0x65, 0x9a, 0xeb, 0xd2, 0x5f, 0x02, 0x34, 0x51, 0xc5, 0xed, 0x5b,
+    0xb5, 0xe0, 0x6c, 0x92, 0x4f, 0x55, 0xaa, 0x0a, 0x4e, 0xef, 0xd2, 0xa5, 0x58, 0x9a, 0xff, 0x67,
+    0xe1, 0x87, 0x77, 0x01, 0x4f, 0x17, 0x1f, 0xfe, 0xe8, 0x6d, 0xec, 0xee, 0xb2, 0x2f, 0xf8, 0xed,
+    0xfb, 0xa0, 0x64, 0x22, 0x14, 0x91, 0x88, 0x35, 0x5b, 0xb2, 0x80, 0x6b, 0xbe, 0x93, 0x09, 0x5f,
+    0x4b, 0x15, 0x1f, 0x6c, 0xc5, 0x7c, 0x59, 0xf0, 0x2d, 0x16, 0xf3, 0x50, 0xdc, 0xbe, 0x2f, 0x59,
+    0xa0, 0x58, 0x26, 0x16, 0x44, 0xc2, 0x2e, 0x4f, 0x64, 0x45, 0xc2, 0xee, 0xbe, 0x81, 0x3a, 0xdc,
+    0x63, 0x05, 0x4f, 0xb5, 0xba, 0xfd, 0xb3, 0x2f, 0x09, 0x73, 0xa2, 0x26, 0x52, 0xa4, 0x3c, 0x16,
+    0x2c, 0xfb, 0xf0, 0x8e, 0x8e, 0x2e, 0x59, 0x82, 0x17, 0x45, 0xb6, 0x2c, 0x23, 0x96, 0xaa, 0x65,
+    0x21, 0x63, 0xf9, 0xe1, 0x8f, 0xbe, 0xcc, 0x6b, 0x94, 0xae, 0xf9, 0x14, 0x6c, 0xc9, 0x01, 0x23,
+    0x58, 0x21, 0x03, 0x05, 0x7e, 0x04, 0x78, 0x53, 0x01, 0x4b, 0xf9, 0x32, 0x1f, 0x6d, 0x13, 0x5e,
+    0x0e, 0x80, 0x44, 0x66, 0xac, 0x28, 0xb3, 0xf2, 0xf6, 0x2d, 0x67, 0xba, 0x0c, 0x17, 0x0a, 0xa7,
+    0x85, 0x58, 0x88, 0xa4, 0x88, 0x41, 0x77, 0xe9, 0xcf, 0x2b, 0xa4, 0xdb, 0x6c, 0x41, 0x0c, 0x82,
+    0x00, 0x95, 0xa9, 0x49, 0x8c, 0x93, 0x6f, 0xdf, 0x13, 0xff, 0xb1, 0x14, 0x11, 0x7b, 0x7e, 0x7e,
+    0x71, 0x69, 0x85, 0x10, 0xe6, 0x3e, 0x4e, 0xfc, 0xc5, 0xc5, 0xf9, 0x33, 0x76, 0xc0, 0xb8, 0x4e,
+    0xcb, 0x49, 0xae, 0x4b, 0x70, 0x1d, 0x09, 0x96, 0xfc, 0xf3, 0xef, 0x21, 0x83, 0x1c, 0xa3, 0x3c,
+    0xe4, 0xe9, 0x92, 0x8f, 0xad, 0x80, 0xa6, 0x52, 0x84, 0xc1, 0xc1, 0xd6, 0x82, 0x36, 0x6e, 0x31,
+    0xad, 0x5a, 0xd6, 0x2b, 0x7a, 0x20, 0x29, 0x15, 0xf8, 0xcb, 0x52, 0xe7, 0xde, 0xc6, 0x06, 0xe4,
+    0x94, 0x69, 0x76, 0x71, 0x72, 0x71, 0xf1, 0xf4, 0xfc, 0xd9, 0xab, 0xb3, 0x0b, 0x1c, 0xf2, 0x9f,
+    0x0f, 0xe8, 0x6f, 0xcc, 0x70, 0xfa, 0x43, 0x16, 0xc9, 0x38, 0xd7, 0x1b, 0xa1, 0xd0, 0xa0, 0x3a,
+    0xcb, 0xc0, 0xc0, 0x49, 0x1c, 0x64, 0x47, 0x1a, 0x60, 0x8f, 0xb8, 0x16, 0x5e, 0xac, 0x0a, 0x77,
+    0xc4, 0x3e, 0xea, 0x20, 0x18, 0x1b, 0x60, 0x9c, 0x19, 0x8b, 0xe0, 0xe4, 0x26, 0x91, 0xa9, 0x8c,
+    0x67, 0x80, 0x9e, 0xf2, 0x30, 0x13, 0x76, 0xcd, 0x57, 0x79, 0xac, 0x03, 0x55, 0xc4, 0x4f, 0x63,
+    0x2d, 0xd2, 0x6b, 0x1e, 0x62, 0x39, 0xce, 0xc3, 0x70, 0x5c, 0x53, 0x73, 0xf9, 0xf4, 0xec, 0xe4,
+    0xd5, 0xe3, 0xa7, 0x27, 0xa7, 0x8f, 0x88, 0x9c, 0x17, 0x4e, 0x02, 0x14, 0x35, 0xac, 0xb3, 0xcd,
+    0x9c, 0x54, 0xe5, 0x78, 0x38, 0x9f, 0x4e, 0x2f, 0x65, 0x24, 0xe8, 0xc5, 0x84, 0x67, 0xe2, 0x58,
+    0x29, 0x5d, 0x3f, 0xc7, 0xea, 0x1b, 0xf9, 0x58, 0xd2, 0x13, 0x20, 0xe9, 0x05, 0x4f, 0x7e, 0x66,
+    0xec, 0xa1, 0x79, 0xb5, 0xc1, 0xf0, 0xe7, 0xf0, 0x82, 0x2f, 0xc4, 0x37, 0x32, 0x06, 0x31, 0x67,
+    0x19, 0xc1, 0x65, 0xa1, 0x10, 0x49, 0xf7, 0x45, 0xc4, 0x6f, 0x9e, 0xe3, 0x74, 0xfb, 0xc0, 0x93,
+    0x63, 0xee, 0x2f, 0xd4, 0x74, 0x6a, 0x1f, 0x83, 0xb9, 0x9f, 0x54, 0x08, 0xed, 0x8b, 0x09, 0x56,
+    0xf3, 0xe4, 0x99, 0xd0, 0x85, 0x4a, 0x17, 0x5f, 0x0a, 0xe8, 0xaa, 0xa1, 0xfa, 0xe5, 0xb8, 0xe2,
+    0xed, 0xf8, 0xfc, 0xfc, 0xf2, 0xd5, 0xf3, 0x27, 0x47, 0x10, 0x98, 0xe1, 0x8d, 0x08, 0xa5, 0xbd,
+    0xc7, 0x29, 0x8f, 0x38, 0x7d, 0x31, 0x5b, 0x62, 0xa1, 0x69, 0x4b, 0xb5, 0x27, 0x54, 0x3c, 0x10,
+    0x01, 0xc0, 0x5f, 0xbf, 0x19, 0x83, 0x6c, 0xe8, 0xe5, 0xc2, 0x9a, 0xe3, 0x55, 0x7e, 0xfb, 0x9e,
+    0x8c, 0xd9, 0x98, 0xb2, 0x1b, 0xe6, 0x13, 0x56, 0x30, 0x9d, 0xf2, 0x85, 0x2f, 0xc5, 0xa8, 0xda,
+    0x1b, 0xc8, 0x14, 0xe6, 0x52, 0x6f, 0xed, 0xec, 0x85, 0x51, 0xc1, 0x26, 0xe1, 0x80, 0x91, 0x24,
+    0x8b, 0x30, 0x86, 0x9b, 0x1b, 0xfd, 0xcc, 0x42, 0x35, 0xe1, 0xe1, 0x57, 0xb1, 0x24, 0x2d, 0xc3,
+    0x0e, 0x68, 0xd3, 0x2f, 0x44, 0x10, 0xab, 0x4c, 0xc3, 0x73, 0x8d, 0xd1, 0xf9, 0x4b, 0x9e, 0xe5,
+    0xf0, 0xc8, 0xca, 0x3d, 0xb6, 0x66, 0x22, 0x86, 0x3f, 0x85, 0x5b, 0xcc, 0x7d, 0x80, 0x3d, 0x57,
+    0x22, 0x5b, 0x92, 0xd1, 0xc2, 0x92, 0xe1, 0xf4, 0x31, 0x1f, 0x6d, 0x6c, 0x4c, 0xf3, 0xd8, 0xb8,
+    0x2d, 0xab, 0xdc, 0xf7, 0x24, 0xcc, 0x5c, 0xb2, 0xe1, 0x11, 0x7b, 0xcd, 0x52, 0xa1, 0xf3, 0x34,
+    0x06, 0x11, 0x7e, 0x4e, 0x8e, 0xee, 0xfd, 0x57, 0x2e, 0xd2, 0xf2, 0x02, 0x6e, 0xef, 0x6b, 0x95,
+    0x1e, 0x85, 0xa1, 0xeb, 0xbc, 0xe8, 0x7b, 0xbe, 0x03, 0x83, 0x33, 0x0e, 0xf0, 0x11, 0x73, 0xb6,
+    0x5e, 0x3a, 0xa3, 0x31, 0x7b, 0xb3, 0x7e, 0xc2, 0x63, 0x72, 0x83, 0xe6, 0x10, 0xa3, 0x6f, 0x2b,
+    0x11, 0xa8, 0x8b, 0x24, 0x0f, 0xf1, 0xd2, 0xbb, 0x55, 0x7a, 0x3c, 0xf8, 0xd3, 0x09, 0xf7, 0xe7,
+    0xae, 0x80, 0x59, 0x1e, 0x22, 0xf8, 0x0c, 0x91, 0x43, 0x90, 0x38, 0xb7, 0x81, 0x9d, 0x12, 0x28,
+    0xf0, 0x7a, 0x49, 0x9e, 0xe1, 0x69, 0x34, 0x1a, 0x59, 0xe4, 0x15, 0x67, 0x58, 0x19, 0x6f, 0x74,
+    0x49, 0x84, 0xac, 0x4f, 0xd2, 0x54, 0xa5, 0x6e, 0x5a, 0x93, 0x06, 0x11, 0xfb, 0x73, 0xe1, 0x2f,
+    0x8e, 0x72, 0x3d, 0x87, 0x43, 0x51, 0x34, 0x5c, 0x20, 0x22, 0xa9, 0x22, 0x87, 0xaa, 0x10, 0x24,
+    0x77, 0x43, 0x35, 0x93, 0x31, 0xc5, 0x52, 0x91, 0x5d, 0x71, 0x04, 0x98, 0x19, 0xcf, 0x10, 0x61,
+    0xcc, 0x5e, 0x39, 0x65, 0x6e, 0xea, 0xa5, 0x02, 0xaa, 0x06, 0x8d, 0x30, 0x94, 0x1f, 0xff, 0x98,
+    0xa5, 0x5e, 0x9e, 0x86, 0x1e, 0x0c, 0x59, 0xdc, 0x9c, 0x4f, 0x5d, 0xc7, 0x6e, 0x77, 0x46, 0xec,
+    0x10, 0x1a, 0xad, 0xcf, 0xa4, 0xbf, 0xc2, 0xd8, 0xba, 0x17, 0x2a, 0x9f, 0x13, 0x65, 0xde, 0x3c,
+    0x15, 0x60, 0x86, 0xd5, 0x1b, 0xc6, 0x0d, 0xa0, 0x9e, 0x83, 0x18, 0x16, 0x8b, 0x82, 0x59, 0xca,
+    0x9d, 0x8b, 0x1e, 0x21, 0x4e, 0xc5, 0xf1, 0x9b, 0x9a, 0x9b, 0x53, 0x19, 0xc1, 0x7e, 0x6c, 0x44,
+    0xbb, 0xfd, 0x0d, 0x08, 0x44, 0xb4, 0x78, 0x15, 0xd2, 0x4b, 0x6f, 0x3e, 0x32, 0x71, 0x13, 0xb9,
+    0x40, 0x8a, 0xe0, 0xf6, 0xbf, 0xd9, 0x04, 0xe1, 0x5f, 0xa7, 0xc2, 0x04, 0xe7, 0x96, 0x1f, 0x4a,
+    0x1a, 0x79, 0xc6, 0x0e, 0x0e, 0x0e, 0xd8, 0x4f, 0x3e, 0xf9, 0x6c, 0xb4, 0x4e, 0xc0, 0xb7, 0x93,
+    0x12, 0x71, 0x06, 0x5a, 0x16, 0xed, 0x31, 0x90, 0x4f, 0x92, 0xfe, 0xf3, 0xef, 0x93, 0xfc, 0x0a,
+    0x06, 0xcd, 0xc8, 0x4e, 0x80, 0x69, 0x2e, 0xe0, 0x3e, 0x69, 0xe6, 0xcd, 0x84, 0x76, 0x1d, 0xe3,
+    0x96, 0x3b, 0x47, 0x53, 0x38, 0x19, 0xc4, 0xf1, 0xab, 0x5f, 0x31, 0xe7, 0x63, 0x87, 0x02, 0x98,
+    0xc3, 0x32, 0xa7, 0xaf, 0xb5, 0xd4, 0xbb, 0xca, 0x54, 0xec, 0x8e, 0x3c, 0x3d, 0x17, 0xb1, 0x7b,
+    0x45, 0x2a, 0x7e, 0xbd, 0x46, 0xc5, 0x95, 0x27, 0xe8, 0x93, 0x10, 0xb9, 0xce, 0x93, 0xcb, 0xcb,
+    0xe7, 0xe6, 0xd0, 0x9a, 0xfa, 0x11, 0x99, 0xe6, 0xa8, 0xaf, 0x7b, 0x72, 0xe6, 0x0b, 0x6b, 0x74,
+    0x3d, 0xe3, 0x24, 0xae, 0xad, 0xa3, 0x5b, 0xf3, 0x1a, 0x55, 0x74, 0x58, 0x9a, 0xba, 0x2b, 0xd0,
+    0x8f, 0x4e, 0x73, 0xf1, 0x43, 0xed, 0xd7, 0x0f, 0x79, 0x96, 0x9d, 0xca, 0x4c, 0x7b, 0x3c, 0x08,
+    0x5c, 0x87, 0x30, 0x21, 0xa2, 0x39, 0xb5, 0x8d, 0x4e, 0x85, 0x06, 0xb4, 0xd3, 0x4d, 0x9a, 0xb5,
+    0x7f, 0x6d, 0x83, 0x61, 0x1f, 0x76, 0x05, 0xa7, 0x94, 0x08, 0xdf, 0x7b, 0xcc, 0x91, 0xb1, 0x1f,
+    0xe6, 0x01, 0xc5, 0x58, 0x1f, 0x67, 0x88, 0x3d, 0x0a, 0xb5, 0x3b, 0x19, 0xfc, 0x42, 0x38, 0x60,
+    0xb4, 0x31, 0x16, 0x2b, 0xb2, 0x94, 0x08, 0x48, 0x3d, 0xb5, 0x20, 0x83, 0xdc, 0xec, 0x59, 0xe8,
+    0xe7, 0x8d, 0x74, 0xd9, 0x5e, 0xd7, 0x1b, 0x56, 0x51, 0x90, 0xdf, 0x13, 0x96, 0xa9, 0x0c, 0xc3,
+    0xae, 0xd0, 0xb6, 0x4d, 0xaa, 0xeb, 0x82, 0xc3, 0x7e, 0x89, 0x69, 0xa3, 0xa5, 0xe6, 0xed, 0x80,
+    0xe4, 0x6c, 0x1e, 0x22, 0x0b, 0x7d, 0xae, 0x90, 0xbc, 0x4c, 0xfd, 0x01, 0x83, 0xe1, 0xb6, 0x0a,
+    0x58, 0xa8, 0x50, 0x5c, 0xc5, 0x2b, 0x45, 0x40, 0x0f, 0x5d, 0x36, 0x57, 0xc5, 0xa5, 0xe2, 0x19,
+    0x4c, 0xe9, 0xbb, 0xbf, 0xfe, 0x8e, 0x75, 0x43, 0xd1, 0x9e, 0x79, 0x12, 0x5e, 0x84, 0x44, 0xc9,
+    0x67, 0xa0, 0xd1, 0x31, 0xb6, 0x51, 0x9b, 0x95, 0x71, 0x8f, 0x55, 0x06, 0x21, 0x00, 0x50, 0xfc,
+    0xaf, 0x28, 0x31, 0x15, 0x91, 0xba, 0x16, 0x5d, 0x3d, 0xae, 0x18, 0xd8, 0x1d, 0xb2, 0xaa, 0xc4,
+    0x32, 0x10, 0x1d, 0xfb, 0x61, 0xac, 0x95, 0x1e, 0x59, 0xe4, 0xa6, 0x3b, 0xf5, 0x0c, 0x7f, 0x08,
+    0x3e, 0x56, 0xe4, 0x3d, 0xb3, 0x6c, 0xa3, 0xea, 0x35, 0x64, 0x4b, 0x00, 0x2f, 0x2c, 0xfc, 0xcb,
+    0x71, 0x0f, 0xcd, 0xd4, 0xd3, 0x65, 0x22, 0x8c, 0x33, 0x3b, 0x26, 0xce, 0x4d, 0xd4, 0x0d, 0xdc,
+    0x6e, 0xea, 0x99, 0x07, 0x93, 0xdb, 0x36, 0x37, 0xaf, 0xdb, 0x3d, 0x02, 0x4a, 0x5a, 0xdb, 0x98,
+    0x82, 0x61, 0xb5, 0xb2, 0x0b, 0x00, 0x48, 0xaf, 0xb9, 0x85, 0x40, 0x3d, 0x0a, 0x89, 0xb8, 0xd7,
+    0xa3, 0xd1, 0x00, 0xa6, 0x4e, 0x51, 0xd1, 0xc4, 0xc5, 0xa9, 0x27, 0x83, 0xf5, 0x98, 0x68, 0x88,
+    0x46, 0xf6, 0xa3, 0xdc, 0x6e, 0xe4, 0x64, 0xe0, 0xb6, 0xd9, 0x75, 0x07, 0x6d, 0xcd, 0x58, 0x9b,
+    0x2b, 0x29, 0x93, 0x35, 0x29, 0x0c, 0xa1, 0xe6, 0xc4, 0x96, 0xad, 0xc7, 0xe5, 0x53, 0xbb, 0x9f,
+    0x2c, 0xe4, 0x55, 0x0e, 0x40, 0xe4, 0x8d, 0x8a, 0xe4, 0x4e, 0xa6, 0x1d, 0x93, 0x18, 0xaf, 0x45,
+    0xaa, 0xe9, 0xc1, 0xd2, 0x35, 0xae, 0x82, 0xa9, 0xb1, 0x1b, 0xcb, 0x47, 0xc3, 0x2c, 0xab, 0x64,
+    0xf5, 0x66, 0xf4, 0x6f, 0x64, 0xb1, 0xb6, 0x5a, 0x5c, 0xcb, 0x65, 0xaf, 0x57, 0xb4, 0xbb, 0x10,
+    0x54, 0x43, 0x4c, 0x89, 0xaf, 0x23, 0x0d, 0x29, 0xa3, 0x06, 0x85, 0x09, 0xb6, 0x08, 0xba, 0x36,
+    0x4e, 0x62, 0x21, 0xf8, 0xda, 0x62, 0x60, 0x30, 0x10, 0x77, 0x5a, 0x49, 0x72, 0x9b, 0x70, 0x59,
+    0x93, 0x7c, 0x81, 0x6f, 0x2f, 0xeb, 0xbc, 0x51, 0xeb, 0x8c, 0x76, 0x1b, 0x83, 0x33, 0x2a, 0xaf,
+    0xea, 0x0a, 0x28, 0x9d, 0x27, 0x49, 0x58, 0xfe, 0xdc, 0x3e, 0x9a, 0xb0, 0x30, 0x08, 0x1f, 0x29,
+    0x04, 0x27, 0xe4, 0x0a, 0x35, 0x9b, 0x85, 0xe2, 0x11, 0x0a, 0xe5, 0xca, 0xce, 0x07, 0x81, 0x03,
+    0xc9, 0x67, 0x35, 0xe6, 0x47, 0xf8, 0xde, 0x45, 0x6b, 0xca, 0xa6, 0x95, 0xa0, 0xd1, 0xf3, 0xb2,
+    0x2e, 0x53, 0x22, 0xac, 0xb8, 0xba, 0xee, 0x06, 0x73, 0x23, 0x33, 0x3a, 0x67, 0x82, 0xca, 0xf4,
+    0x0c, 0x84, 0x11, 0x1b, 0x75, 0x6e, 0x31, 0xbb, 0x8f, 0xeb, 0x05, 0x83, 0xe1, 0xba, 0x43, 0x64,
+    0xb3, 0x37, 0xe3, 0x53, 0x41, 0x20, 0x47, 0x38, 0xf5, 0x9a, 0x58, 0x7b, 0xdd, 0xb1, 0x6c, 0x4f,
+    0x8b, 0x1b, 0x8d, 0xc2, 0x56, 0x53, 0x7b, 0x04, 0x9b, 0x40, 0x58, 0x75, 0xbe, 0xfb, 0xd3, 0xdf,
+    0xfe, 0xe7, 0x1f, 0xbf, 0x67, 0x47, 0x5f, 0x5c, 0xfe, 0xf2, 0x9b, 0x67, 0xbf, 0x44, 0x42, 0xfc,
+    0xd2, 0x14, 0xcb, 0x48, 0x87, 0x93, 0x50, 0x2d, 0xa8, 0xe3, 0x2a, 0x37, 0x1d, 0x04, 0x5d, 0xe7,
+    0xbb, 0xbf, 0xfc, 0x81, 0x3d, 0x93, 0x82, 0x2f, 0x74, 0x59, 0xc4, 0xa5, 0xd3, 0xf5, 0x18, 0x64,
+    0xaf, 0x32, 0x14, 0x9e, 0x9f, 0x65, 0x97, 0x38, 0xa0, 0xc6, 0xec, 0xab, 0x50, 0xa5, 0x7b, 0x08,
+    0xe2, 0x63, 0xf4, 0x1c, 0xb1, 0xde, 0x29, 0x84, 0x9c, 0xcd, 0xf5, 0xde, 0x44, 0x85, 0xc1, 0xd8,
+    0x60, 0xb4, 0x00, 0xb3, 0x54, 0x88, 0x78, 0xdc, 0xc1, 0xd7, 0x8d, 0x17, 0xd6, 0xa2, 0xd7, 0x29,
+    0x1f, 0x92, 0x6d, 0x5f, 0x3a, 0x51, 0xbf, 0x88, 0x83, 0xc1, 0x63, 0x5f, 0x94, 0x91, 0xb1, 0xba,
+    0xf8, 0xd8, 0x65, 0x1f, 0xa3, 0x67, 0x41, 0xae, 0x56, 0x8f, 0xe5, 0x8d, 0x08, 0xdc, 0x8f, 0xeb,
+    0x9c, 0xde, 0xca, 0x74, 0x33, 0xf2, 0x32, 0x1e, 0x25, 0xa1, 0xc8, 0x56, 0xa4, 0x28, 0x63, 0x58,
+    0xd5, 0x93, 0xcb, 0xb3, 0x53, 0x60, 0xdc, 0xda, 0x4f, 0x98, 0xe1, 0xfe, 0xc0, 0x31, 0x4c, 0x66,
+    0x72, 0x29, 0xf6, 0x1e, 0x78, 0x3f, 0x7d, 0x28, 0x22, 0x72, 0x51, 0x62, 0xf0, 0x47, 0x9f, 0x7e,
+    0xfa, 0xe9, 0x98, 0x45, 0x3c, 0x45, 0x81, 0xb4, 0xa3, 0x55, 0xb2, 0xf7, 0x30, 0xb9, 0x19, 0x3b,
+    0x87, 0x28, 0xe0, 0x17, 0xa8, 0xc5, 0x51, 0x52, 0x23, 0x9f, 0x14, 0x94, 0x40, 0xd2, 0xdc, 0x9f,
+    0xe7, 0xd0, 0x40, 0xa2, 0xae, 0x78, 0x21, 0xd1, 0xe7, 0x65, 0xc8, 0x27, 0x78, 0xea, 0xf6, 0x9a,
+    0x02, 0x8c, 0x48, 0xc1, 0x6c, 0x47, 0xc3, 0xbd, 0xfd, 0xdd, 0xe4, 0x70, 0xeb, 0x3e, 0xd1, 0x51,
+    0x7d, 0x4e, 0x6d, 0x75, 0x9f, 0xd4, 0x0e, 0x31, 0x1f, 0x3f, 0x30, 0xd4, 0x7c, 0x8b, 0x76, 0x33,
+    0x5d, 0xaa, 0x58, 0xd4, 0x84, 0x94, 0x7b, 0x6c, 0x7f, 0x72, 0xb8, 0x05, 0xa9, 0x34, 0x62, 0x20,
+    0x09, 0xed, 0xef, 0x4e, 0x0e, 0xb7, 0x4d, 0x05, 0x96, 0x28, 0x8d, 0x62, 0x2a, 0x0d, 0x96, 0x68,
+    0x53, 0x39, 0x9c, 0xd7, 0x76, 0x21, 0xb9, 0xd9, 0xe6, 0x98, 0x6d, 0xda, 0xf6, 0x3a, 0xd8, 0xd7,
+    0x10, 0xb8, 0x45, 0xfb, 0x89, 0xe8, 0x7d, 0x0d, 0xfb, 0x12, 0x35, 0x3d, 0xe8, 0x8f, 0xf5, 0x1c,
+    0xa4, 0x3c, 0xf8, 0x8f, 0x31, 0x23, 0x4d, 0xef, 0xf0, 0x50, 0xce, 0xe2, 0x3d, 0x5f, 0x10, 0x56,
+    0x50, 0xb7, 0xaf, 0x53, 0xfc, 0x9b, 0x1f, 0x3e, 0xe6, 0x4b, 0xbe, 0xbf, 0x8b, 0x2f, 0xf4, 0xf0,
+    0x9c, 0xf2, 0xf0, 0x42, 0xb6, 0xcf, 0x0f, 0x1f, 0xb4, 0xdf, 0x3f, 0x7b, 0xd8, 0x7c, 0x3f, 0xe3,
+    0x37, 0xf6, 0xfb, 0x2e, 0xb0, 0x54, 0xc2, 0x8a, 0xbc, 0x64, 0x8e, 0x1e, 0x30, 0x6b, 0xa2, 0x98,
+    0x9b, 0x6c, 0x33, 0x39, 0xea, 0x87, 0x32, 0x23, 0xb7, 0x8f, 0xe0, 0x54, 0xf6, 0xf8, 0xc0, 0xb0,
+    0xd5, 0xe9, 0xc7, 0x5e, 0xc8, 0x97, 0x56, 0x24, 0x58, 0xaa, 0x97, 0x93, 0xbe, 0xb0, 0xec, 0xdb,
+    0x5e, 0x16, 0x70, 0x5b, 0x90, 0xcf, 0x09, 0xb5, 0xdd, 0x07, 0xb5, 0x62, 0x21, 0x79, 0xf8, 0xe0,
+    0x2c, 0x1b, 0xad, 0x21, 0xad, 0x16, 0x3f, 0x7b, 0x78, 0xf7, 0x22, 0xfa, 0xce, 0xee, 0xa2, 0xf1,
+    0x2f, 0x82, 0xd8, 0x69, 0x60, 0x57, 0xbf, 0x39, 0x35, 0x74, 0x7a, 0xe8, 0xf4, 0x93, 0x43, 0xcb,
+    0xf7, 0xae, 0xd1, 0xd2, 0xe1, 0x7e, 0x02, 0x61, 0xab, 0x84, 0xea, 0x1f, 0x84, 0x03, 0xd3, 0xcc,
+    0x35, 0xf6, 0xda, 0xe8, 0xdb, 0x85, 0x9d, 0xe4, 0xb3, 0x99, 0xc8, 0x50, 0xaf, 0x9d, 0x65, 0x0d,
+    0xcb, 0x9f, 0xb3, 0x33, 0xae, 0xe7, 0xde, 0x34, 0x54, 0x28, 0xd8, 0x7a, 0x20, 0xb5, 0x0f, 0x5a,
+    0xc7, 0x23, 0xc3, 0x60, 0xae, 0x9a, 0x08, 0x1f, 0x5d, 0xa0, 0x29, 0x8c, 0x7a, 0xfb, 0xfc, 0x3c,
+    0x85, 0x97, 0xeb, 0xd5, 0x5d, 0x23, 0xa7, 0x39, 0x08, 0x0c, 0xa3, 0x84, 0x8f, 0xf8, 0xed, 0x5b,
+    0xd5, 0xba, 0x95, 0xc5, 0x1a, 0xc9, 0xd8, 0x63, 0xd6, 0x26, 0xf1, 0xf5, 0xa2, 0x55, 0xd0, 0xa8,
+    0x16, 0x42, 0x52, 0xcb, 0x60, 0xc5, 0xbd, 0x49, 0x14, 0xab, 0xad, 0xd8, 0x6a, 0x5e, 0xa9, 0x2c,
+    0xc6, 0xe6, 0x90, 0xcb, 0x39, 0xb2, 0xb8, 0x79, 0xef, 0xd1, 0x64, 0x8a, 0xe2, 0x51, 0x9d, 0x21,
+    0xee, 0xc8, 0xf5, 0x4e, 0x28, 0x82, 0xe3, 0x94, 0x42, 0x63, 0x8c, 0x3a, 0xf0, 0x6b, 0x4a, 0x5e,
+    0x2b, 0xd1, 0xce, 0x60, 0xeb, 0x41, 0x59, 0x8c, 0xbd, 0xbe, 0xdb, 0x00, 0xb5, 0x6f, 0xbe, 0xa6,
+    0xbc, 0x5f, 0xe7, 0x7a, 0xfd, 0xf3, 0xe6, 0x7d, 0xb7, 0x00, 0x19, 0x60, 0xac, 0x4d, 0x6b, 0x15,
+    0x57, 0xdf, 0xdb, 0x64, 0x83, 0xae, 0x6e, 0x35, 0x10, 0x90, 0x0b, 0x05, 0x9d, 0xf2, 0xd3, 0x8a,
+    0xc5, 0x75, 0x70, 0x6e, 0xb1, 0x43, 0x3a, 0x08, 0x86, 0x8a, 0x02, 0x60, 0x71, 0x46, 0xdb, 0xf7,
+    0xac, 0x99, 0xec, 0x56, 0x0b, 0xa2, 0xce, 0xfd, 0xd5, 0xb4, 0x83, 0x4f, 0xa8, 0x6a, 0xb9, 0x5b,
+    0xc0, 0x99, 0x8c, 0x4e, 0x09, 0xa6, 0x2e, 0x3a, 0xcc, 0x86, 0x21, 0x19, 0xd7, 0x80, 0x5d, 0xb0,
+    0x2a, 0xb5, 0x51, 0x24, 0xef, 0x80, 0xd9, 0xf4, 0x4a, 0x0e, 0x8c, 0xfc, 0x66, 0x9c, 0xcd, 0xa4,
+    0x31, 0xe7, 0x7b, 0x54, 0x8d, 0x9d, 0x17, 0xa6, 0xd1, 0x1b, 0xd6, 0x71, 0xb3, 0xfc, 0x3d, 0x68,
+    0x22, 0x1e, 0xe7, 0x3c, 0xb4, 0x13, 0xaa, 0x53, 0x19, 0x2f, 0x80, 0xcd, 0x92, 0x19, 0xc8, 0x2c,
+    0x09, 0x79, 0x59, 0xe3, 0xe3, 0x09, 0xd9, 0x1f, 0x51, 0x19, 0x23, 0xb2, 0x1b, 0x32, 0x1d, 0xa3,
+    0x74, 0xd3, 0xcd, 0x84, 0xbc, 0x33, 0x0b, 0xac, 0x27, 0x33, 0x57, 0x94, 0x94, 0xa8, 0xb3, 0x59,
+    0x16, 0xe5, 0xe2, 0xf6, 0x2d, 0x52, 0x4e, 0x51, 0x52, 0xbf, 0x1e, 0x4b, 0x78, 0x3a, 0x85, 0xfd,
+    0xa2, 0xbc, 0x7d, 0xfb, 0xe1, 0x9d, 0xbf, 0xb4, 0x93, 0x49, 0x69, 0x66, 0x36, 0x7c, 0x19, 0xf3,
+    0xea, 0xcd, 0xda, 0x58, 0xe5, 0x58, 0x05, 0xe5, 0xc0, 0x50, 0x25, 0xe1, 0x29, 0xa7, 0x6c, 0x6c,
+    0x5a, 0xe3, 0xaf, 0xbe, 0x3c, 0xbd, 0x10, 0x3c, 0xf5, 0xe7, 0xcf, 0xcd, 0x5b, 0xb7, 0x5f, 0xa4,
+    0xfe, 0xd0, 0xd6, 0x63, 0x4a, 0xec, 0x53, 0xbc, 0x0a, 0xd6, 0x7b, 0x0e, 0x5a, 0x1f, 0x6e, 0x2a,
+    0xa8, 0x13, 0x1f, 0x6a, 0x1a, 0xa8, 0x05, 0x6d, 0x1a, 0x87, 0x75, 0x84, 0x96, 0x7e, 0x48, 0x38,
+    0x41, 0xed, 0x51, 0xf5, 0x3c, 0xdb, 0x75, 0xbd, 0x3d, 0xea, 0xc7, 0xd3, 0xaa, 0x86, 0xab, 0xb6,
+    0x68, 0x55, 0xb5, 0x1d, 0x2b, 0xfe, 0x57, 0x71, 0x0b, 0xc7, 0x95, 0x41, 0x4f, 0x60, 0xd5, 0xf6,
+    0x21, 0x69, 0x08, 0x74, 0x00, 0xa5, 0x95, 0x45, 0xcb, 0xbd, 0xe5, 0x28, 0x15, 0x89, 0x4a, 0xb5,
+    0xc1, 0x26, 0x75, 0xe9, 0xae, 0x36, 0x7d, 0x19, 0xbf, 0x16, 0x43, 0x53, 0x85, 0x6e, 0xd7, 0x53,
+    0xcb, 0x5a, 0x06, 0x76, 0x96, 0x41, 0x42, 0xbc, 0xcb, 0x26, 0xab, 0x7e, 0x85, 0x0c, 0x10, 0x1d,
+    0x26, 0xcb, 0x13, 0x18, 0xa0, 0x78, 0x22, 0x83, 0x00, 0x3d, 0xab, 0xed, 0x4d, 0xfa, 0xc2, 0xb8,
+    0x7f, 0x8a, 0xd0, 0x88, 0x39, 0x12, 0x7a, 0xae, 0x02, 0xd8, 0x2d, 0xcd, 0xb7, 0xab, 0x29, 0xac,
+    0x31, 0xa2, 0xe1, 0x29, 0x43, 0x9b, 0xba, 0xed, 0x08, 0x67, 0x0f, 0x54, 0x3b, 0x95, 0x93, 0xed,
+    0x5c, 0x42, 0xc7, 0xd4, 0x73, 0x53, 0xa0, 0x93, 0x76, 0x7c, 0xb5, 0x7b, 0xb3, 0x53, 0x14, 0xc5,
+    0x0e, 0xb9, 0xc1, 0x4e, 0x9e, 0x86, 0x22, 0xf6, 0xe1, 0x2f, 0xf0, 0xe7, 0x37, 0x2d, 0xa6, 0x09,
+    0xec, 0x77, 0x6f, 0xdd, 0x98, 0x37, 0x06, 0xbb, 0xf3, 0xff, 0x87, 0x09, 0x86, 0x19, 0x45, 0x7c,
+    0xd3, 0x4c, 0xe8, 0x51, 0x1d, 0xc6, 0xa0, 0x1e, 0x6a, 0x5e, 0x9a, 0xeb, 0x14, 0x7b, 0x39, 0x92,
+    0xa7, 0xcb, 0x0f, 0xef, 0x4c, 0x65, 0x26, 0xd6, 0xb4, 0xfe, 0x88, 0x3a, 0x15, 0xb7, 0xef, 0x8d,
+    0x74, 0x00, 0x39, 0xe3, 0xf9, 0xe4, 0x0a, 0x47, 0x7a, 0xe8, 0x26, 0x32, 0xd7, 0x74, 0x34, 0x70,
+    0x38, 0x19, 0xa2, 0x06, 0x73, 0x63, 0x13, 0xd7, 0x6d, 0x93, 0xf3, 0xb2, 0xd3, 0x78, 0x6c, 0x9a,
+    0xad, 0x08, 0xca, 0xf1, 0x4c, 0xcf, 0xa9, 0xa5, 0xed, 0xcc, 0x3b, 0x4c, 0x85, 0x6b, 0x66, 0xc6,
+    0xcd, 0xc0, 0x18, 0x71, 0xc4, 0x0c, 0xad, 0x65, 0x3c, 0x55, 0x34, 0x87, 0xad, 0xdc, 0xaa, 0x2a,
+    0x56, 0x3b, 0x08, 0xad, 0x65, 0x77, 0x7d, 0x62, 0x65, 0x92, 0x60, 0x42, 0x98, 0x99, 0xbf, 0x48,
+    0x94, 0xcc, 0x1d, 0x86, 0x99, 0x9a, 0x20, 0x60, 0xe5, 0x33, 0x1a, 0x84, 0x5e, 0xd1, 0x14, 0xba,
+    0xbd, 0x26, 0x01, 0x9f, 0x29, 0x5f, 0x36, 0x75, 0xb1, 0x3f, 0xe7, 0xe8, 0x39, 0x0f, 0x18, 0x6a,
+    0x9b, 0x48, 0x66, 0x02, 0xda, 0xca, 0x54, 0x78, 0x2d, 0xdc, 0x5e, 0x76, 0x99, 0x72, 0x19, 0x9a,
+    0xc9, 0x41, 0x3d, 0x00, 0xb6, 0xf4, 0xd5, 0xbe, 0x11, 0x5b, 0xd7, 0xa8, 0x51, 0x99, 0xcf, 0xde,
+    0xa4, 0xa6, 0xeb, 0x67, 0xa3, 0xde, 0xd4, 0xa9, 0x42, 0x6d, 0x67, 0xc0, 0x31, 0x84, 0x31, 0x30,
+    0x2a, 0x1a, 0x1a, 0x0e, 0x99, 0xde, 0xb7, 0xf1, 0xa7, 0xb5, 0x13, 0x57, 0xe6, 0x31, 0xd5, 0x21,
+    0x8d, 0x82, 0xee, 0x1c, 0x4e, 0xfd, 0xe5, 0x1d, 0xfb, 0xa2, 0xbd, 0x98, 0xe3, 0xb5, 0xbe, 0x8c,
+    0xba, 0xb2, 0xdc, 0xf7, 0x41, 0x87, 0xb3, 0x32, 0xd0, 0xf0, 0x43, 0x44, 0xed, 0xca, 0x9e, 0x3a,
+    0x33, 0xab, 0x26, 0xf8, 0xd9, 0x4c, 0x73, 0xd0, 0xfc, 0xb1, 0xc7, 0x47, 0xc7, 0xec, 0x02, 0x12,
+    0x41, 0x11, 0x8c, 0xdc, 0x52, 0xf0, 0x2b, 0x64, 0x92, 0xd2, 0xe4, 0x1b, 0x5f, 0x66, 0x8b, 0xea,
+    0x4e, 0x61, 0xd4, 0xd9, 0xb1, 0x51, 0x2b, 0x61, 0x72, 0x5f, 0x82, 0xc7, 0x32, 0x61, 0x25, 0xf2,
+    0x48, 0xaf, 0x13, 0x01, 0xed, 0x88, 0x27, 0x3c, 0x0e, 0x42, 0xea, 0x0a, 0xf3, 0x38, 0x68, 0x5b,
+    0xf2, 0xd6, 0x17, 0x2c, 0xd4, 0x57, 0x31, 0xcd, 0xc5, 0x2a, 0x58, 0xd7, 0x5c, 0x2f, 0x08, 0x2f,
+    0x49, 0x61, 0x7e, 0xb1, 0x7e, 0x24, 0xa6, 0x3c, 0x0f, 0x35, 0x78, 0x63, 0x64, 0x1c, 0x64, 0x7b,
+    0x5f, 0x57, 0xe3, 0x14, 0xe4, 0xd1, 0xde, 0x1d, 0x02, 0x1a, 0xaa, 0x85, 0x15, 0x84, 0x18, 0xea,
+    0x3b, 0x85, 0xa7, 0xd1, 0x71, 0x09, 0x8d, 0xba, 0x48, 0xa1, 0xeb, 0xd0, 0x2b, 0x37, 0x14, 0x2f,
+    0x9d, 0xae, 0x47, 0xd1, 0x16, 0x84, 0xf0, 0xcd, 0x66, 0x93, 0x8d, 0xcf, 0x5d, 0xe3, 0xb7, 0x8e,
+    0x08, 0xc0, 0xa1, 0x7a, 0xa9, 0x42, 0xea, 0x8c, 0xfa, 0x83, 0x5f, 0x08, 0x69, 0x75, 0xb4, 0x4b,
+    0xea, 0xef, 0x1d, 0xbd, 0x2e, 0x39, 0x12, 0x48, 0x35, 0xf3, 0xc7, 0x96, 0x13, 0x12, 0x0b, 0xed,
+    0xa7, 0xfa, 0xd7, 0x75, 0x2c, 0x78, 0x6e, 0x44, 0xe8, 0x6c, 0x0f, 0x49, 0x14, 0xa2, 0x1b, 0xd4,
+    0x86, 0x21, 0x0b, 0x12, 0xec, 0xca, 0xb0, 0x6b, 0x4d, 0x95, 0x0c, 0xfb, 0x34, 0xd7, 0x93, 0xcc,
+    0x55, 0xb2, 0xef, 0xa5, 0xda, 0x6e, 0xfa, 0x3f, 0x23, 0xbc, 0x1a, 0x07, 0xf7, 0x29, 0xb7, 0xd9,
+    0xee, 0xc2, 0xde, 0x77, 0xfe, 0xac, 0xbe, 0xad, 0x5c, 0x89, 0xb1, 0x51, 0x76, 0x2a, 0xa6, 0x54,
+    0xea, 0xf5, 0xef, 0x45, 0x77, 0x3a, 0xf7, 0xa2, 0x30, 0xcf, 0x9a, 0xa7, 0x0a, 0x7a, 0x7f, 0x65,
+    0xd4, 0x48, 0x4b, 0x6b, 0xd7, 0xa1, 0x23, 0x2b, 0xba, 0xfa, 0x71, 0x00, 0xa0, 0x75, 0x4e, 0x0e,
+    0x5e, 0x60, 0x7e, 0x97, 0x85, 0xba, 0xe2, 0x2b, 0x77, 0x43, 0x1e, 0xfb, 0x56, 0x65, 0x9a, 0xe2,
+    0x64, 0x46, 0x65, 0x5e, 0xa8, 0x66, 0xa6, 0xdd, 0xf3, 0xba, 0x5e, 0x7f, 0xe7, 0xf5, 0xcf, 0x9d,
+    0xf3, 0x9b, 0x3a, 0x58, 0x1f, 0xd1, 0xc1, 0xec, 0xd7, 0x9f, 0x3c, 0x60, 0x99, 0x49, 0x52, 0x01,
+    0x62, 0xf7, 0xed, 0x6f, 0x7c, 0x11, 0x31, 0x4a, 0x62, 0xcb, 0x82, 0x6e, 0x09, 0xf3, 0xdb, 0xf7,
+    0xa5, 0x5e, 0x80, 0x70, 0x89, 0xff, 0x6c, 0x2e, 0x0b, 0x10, 0xca, 0xf1, 0xf6, 0xc3, 0x6f, 0x19,
+    0x4d, 0x13, 0x52, 0x16, 0xaa, 0x05, 0x0f, 0x29, 0xad, 0xad, 0x0b, 0xea, 0x13, 0xba, 0x85, 0x36,
+    0x89, 0xb7, 0x7f, 0x99, 0xdc, 0xbb, 0xbe, 0x5a, 0xbd, 0x66, 0x6e, 0xfd, 0xa3, 0x15, 0x2f, 0x82,
+    0x60, 0x1a, 0x75, 0x2f, 0xac, 0x6e, 0xff, 0x4c, 0xc9, 0x03, 0x45, 0x32, 0x51, 0x2f, 0x16, 0xb0,
+    0x04, 0x0f, 0x49, 0xa3, 0x4b, 0x9c, 0xaa, 0x6e, 0x02, 0x44, 0x7d, 0x03, 0xfe, 0x39, 0x55, 0x41,
+    0x2b, 0xc1, 0xf6, 0x87, 0xde, 0x87, 0x77, 0x37, 0xdd, 0x75, 0x2f, 0xbe, 0x12, 0x6c, 0x7b, 0xe6,
+    0xb8, 0x3e, 0xcd, 0xec, 0x19, 0xa2, 0x19, 0xd5, 0x44, 0x52, 0xd7, 0x9d, 0xc7, 0x60, 0x87, 0xe7,
+    0x22, 0x45, 0x27, 0xb9, 0x36, 0x13, 0xcd, 0x83, 0x2d, 0xba, 0x9f, 0xa6, 0x56, 0x62, 0xeb, 0xe5,
+    0x0b, 0x53, 0xe0, 0x1e, 0x6c, 0x75, 0x91, 0xd0, 0x95, 0x6a, 0x5d, 0x29, 0x77, 0x53, 0x67, 0x00,
+    0x0a, 0x1e, 0xc9, 0xeb, 0xfb, 0x22, 0x77, 0xd0, 0x10, 0x59, 0x5b, 0x59, 0xb5, 0x69, 0xad, 0xa1,
+    0xe9, 0x51, 0x8d, 0x8e, 0x66, 0x02, 0x1b, 0x5c, 0x98, 0x96, 0xc6, 0xf4, 0x36, 0xfd, 0xcd, 0xeb,
+    0xcd, 0xaa, 0xe1, 0x66, 0x1b, 0x3a, 0xa0, 0x77, 0x9d, 0x7e, 0xd5, 0xbc, 0xaf, 0xca, 0x5b, 0xfa,
+    0xda, 0x56, 0xd1, 0x07, 0x6c, 0xb3, 0x7b, 0x66, 0x73, 0x31, 0xd7, 0xf0, 0xb2, 0x1e, 0x0f, 0x1f,
+    0x9d, 0x9f, 0x55, 0xc5, 0xe6, 0xa9, 0xb9, 0x44, 0x42, 0x68, 0xe9, 0xe6, 0xe4, 0x2a, 0x97, 0xa1,
+    0x5c, 0xbb, 0x4f, 0x24, 0xb6, 0x1a, 0x7e, 0x0c, 0xa8, 0x5a, 0x24, 0xb4, 0x63, 0xe0, 0x34, 0x43,
+    0x2f, 0x8e, 0x68, 0x72, 0xcf, 0xfd, 0xe0, 0x28, 0x14, 0xe2, 0x99, 0xf8, 0xe1, 0xf0, 0x59, 0x3e,
+    0x01, 0xeb, 0x80, 0xaf, 0xaa, 0x95, 0xa1, 0xb4, 0xd8, 0xa9, 0x27, 0xdb, 0x8a, 0x84, 0x82, 0xf6,
+    0xc0, 0xf1, 0xa8, 0xb9, 0x17, 0xc0, 0xd6, 0x6c, 0xa9, 0xa3, 0x5d, 0xef, 0xc7, 0x02, 0x76, 0x3a,
+    0x11, 0x73, 0x88, 0x87, 0x7e, 0x01, 0x54, 0xda, 0x5f, 0x0f, 0xd0, 0xec, 0x13, 0xcb, 0xb2, 0xf9,
+    0x29, 0x0c, 0xa2, 0xa6, 0xa9, 0x15, 0x4a, 0xf3, 0x83, 0xa0, 0xa2, 0xfd, 0x3d, 0xc1, 0xfd, 0x7d,
+    0x73, 0x3b, 0xfb, 0x80, 0x05, 0xdc, 0x23, 0xa1, 0x8a, 0xe3, 0xde, 0x7c, 0x05, 0xdd, 0x5b, 0x26,
+    0x10, 0x50, 0xdd, 0x26, 0x2d, 0x57, 0xad, 0x5e, 0xc3, 0xf7, 0x3d, 0xa3, 0x92, 0x61, 0x5f, 0xea,
+    0x98, 0x61, 0xd5, 0x38, 0xdc, 0x43, 0xd3, 0xaa, 0x53, 0x8f, 0x3a, 0xf2, 0x7b, 0xc2, 0xd3, 0x48,
+    0xc5, 0xf2, 0x6a, 0x21, 0xeb, 0x5f, 0x2a, 0xa1, 0xb0, 0x42, 0xbf, 0x80, 0x70, 0x74, 0xcf, 0x6f,
+    0x95, 0xbe, 0x8f, 0xe8, 0x40, 0x68, 0xd4, 0x8e, 0xd9, 0x6a, 0xa5, 0xd2, 0x1f, 0xf5, 0xb4, 0x21,
+    0x2e, 0x18, 0xa0, 0xde, 0x12, 0xdd, 0xba, 0x81, 0x6d, 0x21, 0x3d, 0x85, 0xa6, 0x79, 0xd4, 0xbb,
+    0xd8, 0x0e, 0xee, 0x2d, 0x64, 0x3a, 0x42, 0xae, 0x3f, 0xbb, 0x9b, 0xdb, 0x5b, 0x9f, 0x81, 0x35,
+    0x7b, 0x69, 0x53, 0xc9, 0x6a, 0xe8, 0x97, 0x44, 0x99, 0xd0, 0x4d, 0xe6, 0x1c, 0x4e, 0xe4, 0xdb,
+    0x76, 0xe2, 0x08, 0xef, 0xc7, 0xbf, 0xff, 0x05, 0x61, 0x68, 0x79, 0x70, 0xc7, 0x26, 0x00, 0x00,
+};
+
+const uint8_t STATIC_CONFIG_HTML_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0x6b, 0x8f, 0x1b, 0xc9,
+    0x71, 0xdf, 0xef, 0x57, 0xf4, 0xd1, 0x09, 0x96, 0xcc, 0x2d, 0xb9, 0x24, 0xf7, 0xa1, 0xd5, 0x4a,
+    0x4b, 0x61, 0xf5, 0xb8, 0x3b, 0xf9, 0xa4, 0xd3, 0x42, 0x2b, 0x79, 0x63, 0xd9, 0x97, 0xa0, 0x39,
+    0xd3, 0xcb, 0x6d, 0x72, 0x38, 0x3d, 0x99, 0xc7, 0x52, 0x43, 0x9f, 0x01, 0x5b, 0x38, 0xc5, 0x09,
+    0x10, 0xc0, 0x89, 0xcf, 0x40, 0x20, 0x5f, 0x00, 0xc7, 0xf9, 0x07, 0x81, 0x00, 0xc3, 0xb1, 0x0f,
+    0xf9, 0xa2, 0xe5, 0x1f, 0xd1, 0x1f, 0xb0, 0x7f, 0x42, 0xaa, 0xba, 0x7b, 0x5e, 0xe4, 0x0c, 0xc9,
+    0xa1, 0x56, 0x8f, 0x0b, 0x74, 0x07, 0xed, 0x2e, 0x87, 0xd3, 0x5d, 0xd5, 0xd5, 0x55, 0xd5, 0x55,
+    0xd5, 0xd5, 0xd5, 0x57, 0x3f, 0xbc, 0x79, 0xef, 0xc6, 0x83, 0x1f, 0x1e, 0xde, 0x22, 0xa7, 0xfe,
+    0xd0, 0xea, 0x7c, 0x70, 0x15, 0x7f, 0x11, 0x8b, 0xda, 0xbd, 0xfd, 0x35, 0xc7, 0x5a, 0xc3, 0x07,
+    0x8c, 0x9a, 0xf0, 0x6b, 0xc8, 0x7c, 0x4a, 0x8c, 0x53, 0xea, 0x7a, 0xcc, 0xdf, 0x5f, 0x7b, 0xf8,
+    0xe0, 0xe3, 0xfa, 0xee, 0x5a, 0xf4, 0xd8, 0xa6, 0x43, 0xb6, 0xbf, 0x76, 0xc6, 0xd9, 0xc8, 0x11,
+    0xae, 0xbf, 0x46, 0x0c, 0x61, 0xfb, 0xcc, 0x86, 0xd7, 0x46, 0xdc, 0xf4, 0x4f, 0xf7, 0x4d, 0x76,
+    0xc6, 0x0d, 0x56, 0x97, 0x1f, 0xd6, 0x09, 0xb7, 0xb9, 0xcf, 0xa9, 0x55, 0xf7, 0x0c, 0x6a, 0xb1,
+    0xfd, 0x56, 0xa3, 0x89, 0xdd, 0xf8, 0xdc, 0xb7, 0x58, 0xe7, 0x33, 0x61, 0x9f, 0xf0, 0x5e, 0xe0,
+    0x52, 0xa3, 0x4f, 0x49, 0x9d, 0x1c, 0xf9, 0x2e, 0x9d, 0x7c, 0x6b, 0xf3, 0x01, 0xb9, 0x0d, 0xfd,
+    0xb9, 0x36, 0xf3, 0x83, 0xab, 0x1b, 0xea, 0xcd, 0x0f, 0xae, 0x5a, 0xdc, 0x1e, 0x10, 0x97, 0x59,
+    0xfb, 0x6b, 0x1c, 0xc0, 0xad, 0x11, 0x3f, 0x74, 0x00, 0x07, 0x3e, 0xa4, 0x3d, 0xb6, 0xe1, 0x9d,
+    0xf5, 0x3e, 0x7a, 0x3c, 0xb4, 0xd6, 0xc8, 0xa9, 0xcb, 0x4e, 0xf6, 0xd7, 0x36, 0x3c, 0x9f, 0xfa,
+    0xdc, 0xd8, 0xc0, 0x17, 0x1b, 0xf0, 0xdd, 0xb5, 0xb3, 0xfd, 0xcb, 0xed, 0xdd, 0xed, 0xee, 0xe6,
+    0xa5, 0xd6, 0x5a, 0xa6, 0x27, 0xcf, 0x0f, 0x2d, 0xe6, 0x9d, 0x32, 0xe6, 0x4f, 0x37, 0xa5, 0x8e,
+    0xd3, 0x30, 0x3c, 0x0f, 0x5a, 0xee, 0x9c, 0x18, 0xad, 0xcd, 0x66, 0x57, 0x0e, 0xde, 0x33, 0x5c,
+    0xee, 0xf8, 0xc4, 0x73, 0x8d, 0xec, 0x9b, 0x7d, 0x7c, 0xb1, 0xb9, 0x7d, 0x99, 0x6d, 0xb1, 0x9d,
+    0xad, 0xb5, 0xce, 0xd5, 0x0d, 0xf5, 0x62, 0xdc, 0xa2, 0x63, 0x0a, 0x23, 0x18, 0x02, 0x85, 0x1a,
+    0xd1, 0x1f, 0xb7, 0x2c, 0x26, 0x3f, 0x03, 0x71, 0x0f, 0x7c, 0xdf, 0xe5, 0xdd, 0xc0, 0x67, 0xd5,
+    0x35, 0x93, 0xfa, 0xb4, 0xee, 0x9f, 0xc2, 0x57, 0x6b, 0xeb, 0xc4, 0x12, 0x40, 0xb0, 0x23, 0x5f,
+    0xb8, 0x30, 0xc2, 0x46, 0x8f, 0xf9, 0xb7, 0x7d, 0x36, 0xac, 0xae, 0xa9, 0x6f, 0x6b, 0xe4, 0xcb,
+    0x2f, 0xc9, 0x9a, 0xc5, 0x7b, 0xa7, 0xfe, 0x5a, 0xed, 0x4a, 0x0a, 0xde, 0x86, 0x9e, 0xbd, 0xae,
+    0x30, 0xc3, 0xce, 0x07, 0x04, 0xfe, 0xbb, 0x6a, 0xf2, 0x33, 0x62, 0x58, 0xd4, 0xf3, 0xf6, 0x2b,
+    0x38, 0x4f, 0x94, 0xdb, 0xcc, 0xad, 0xa8, 0xef, 0xe4, 0xf7, 0xa7, 0xad, 0xec, 0x3c, 0xc4, 0xb3,
+    0x40, 0xd3, 0xd3, 0x00, 0x6f, 0x25, 0x4d, 0x4e, 0x84, 0x3b, 0x24, 0xdc, 0x94, 0x1d, 0x42, 0xc3,
+    0x8f, 0xe1, 0x63, 0x85, 0xd8, 0xe2, 0x8c, 0x5a, 0x1c, 0x86, 0xc0, 0x52, 0x6f, 0x22, 0x70, 0x39,
+    0x2a, 0x8f, 0x19, 0x3e, 0x17, 0xf6, 0x7e, 0xa5, 0xc7, 0x00, 0x3e, 0xb5, 0x2a, 0x44, 0x12, 0x7f,
+    0xbf, 0x62, 0x72, 0xcf, 0xb1, 0x68, 0xb8, 0x77, 0x62, 0xb1, 0xc7, 0x57, 0x48, 0x3f, 0xf0, 0x7c,
+    0x7e, 0x12, 0xd6, 0x35, 0x47, 0xc9, 0xa7, 0x75, 0x66, 0x9b, 0x57, 0xc8, 0x90, 0xba, 0x3d, 0x6e,
+    0xd7, 0xbb, 0xc2, 0xf7, 0xc5, 0x70, 0xaf, 0xb5, 0xed, 0x3c, 0xbe, 0x92, 0x1a, 0xc5, 0xf4, 0x48,
+    0xbd, 0x11, 0xf7, 0x8d, 0xd3, 0xfa, 0xc8, 0xa5, 0x4e, 0x0c, 0x49, 0xf6, 0x65, 0x72, 0x57, 0x61,
+    0xb2, 0x67, 0x08, 0x2b, 0x18, 0xda, 0x57, 0x08, 0x20, 0xdd, 0xb3, 0xeb, 0x1c, 0xa8, 0xeb, 0xa5,
+    0xc0, 0xf5, 0xa8, 0xb3, 0xb7, 0x33, 0x0b, 0x23, 0x86, 0x93, 0x8b, 0x7d, 0xba, 0x2b, 0x83, 0x21,
+    0xf1, 0x54, 0x47, 0xad, 0x66, 0x7e, 0x4f, 0xb2, 0x37, 0xcf, 0xa1, 0x76, 0xe7, 0x81, 0x1b, 0x76,
+    0x89, 0xc1, 0xd9, 0xd0, 0x0e, 0x61, 0x36, 0xf1, 0x49, 0xfe, 0xcb, 0x16, 0xed, 0x32, 0x2b, 0x3b,
+    0xc8, 0x82, 0x7e, 0xe5, 0xeb, 0xdc, 0x76, 0x02, 0x5f, 0x89, 0x4a, 0xc5, 0x38, 0x65, 0xc6, 0xa0,
+    0x2b, 0x1e, 0x57, 0xe4, 0xcc, 0x49, 0x3e, 0x3a, 0x52, 0x1d, 0x28, 0x79, 0xae, 0x98, 0xd4, 0x1d,
+    0xdc, 0x15, 0x26, 0xab, 0x10, 0x61, 0x83, 0xe0, 0xdb, 0x3d, 0x78, 0xe6, 0x8b, 0x5e, 0xcf, 0x62,
+    0x0f, 0xf0, 0xe5, 0xaa, 0x7f, 0xca, 0xbd, 0x86, 0xec, 0x85, 0x99, 0xb5, 0x79, 0x50, 0x11, 0xff,
+    0x18, 0x47, 0x60, 0x09, 0xe4, 0xb7, 0xb9, 0xa3, 0xda, 0x90, 0xc3, 0xca, 0xa1, 0xf4, 0x06, 0x90,
+    0x3a, 0xe7, 0xb1, 0xa2, 0x42, 0x34, 0xad, 0xc0, 0x2a, 0x75, 0x8f, 0x8f, 0xd9, 0x5e, 0xb3, 0x71,
+    0x79, 0x9b, 0x0d, 0x81, 0xd0, 0xdf, 0x67, 0xa6, 0x2d, 0x3c, 0x7f, 0xc0, 0x49, 0xcf, 0x12, 0x5d,
+    0x6a, 0xd9, 0x6c, 0x0f, 0xb0, 0x62, 0x16, 0xcc, 0xbc, 0x1c, 0xbc, 0x7a, 0xfa, 0x10, 0x14, 0x53,
+    0x34, 0xf6, 0xf4, 0x93, 0x64, 0xf4, 0x20, 0x9d, 0x9f, 0xc4, 0x5f, 0xa8, 0xf1, 0x03, 0x8f, 0x07,
+    0xac, 0x16, 0xf3, 0x94, 0xe6, 0x4a, 0x8b, 0x9d, 0xf8, 0x7b, 0xc8, 0x92, 0xc4, 0xa1, 0xa6, 0xc9,
+    0xed, 0xde, 0xde, 0xd6, 0x9c, 0x19, 0x17, 0x0e, 0x32, 0x20, 0x91, 0x5d, 0xed, 0x57, 0x5a, 0x95,
+    0xce, 0xd0, 0xbb, 0xba, 0xa1, 0x1e, 0x2e, 0xd7, 0xa2, 0xd9, 0x6c, 0x56, 0x3a, 0xe5, 0xda, 0xec,
+    0x34, 0x65, 0xa3, 0x21, 0xb7, 0x8b, 0x9b, 0xc1, 0x1c, 0x49, 0x1a, 0x75, 0x8a, 0x27, 0x24, 0xcd,
+    0x50, 0xa7, 0xdc, 0x34, 0x99, 0x5d, 0x99, 0xa2, 0xe8, 0x0f, 0x10, 0xde, 0x2c, 0x59, 0xd5, 0xe3,
+    0x29, 0x81, 0xcd, 0x4e, 0xaf, 0xfe, 0xf8, 0x41, 0xae, 0x3c, 0x2b, 0xa1, 0xad, 0x4c, 0x29, 0x13,
+    0x93, 0xd3, 0xde, 0x74, 0xa7, 0xa7, 0xed, 0xce, 0x4d, 0x78, 0x8c, 0x0c, 0x10, 0x82, 0x0e, 0x73,
+    0x19, 0xcc, 0xe2, 0x8b, 0xe7, 0x23, 0x50, 0x61, 0xed, 0x1c, 0x7d, 0x31, 0x25, 0xc7, 0x3d, 0x97,
+    0xa3, 0xf0, 0xc3, 0xcf, 0x3a, 0x48, 0x31, 0x3c, 0xf2, 0x59, 0x5d, 0x29, 0x0a, 0x6f, 0x0f, 0xba,
+    0x72, 0x18, 0xf5, 0xab, 0x34, 0xf0, 0x45, 0xfd, 0x84, 0xfb, 0xeb, 0x04, 0xa8, 0x39, 0xa4, 0x8f,
+    0xab, 0xad, 0x5d, 0x90, 0xef, 0x75, 0xd2, 0x3a, 0x71, 0x6b, 0x35, 0x25, 0xf0, 0xbb, 0x8b, 0x35,
+    0x47, 0x97, 0x1a, 0x83, 0x9e, 0x2b, 0x02, 0xdb, 0xdc, 0x3b, 0xa3, 0x6e, 0xb5, 0x5e, 0x07, 0xd2,
+    0xd6, 0x12, 0xfe, 0x91, 0x2a, 0x83, 0x74, 0x85, 0x0b, 0xd2, 0xb3, 0xd7, 0x72, 0x1e, 0x13, 0x4f,
+    0x80, 0x24, 0x11, 0xf5, 0x6a, 0xd7, 0x35, 0x6b, 0xd1, 0x97, 0x75, 0x97, 0x9a, 0x3c, 0xf0, 0xb4,
+    0xb2, 0x3a, 0x9e, 0x3c, 0x39, 0x7f, 0x6a, 0x8c, 0x99, 0xcd, 0x19, 0x19, 0x53, 0x8f, 0xc3, 0xc2,
+    0xce, 0x29, 0x30, 0x7f, 0x57, 0x11, 0xee, 0x84, 0x33, 0x0b, 0x66, 0x4b, 0xd2, 0xe4, 0x26, 0x3b,
+    0xa1, 0x81, 0xe5, 0x57, 0x3a, 0xf5, 0xab, 0x1b, 0xdd, 0x4e, 0x91, 0xa8, 0xbd, 0x7e, 0x8c, 0x29,
+    0xa8, 0x20, 0x53, 0xf4, 0x88, 0xe7, 0xb8, 0xe3, 0xf3, 0x67, 0xbe, 0x18, 0x85, 0xf9, 0xf8, 0x1e,
+    0x9b, 0xef, 0x0e, 0xae, 0x8e, 0x2b, 0x7a, 0x2e, 0x1d, 0x16, 0xe2, 0x7a, 0x24, 0x4e, 0xde, 0x09,
+    0x7c, 0xc3, 0xfe, 0xf9, 0x53, 0x9f, 0x0d, 0x36, 0x6e, 0xb8, 0xd4, 0x3b, 0xcd, 0x47, 0xf5, 0xd6,
+    0x63, 0x83, 0x49, 0x7d, 0xf0, 0xb6, 0x91, 0x45, 0x9a, 0xa1, 0xb4, 0xfa, 0xd4, 0xf5, 0x8b, 0xa9,
+    0xfa, 0xf6, 0x49, 0xda, 0x0d, 0x4c, 0x2d, 0x5f, 0xc4, 0x64, 0xcc, 0x21, 0x9e, 0x05, 0x3f, 0x8b,
+    0x44, 0x8c, 0x39, 0x47, 0xf8, 0xf5, 0xdb, 0xc6, 0xfa, 0x3e, 0x62, 0x43, 0xc6, 0x6c, 0x64, 0x83,
+    0x84, 0xb9, 0x63, 0x3b, 0x2c, 0xe2, 0x05, 0xff, 0x9d, 0xc0, 0x34, 0x24, 0xd0, 0x2f, 0x58, 0x4f,
+    0x94, 0x54, 0x95, 0x3e, 0x03, 0x72, 0xd7, 0x66, 0x51, 0x96, 0xef, 0xc8, 0x06, 0x37, 0x00, 0x8d,
+    0x39, 0xa8, 0xe7, 0x3d, 0x72, 0xf2, 0xec, 0x87, 0x5d, 0xb4, 0x1f, 0xc0, 0x9d, 0xb1, 0x84, 0xbb,
+    0xf7, 0xbd, 0x9d, 0x9d, 0x9d, 0xd8, 0xec, 0xf4, 0x45, 0x64, 0x0e, 0xde, 0xe1, 0xc6, 0xb8, 0x1b,
+    0x82, 0x72, 0x75, 0xb8, 0x17, 0x8e, 0xa8, 0xcd, 0xc8, 0x88, 0x28, 0x33, 0x18, 0xdc, 0x00, 0x58,
+    0x6f, 0x6d, 0x4a, 0x06, 0x60, 0x3f, 0x9b, 0xe1, 0x90, 0x20, 0x2b, 0x83, 0x4d, 0x47, 0x5e, 0xfe,
+    0xec, 0x6b, 0xe2, 0x08, 0xf0, 0x54, 0x28, 0x88, 0x23, 0x19, 0x85, 0x03, 0x37, 0x3c, 0xff, 0x05,
+    0x39, 0xbe, 0xf9, 0x60, 0x83, 0x45, 0xc2, 0x47, 0xce, 0xbc, 0x06, 0x58, 0xd0, 0xee, 0x10, 0x8d,
+    0x15, 0xb5, 0x66, 0x85, 0x0d, 0x18, 0xf0, 0x14, 0x3d, 0x70, 0x7c, 0xc4, 0x17, 0x64, 0xe4, 0x8d,
+    0x43, 0xb4, 0x6f, 0xa2, 0x57, 0x63, 0x7a, 0x41, 0xe7, 0xc2, 0x46, 0xa4, 0x40, 0x99, 0xb2, 0x31,
+    0xb9, 0x75, 0x74, 0x48, 0xe4, 0x7a, 0x35, 0xa4, 0x7e, 0x08, 0x64, 0x64, 0xe4, 0x23, 0xe2, 0x9e,
+    0x3f, 0xc3, 0xbf, 0x6a, 0x8d, 0xab, 0x1b, 0xce, 0xf2, 0x34, 0x99, 0xa1, 0xc3, 0x55, 0xaa, 0x5c,
+    0xa6, 0xca, 0x86, 0x81, 0xca, 0xc5, 0x12, 0xb0, 0x10, 0x1f, 0x8d, 0x61, 0xe9, 0xe9, 0xbd, 0x78,
+    0x3e, 0x79, 0x12, 0x12, 0x3a, 0xa2, 0x2e, 0xe7, 0xa4, 0x3a, 0x92, 0x3a, 0x08, 0x4c, 0x31, 0x8e,
+    0x23, 0xae, 0xe1, 0x2a, 0xda, 0x07, 0x21, 0x77, 0xc3, 0x75, 0x00, 0x26, 0xbc, 0x75, 0x22, 0xd0,
+    0x91, 0x92, 0xf2, 0x04, 0x06, 0x28, 0x4a, 0x16, 0x8c, 0x92, 0x76, 0xc0, 0x1d, 0x94, 0x24, 0xa6,
+    0x76, 0x68, 0xcc, 0x6a, 0x2e, 0x09, 0xf2, 0x8e, 0xe8, 0x65, 0xe7, 0xdd, 0x79, 0x25, 0x5b, 0x22,
+    0x72, 0x4c, 0x66, 0xcd, 0x89, 0x3b, 0x0c, 0xbe, 0x33, 0x29, 0xb9, 0xc9, 0x85, 0x49, 0xee, 0xdc,
+    0xba, 0x39, 0x6b, 0x4a, 0x14, 0x99, 0x13, 0x44, 0xf9, 0x05, 0x68, 0x12, 0x10, 0x25, 0x10, 0xd2,
+    0xc3, 0x40, 0xb7, 0x64, 0x8f, 0xe0, 0xcf, 0x42, 0x1b, 0x31, 0xe9, 0x6c, 0x6d, 0xb1, 0x8f, 0x11,
+    0xc9, 0x1c, 0x41, 0x13, 0x14, 0xfc, 0xcf, 0x94, 0x01, 0xbe, 0x66, 0x0a, 0x9f, 0xc0, 0xbf, 0x7a,
+    0xcf, 0x65, 0x0c, 0xdc, 0x66, 0x39, 0x66, 0x8b, 0x99, 0xfb, 0x6b, 0xea, 0x41, 0x64, 0x98, 0x23,
+    0xaf, 0x3d, 0x02, 0xe2, 0x02, 0xf7, 0xec, 0x49, 0x2e, 0x8b, 0x7c, 0x3f, 0x72, 0xef, 0xb3, 0x02,
+    0x65, 0xf0, 0x7a, 0xf0, 0x74, 0x99, 0x99, 0xc6, 0x12, 0x3f, 0xa6, 0x71, 0xbc, 0x31, 0x66, 0xee,
+    0x28, 0x46, 0xf2, 0x00, 0x99, 0x8c, 0x92, 0x0d, 0x22, 0xc5, 0xe4, 0x8d, 0xe2, 0xd9, 0x05, 0x7b,
+    0x36, 0x8d, 0xa8, 0xfc, 0x9c, 0xc6, 0xf4, 0x73, 0xce, 0xba, 0x9c, 0x79, 0x03, 0x8d, 0xaa, 0xf4,
+    0xf0, 0x0e, 0x0e, 0x01, 0xd7, 0x7b, 0x20, 0x24, 0x03, 0x0e, 0xaa, 0x83, 0xb3, 0xd5, 0x75, 0x15,
+    0x01, 0x67, 0x27, 0xd1, 0x55, 0x44, 0x2a, 0xab, 0x4a, 0x07, 0x39, 0x94, 0x12, 0x3b, 0x82, 0x4c,
+    0xbc, 0xb0, 0x67, 0xc3, 0x00, 0xc7, 0x41, 0x9f, 0x11, 0x1f, 0x11, 0x18, 0xc4, 0x9e, 0x7e, 0xd8,
+    0xb7, 0x43, 0x62, 0x05, 0x5d, 0x22, 0x06, 0xa0, 0x43, 0x40, 0x67, 0xb9, 0xcc, 0x36, 0xfa, 0x1c,
+    0x14, 0x15, 0x19, 0xc5, 0x46, 0x64, 0x90, 0x18, 0x91, 0x39, 0xea, 0x42, 0xb9, 0x61, 0x27, 0xc2,
+    0xdd, 0xaf, 0x00, 0x09, 0xae, 0xbb, 0x18, 0x8e, 0xb0, 0x99, 0xe7, 0x4d, 0x7b, 0x47, 0xa8, 0x34,
+    0x5a, 0x6d, 0xa9, 0x35, 0xbe, 0x4f, 0x3d, 0x5b, 0x4c, 0xbe, 0x01, 0xf5, 0x67, 0x6a, 0x61, 0xda,
+    0xcb, 0x75, 0x36, 0x2e, 0xce, 0xc7, 0xce, 0xb8, 0x2c, 0x2e, 0xfa, 0x75, 0xca, 0x63, 0x99, 0xc2,
+    0x58, 0xf9, 0x2b, 0x53, 0x0f, 0xc1, 0xbe, 0xdf, 0xaf, 0x34, 0xe1, 0x37, 0x7d, 0xbc, 0x5f, 0x69,
+    0x6f, 0x6f, 0xa3, 0x6f, 0x28, 0xbb, 0xdb, 0xaf, 0x04, 0x0e, 0x46, 0x3a, 0x92, 0x97, 0xd3, 0xde,
+    0x61, 0x2e, 0x1a, 0x92, 0x87, 0x66, 0x00, 0xff, 0x00, 0x15, 0x4e, 0x9e, 0x6f, 0xbc, 0x3c, 0x1b,
+    0xcc, 0x5d, 0xb3, 0xa4, 0x4f, 0x9a, 0x0d, 0x9d, 0x28, 0x3a, 0xdd, 0x14, 0xb8, 0x20, 0x84, 0xf1,
+    0x4a, 0x62, 0x9c, 0xaa, 0x19, 0xa9, 0xde, 0xff, 0xe4, 0x7a, 0xad, 0x41, 0x9a, 0x64, 0x1f, 0xd6,
+    0x12, 0xc5, 0x07, 0xc2, 0x66, 0xeb, 0x04, 0x46, 0x0f, 0x8f, 0x1c, 0x36, 0x79, 0x02, 0x0b, 0x5c,
+    0x3f, 0x9a, 0xc5, 0xc6, 0x5c, 0xa5, 0x3b, 0x5f, 0xfd, 0xce, 0xea, 0xd9, 0x97, 0xbf, 0x79, 0xf6,
+    0xe7, 0x3f, 0xfc, 0x92, 0x1c, 0x52, 0x30, 0xad, 0x19, 0xb0, 0x2b, 0x89, 0xed, 0xed, 0x3a, 0x79,
+    0x08, 0xab, 0xc4, 0x88, 0xe3, 0xea, 0x00, 0x2c, 0x09, 0x6b, 0x8b, 0xed, 0x09, 0x5c, 0x7c, 0x73,
+    0xbc, 0xba, 0xdc, 0x45, 0xec, 0x72, 0x01, 0x8d, 0x34, 0x4d, 0xda, 0x8a, 0x28, 0x09, 0x64, 0x47,
+    0x98, 0x63, 0xa9, 0x0d, 0x61, 0x79, 0x67, 0xe6, 0xe4, 0x49, 0x00, 0xfe, 0x09, 0x70, 0x1b, 0x68,
+    0x9b, 0x00, 0x08, 0x06, 0xf8, 0x0c, 0x2c, 0x3e, 0xb0, 0x79, 0x9f, 0xd0, 0x2e, 0x2e, 0xbe, 0xe3,
+    0x11, 0xb7, 0xcf, 0x9f, 0x02, 0x57, 0x7b, 0x6c, 0x60, 0xf4, 0xcf, 0x9f, 0x29, 0xba, 0x4c, 0x71,
+    0x34, 0xf3, 0x29, 0xb7, 0xbc, 0x88, 0x0c, 0xd4, 0x30, 0xc0, 0xfc, 0xc9, 0x59, 0x87, 0x86, 0xc0,
+    0x63, 0xbe, 0x70, 0x73, 0x79, 0x28, 0x18, 0x02, 0xde, 0x61, 0x07, 0xb4, 0xcb, 0x5f, 0x7e, 0xfb,
+    0xf5, 0xef, 0x48, 0xab, 0x41, 0x0e, 0x85, 0x89, 0x94, 0x11, 0x23, 0x46, 0x82, 0x84, 0x44, 0xba,
+    0x0f, 0xd0, 0x61, 0x81, 0x5a, 0x1a, 0xa3, 0x96, 0xf9, 0xab, 0xd6, 0x34, 0x4a, 0x51, 0xf8, 0xad,
+    0x32, 0x37, 0x0a, 0x25, 0x05, 0xdf, 0x01, 0x18, 0x72, 0xa9, 0x38, 0x43, 0x4e, 0x96, 0x7f, 0x8d,
+    0xe8, 0xe4, 0x09, 0x71, 0xa4, 0xfe, 0xcc, 0x84, 0x82, 0x7c, 0x21, 0x2c, 0x9f, 0x83, 0x2d, 0x7c,
+    0x2d, 0xef, 0xb1, 0xcf, 0xd0, 0xf8, 0xbc, 0x01, 0xfa, 0x86, 0xe0, 0x90, 0xce, 0x9f, 0x39, 0x01,
+    0xc8, 0xdf, 0xf9, 0x33, 0x13, 0xc8, 0x0d, 0xae, 0x21, 0x1d, 0x99, 0x63, 0xd4, 0x98, 0x43, 0x98,
+    0x9a, 0x58, 0x3d, 0xa1, 0x52, 0x92, 0xa2, 0x13, 0xff, 0x2a, 0x88, 0x5b, 0x4c, 0x8f, 0xd4, 0xe7,
+    0x43, 0x56, 0x47, 0xe3, 0xd5, 0x59, 0x36, 0x7a, 0x66, 0x07, 0xc3, 0x2e, 0x73, 0x95, 0xea, 0x48,
+    0x8f, 0xf9, 0xef, 0x51, 0x3b, 0xa1, 0xc2, 0x63, 0x0e, 0xa8, 0x8a, 0x46, 0x2b, 0x51, 0x1a, 0x53,
+    0xaa, 0xe2, 0x53, 0x19, 0x2d, 0xa9, 0xae, 0xa5, 0x1b, 0xaf, 0xcd, 0x0f, 0xa3, 0x25, 0x01, 0xab,
+    0x0c, 0xc4, 0x40, 0x46, 0xa9, 0xf4, 0x48, 0xf0, 0x43, 0x5d, 0xbd, 0x99, 0x8e, 0x5c, 0xc1, 0x04,
+    0x9e, 0x31, 0xd7, 0x97, 0x71, 0xab, 0xe5, 0x41, 0xae, 0x16, 0x9d, 0x7a, 0x95, 0x28, 0xd5, 0x2b,
+    0x44, 0xab, 0x66, 0xa2, 0x56, 0x05, 0xb1, 0xc5, 0x62, 0x9b, 0xa0, 0x28, 0x98, 0x95, 0xe1, 0x69,
+    0xbd, 0x32, 0x64, 0xf9, 0x3c, 0xb7, 0xbf, 0x85, 0xb2, 0x72, 0x02, 0xf2, 0x7f, 0x87, 0x0f, 0x61,
+    0xf6, 0x3a, 0xf2, 0x17, 0xe9, 0x02, 0x27, 0x3f, 0x33, 0x5f, 0x3c, 0x1f, 0x49, 0x73, 0xdd, 0x54,
+    0xc6, 0x3c, 0x1b, 0xae, 0x20, 0x37, 0xd2, 0x2b, 0x91, 0x2b, 0x7f, 0x60, 0x4a, 0x93, 0x19, 0x7a,
+    0x7c, 0xf1, 0xbc, 0x2b, 0xc5, 0x30, 0xdb, 0x79, 0xe4, 0x2a, 0x94, 0x12, 0x9d, 0x22, 0x49, 0x48,
+    0x46, 0xa4, 0xc9, 0x94, 0x7a, 0x20, 0xe5, 0x00, 0xe4, 0xc1, 0x65, 0xff, 0x10, 0x70, 0x30, 0xe3,
+    0x66, 0xbb, 0x2e, 0x41, 0xc5, 0xd3, 0xad, 0xce, 0x51, 0xa2, 0x04, 0x32, 0x3a, 0x00, 0x96, 0x80,
+    0xad, 0x85, 0x46, 0x5f, 0x25, 0xab, 0xef, 0x77, 0xa5, 0x29, 0x5e, 0xb0, 0x3e, 0x6c, 0x6f, 0x6f,
+    0x5f, 0x99, 0x23, 0x24, 0xc7, 0xe8, 0xbf, 0xf9, 0x94, 0x74, 0x61, 0xad, 0x00, 0x9f, 0xe0, 0xd3,
+    0x1b, 0x87, 0x33, 0xee, 0x09, 0xa8, 0x7a, 0x60, 0x48, 0x66, 0x7e, 0x02, 0x72, 0x3f, 0xa2, 0xa1,
+    0x76, 0x50, 0x48, 0x35, 0x98, 0x7c, 0x8b, 0x2e, 0x23, 0x5d, 0x27, 0x3d, 0x33, 0x24, 0x6a, 0x20,
+    0x26, 0xf5, 0xc6, 0x68, 0x71, 0xc1, 0x92, 0xca, 0xfa, 0xb5, 0x79, 0x3c, 0xbc, 0x50, 0xab, 0xe5,
+    0x6d, 0x7a, 0x4c, 0x6f, 0xa8, 0x28, 0x07, 0x44, 0x06, 0x59, 0xa6, 0x17, 0xc1, 0xdd, 0xe2, 0x90,
+    0xf5, 0x0a, 0x7b, 0x0f, 0x0b, 0xf6, 0x1f, 0x02, 0x8f, 0x69, 0xea, 0xdc, 0x03, 0x45, 0xe5, 0x72,
+    0x33, 0x8e, 0x19, 0xe7, 0x7c, 0xb3, 0x00, 0x4a, 0xd9, 0xfd, 0x86, 0xb9, 0x7b, 0x0e, 0xd9, 0x5e,
+    0x73, 0xc2, 0xfc, 0x44, 0x5b, 0x9a, 0x0f, 0x61, 0x32, 0xfb, 0xd1, 0xcc, 0xf5, 0x04, 0xa1, 0x26,
+    0x48, 0x58, 0x20, 0xd9, 0x62, 0xfe, 0x1e, 0xce, 0xbc, 0xd9, 0x4c, 0x69, 0x8b, 0xde, 0x34, 0x11,
+    0x0e, 0x10, 0x80, 0xea, 0x9f, 0x54, 0x85, 0x63, 0xf4, 0xc1, 0x0d, 0xb2, 0x74, 0x64, 0xa4, 0xac,
+    0xbe, 0xf8, 0x04, 0xf8, 0x4f, 0x9b, 0xf9, 0x21, 0xf0, 0x1f, 0x6a, 0x88, 0x28, 0xd2, 0x32, 0x58,
+    0x27, 0xa3, 0x38, 0xce, 0x89, 0x16, 0x04, 0xfa, 0x0e, 0xcc, 0x56, 0xe3, 0x03, 0xe3, 0x6b, 0xc8,
+    0xa9, 0xe7, 0x6b, 0x34, 0xc6, 0x92, 0xff, 0x57, 0x56, 0x25, 0x12, 0x17, 0xb5, 0x7f, 0x90, 0xcf,
+    0x0b, 0x33, 0x8f, 0x1d, 0xea, 0xa3, 0x5b, 0xba, 0x5f, 0xf9, 0xbb, 0x6a, 0xb5, 0xbd, 0xfd, 0xa3,
+    0x66, 0x7d, 0xfb, 0x8b, 0x2f, 0xdb, 0xf0, 0x6b, 0xeb, 0x0b, 0xf8, 0x71, 0xf9, 0x8b, 0x2f, 0x7f,
+    0xd4, 0x6c, 0x7d, 0x71, 0x4d, 0xfe, 0x29, 0x7f, 0x5c, 0xab, 0xfd, 0xb8, 0x51, 0xfb, 0xc9, 0xe6,
+    0x4f, 0x97, 0x7b, 0xf7, 0xaf, 0x2a, 0x44, 0xee, 0x36, 0xef, 0x57, 0x8e, 0x1d, 0x17, 0xcc, 0x4b,
+    0x73, 0xf2, 0x47, 0x10, 0x50, 0x54, 0x3b, 0xe0, 0x2a, 0xa9, 0xe1, 0xdf, 0x3e, 0x3c, 0xdb, 0x22,
+    0x55, 0xdb, 0x69, 0x90, 0xd6, 0xe5, 0x76, 0xa3, 0xb5, 0xb3, 0xdb, 0x68, 0x35, 0x5a, 0xb8, 0xa4,
+    0x2e, 0x9c, 0xce, 0x53, 0xe1, 0xf9, 0xb0, 0x98, 0x7e, 0x0a, 0xbf, 0x48, 0x8b, 0x54, 0x3d, 0xb0,
+    0x93, 0x98, 0x0b, 0x84, 0xf5, 0x30, 0xe2, 0xbd, 0xca, 0x14, 0x1e, 0x68, 0x84, 0x88, 0xea, 0x8a,
+    0x82, 0x57, 0x9a, 0x32, 0x94, 0xa8, 0xc2, 0x72, 0xb7, 0x21, 0xff, 0xaf, 0x5d, 0xc0, 0x14, 0xa9,
+    0x01, 0xe8, 0x89, 0xd1, 0x1f, 0x22, 0xdd, 0xfe, 0x0e, 0xcd, 0x4b, 0x34, 0xe2, 0x55, 0x17, 0x69,
+    0x1c, 0x59, 0x5b, 0xcf, 0x53, 0x9b, 0x54, 0xc7, 0xd4, 0xa1, 0xde, 0x8a, 0x33, 0xf4, 0x48, 0xb7,
+    0x8d, 0x71, 0x9c, 0x9a, 0xa2, 0x0b, 0x9a, 0x94, 0x76, 0x7a, 0x52, 0xda, 0xef, 0xe4, 0xa4, 0xb4,
+    0x1a, 0xad, 0x48, 0x50, 0x96, 0x30, 0xd0, 0xe0, 0x91, 0xf2, 0x95, 0x56, 0x75, 0xa1, 0xa4, 0xa9,
+    0xb3, 0xd0, 0x81, 0xfa, 0xf5, 0x57, 0xa4, 0xdd, 0x48, 0x79, 0x9b, 0xb2, 0x55, 0x90, 0x0e, 0xb5,
+    0xbe, 0x46, 0xbf, 0x49, 0x41, 0xb9, 0x77, 0x72, 0xf2, 0x00, 0x5c, 0x11, 0xed, 0xf7, 0x44, 0x0e,
+    0xb7, 0x74, 0xe1, 0x34, 0x1a, 0xab, 0xfb, 0x50, 0x06, 0x38, 0x4f, 0x86, 0x74, 0x97, 0x75, 0x04,
+    0x27, 0x09, 0xaa, 0x4b, 0x87, 0x56, 0x85, 0x61, 0xd4, 0xa0, 0x6b, 0x6f, 0xc7, 0x91, 0xca, 0x10,
+    0xa1, 0xb4, 0x27, 0x95, 0x69, 0xbd, 0xb4, 0x2b, 0x95, 0x85, 0x59, 0xda, 0x97, 0x5a, 0x1e, 0xe8,
+    0x7b, 0x67, 0x6a, 0x96, 0xde, 0x91, 0xa6, 0x9a, 0xe2, 0xfe, 0xd5, 0x34, 0x75, 0x97, 0x7a, 0xec,
+    0xba, 0x10, 0x7e, 0x4a, 0x82, 0x5c, 0x31, 0x76, 0x03, 0xe3, 0x34, 0x48, 0x58, 0xbd, 0xe7, 0x52,
+    0x03, 0xcc, 0x6c, 0xe6, 0x72, 0x61, 0xd6, 0x56, 0x15, 0x26, 0x9b, 0x92, 0x00, 0xfb, 0x15, 0x43,
+    0x2e, 0x77, 0xfe, 0xa2, 0xde, 0x0b, 0x63, 0xa5, 0x72, 0xe3, 0x05, 0xdf, 0xc4, 0xf5, 0x1d, 0x0d,
+    0x28, 0x1e, 0x65, 0x52, 0xe9, 0x8d, 0x19, 0x34, 0xa8, 0x64, 0xe0, 0xf5, 0xed, 0x08, 0x5e, 0x9a,
+    0x74, 0xa5, 0xe5, 0x2e, 0xdd, 0x78, 0x69, 0xb1, 0xcb, 0x40, 0x2c, 0x2d, 0x75, 0x4b, 0x83, 0x7c,
+    0x2f, 0x74, 0x33, 0xd4, 0x8e, 0x64, 0x2e, 0x2b, 0x2e, 0xaf, 0xcf, 0x9b, 0xc4, 0xb0, 0x33, 0x99,
+    0x97, 0xf1, 0x76, 0xf1, 0xce, 0x64, 0x17, 0x86, 0x75, 0x10, 0xf8, 0xe2, 0x41, 0x60, 0x27, 0xc3,
+    0x4d, 0x3f, 0x7b, 0x27, 0x1d, 0xc8, 0x83, 0xf4, 0xbe, 0xac, 0xe7, 0xbb, 0xa2, 0x2f, 0x95, 0x8b,
+    0x01, 0x6a, 0x24, 0x48, 0x34, 0x59, 0x69, 0x8d, 0x75, 0x28, 0xe2, 0x0d, 0x68, 0x5c, 0xdc, 0x71,
+    0x03, 0x1a, 0xd4, 0x96, 0x3b, 0x16, 0x60, 0x97, 0xe1, 0xce, 0xab, 0x04, 0x80, 0x96, 0xe8, 0x31,
+    0xff, 0x98, 0xaf, 0x6b, 0x47, 0x8e, 0x27, 0x1a, 0xaa, 0x41, 0xd0, 0x39, 0xf4, 0xce, 0x9f, 0x12,
+    0x43, 0x00, 0x2d, 0xfb, 0x43, 0x40, 0xaa, 0x4f, 0x36, 0x71, 0x07, 0x9b, 0x53, 0xdc, 0xb6, 0x35,
+    0x32, 0x9a, 0x56, 0x76, 0xa9, 0x42, 0xcf, 0x14, 0x20, 0x80, 0xaa, 0x3c, 0xbc, 0xbc, 0xad, 0x07,
+    0x01, 0x40, 0x12, 0xc5, 0xf7, 0x91, 0x66, 0x10, 0x30, 0x0c, 0xab, 0x23, 0x19, 0xf8, 0x90, 0x71,
+    0x2a, 0x50, 0xd0, 0x36, 0x37, 0xa8, 0x71, 0x3a, 0x6b, 0x83, 0xbc, 0xba, 0x0f, 0x8d, 0x4c, 0x80,
+    0x0c, 0x70, 0x57, 0x42, 0x3e, 0x62, 0x46, 0xa5, 0x73, 0x37, 0x42, 0xc2, 0x01, 0xf7, 0xd9, 0x94,
+    0xc8, 0xc6, 0x63, 0xa9, 0x7a, 0xb5, 0xbd, 0xd5, 0x02, 0x61, 0xb3, 0x80, 0x52, 0x6c, 0x38, 0xf5,
+    0x45, 0x66, 0x57, 0x09, 0xf4, 0x44, 0x3a, 0x44, 0xb6, 0xfc, 0x88, 0xf4, 0x70, 0x8e, 0x62, 0xbe,
+    0xa9, 0x63, 0xc7, 0x1c, 0x13, 0x08, 0xc2, 0xa9, 0x29, 0xba, 0x80, 0x61, 0xe5, 0x8f, 0x29, 0x3d,
+    0xa0, 0x56, 0x34, 0xa2, 0xd6, 0xee, 0xaa, 0x43, 0xa2, 0x8f, 0x67, 0x87, 0x44, 0x07, 0x5e, 0xf8,
+    0x9a, 0xc6, 0xa4, 0xc0, 0xcd, 0xcc, 0xd3, 0xe3, 0x25, 0xc6, 0x54, 0xa8, 0x3b, 0xd3, 0x51, 0x40,
+    0xec, 0x12, 0xf3, 0x69, 0xe5, 0x0e, 0x5f, 0x7e, 0x3a, 0xcd, 0x6b, 0xf0, 0x7d, 0x3c, 0x7a, 0xc2,
+    0xfc, 0x70, 0xa1, 0xf3, 0xf3, 0xcd, 0xef, 0x70, 0xab, 0x6d, 0xb3, 0x41, 0xee, 0x19, 0xa7, 0x2e,
+    0x48, 0x82, 0x0e, 0x12, 0x23, 0xce, 0xc4, 0x12, 0xc2, 0x21, 0xd5, 0x23, 0xd9, 0x11, 0xc1, 0x11,
+    0xd4, 0x5e, 0xb3, 0x33, 0x84, 0x50, 0xef, 0x00, 0xd0, 0x63, 0x6e, 0x9b, 0x62, 0x04, 0xf4, 0x17,
+    0xb6, 0xe9, 0x55, 0x3a, 0xf7, 0x06, 0xb6, 0x20, 0x18, 0x4b, 0x1d, 0xe0, 0xc6, 0x74, 0x0a, 0xb5,
+    0x11, 0xee, 0xb3, 0x05, 0xb6, 0x89, 0x5a, 0x63, 0x05, 0x9b, 0xee, 0xfb, 0x6c, 0xf2, 0x8d, 0xc5,
+    0xa5, 0x8d, 0x36, 0x56, 0xfe, 0x0f, 0x58, 0x68, 0x1e, 0xb8, 0x4b, 0x04, 0x74, 0x01, 0xc5, 0x4d,
+    0x51, 0x02, 0xce, 0xd3, 0xd3, 0x5e, 0x00, 0x66, 0x5a, 0x4f, 0x28, 0x5d, 0xb6, 0x4e, 0xe8, 0xc0,
+    0x0f, 0x47, 0xf1, 0x9b, 0x48, 0x1d, 0x49, 0x1b, 0x52, 0x55, 0xd6, 0x20, 0x58, 0x7f, 0x5d, 0x4b,
+    0x0c, 0x70, 0x57, 0x12, 0x74, 0xa4, 0xaf, 0x76, 0xfb, 0x6b, 0x0d, 0x72, 0x53, 0x0c, 0x43, 0x00,
+    0x87, 0xec, 0xdc, 0x6a, 0x37, 0x9b, 0x1e, 0xd9, 0x27, 0xed, 0x26, 0xb2, 0x57, 0xe0, 0x5f, 0x48,
+    0x08, 0x3e, 0x9f, 0x76, 0x29, 0xae, 0xce, 0xf9, 0x52, 0x32, 0xf7, 0xce, 0x62, 0x8e, 0x2e, 0x9f,
+    0x23, 0xa5, 0xd2, 0xf2, 0xf1, 0x40, 0x40, 0x30, 0x79, 0x02, 0xce, 0x6b, 0x35, 0x63, 0xe9, 0xc3,
+    0x1a, 0x90, 0xb6, 0x42, 0xe0, 0xa3, 0x32, 0xcf, 0x3f, 0x92, 0x76, 0x32, 0x3e, 0xaa, 0x91, 0x17,
+    0xff, 0x8e, 0xb3, 0xa0, 0x93, 0x76, 0xc1, 0x3d, 0x77, 0xc7, 0xe1, 0x00, 0xba, 0x32, 0xa1, 0xaf,
+    0x9d, 0x26, 0xbc, 0xd9, 0xda, 0x4e, 0x7e, 0x6e, 0x36, 0xf5, 0xfb, 0xfb, 0xa4, 0x75, 0x79, 0x1b,
+    0x68, 0xfb, 0xf2, 0x9f, 0xff, 0x89, 0x6c, 0xb6, 0x71, 0x7c, 0xb3, 0xe9, 0x0a, 0xf3, 0xfd, 0x8a,
+    0xfc, 0xc4, 0xb6, 0xef, 0x9d, 0x9c, 0x9c, 0x6c, 0x1a, 0x66, 0x2a, 0xab, 0xad, 0x9d, 0x64, 0xb5,
+    0xa5, 0x13, 0xd7, 0xd2, 0x34, 0x28, 0xc8, 0x7c, 0xfb, 0x9e, 0x49, 0xe9, 0x76, 0xbb, 0x39, 0xd7,
+    0x2a, 0xea, 0x82, 0xf2, 0xa3, 0x7e, 0xe0, 0x25, 0xec, 0xa5, 0x92, 0x47, 0x14, 0x2f, 0xa7, 0x95,
+    0x0b, 0x8a, 0x39, 0x7e, 0x7f, 0x00, 0x62, 0x7f, 0xc6, 0xe4, 0x0e, 0xc3, 0xc2, 0xe5, 0xf2, 0x4d,
+    0xa8, 0x1f, 0xea, 0x2c, 0xde, 0xb8, 0xfe, 0x3d, 0xd9, 0xc2, 0x89, 0x15, 0x5d, 0x8b, 0xc9, 0x18,
+    0x32, 0x1a, 0x22, 0x60, 0x81, 0x68, 0x99, 0x79, 0xcd, 0xba, 0xc6, 0x16, 0x08, 0x0e, 0x79, 0x0d,
+    0x38, 0x33, 0x0a, 0x96, 0xc4, 0x19, 0x39, 0x78, 0xb6, 0x49, 0xe1, 0xf3, 0xaa, 0x3b, 0x72, 0x60,
+    0x86, 0xf5, 0xe9, 0x80, 0x0f, 0xa5, 0xfa, 0x00, 0xe1, 0x07, 0x3b, 0x6b, 0x10, 0xa8, 0xae, 0x95,
+    0xd2, 0x01, 0x4d, 0x81, 0xf1, 0x17, 0x29, 0x1f, 0x6f, 0xc7, 0x0b, 0xcc, 0x90, 0xa2, 0xb4, 0x1b,
+    0x98, 0x69, 0xbd, 0xb4, 0x1f, 0x98, 0x85, 0x59, 0xda, 0x11, 0x5c, 0x1e, 0xe8, 0x7b, 0x4f, 0x70,
+    0x96, 0xde, 0xd1, 0xb2, 0x30, 0x25, 0x03, 0x8b, 0x4d, 0x34, 0xea, 0xdc, 0x90, 0x89, 0x63, 0x71,
+    0x13, 0xfd, 0x07, 0xac, 0x94, 0x28, 0xb5, 0xc0, 0xde, 0x07, 0x87, 0xa4, 0x9a, 0x88, 0x11, 0x93,
+    0x69, 0xb0, 0xc9, 0xa9, 0xb2, 0xf3, 0x67, 0xb5, 0x0b, 0x13, 0x21, 0xb9, 0x0e, 0x63, 0xfa, 0x91,
+    0xc1, 0x01, 0xfc, 0xc1, 0xe1, 0x3a, 0x86, 0xd4, 0x5f, 0x3c, 0xef, 0x2a, 0x79, 0x02, 0xab, 0x5e,
+    0x8c, 0x24, 0x02, 0x3a, 0x99, 0x16, 0x16, 0x70, 0x44, 0x31, 0x20, 0x47, 0x0f, 0x0e, 0xde, 0x8e,
+    0x98, 0x4d, 0x11, 0xaf, 0xb4, 0xa0, 0x4d, 0xb5, 0x5f, 0x5a, 0xd4, 0xa6, 0xe1, 0x96, 0x16, 0xb6,
+    0x32, 0x80, 0xdf, 0x8b, 0x5b, 0x1e, 0xcd, 0x23, 0x81, 0x9b, 0x91, 0x9f, 0xd5, 0x22, 0x9e, 0xd4,
+    0x01, 0xf7, 0xe4, 0xc0, 0xc7, 0x93, 0x49, 0xbe, 0x87, 0xae, 0xac, 0x76, 0x8e, 0x28, 0xb1, 0x54,
+    0xfe, 0x87, 0x4a, 0xfa, 0x18, 0x85, 0x7d, 0x94, 0x0e, 0x0a, 0x4b, 0xeb, 0xc1, 0xe1, 0x6a, 0x72,
+    0xc7, 0xad, 0x60, 0x26, 0x99, 0x84, 0xe2, 0x1f, 0xa9, 0xc4, 0x0b, 0xbd, 0x72, 0xaf, 0xc7, 0x7b,
+    0xc2, 0x4a, 0xce, 0x40, 0x13, 0xa8, 0x2c, 0xf4, 0x68, 0x77, 0x21, 0xce, 0x38, 0x49, 0xdb, 0xc2,
+    0x5b, 0x17, 0x62, 0xfc, 0x66, 0x09, 0x12, 0x13, 0x3b, 0xf3, 0x70, 0x71, 0x1e, 0xca, 0x92, 0xb4,
+    0xbf, 0x0e, 0x76, 0xa1, 0x38, 0x39, 0xb9, 0x0b, 0x94, 0xd7, 0x7f, 0x62, 0x00, 0xd8, 0x11, 0x78,
+    0x5c, 0xd6, 0xd0, 0x1a, 0x10, 0x3d, 0x16, 0x21, 0x3d, 0x2a, 0x9b, 0xad, 0x1c, 0x6e, 0x4e, 0x9b,
+    0x23, 0x00, 0x41, 0xcf, 0x03, 0xeb, 0xab, 0x69, 0x00, 0xe2, 0x65, 0x26, 0x58, 0x5b, 0x2a, 0x03,
+    0x61, 0xb1, 0xbe, 0x7d, 0xfe, 0x54, 0xbd, 0x74, 0xfe, 0x34, 0x43, 0xed, 0x9d, 0x55, 0x3c, 0x8e,
+    0x0b, 0x54, 0x80, 0x31, 0xe9, 0x56, 0x50, 0x7e, 0x71, 0xdb, 0x12, 0x8a, 0x2f, 0x81, 0xb7, 0x82,
+    0xd2, 0x5b, 0x0e, 0xe0, 0x7b, 0x85, 0x37, 0x4d, 0xeb, 0x44, 0xfe, 0x52, 0x92, 0xb2, 0x9a, 0xb0,
+    0x99, 0xa7, 0x86, 0xa3, 0x75, 0x25, 0x76, 0x12, 0x59, 0x1b, 0x3a, 0xd9, 0xaa, 0xac, 0x50, 0xdd,
+    0x9d, 0x0a, 0x22, 0x4d, 0x99, 0xfb, 0x20, 0x3f, 0xa1, 0xcc, 0xf6, 0x95, 0x31, 0x27, 0x9d, 0xc6,
+    0x73, 0xfb, 0x50, 0xef, 0xd4, 0xc8, 0x04, 0x97, 0xb4, 0x2c, 0x6d, 0xbf, 0x4d, 0x51, 0xca, 0x10,
+    0xa6, 0xb4, 0x30, 0x65, 0x5a, 0x2f, 0x2d, 0x4e, 0x59, 0x98, 0xa5, 0x05, 0x6a, 0x79, 0xa0, 0xef,
+    0x45, 0x6a, 0x96, 0xde, 0xf1, 0xe1, 0xfc, 0xac, 0x44, 0xbc, 0x11, 0x5f, 0xde, 0x71, 0xc5, 0x99,
+    0xda, 0x0c, 0x59, 0xe0, 0xd1, 0xff, 0xcb, 0xbf, 0x92, 0xed, 0x86, 0x3a, 0x8c, 0xc3, 0x88, 0x89,
+    0x07, 0xba, 0x46, 0x46, 0x98, 0x84, 0xfe, 0x5f, 0x77, 0x0a, 0xba, 0x46, 0xf3, 0x63, 0x18, 0x54,
+    0xe0, 0xb2, 0x4c, 0x86, 0x6d, 0x14, 0x48, 0x22, 0xa6, 0x45, 0xa3, 0x23, 0x69, 0x11, 0x82, 0xab,
+    0x5b, 0x46, 0xb2, 0x57, 0x34, 0x87, 0xba, 0xa0, 0x20, 0xbc, 0x60, 0x60, 0xa0, 0xc6, 0x08, 0xc6,
+    0xd2, 0xe4, 0x91, 0x40, 0xce, 0x9f, 0xe1, 0xc2, 0x8d, 0x7b, 0x3a, 0x76, 0x9a, 0x22, 0xd5, 0xc8,
+    0x52, 0x72, 0x54, 0xf0, 0x23, 0x80, 0x05, 0x5c, 0x19, 0x47, 0x6c, 0x58, 0xbb, 0x10, 0x83, 0x28,
+    0x97, 0x16, 0x51, 0x0a, 0x73, 0xee, 0x77, 0xaf, 0x62, 0x1e, 0x7d, 0x37, 0x77, 0x0b, 0x95, 0xf7,
+    0xab, 0xd7, 0xa8, 0xac, 0x4b, 0x1c, 0x3d, 0x7c, 0x27, 0xf7, 0x0b, 0x8f, 0x43, 0xcc, 0xdb, 0x99,
+    0x7c, 0x4b, 0xfb, 0x6a, 0x19, 0xc3, 0x75, 0x0b, 0xd8, 0x6c, 0x04, 0xf4, 0x1c, 0xe3, 0xc9, 0x52,
+    0x03, 0x2c, 0x44, 0x19, 0x9b, 0x8e, 0x8e, 0x5e, 0xde, 0x7a, 0x0c, 0xde, 0x30, 0x10, 0x9e, 0x53,
+    0x8b, 0xe8, 0x91, 0xd5, 0xde, 0x91, 0x30, 0xa1, 0x35, 0x53, 0xb7, 0x61, 0x5a, 0xab, 0xbc, 0xfc,
+    0xe5, 0x7f, 0xe3, 0x0e, 0xc5, 0x0e, 0xac, 0xbd, 0x6a, 0x07, 0x80, 0x12, 0xe1, 0xbc, 0x78, 0x3e,
+    0xf9, 0x23, 0x48, 0xd4, 0xe4, 0x2b, 0x52, 0xbd, 0x43, 0x7b, 0xf1, 0xf9, 0xa0, 0xd7, 0xbd, 0x3f,
+    0x31, 0xa4, 0x8f, 0x0f, 0xb9, 0xdd, 0xbb, 0xeb, 0xcd, 0xda, 0x12, 0x32, 0xc1, 0xbe, 0x8a, 0x36,
+    0x77, 0x8f, 0xc0, 0xa0, 0x82, 0x95, 0xe2, 0x1c, 0xb2, 0x75, 0xbc, 0xd1, 0x31, 0x0a, 0x3d, 0x31,
+    0xe0, 0x18, 0xb8, 0x88, 0x07, 0x2c, 0x73, 0x4a, 0xf4, 0xb6, 0x45, 0x9c, 0xd2, 0x3f, 0x70, 0x05,
+    0x9e, 0xe0, 0xf2, 0x61, 0xc6, 0x61, 0xc2, 0x7d, 0x95, 0xcf, 0x35, 0xc2, 0x53, 0x4b, 0xf0, 0x0d,
+    0x9e, 0xa8, 0x5d, 0x27, 0xd1, 0xd6, 0x04, 0x2a, 0xa0, 0x3e, 0x4b, 0x02, 0x8f, 0x76, 0xf8, 0x76,
+    0xcc, 0x97, 0x98, 0x90, 0xa5, 0x4d, 0x97, 0xb8, 0xe5, 0xd2, 0x66, 0x4b, 0x02, 0xab, 0xb4, 0xc9,
+    0xb2, 0x1c, 0xb0, 0xf7, 0xe6, 0x4a, 0x96, 0xce, 0x91, 0x2a, 0x4d, 0x49, 0xcb, 0x6a, 0xd6, 0x3f,
+    0xc8, 0xd1, 0x7d, 0xe6, 0x83, 0x2d, 0xe1, 0xc5, 0x07, 0x5b, 0x3c, 0x87, 0x0f, 0xd8, 0x9a, 0x5c,
+    0xc8, 0xd1, 0xe5, 0xf6, 0x81, 0xcd, 0x5d, 0x53, 0x45, 0x21, 0x50, 0xea, 0x56, 0x10, 0xba, 0xdb,
+    0x16, 0xd3, 0x3e, 0xb3, 0x0c, 0x70, 0x00, 0xc2, 0xd8, 0xfb, 0x30, 0xf0, 0x78, 0x4a, 0xb8, 0x30,
+    0xa0, 0x88, 0xc2, 0xb9, 0x2e, 0xcf, 0xf9, 0xe9, 0x15, 0x7e, 0xf2, 0x2d, 0xc3, 0x33, 0xf8, 0xf0,
+    0x12, 0xbc, 0x31, 0xe2, 0xa0, 0xb1, 0x11, 0x07, 0x52, 0x55, 0xe7, 0x39, 0xfa, 0xcc, 0x0c, 0x6d,
+    0x43, 0x1e, 0x5a, 0x03, 0x94, 0xb3, 0x1b, 0x80, 0x9b, 0x17, 0xb2, 0xc6, 0xa7, 0xc8, 0x13, 0x1d,
+    0x5b, 0x4d, 0x3d, 0x99, 0x5d, 0xcf, 0xff, 0x3f, 0xad, 0xdd, 0x30, 0xd2, 0x87, 0x1e, 0x3b, 0xbc,
+    0xbc, 0x9d, 0x1a, 0xba, 0x7e, 0xf0, 0x4e, 0xae, 0xd9, 0xb8, 0x4a, 0x8d, 0x7a, 0x32, 0xcb, 0x64,
+    0x1c, 0x55, 0x3a, 0x00, 0x76, 0x6b, 0x49, 0x27, 0x32, 0xb1, 0x07, 0x13, 0x46, 0x8c, 0x19, 0xbd,
+    0xb6, 0xc2, 0x21, 0x30, 0x00, 0x26, 0xd3, 0x71, 0x62, 0x01, 0x91, 0x7b, 0xd1, 0x78, 0xd6, 0xe8,
+    0x32, 0xd8, 0xe7, 0x0e, 0x73, 0xf1, 0xc0, 0x74, 0x68, 0xa9, 0x63, 0x1d, 0x88, 0xd0, 0x00, 0xdc,
+    0xdf, 0x96, 0x76, 0x68, 0x35, 0xdb, 0x53, 0x58, 0xd6, 0x14, 0xd3, 0x37, 0xc8, 0x71, 0x88, 0x45,
+    0x2b, 0x32, 0x79, 0x40, 0xad, 0xa6, 0x0a, 0x30, 0xb1, 0x01, 0xa9, 0x27, 0xdc, 0xce, 0x88, 0x37,
+    0x80, 0x35, 0x4b, 0x66, 0x0d, 0xf1, 0x9e, 0x2d, 0x5c, 0x79, 0x38, 0xf7, 0x75, 0x24, 0xf4, 0x04,
+    0xae, 0x17, 0x55, 0xfb, 0xd0, 0xaa, 0x21, 0x12, 0x5d, 0x4c, 0x0a, 0x90, 0x66, 0x8f, 0x4a, 0x54,
+    0x42, 0xeb, 0x9b, 0xfa, 0x2b, 0xe5, 0xed, 0x7f, 0x86, 0xe9, 0x53, 0x2c, 0xca, 0xd4, 0x97, 0x51,
+    0x01, 0x58, 0x93, 0xc3, 0xc9, 0x13, 0x2a, 0x41, 0xa0, 0x71, 0xaf, 0x61, 0x72, 0x19, 0x78, 0x0d,
+    0xd1, 0x9e, 0x47, 0xd2, 0x92, 0x00, 0x60, 0x82, 0xc4, 0xc0, 0x44, 0x36, 0x48, 0x0b, 0xcf, 0x4b,
+    0x27, 0xea, 0x40, 0x19, 0x0a, 0xe8, 0x30, 0x28, 0xfc, 0x82, 0x08, 0x41, 0x20, 0x73, 0xb4, 0x89,
+    0xa2, 0x06, 0x60, 0x15, 0x4f, 0x63, 0x52, 0xf7, 0x03, 0xbb, 0xe3, 0xba, 0x41, 0xac, 0xaf, 0x74,
+    0xf4, 0xaf, 0x77, 0x31, 0x89, 0x05, 0x09, 0xa9, 0xa3, 0x6c, 0x82, 0xd4, 0x93, 0x48, 0xcd, 0xa8,
+    0xa3, 0xf1, 0x25, 0x13, 0x7e, 0xb0, 0x9f, 0x4f, 0xa8, 0x83, 0x2b, 0xc4, 0x3d, 0x75, 0xd6, 0x37,
+    0x3e, 0xea, 0x8b, 0xe3, 0x02, 0xa1, 0x88, 0xe6, 0x72, 0xb8, 0x7a, 0x9a, 0x4f, 0x02, 0x24, 0x8d,
+    0xbe, 0x7e, 0x92, 0xc9, 0xc1, 0xda, 0x6e, 0x96, 0xcc, 0x58, 0xb2, 0x84, 0xe7, 0xa1, 0x17, 0x75,
+    0x08, 0x36, 0x04, 0xa6, 0x2b, 0x81, 0x69, 0x4b, 0x1c, 0x0a, 0xd3, 0x22, 0x5d, 0x4d, 0x5c, 0x26,
+    0xf0, 0x94, 0x1f, 0x01, 0x41, 0xc2, 0x13, 0x9e, 0x4f, 0x4d, 0x52, 0xfd, 0xeb, 0x55, 0xf8, 0xf0,
+    0x88, 0x61, 0x71, 0x8b, 0x31, 0x53, 0x9c, 0x02, 0x93, 0x0b, 0x73, 0x3b, 0xc2, 0x10, 0x2f, 0x96,
+    0x6d, 0x18, 0x01, 0xc1, 0x06, 0x1e, 0x4e, 0xb9, 0x30, 0x65, 0x3d, 0xaa, 0x40, 0xf3, 0xa2, 0x74,
+    0x01, 0xfa, 0x74, 0x20, 0x22, 0xe0, 0x99, 0x98, 0x7d, 0xd5, 0xa7, 0x03, 0xfc, 0x56, 0x6e, 0xa6,
+    0x29, 0x45, 0x70, 0x31, 0x9e, 0x67, 0x9a, 0x26, 0x91, 0x6e, 0x4e, 0x3f, 0xca, 0x30, 0x4c, 0x6b,
+    0x05, 0x82, 0x1f, 0x53, 0xd7, 0xce, 0x27, 0x78, 0x1d, 0x35, 0x2b, 0x9e, 0x60, 0xfb, 0x56, 0xca,
+    0xea, 0x6a, 0xc4, 0xbe, 0x67, 0xaa, 0x6c, 0x1f, 0x45, 0x4a, 0x4f, 0xc1, 0x90, 0x62, 0x18, 0x97,
+    0xfa, 0xa1, 0xa0, 0x63, 0x2c, 0xfc, 0x16, 0x6c, 0x74, 0x6e, 0x82, 0xbc, 0xc9, 0x27, 0x9e, 0xcc,
+    0xd8, 0x40, 0x6b, 0x9b, 0x82, 0x49, 0xa1, 0x8c, 0x80, 0x91, 0x30, 0x31, 0x53, 0x48, 0x25, 0x17,
+    0xcd, 0x54, 0x53, 0xb8, 0x30, 0x7a, 0x47, 0x24, 0x49, 0xd1, 0x3b, 0x7e, 0x94, 0xe1, 0xf0, 0xd6,
+    0xfc, 0xf4, 0xb5, 0xd7, 0x92, 0x87, 0x06, 0x0b, 0xb7, 0x19, 0x58, 0x6c, 0x71, 0x3a, 0xc8, 0x53,
+    0x72, 0xa9, 0x41, 0x1e, 0x51, 0xc7, 0xa2, 0xb6, 0x5c, 0x36, 0xa2, 0x9a, 0x46, 0x9c, 0xc8, 0x4a,
+    0x7b, 0x6a, 0x0f, 0x09, 0x79, 0xdb, 0xe6, 0x03, 0x59, 0xc8, 0xef, 0xb5, 0xfa, 0x7a, 0x11, 0xde,
+    0xa6, 0x2c, 0x29, 0xe3, 0xdd, 0xb2, 0x69, 0x17, 0x3e, 0xc4, 0x95, 0xf5, 0x90, 0x1b, 0xa6, 0x10,
+    0x5d, 0x81, 0xd9, 0xee, 0xab, 0xac, 0xb3, 0xc8, 0x3f, 0x13, 0xf2, 0x2c, 0x00, 0x18, 0x89, 0x72,
+    0xe9, 0x90, 0x8e, 0x25, 0x46, 0x97, 0xaa, 0x9f, 0x7e, 0xba, 0x77, 0xf7, 0x6e, 0x0d, 0x79, 0x6a,
+    0x0c, 0xbc, 0x85, 0x45, 0x59, 0x19, 0x4a, 0x3b, 0x70, 0x9c, 0x1d, 0x10, 0x85, 0x0f, 0xd6, 0xcd,
+    0x05, 0x96, 0x55, 0x9b, 0xe2, 0x72, 0xcf, 0x1d, 0x8f, 0x03, 0x62, 0x21, 0xd7, 0x95, 0xb9, 0x2c,
+    0x6b, 0x71, 0x15, 0xd0, 0x43, 0xb3, 0x5c, 0x11, 0xb5, 0x4a, 0x1b, 0xfe, 0x39, 0x15, 0x63, 0x94,
+    0x05, 0x85, 0x3b, 0x62, 0x61, 0x8a, 0xea, 0x48, 0xa0, 0x38, 0xaa, 0x57, 0xc5, 0x4a, 0xb4, 0xd4,
+    0x27, 0x92, 0x50, 0xeb, 0xc4, 0x01, 0xa3, 0x95, 0x65, 0x65, 0x6d, 0xd1, 0xf2, 0x91, 0x57, 0xb4,
+    0x69, 0x99, 0x22, 0x90, 0xdb, 0xaa, 0xde, 0x63, 0xba, 0xb6, 0xd3, 0x3c, 0x23, 0xb8, 0xd0, 0xad,
+    0xca, 0x3d, 0x1b, 0x86, 0xc3, 0xc3, 0x60, 0x6f, 0x33, 0xaa, 0xdc, 0xd6, 0xda, 0x5b, 0x68, 0x8a,
+    0xce, 0x39, 0x24, 0x98, 0xea, 0x2f, 0x3a, 0x7f, 0x93, 0x7a, 0x02, 0xe3, 0x33, 0xd8, 0xa9, 0xb0,
+    0xc0, 0x22, 0xde, 0xaf, 0x48, 0x42, 0x4a, 0xa5, 0x61, 0x31, 0xbb, 0xe7, 0x9f, 0xc2, 0xe2, 0x98,
+    0x3a, 0x74, 0xfb, 0x63, 0xf3, 0x27, 0xed, 0x9f, 0xee, 0xc9, 0x9f, 0xf3, 0x06, 0xbb, 0x31, 0x77,
+    0xb4, 0x2b, 0xd2, 0xa2, 0x15, 0xd1, 0xa2, 0x7d, 0x31, 0xb4, 0x68, 0xcd, 0xd0, 0xa2, 0xf5, 0x9d,
+    0xa1, 0x45, 0x3b, 0xa2, 0xc5, 0xe6, 0xc5, 0xd0, 0xa2, 0x3d, 0x43, 0x8b, 0xf6, 0x77, 0x86, 0x16,
+    0x9b, 0x11, 0x2d, 0xb6, 0x2e, 0x86, 0x16, 0x9b, 0x33, 0xb4, 0xd8, 0xfc, 0xce, 0xd0, 0x62, 0x2b,
+    0xa2, 0xc5, 0xf6, 0xc5, 0xd0, 0x62, 0x6b, 0x86, 0x16, 0x5b, 0x6f, 0x96, 0x16, 0x73, 0xbe, 0x5a,
+    0x9c, 0xb0, 0x01, 0xc6, 0x43, 0x52, 0x1c, 0x92, 0xb9, 0xde, 0xa7, 0x02, 0x1c, 0x80, 0xdc, 0xda,
+    0x64, 0xdb, 0xf1, 0x79, 0x9c, 0x19, 0x6b, 0x03, 0xf7, 0x71, 0xfe, 0x96, 0xf4, 0xb0, 0x1c, 0x94,
+    0x2d, 0xd7, 0xe4, 0xe6, 0x7e, 0xb2, 0xba, 0x84, 0xaf, 0x90, 0x7d, 0x1e, 0xb8, 0x60, 0xbb, 0x6b,
+    0xef, 0x92, 0x0e, 0x82, 0x61, 0x60, 0xa1, 0xc5, 0x28, 0x63, 0xca, 0x3a, 0x7e, 0xaf, 0xf6, 0x9f,
+    0x63, 0xcb, 0x00, 0xed, 0x7e, 0xf4, 0x78, 0xc1, 0xba, 0x57, 0xe8, 0xac, 0xa7, 0xdc, 0x41, 0x8d,
+    0x30, 0x8f, 0xda, 0xca, 0x88, 0x2f, 0x36, 0x49, 0x42, 0xbe, 0x78, 0x9c, 0xa2, 0x82, 0xe5, 0x1e,
+    0x7c, 0xac, 0x50, 0xe9, 0xfa, 0xb4, 0xf2, 0x7a, 0x0c, 0xd3, 0x22, 0xba, 0xeb, 0xe4, 0x80, 0x82,
+    0x6f, 0x23, 0x73, 0x75, 0x55, 0x23, 0x35, 0xe7, 0xad, 0x0f, 0x8a, 0x6c, 0x56, 0x6d, 0xa3, 0x92,
+    0x42, 0xdb, 0x35, 0xaa, 0x7f, 0x31, 0x5d, 0xa3, 0x2c, 0xb6, 0x5b, 0x4f, 0xdb, 0x59, 0x36, 0xda,
+    0xc3, 0xb4, 0xee, 0xe8, 0x50, 0xc5, 0x67, 0x60, 0x6b, 0xba, 0xc2, 0xca, 0x54, 0xd2, 0xaf, 0xde,
+    0x55, 0x15, 0xb9, 0x84, 0xcc, 0x8e, 0xac, 0xc9, 0xb2, 0x65, 0x05, 0x46, 0x6c, 0x59, 0x03, 0xb6,
+    0x28, 0x75, 0xbd, 0x45, 0x37, 0x69, 0x8b, 0xc6, 0x99, 0xfa, 0x74, 0xf7, 0x64, 0x9b, 0xee, 0x2e,
+    0x9f, 0xc9, 0x9e, 0x2e, 0xb4, 0x9f, 0x93, 0xcc, 0xbe, 0x45, 0x4d, 0xb6, 0x5b, 0x98, 0xcc, 0x8e,
+    0xfb, 0x37, 0xbf, 0xf9, 0x4f, 0x24, 0xc6, 0xbd, 0xa3, 0x07, 0xf7, 0x1f, 0xdd, 0x9a, 0xfc, 0xe9,
+    0xd6, 0xe7, 0xb7, 0x6f, 0x01, 0x03, 0xde, 0x04, 0x4b, 0x16, 0x4d, 0x55, 0x79, 0xd3, 0x40, 0xb4,
+    0x7d, 0x23, 0x73, 0xdc, 0xaf, 0x76, 0xdd, 0xfc, 0xbe, 0x5e, 0xfe, 0xec, 0xbf, 0xc8, 0x71, 0x98,
+    0xaa, 0x6b, 0x1d, 0x57, 0x27, 0x01, 0x28, 0xc7, 0x3f, 0x9c, 0xfc, 0xfc, 0xfc, 0xab, 0x1b, 0x8f,
+    0x0e, 0x64, 0x9a, 0xfc, 0x30, 0x4d, 0xe4, 0x48, 0x14, 0x92, 0x6d, 0xe8, 0x79, 0x10, 0xa0, 0xaf,
+    0xeb, 0xf7, 0x0f, 0x3e, 0x23, 0xa9, 0x62, 0xa9, 0x69, 0x4b, 0x53, 0x76, 0x2f, 0x37, 0xdc, 0x54,
+    0x12, 0xea, 0x72, 0x9d, 0xde, 0x57, 0xe6, 0x7d, 0x17, 0x43, 0x1b, 0x51, 0xad, 0x56, 0x69, 0xc3,
+    0x22, 0xb8, 0x07, 0x3f, 0xbc, 0xf3, 0xd9, 0x3d, 0xd9, 0xaf, 0xaa, 0xc8, 0xca, 0xd9, 0xdc, 0xbe,
+    0x72, 0x1c, 0xa4, 0xa1, 0xe8, 0x81, 0x84, 0x77, 0x31, 0x4a, 0x9d, 0x04, 0xdd, 0x0a, 0x3b, 0x01,
+    0x90, 0x0f, 0x65, 0xfd, 0xa1, 0x3e, 0x91, 0xa0, 0xe5, 0x96, 0x38, 0x9e, 0xbb, 0x40, 0x2d, 0x87,
+    0x11, 0x05, 0x0c, 0x30, 0x65, 0x29, 0x28, 0xdd, 0x5f, 0xd1, 0xf5, 0xb0, 0x5c, 0x00, 0x97, 0x90,
+    0x51, 0x09, 0x8e, 0x59, 0xff, 0x43, 0xc4, 0xbb, 0x64, 0xb9, 0x7e, 0xa9, 0x94, 0xa3, 0xb9, 0x9b,
+    0x71, 0xab, 0xe2, 0x52, 0x7f, 0xd5, 0xcc, 0xb1, 0x48, 0x35, 0xd2, 0x57, 0x50, 0xb3, 0x99, 0x22,
+    0x86, 0x69, 0x9d, 0x8b, 0xff, 0xa2, 0x89, 0x49, 0x46, 0x2d, 0x33, 0x88, 0x53, 0xe1, 0x12, 0x9e,
+    0x79, 0x6f, 0x26, 0x6f, 0x9f, 0xa6, 0xf9, 0x85, 0xb3, 0x06, 0xb9, 0x8e, 0x51, 0x95, 0xe4, 0xcc,
+    0x23, 0x36, 0xf6, 0xe2, 0x70, 0xc0, 0xe4, 0x5b, 0x6a, 0x4a, 0xae, 0x82, 0xce, 0xe8, 0xe4, 0x09,
+    0x9d, 0x7c, 0xb5, 0xac, 0xc2, 0x9d, 0xe3, 0x9f, 0x4d, 0x53, 0x54, 0xeb, 0xd9, 0x19, 0x42, 0x2f,
+    0xa8, 0xbc, 0x9f, 0xd6, 0xa3, 0xab, 0x2b, 0xce, 0xa1, 0x98, 0xa9, 0xd6, 0xb4, 0x40, 0x69, 0xea,
+    0x9a, 0x8f, 0xb2, 0x3a, 0xaa, 0x83, 0x65, 0x49, 0xdf, 0x84, 0x6a, 0xdc, 0xa4, 0xed, 0x93, 0xe6,
+    0x49, 0xac, 0x1a, 0x4f, 0x76, 0xd9, 0x25, 0xda, 0xba, 0x30, 0xd5, 0x68, 0x6c, 0x5f, 0x3e, 0x69,
+    0x77, 0x17, 0xab, 0xc6, 0xe3, 0x83, 0xc9, 0x9f, 0x3e, 0x47, 0xa5, 0xa8, 0x07, 0x3f, 0x66, 0x2e,
+    0x46, 0x99, 0xc2, 0xf9, 0xea, 0xf0, 0x66, 0x5c, 0x73, 0x7c, 0x56, 0xff, 0x9d, 0x04, 0xb6, 0x2c,
+    0x3f, 0x99, 0xa8, 0xc8, 0x98, 0x15, 0x3f, 0x94, 0xc7, 0xdd, 0x26, 0xdf, 0x38, 0x5c, 0xf3, 0xb4,
+    0xe6, 0x79, 0xe4, 0xcb, 0x6c, 0x45, 0xc5, 0x25, 0x14, 0x1a, 0x56, 0xb7, 0x05, 0x75, 0xae, 0x8c,
+    0x0c, 0x9e, 0xd9, 0x57, 0x56, 0x8a, 0x52, 0x98, 0xd2, 0x90, 0xf1, 0xec, 0x00, 0xc1, 0xce, 0xed,
+    0xf2, 0x28, 0x8a, 0x20, 0xe4, 0x68, 0x35, 0x8c, 0x94, 0xdb, 0xfc, 0xfc, 0x99, 0x8f, 0xaa, 0x48,
+    0x6d, 0x7e, 0x83, 0x0a, 0x86, 0x69, 0x42, 0xcb, 0xc6, 0xa6, 0x24, 0x02, 0x32, 0x7f, 0xed, 0x60,
+    0xdd, 0x87, 0xb7, 0x63, 0x11, 0x06, 0x74, 0x31, 0x1d, 0xe7, 0xfc, 0x99, 0x63, 0xb3, 0x34, 0x9e,
+    0x8b, 0xd4, 0x66, 0x1f, 0x84, 0xcf, 0x1a, 0x88, 0x04, 0x0f, 0x2e, 0xdc, 0xd0, 0x97, 0x05, 0xf5,
+    0x94, 0x96, 0xf4, 0xc6, 0xc6, 0x18, 0x60, 0xe8, 0xea, 0xb6, 0x58, 0x4b, 0xba, 0xc7, 0xf9, 0x7a,
+    0x9a, 0xd4, 0xb8, 0x01, 0xd0, 0xde, 0xda, 0xb8, 0x54, 0x4e, 0x79, 0x16, 0x16, 0xc2, 0xc5, 0xc0,
+    0x83, 0xac, 0x5b, 0x9a, 0x5b, 0x12, 0x37, 0xa9, 0x33, 0x3d, 0xb7, 0xcc, 0xb4, 0xd2, 0x37, 0x53,
+    0x35, 0x72, 0x41, 0xaa, 0x62, 0x35, 0x22, 0xa2, 0x3b, 0x61, 0xf4, 0x5e, 0x33, 0x0a, 0x1b, 0xb7,
+    0x03, 0x11, 0x78, 0x95, 0x8d, 0x0e, 0x39, 0x04, 0x89, 0xa5, 0xea, 0xb0, 0x24, 0xee, 0x8e, 0x54,
+    0x63, 0x2d, 0x8e, 0xe3, 0xac, 0xcd, 0xb7, 0x1f, 0x4b, 0x83, 0x96, 0xbc, 0x3c, 0xe4, 0xbe, 0x14,
+    0xf6, 0x18, 0x78, 0x2c, 0x37, 0x00, 0x3e, 0x25, 0x1b, 0x75, 0x72, 0xfd, 0xd6, 0xa3, 0x58, 0x0e,
+    0x3e, 0xac, 0x95, 0xbe, 0x63, 0x06, 0xe9, 0x2e, 0xb3, 0xf1, 0x02, 0x3f, 0xfc, 0x18, 0xcf, 0xdc,
+    0x15, 0x97, 0x35, 0xce, 0x55, 0x1c, 0x4b, 0xd7, 0xbc, 0x27, 0x05, 0x85, 0xf4, 0x85, 0x43, 0x0d,
+    0xee, 0x87, 0x7b, 0xa0, 0x98, 0xc0, 0x8e, 0xb4, 0x3d, 0x2e, 0x6f, 0x2d, 0xd2, 0x4f, 0x49, 0xb3,
+    0xb1, 0xe9, 0x01, 0x60, 0x21, 0x89, 0x52, 0x67, 0x67, 0x40, 0x13, 0x6f, 0x0f, 0x17, 0xa3, 0x2b,
+    0x4b, 0xc4, 0x38, 0xc1, 0x32, 0x1a, 0x30, 0x75, 0x26, 0x14, 0xf7, 0x60, 0x64, 0xd2, 0x79, 0xfa,
+    0x58, 0x8d, 0xca, 0x28, 0xf7, 0x6c, 0x36, 0xdc, 0x7b, 0x53, 0x29, 0xe2, 0x69, 0x8c, 0xca, 0x27,
+    0x89, 0xa7, 0x5b, 0x2f, 0x9f, 0x26, 0x9e, 0x81, 0x59, 0x3e, 0x51, 0x7c, 0x69, 0xa0, 0xef, 0x13,
+    0x45, 0x66, 0xe9, 0x1d, 0xfb, 0x83, 0x59, 0x56, 0x5c, 0xbc, 0x15, 0x24, 0xc5, 0x3b, 0xe9, 0x65,
+    0x6e, 0xdc, 0x98, 0x04, 0xb8, 0xe0, 0x49, 0x43, 0x0e, 0x96, 0xa1, 0xbd, 0xec, 0x76, 0xbd, 0x5e,
+    0xfc, 0x8d, 0x66, 0x53, 0x97, 0x02, 0x1d, 0x31, 0xac, 0xca, 0xbd, 0xd7, 0x15, 0x96, 0x09, 0xed,
+    0xff, 0xe6, 0xcd, 0x66, 0x46, 0x65, 0x86, 0x55, 0x5a, 0x00, 0x32, 0xad, 0xd7, 0x40, 0x79, 0x44,
+    0x57, 0xb1, 0xc9, 0xdb, 0x47, 0x30, 0x70, 0xe3, 0x55, 0x6b, 0x57, 0x96, 0x94, 0x8b, 0x2c, 0x2a,
+    0xa5, 0xe5, 0xe2, 0x95, 0x71, 0x79, 0x2f, 0x2e, 0xb3, 0xd3, 0x10, 0xef, 0xb7, 0x64, 0x1e, 0x76,
+    0x4a, 0x9d, 0x65, 0x5f, 0x64, 0xf5, 0x36, 0x67, 0xad, 0xde, 0xad, 0xdc, 0xa3, 0xed, 0xb3, 0xd5,
+    0x00, 0xca, 0x1a, 0xc1, 0x99, 0x08, 0x41, 0x57, 0x8c, 0xc0, 0x80, 0x18, 0x0f, 0xb0, 0x86, 0xf9,
+    0x98, 0x62, 0x51, 0xac, 0x05, 0x26, 0xb0, 0xb2, 0xeb, 0xee, 0x66, 0xaa, 0x9d, 0x60, 0x0d, 0xde,
+    0x8e, 0xce, 0x64, 0x51, 0xc5, 0x76, 0x37, 0x9b, 0x4d, 0xaf, 0x26, 0xef, 0x5e, 0xc1, 0xdc, 0x2d,
+    0x90, 0xff, 0xdd, 0xf6, 0xce, 0x0e, 0x19, 0x9b, 0xe7, 0x4f, 0xc1, 0x9c, 0x9b, 0x3c, 0x51, 0xfb,
+    0xe4, 0x23, 0x79, 0x9d, 0x0f, 0x3f, 0xff, 0xc5, 0x22, 0x60, 0xd9, 0xb4, 0x4f, 0x09, 0x2d, 0x3a,
+    0x54, 0xa5, 0xc1, 0xed, 0xc4, 0xf0, 0x2c, 0x99, 0x7a, 0x9e, 0x5c, 0x0e, 0x14, 0x01, 0x2f, 0xcd,
+    0x1a, 0xe5, 0xeb, 0x2f, 0xec, 0xea, 0xd2, 0xb4, 0x4a, 0xed, 0x61, 0x86, 0x9b, 0xab, 0x22, 0x7e,
+    0xe9, 0xcb, 0x8a, 0xf0, 0x52, 0x16, 0x99, 0xd8, 0x93, 0x71, 0x75, 0x3f, 0x39, 0xbc, 0x7d, 0xaf,
+    0xb5, 0xf3, 0xf2, 0x1f, 0x7f, 0x75, 0xff, 0xe8, 0x01, 0x66, 0xd9, 0xc1, 0x2f, 0xcc, 0x4d, 0x49,
+    0xee, 0x3b, 0xd2, 0x95, 0xcb, 0x40, 0x80, 0x5d, 0x19, 0x2f, 0x50, 0x61, 0x0b, 0x5d, 0x37, 0x31,
+    0xbf, 0xde, 0xc2, 0xe2, 0xfb, 0x2d, 0x56, 0x77, 0x3d, 0xf3, 0xdd, 0xcc, 0x58, 0xbb, 0x07, 0xae,
+    0x07, 0x04, 0xd2, 0x06, 0xd2, 0x15, 0xa9, 0xad, 0x2c, 0x6e, 0x0c, 0xf6, 0x2b, 0xd2, 0x56, 0x6a,
+    0x38, 0xae, 0xfc, 0xad, 0x2f, 0x41, 0x03, 0x85, 0x44, 0x46, 0x52, 0xaa, 0x1a, 0x78, 0xed, 0x26,
+    0x42, 0x6a, 0xe8, 0x0b, 0x41, 0x47, 0xfc, 0x84, 0xaf, 0xe5, 0xde, 0xe8, 0x50, 0x10, 0x04, 0xfc,
+    0xfa, 0xf7, 0xe4, 0x88, 0x33, 0xb0, 0xa2, 0x30, 0xa1, 0x3c, 0xe7, 0x7e, 0x82, 0x0b, 0x72, 0x6d,
+    0x9d, 0xec, 0xad, 0x9d, 0xaa, 0xb0, 0x00, 0x3a, 0x64, 0x68, 0x88, 0x3b, 0xf2, 0x22, 0x1d, 0xe6,
+    0x71, 0xac, 0xec, 0x02, 0x73, 0x29, 0x3c, 0xd1, 0xc5, 0x03, 0x84, 0xf2, 0x44, 0x42, 0x58, 0x30,
+    0x57, 0xdd, 0x00, 0xdc, 0x5a, 0x5b, 0x6b, 0x22, 0xf5, 0x21, 0x56, 0xfc, 0x5d, 0xdf, 0x96, 0x37,
+    0x9e, 0x10, 0xfc, 0x63, 0xc4, 0xf5, 0x25, 0x91, 0x8a, 0xa0, 0x0b, 0x08, 0x77, 0xcf, 0x1f, 0xbd,
+    0x78, 0xee, 0x8e, 0xb3, 0xc7, 0xc1, 0x35, 0x71, 0x14, 0x94, 0x65, 0x19, 0xe4, 0x15, 0x83, 0x13,
+    0xa8, 0x0b, 0x67, 0x16, 0xe7, 0x85, 0x31, 0xdd, 0x5f, 0xff, 0x1c, 0xa7, 0x53, 0x9e, 0x65, 0x95,
+    0x57, 0xcf, 0x8c, 0xc0, 0xcf, 0xb8, 0x2e, 0x7b, 0xba, 0xd8, 0x28, 0xee, 0x52, 0xd7, 0x56, 0xa8,
+    0xc2, 0xcd, 0xe0, 0x6b, 0x61, 0x22, 0x10, 0x05, 0x15, 0x86, 0x88, 0x8d, 0xf1, 0xd6, 0x07, 0x15,
+    0xc7, 0xe2, 0x43, 0x11, 0x87, 0x2c, 0xb3, 0xe1, 0xae, 0xa4, 0xc2, 0x33, 0x55, 0x9a, 0x2f, 0x6e,
+    0x2e, 0xc6, 0x18, 0xd3, 0x93, 0xfb, 0x0b, 0x32, 0x6b, 0x28, 0x35, 0x4e, 0x8b, 0x7b, 0xf2, 0xb6,
+    0xdf, 0xf8, 0x24, 0x4b, 0x72, 0xe9, 0x13, 0xce, 0x6e, 0xa5, 0x93, 0x66, 0x74, 0xda, 0xa9, 0x11,
+    0x8e, 0xb9, 0x82, 0x78, 0x66, 0x7f, 0xf2, 0x4d, 0x74, 0x46, 0xe1, 0xc5, 0xf3, 0x2e, 0xc6, 0x18,
+    0x46, 0xf0, 0x07, 0xf8, 0x89, 0xbf, 0x40, 0x6e, 0xd4, 0xf8, 0xb3, 0x7e, 0x01, 0x23, 0xbe, 0x91,
+    0x92, 0xe6, 0x17, 0x77, 0x95, 0x2a, 0x93, 0x21, 0x36, 0xc5, 0x13, 0x9f, 0x33, 0x1f, 0xfd, 0xd6,
+    0x68, 0xb9, 0xce, 0xfb, 0xea, 0x4d, 0x5c, 0x9c, 0xba, 0xdc, 0x79, 0x12, 0x1d, 0x7a, 0xf5, 0x32,
+    0xec, 0x7d, 0xfe, 0xb4, 0x08, 0x62, 0x51, 0x8e, 0x66, 0xb6, 0x26, 0x67, 0x6a, 0xa8, 0x1f, 0x27,
+    0xf7, 0x1d, 0x5c, 0x97, 0x37, 0x1d, 0x84, 0xda, 0xb3, 0x4c, 0x98, 0x91, 0xc9, 0x2b, 0x3d, 0x6c,
+    0x9a, 0x02, 0x4f, 0xaa, 0xad, 0x7a, 0xab, 0x39, 0x27, 0x6f, 0x63, 0x4e, 0x55, 0xcb, 0x5c, 0xe0,
+    0x71, 0xfd, 0xc3, 0xfc, 0x6f, 0xa7, 0x12, 0xd3, 0xe6, 0xe6, 0xa5, 0x15, 0x0e, 0x15, 0xd3, 0xaf,
+    0xc3, 0xe4, 0x7e, 0x88, 0x43, 0x79, 0x5e, 0x1e, 0x13, 0xc1, 0x5c, 0xe1, 0x07, 0x19, 0x9e, 0x07,
+    0x09, 0x99, 0x33, 0xb4, 0x32, 0xfe, 0xc4, 0x72, 0x74, 0xc8, 0x60, 0xb6, 0x42, 0xad, 0xcf, 0xa2,
+    0xae, 0x0a, 0x3d, 0xde, 0x6c, 0xd5, 0xcf, 0x42, 0x4c, 0x56, 0xa8, 0x01, 0x5a, 0x1a, 0x95, 0xd5,
+    0x3d, 0x89, 0x55, 0xbd, 0x88, 0x15, 0x3d, 0x88, 0x62, 0xef, 0xa1, 0x28, 0x3c, 0x55, 0x5c, 0xf9,
+    0xb3, 0x90, 0x2b, 0xf3, 0xe4, 0x60, 0x8a, 0x6f, 0xe7, 0x73, 0xbc, 0xc3, 0xed, 0xfb, 0xcc, 0xa2,
+    0xe1, 0x75, 0xbd, 0x90, 0x1e, 0x72, 0x5b, 0xe5, 0x1e, 0x53, 0x3c, 0xa4, 0x34, 0x48, 0x0a, 0x4c,
+    0x47, 0xc2, 0xcc, 0x7a, 0xf3, 0x78, 0x3d, 0x7b, 0xbf, 0x4d, 0xba, 0xe7, 0xe4, 0xce, 0x95, 0x0c,
+    0xbc, 0xa5, 0xee, 0x46, 0xde, 0xa9, 0x74, 0x6e, 0x36, 0x49, 0x55, 0x59, 0xb3, 0xb5, 0x52, 0x77,
+    0x24, 0x6f, 0x43, 0xd3, 0x96, 0x6a, 0xba, 0x5d, 0xae, 0xe5, 0x16, 0xb4, 0x6c, 0xab, 0x96, 0x5b,
+    0xe5, 0x5a, 0x02, 0x77, 0xdc, 0xdc, 0x54, 0x2d, 0x9b, 0xe5, 0x5a, 0xb6, 0xa1, 0xe5, 0x96, 0x6a,
+    0xd9, 0x2e, 0xd7, 0xb2, 0x85, 0xe8, 0x6e, 0x6b, 0x1a, 0x95, 0xc4, 0xb7, 0x85, 0x60, 0x77, 0x74,
+    0xdb, 0xb2, 0x70, 0x37, 0xa1, 0xed, 0x25, 0xdd, 0x76, 0xb3, 0x64, 0x5b, 0x9c, 0x9c, 0x5d, 0xdd,
+    0x76, 0xde, 0xec, 0xcc, 0x11, 0xa5, 0x55, 0xcb, 0xd9, 0x7d, 0x2e, 0x0f, 0x00, 0x74, 0x39, 0xb0,
+    0x76, 0x1f, 0x53, 0xa6, 0x03, 0xa2, 0x2f, 0x72, 0x51, 0xf9, 0xc2, 0xe8, 0x15, 0xa5, 0xc4, 0x20,
+    0x52, 0xf5, 0xe1, 0xba, 0xbc, 0x51, 0x4d, 0x5d, 0xb2, 0x87, 0xfb, 0x16, 0x06, 0xf7, 0x06, 0x0d,
+    0xf2, 0x68, 0xc8, 0x31, 0x56, 0x2d, 0xbb, 0xd1, 0xfb, 0x80, 0x98, 0x63, 0xa2, 0x2e, 0xbe, 0x35,
+    0x38, 0xcb, 0xb9, 0x67, 0x6f, 0xbe, 0x41, 0xbc, 0x92, 0x2d, 0x4c, 0x4d, 0xd0, 0x49, 0xa5, 0x4d,
+    0xe1, 0x5f, 0x91, 0x47, 0x20, 0xcb, 0x63, 0xf0, 0x2d, 0xa3, 0x6c, 0xf2, 0x43, 0x20, 0x82, 0x05,
+    0x66, 0xdf, 0xbd, 0x07, 0x07, 0x17, 0x6b, 0x0e, 0xa7, 0xa3, 0xd5, 0x88, 0xeb, 0x43, 0x0f, 0x8d,
+    0xa1, 0x3b, 0x02, 0xb0, 0x21, 0xf2, 0x01, 0x97, 0x29, 0xda, 0x62, 0xa5, 0x0a, 0xf9, 0x9f, 0xd3,
+    0x31, 0x98, 0xb7, 0x38, 0x89, 0xfe, 0x00, 0xab, 0x45, 0x0d, 0xa4, 0x93, 0x64, 0x89, 0x9e, 0x50,
+    0x45, 0x21, 0x46, 0xc4, 0xc1, 0x71, 0x05, 0x2b, 0x6d, 0xcf, 0x26, 0x79, 0x54, 0x09, 0xe2, 0x51,
+    0xb0, 0x33, 0x79, 0x90, 0xc9, 0xa2, 0xca, 0x9b, 0x8d, 0xdc, 0x1c, 0xa7, 0x19, 0xb2, 0x1c, 0xc2,
+    0xe0, 0x2a, 0x9d, 0x4f, 0xa9, 0x37, 0x79, 0x22, 0x5e, 0x9d, 0x2e, 0xba, 0x1f, 0x3c, 0x62, 0x27,
+    0xc7, 0x3f, 0xd5, 0xe3, 0xd2, 0xe4, 0x58, 0xd9, 0x8a, 0x71, 0xa0, 0x0d, 0x2c, 0x4b, 0x66, 0x8a,
+    0x7e, 0x72, 0x84, 0x69, 0xfa, 0xa9, 0x07, 0x4b, 0xd1, 0xaf, 0xd8, 0xad, 0x8d, 0x9d, 0x57, 0x5f,
+    0xf4, 0x7a, 0x16, 0x3b, 0xd4, 0x70, 0xab, 0x6b, 0x31, 0x08, 0x34, 0x2a, 0xfe, 0xf2, 0xdb, 0x7f,
+    0xfb, 0xf9, 0x9f, 0xff, 0xf0, 0xcb, 0x7c, 0x3f, 0xb5, 0xc8, 0x24, 0x5e, 0x4a, 0x5c, 0x93, 0x08,
+    0x1d, 0x52, 0xbe, 0x2e, 0x77, 0xf0, 0xf6, 0x48, 0xb4, 0x79, 0x97, 0x3e, 0x5f, 0xa7, 0xb6, 0xf8,
+    0xb2, 0x6e, 0x0d, 0xd9, 0xcc, 0xc9, 0x37, 0xce, 0x0e, 0xd4, 0x0b, 0xba, 0xc3, 0x94, 0x81, 0x85,
+    0x6e, 0xbb, 0xbc, 0xf0, 0x55, 0x3a, 0xf0, 0x56, 0x4f, 0x5e, 0x4e, 0xc2, 0xbd, 0x29, 0xaf, 0x7c,
+    0x76, 0xa0, 0x33, 0xf7, 0xe8, 0x7e, 0x58, 0xaf, 0x93, 0xc3, 0xc9, 0x13, 0x4c, 0x23, 0x01, 0xfb,
+    0x3d, 0x8c, 0x15, 0x9b, 0x3a, 0x25, 0x11, 0xe0, 0xe9, 0xab, 0x01, 0x1d, 0xcb, 0x7d, 0x6c, 0x99,
+    0x50, 0x82, 0x27, 0xc2, 0x64, 0xfe, 0xba, 0xbc, 0xcb, 0x97, 0x91, 0x31, 0xaa, 0xbf, 0xb0, 0x46,
+    0xea, 0xf5, 0x14, 0x90, 0xdc, 0x29, 0x52, 0xf7, 0x8b, 0x75, 0x8f, 0xe8, 0x19, 0x8b, 0x87, 0x01,
+    0x9f, 0x49, 0x3c, 0x94, 0xf8, 0x02, 0x12, 0x3d, 0x14, 0xd5, 0x35, 0xce, 0xda, 0xaf, 0xfe, 0x97,
+    0xa8, 0x67, 0xc9, 0x80, 0xca, 0xdc, 0x04, 0x6c, 0xf2, 0x99, 0xd3, 0xe9, 0x57, 0x4f, 0x37, 0x3b,
+    0x37, 0xe1, 0xb1, 0x2d, 0x60, 0xda, 0x06, 0x98, 0x17, 0xf2, 0x00, 0x14, 0x36, 0x26, 0x2b, 0x6c,
+    0xe6, 0xc6, 0x66, 0x8e, 0xe2, 0xcb, 0x22, 0x99, 0xbe, 0xe3, 0x07, 0x77, 0x9b, 0x41, 0xeb, 0x58,
+    0xf2, 0x0e, 0x68, 0x7d, 0xb4, 0x8c, 0x4b, 0xbf, 0x8b, 0xaa, 0x3d, 0xfb, 0xc4, 0x5b, 0xa7, 0x05,
+    0x7e, 0x71, 0xa9, 0x9b, 0x2d, 0x93, 0xe5, 0xeb, 0xe5, 0x57, 0xff, 0x83, 0x71, 0xd6, 0xa3, 0x70,
+    0x18, 0x80, 0xd0, 0xf4, 0x31, 0x28, 0x38, 0xf9, 0x4a, 0x1e, 0x16, 0x53, 0xd5, 0x02, 0xd2, 0x19,
+    0x2c, 0xb8, 0x14, 0x6d, 0x26, 0xf5, 0x2d, 0x70, 0xe9, 0x1a, 0x8a, 0xc9, 0xb7, 0x78, 0xe7, 0xa7,
+    0x0c, 0xce, 0xca, 0x96, 0xb8, 0x35, 0x1f, 0xe5, 0x2c, 0xc5, 0x0c, 0x80, 0x7e, 0x5c, 0x45, 0xc2,
+    0x08, 0xfa, 0xd2, 0xf1, 0x79, 0xf1, 0xdc, 0x4f, 0xd2, 0x0f, 0x2a, 0xc9, 0x90, 0x96, 0xd0, 0x72,
+    0x85, 0xf7, 0xb6, 0x11, 0x95, 0x73, 0x11, 0xdf, 0xcf, 0x9b, 0x29, 0xb5, 0x4a, 0xd2, 0xe1, 0x67,
+    0xc3, 0x98, 0x8e, 0x65, 0x93, 0xed, 0xec, 0x66, 0x6b, 0x5d, 0x5f, 0x9d, 0x9b, 0xda, 0x73, 0x2d,
+    0x4e, 0xd9, 0xd0, 0x65, 0x59, 0x3d, 0x4d, 0x43, 0xae, 0xca, 0xb2, 0xce, 0xf1, 0xbb, 0x65, 0x04,
+    0x9f, 0x0f, 0xef, 0xa0, 0x86, 0xac, 0x64, 0xe6, 0x2d, 0xbb, 0xcd, 0x14, 0xd5, 0x6d, 0xc5, 0xf8,
+    0x73, 0xa6, 0xa5, 0x82, 0x58, 0x59, 0x2e, 0x2a, 0x54, 0xda, 0x65, 0x4f, 0x09, 0x01, 0xca, 0x93,
+    0x2b, 0x46, 0x45, 0x63, 0x8f, 0x23, 0x3e, 0xc8, 0xc6, 0x1b, 0x78, 0x60, 0x0c, 0xef, 0xf8, 0x03,
+    0x90, 0x8b, 0xc2, 0x85, 0x2e, 0x66, 0x1d, 0x45, 0x0c, 0x11, 0x55, 0x45, 0xc1, 0x83, 0xe1, 0xb1,
+    0x50, 0x62, 0xcc, 0x68, 0x19, 0xa0, 0xa7, 0x40, 0x30, 0x04, 0xbc, 0x04, 0xd0, 0x90, 0x59, 0x16,
+    0x8e, 0x25, 0x82, 0xab, 0x6a, 0x29, 0xe8, 0xc3, 0x97, 0x16, 0x95, 0x95, 0x22, 0xca, 0x01, 0xb7,
+    0x85, 0x0a, 0x75, 0x2d, 0x04, 0x2d, 0xd4, 0xe5, 0xc2, 0x31, 0x68, 0x79, 0xc0, 0x4e, 0x86, 0x65,
+    0xab, 0x2d, 0x74, 0xb3, 0xcb, 0x83, 0x06, 0xb5, 0xe1, 0x2c, 0x01, 0x58, 0x29, 0xc3, 0xce, 0xcb,
+    0xff, 0xf8, 0x9a, 0x14, 0xca, 0xdf, 0x7c, 0xd8, 0x05, 0x4e, 0x66, 0x4e, 0xc8, 0x7b, 0x33, 0x67,
+    0xc3, 0x35, 0x5a, 0x8d, 0x6e, 0xdb, 0xa0, 0xdf, 0xf1, 0x5e, 0x3a, 0x56, 0xa0, 0x16, 0x57, 0x60,
+    0x3a, 0x75, 0x93, 0x53, 0xb2, 0x5c, 0xbb, 0x30, 0x16, 0x17, 0x8c, 0x17, 0x5c, 0xb5, 0xdc, 0x61,
+    0x75, 0xed, 0xc6, 0x58, 0x5e, 0x39, 0xe0, 0xb0, 0x91, 0x2d, 0x88, 0x71, 0x6a, 0x30, 0x5c, 0x07,
+    0x66, 0xd2, 0xf4, 0xae, 0xe1, 0x62, 0xbe, 0x90, 0x8e, 0xc0, 0x24, 0x83, 0x28, 0x81, 0x3e, 0xb9,
+    0x04, 0x6a, 0xe9, 0x29, 0x73, 0x19, 0x56, 0xdb, 0x5e, 0x01, 0x57, 0x0c, 0x5c, 0x2a, 0x6c, 0xd3,
+    0x01, 0xdb, 0xea, 0xad, 0xa3, 0xc3, 0xda, 0x72, 0x88, 0x4b, 0x49, 0xbb, 0xaf, 0x3a, 0x4a, 0x2f,
+    0x23, 0xaa, 0x8f, 0x32, 0x63, 0x38, 0xa1, 0x06, 0x18, 0x7a, 0xe1, 0x2a, 0x54, 0xc7, 0x75, 0x20,
+    0x0e, 0xf2, 0xa6, 0xae, 0x22, 0x86, 0x25, 0xdb, 0x95, 0xb9, 0x9c, 0xd7, 0xc8, 0x51, 0x9c, 0x09,
+    0xe9, 0x0b, 0x78, 0x25, 0xb0, 0xe5, 0x0d, 0x55, 0x2c, 0x6d, 0x83, 0xf0, 0xa8, 0x18, 0x74, 0xea,
+    0x5e, 0x6a, 0xdd, 0xd9, 0xe4, 0xab, 0xc6, 0xf2, 0xd4, 0x38, 0xd4, 0xd8, 0x14, 0xe0, 0x52, 0x86,
+    0x26, 0x43, 0x6a, 0x07, 0xd4, 0x92, 0x63, 0xef, 0x45, 0x15, 0x2f, 0xf0, 0x89, 0xaa, 0xe8, 0x79,
+    0x07, 0x99, 0x66, 0x3a, 0x41, 0xcb, 0x16, 0x36, 0xbb, 0x52, 0x80, 0x6a, 0xe7, 0xbe, 0xde, 0x36,
+    0xcb, 0xbb, 0x8f, 0xbd, 0x7a, 0x0c, 0x02, 0x3c, 0xf9, 0x06, 0x2b, 0xc7, 0x97, 0x41, 0xd1, 0x04,
+    0x27, 0xc6, 0x12, 0xd4, 0x04, 0x0f, 0xc6, 0x5b, 0x82, 0x42, 0xb8, 0x91, 0x83, 0xb5, 0xac, 0xd0,
+    0xa3, 0x1d, 0xa3, 0xdb, 0xc3, 0xcb, 0x00, 0x33, 0x2c, 0x46, 0x5d, 0xc9, 0x21, 0x86, 0x4e, 0xe1,
+    0x5f, 0x96, 0x53, 0x46, 0x78, 0xe3, 0x38, 0x26, 0x18, 0xc1, 0xac, 0xc4, 0x07, 0x16, 0xa2, 0xed,
+    0x8a, 0x6b, 0xe4, 0x81, 0x20, 0xc2, 0xc4, 0x1a, 0xfa, 0xc8, 0x21, 0x98, 0xad, 0x08, 0x7e, 0x48,
+    0xaa, 0x8a, 0xaf, 0x76, 0x96, 0xd1, 0x3c, 0x5a, 0x8a, 0x0f, 0xa8, 0x0c, 0x88, 0x76, 0x8e, 0x15,
+    0xd0, 0x3c, 0x90, 0x65, 0x46, 0xad, 0xc2, 0xa2, 0x4b, 0x80, 0x35, 0x42, 0x0a, 0x93, 0x7c, 0x30,
+    0xf0, 0x81, 0x45, 0xf8, 0x58, 0xee, 0xcd, 0x55, 0x95, 0x77, 0xbc, 0x82, 0x06, 0xce, 0x51, 0x99,
+    0x64, 0xe8, 0xd7, 0x5b, 0xcd, 0x85, 0x8a, 0x13, 0x9d, 0x59, 0x2c, 0x34, 0xbb, 0xcc, 0xea, 0x11,
+    0x22, 0x95, 0xf0, 0x60, 0x73, 0xbf, 0x34, 0x92, 0x57, 0x37, 0xf0, 0x04, 0x66, 0x8e, 0xaf, 0x3f,
+    0xeb, 0xdd, 0x44, 0xce, 0x8d, 0xb6, 0xca, 0x64, 0x3a, 0x41, 0x6e, 0x8a, 0x9c, 0xb6, 0xee, 0xd4,
+    0x1b, 0xd3, 0xc5, 0xf5, 0x95, 0x3b, 0xa4, 0x8d, 0x9f, 0x4b, 0x97, 0x2e, 0xcd, 0x5e, 0xe3, 0x0b,
+    0x83, 0x01, 0x9e, 0x94, 0xe5, 0xa2, 0x5c, 0xd1, 0x73, 0xe9, 0x50, 0x39, 0xf5, 0x33, 0x97, 0xf4,
+    0x52, 0xc7, 0xf9, 0x01, 0xbc, 0x28, 0xb7, 0x92, 0xeb, 0xea, 0x50, 0xf1, 0xb4, 0xe3, 0x16, 0x7d,
+    0x9c, 0x3e, 0x54, 0x72, 0xd5, 0x33, 0x5c, 0xf0, 0x99, 0x89, 0xe7, 0x1a, 0xfb, 0x6b, 0x1b, 0x78,
+    0x00, 0x9c, 0x1b, 0x1b, 0x4a, 0x43, 0x34, 0xfa, 0xde, 0xb5, 0xb3, 0xfd, 0x4b, 0x66, 0x9b, 0x9a,
+    0x5b, 0x2d, 0x73, 0x0d, 0x2d, 0x33, 0xf9, 0x6e, 0xe7, 0x03, 0x00, 0x21, 0xcc, 0x10, 0x7f, 0x9f,
+    0xfa, 0x43, 0xf0, 0x9a, 0xff, 0x0f, 0xcb, 0x0f, 0x57, 0xaf, 0x8a, 0x93, 0x00, 0x00,
+};
@@ -0,0 +1,42 @@
+// Wygenerowano przez scripts/gzip_assets.py z plików web/ - nie edytować ręcznie
+#ifndef STATIC_ASSETS_H
+#define STATIC_ASSETS_H
+
+#include <Arduino.h>
+
+// web/app.css: 8905 B -> 2302 B gzip
+extern const uint8_t STATIC_APP_CSS_GZ[] PROGMEM;
+#define STATIC_APP_CSS_GZ_LEN 2302
+#define STATIC_APP_CSS_VER "6fc130b8"
+
+// web/app.js: 7526 B -> 2380 B gzip
+extern const uint8_t STATIC_APP_JS_GZ[] PROGMEM;
+#define STATIC_APP_JS_GZ_LEN 2380
+#define STATIC_APP_JS_VER "059e4e64"
+
+// web/icon.svg: 158 B -> 158 B gzip
+extern const uint8_t STATIC_ICON_SVG_GZ[] PROGMEM;
+#define STATIC_ICON_SVG_GZ_LEN 158
+#define STATIC_ICON_SVG_VER "9285b371"
+
+// web/dashboard.js: 11638 B -> 4325 B gzip
+extern const uint8_t STATIC_DASHBOARD_JS_GZ[] PROGMEM;
+#define STATIC_DASHBOARD_JS_GZ_LEN 4325
+#define STATIC_DASHBOARD_JS_VER "a6589edc"
+
+// web/index.html: 5081 B -> 2012 B gzip
+extern const uint8_t STATIC_INDEX_HTML_GZ[] PROGMEM;
+#define STATIC_INDEX_HTML_GZ_LEN 2012
+#define STATIC_INDEX_HTML_VER "9c1c146d"
+
+// web/config.js: 9927 B -> 3776 B gzip
+extern const uint8_t STATIC_CONFIG_JS_GZ[] PROGMEM;
+#define STATIC_CONFIG_JS_GZ_LEN 3776
+#define STATIC_CONFIG_JS_VER "7d2ad41d"
+
+// web/config.html: 37770 B -> 8046 B gzip
+extern const uint8_t STATIC_CONFIG_HTML_GZ[] PROGMEM;
+#define STATIC_CONFIG_HTML_GZ_LEN 8046
+#define STATIC_CONFIG_HTML_VER "35738a2a"
+
+#endif // STATIC_ASSETS_H
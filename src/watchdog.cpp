@@ -3,6 +3,16 @@
 #include "constants.h"
 #include "WiFiConfig.h"
 #include "app_globals.h" // Centralne extern deklaracje
+#include "rtt_stats.h"
+#include "history.h"
+#include "probe.h"
+#include "incidents.h"
+#include "router_cycle.h"
+#include "button.h"
+#include "led_pattern.h"
+#include "perf.h"
+#include "heap_stats.h"
+#include "sse.h"
 #include <ESP8266WiFi.h>
 #include <ESP8266Ping.h>
 #include <WiFiClientSecure.h>
@@ -13,6 +23,7 @@
 // Pomocnicza funkcja do sprawdzenia dostępności bramy (routera)
 bool pingGateway()
 {
+    PERF_SCOPE("ping.gateway");
     IPAddress gw;
 
     // Jeśli włączono ręczną bramę i jest poprawna, użyj jej; w przeciwnym razie sięgnij po DHCP
@@ -90,6 +101,8 @@ bool shouldExecuteScheduledReset(time_t currentTime)
 // === BACKUP NETWORK MANAGEMENT ===
 void handleBackupNetworkSwitching()
 {
+    HEAP_SCOPE("wd.backup");
+
     // Jeśli funkcja wyłączona - wymuś bezpieczny stan przekaźnika i wyjdź
     if (!config.enableBackupNetwork)
     {
@@ -140,6 +153,7 @@ void handleBackupNetworkSwitching()
         // Zmień ustawienia i spróbuj połączyć
         config.backupNetworkActive = true;
         config.lastBackupSwitchTime = now;
+        incidentNoteAction(INC_ACTION_BACKUP);
         config.backupNetworkFailCount = 0;
         failCount = 0;
         backupRouterBootStartTime = millis(); // Grace period dla backup routera
@@ -197,15 +211,157 @@ void handleBackupNetworkSwitching()
     }
 }
 
-void monitorInternetConnection()
+// Werdykt "Internet OK" - wspólny dla pojedynczego pingu i serii
+// rttMs: RTT do archiwum (-1 = brak), sent/lost: pingi wysłane/utracone w próbie
+static void onProbeSuccess(int rttMs, uint8_t sent, uint8_t lost)
 {
+    historyRecordProbe(true, rttMs, sent, lost);
+    sseMarkDirty();
+    incidentClose();
+    ledOK();
+    if (failCount > 0)
+        logEvent("Internet OK (Po " + String(failCount) + " bledach)");
+    failCount = 0;
+    lagCount = 0; // Reset licznika spike'ów gdy internet OK
+    statusMsg = "Internet OK";
+
+    // --- POPRAWKA: Logika sukcesu ---
+    // Jeśli Internet działa, a mamy zarejestrowane wcześniejsze resety, to znaczy, że AWARIA MINĘŁA.
+    if (totalResets > 0)
+    {
+        logEvent("Internet wrocil po awarii (Resety: " + String(totalResets) + ")");
+
+        if (simPingFail || simNoWiFi || simHighPing)
+        {
+            simStatus = "Internet przywrócony - symulacja zakończona pomyślnie";
+        }
+
+        // Zerujemy liczniki awarii i zapisujemy "czysty" stan
+        totalResets = 0;
+        resetBackoffUntil = 0; // Awaria minęła - okno ochronne niepotrzebne
+        nextResetDelay = FIVE_MINUTES_MS; // Reset do domyślnych 5 min
+        firstResetTime = 0;
+        simResetCount = 0;               // Reset licznika symulacji
+        providerFailureNotified = false; // Reset flagi awarii dostawcy
+        lastGatewayFailReset = false;    // Reset flagi zawieszenia routera
+
+        // Aktualizujemy strukturę config i zapisujemy
+        config.totalResets = 0;
+        config.nextResetDelay = FIVE_MINUTES_MS;
+        config.firstResetTime = 0;
+        if (!saveConfig())
+        {
+            Serial.println("BŁĄD ZAPISU CONFIG PO SUKCESIE!");
+            logEvent("BLAD ZAPISU CONFIG PO SUKCESIE");
+        }
+    }
+}
+
+// Werdykt "błąd połączenia" - wspólny dla pojedynczego pingu i serii
+// cause: przyczyna zapisywana w rejestrze awarii, jeśli to początek awarii
+static void onProbeFailure(int rttMs, uint8_t sent, uint8_t lost, IncidentCause cause)
+{
+    historyRecordProbe(false, rttMs, sent, lost);
+    sseMarkDirty();
+    incidentOpen(cause);
+    failCount++;
+    ledFail();
+    if (failCount == 1 || failCount == config.failLimit)
+    {
+        logEvent("Blad polaczenia (" + String(failCount) + "/" + String(config.failLimit) + ")");
+    }
+    statusMsg = "Blad polaczenia (" + String(failCount) + "/" + String(config.failLimit) + ")";
+    if (simPingFail || simNoWiFi || simHighPing)
+    {
+        simStatus = "Wykryto " + String(failCount) + "/" + String(config.failLimit) + " błędów - oczekiwanie na reset...";
+    }
+
+    if (failCount >= config.failLimit)
+    {
+        wykonajReset();
+    }
+}
+
+// Werdykt serii pingów: strata pakietów, a potem lag
+static void handleBurstResult(const ProbeResult &r)
+{
+    HEAP_SCOPE("wd.burst");
+    static bool lossWarned = false;
+
+    // Statystyki RTT z każdego echa - tylko prawdziwe pomiary, nie wyniki symulacji
+    bool simulated = simPingFail || simNoWiFi || simHighPing;
+    uint8_t received = simPingFail ? 0 : r.received;
+    for (uint8_t i = 0; i < r.sent && !simulated; i++)
+    {
+        if (r.rtt[i] == PROBE_RTT_LOST)
+            rttStatsRecordLoss();
+        else
+            rttStatsRecord(r.rtt[i]);
+    }
+    uint8_t lost = r.sent - received;
+
+    if (received == 0)
+    {
+        onProbeFailure(-1, r.sent, lost, INC_CAUSE_UPSTREAM);
+        return;
+    }
+
+    int avgMs = simHighPing ? config.maxPingMs + 100 : r.rttAvg;
+    int minMs = simHighPing ? config.maxPingMs + 100 : r.rttMin;
+    lastPingMs = avgMs;
+
+    if (r.lossPct >= config.lossFailPct)
+    {
+        logEvent("Strata pakietow " + String(r.lossPct) + "% (" + String(lost) + "/" + String(r.sent) + ") >= " + String(config.lossFailPct) + "%");
+        onProbeFailure(avgMs, r.sent, lost, INC_CAUSE_LOSS);
+        return;
+    }
+
+    // Ostrzeżenie tylko przy zmianie stanu - bez zalewania logów co serię
+    bool warn = (config.lossWarnPct > 0 && r.lossPct >= config.lossWarnPct);
+    if (warn != lossWarned)
+    {
+        if (warn)
+            logEvent("Ostrzezenie: strata pakietow " + String(r.lossPct) + "% (" + String(lost) + "/" + String(r.sent) + ")");
+        else
+            logEvent("Strata pakietow w normie (" + String(r.lossPct) + "%)");
+        lossWarned = warn;
+    }
+
+    // Lag: w serii wszystkie echa powyżej progu odpowiadają "lagRetries spike'om z rzędu"
+    // Symulowany lag nie trafia do statystyk, więc w trybie P95 rozstrzyga sam
+    uint16_t p95 = simHighPing ? (uint16_t)avgMs : 0;
+    bool lag = (config.lagUseP95 && !simHighPing) ? rttStatsP95Exceeds(config.maxPingMs, &p95) : (minMs > config.maxPingMs);
+    if (lag)
+    {
+        lagCount++;
+        if (config.lagUseP95)
+            logEvent("LAG (P95 15 min): " + String(p95) + "ms > " + String(config.maxPingMs) + "ms");
+        else
+            logEvent("LAG: wszystkie pingi serii > " + String(config.maxPingMs) + "ms (min " + String(minMs) + "ms, sr " + String(avgMs) + "ms)");
+        onProbeFailure(avgMs, r.sent, lost, INC_CAUSE_LAG);
+        return;
+    }
+    if (lagCount > 0)
+        logEvent("Lag odzyskany: ping " + String(avgMs) + "ms jest OK");
+
+    onProbeSuccess(avgMs, r.sent, lost);
+    if (warn)
+        statusMsg = "Internet OK (strata " + String(r.lossPct) + "%)";
+}
+
+// Stan watchdoga bez pingów; true = można testować internet
+static bool updateWatchdogState()
+{
+    HEAP_SCOPE("wd.monitor"); // Cała faza: kopie zapasowe, harmonogram, WiFi
+
     // === WATCHDOG DISABLE ===
     // Jeśli watchdog wyłączony, nie monitoruj i nie resetuj
     if (!config.watchdogEnabled)
     {
         ledOK(); // Sygnał że wszystko OK (watchdog wyłączony)
         statusMsg = "Watchdog WYŁĄCZONY";
-        return;
+        return false;
     }
 
     // === BACKUP NETWORK MANAGEMENT ===
@@ -213,9 +369,7 @@ void monitorInternetConnection()
 
     // Pomiń sprawdzanie podczas resetu routera
     if (routerResetInProgress)
-    {
-        return;
-    }
+        return false;
 
     // === SCHEDULED RESETS (Cykliczne resety o wybranym czasie - z dokładnością do minuty) ===
     if (config.scheduledResetsEnabled)
@@ -253,7 +407,7 @@ void monitorInternetConnection()
             else
             {
                 // Nigdy nie było synchronizacji - nie możemy resetować
-                return;
+                return false;
             }
         }
 
@@ -271,8 +425,9 @@ void monitorInternetConnection()
             statusMsg = "Zaplanowany reset routera...";
             config.lastScheduledResetTime = estimatedOfflineTime;
             saveConfig();
+            incidentOpen(INC_CAUSE_SCHEDULED);
             wykonajReset();
-            return;
+            return false;
         }
     }
 
@@ -344,7 +499,7 @@ void monitorInternetConnection()
         }
         else
         {
-            return;
+            return false;
         }
     }
 
@@ -375,7 +530,7 @@ void monitorInternetConnection()
             unsigned long remainMs = config.baseBootTime - (millis() - gracePeriodTime);
             String routerLabel = isBackupGracePeriod ? "Router backup" : "Router";
             statusMsg = routerLabel + " startuje... grace period " + String(remainMs / 1000) + "s";
-            return; // Pomiń testy
+            return false; // Pomiń testy
         }
         else if (gracePeriodTime > 0)
         {
@@ -386,110 +541,7 @@ void monitorInternetConnection()
                 routerBootStartTime = 0; // Zresetuj flagę główną
         }
 
-        if (millis() - lastPingTime > config.pingInterval)
-        {
-            lastPingTime = millis();
-            ESP.wdtFeed();
-
-            // Najpierw sprawdź, czy osiągalna jest brama (router). Jeśli nie, to problem lokalny/LAN.
-            static int gatewayFailCount = 0;
-            if (!pingGateway())
-            {
-                gatewayFailCount++;
-                failCount = 0; // Nie mieszaj błędów pingu do Internetu z brakiem bramy
-                statusMsg = "Brama nie odpowiada (" + String(gatewayFailCount) + "/" + String(config.failLimit) + ")";
-
-                if (gatewayFailCount == 1 || gatewayFailCount == config.failLimit)
-                {
-                    logEvent("Brama (" + WiFi.gatewayIP().toString() + ") nie odpowiada " + String(gatewayFailCount) + "/" + String(config.failLimit));
-                }
-
-                // INTELIGENTNA DETEKCJA: Jeśli ostatni reset był z powodu gateway i problem się powtarza,
-                // to nie jest zwykłe zawieszenie routera - traktuj jako awarię dostawcy (limit 5 prób)
-                if (gatewayFailCount >= config.failLimit)
-                {
-                    if (lastGatewayFailReset && totalResets > 0)
-                    {
-                        // Drugi raz z rzędu brak gateway po resecie → awaria dostawcy
-                        logEvent("Gateway nie wrócił po resecie - prawdopodobnie awaria dostawcy (Total: " + String(totalResets) + ")");
-                        lastGatewayFailReset = false; // Reset flagi, przełączamy na tryb awarii dostawcy
-                        // Od teraz failCount i totalResets będą kontrolować limit 5 prób
-                    }
-                    else
-                    {
-                        // Pierwszy raz brak gateway → prawdopodobnie zawieszenie routera
-                        logEvent("Prawdopodobnie zawieszenie routera - wykonuję reset");
-                        lastGatewayFailReset = true; // Zapamiętaj że resetujemy z powodu gateway
-                    }
-                    wykonajReset();
-                }
-                return; // Nie sprawdzaj Internetu, skoro brama jest martwa
-            }
-            else
-            {
-                gatewayFailCount = 0;         // Brama żyje, można sprawdzać Internet
-                lastGatewayFailReset = false; // Reset OK, nie był problem z gateway
-            }
-
-            if (sprawdzInternet())
-            {
-                ledOK();
-                if (failCount > 0)
-                    logEvent("Internet OK (Po " + String(failCount) + " bledach)");
-                failCount = 0;
-                lagCount = 0; // Reset licznika spike'ów gdy internet OK
-                statusMsg = "Internet OK";
-
-                // --- POPRAWKA: Logika sukcesu ---
-                // Jeśli Internet działa, a mamy zarejestrowane wcześniejsze resety, to znaczy, że AWARIA MINĘŁA.
-                if (totalResets > 0)
-                {
-                    logEvent("Internet wrocil po awarii (Resety: " + String(totalResets) + ")");
-
-                    if (simPingFail || simNoWiFi || simHighPing)
-                    {
-                        simStatus = "Internet przywrócony - symulacja zakończona pomyślnie";
-                    }
-
-                    // Zerujemy liczniki awarii i zapisujemy "czysty" stan
-                    totalResets = 0;
-                    nextResetDelay = FIVE_MINUTES_MS; // Reset do domyślnych 5 min
-                    firstResetTime = 0;
-                    simResetCount = 0;               // Reset licznika symulacji
-                    providerFailureNotified = false; // Reset flagi awarii dostawcy
-                    lastGatewayFailReset = false;    // Reset flagi zawieszenia routera
-
-                    // Aktualizujemy strukturę config i zapisujemy
-                    config.totalResets = 0;
-                    config.nextResetDelay = FIVE_MINUTES_MS;
-                    config.firstResetTime = 0;
-                    if (!saveConfig())
-                    {
-                        Serial.println("BŁĄD ZAPISU CONFIG PO SUKCESIE!");
-                        logEvent("BLAD ZAPISU CONFIG PO SUKCESIE");
-                    }
-                }
-            }
-            else
-            {
-                failCount++;
-                ledFail();
-                if (failCount == 1 || failCount == config.failLimit)
-                {
-                    logEvent("Blad polaczenia (" + String(failCount) + "/" + String(config.failLimit) + ")");
-                }
-                statusMsg = "Blad polaczenia (" + String(failCount) + "/" + String(config.failLimit) + ")";
-                if (simPingFail || simNoWiFi || simHighPing)
-                {
-                    simStatus = "Wykryto " + String(failCount) + "/" + String(config.failLimit) + " błędów - oczekiwanie na reset...";
-                }
-
-                if (failCount >= config.failLimit)
-                {
-                    wykonajReset();
-                }
-            }
-        }
+        return true; // Pingi w zadaniu "ping" (watchdogPingStep)
     }
     else
     {
@@ -498,9 +550,18 @@ void monitorInternetConnection()
         statusMsg = "Brak połączenia z WiFi";
         failCount = 0; // Resetujemy licznik błędów pingu, bo brak WiFi to inna kategoria błędu
 
+        // Brak WiFi też jest niedostępnością - rejestruj w historii w rytmie pingów
+        static unsigned long lastNoWiFiSample = 0;
+        if (millis() - lastNoWiFiSample > config.pingInterval)
+        {
+            lastNoWiFiSample = millis();
+            historyRecordProbe(false, -1, 0, 0);
+        }
+
         if (noWiFiStartTime == 0)
         {
             noWiFiStartTime = millis();
+            incidentOpen(INC_CAUSE_WIFI);
             logEvent("Utracono polaczenie WiFi");
             if (simNoWiFi)
             {
@@ -538,10 +599,103 @@ void monitorInternetConnection()
             simStatus = "Brak WiFi od " + String(elapsed) + "s / " + String(timeout / 1000) + "s...";
         }
     }
+    return false;
+}
+
+bool monitorInternetConnection()
+{
+    bool probing = updateWatchdogState();
+    if (!probing)
+        probeAbort(); // Niedokończona seria nie ma sensu (utrata WiFi, reset, grace period)
+    return probing;
+}
+
+// Czas do następnego pingu wg pingInterval (liczony od startu poprzedniego)
+static uint32_t untilNextPing()
+{
+    unsigned long since = millis() - lastPingTime;
+    return since >= config.pingInterval ? 0 : config.pingInterval - since;
+}
+
+uint32_t watchdogPingStep()
+{
+    // Seria pingów w toku - jedno echo na wybudzenie, w odstępach burstGapMs
+    if (probeBusy())
+    {
+        if (!probeStep())
+            return probeNextStepInMs();
+        handleBurstResult(probeResult());
+        return untilNextPing();
+    }
+
+    lastPingTime = millis();
+    ESP.wdtFeed();
+
+    // Najpierw sprawdź, czy osiągalna jest brama (router). Jeśli nie, to problem lokalny/LAN.
+    static int gatewayFailCount = 0;
+    if (!pingGateway())
+    {
+        gatewayFailCount++;
+        failCount = 0; // Nie mieszaj błędów pingu do Internetu z brakiem bramy
+        historyRecordProbe(false, -1, 1, 1);
+        incidentOpen(INC_CAUSE_GATEWAY);
+        statusMsg = "Brama nie odpowiada (" + String(gatewayFailCount) + "/" + String(config.failLimit) + ")";
+
+        if (gatewayFailCount == 1 || gatewayFailCount == config.failLimit)
+        {
+            logEvent("Brama (" + WiFi.gatewayIP().toString() + ") nie odpowiada " + String(gatewayFailCount) + "/" + String(config.failLimit));
+        }
+
+        // INTELIGENTNA DETEKCJA: Jeśli ostatni reset był z powodu gateway i problem się powtarza,
+        // to nie jest zwykłe zawieszenie routera - traktuj jako awarię dostawcy (limit 5 prób)
+        if (gatewayFailCount >= config.failLimit)
+        {
+            if (lastGatewayFailReset && totalResets > 0)
+            {
+                // Drugi raz z rzędu brak gateway po resecie → awaria dostawcy
+                logEvent("Gateway nie wrócił po resecie - prawdopodobnie awaria dostawcy (Total: " + String(totalResets) + ")");
+                lastGatewayFailReset = false; // Reset flagi, przełączamy na tryb awarii dostawcy
+                // Od teraz failCount i totalResets będą kontrolować limit 5 prób
+            }
+            else
+            {
+                // Pierwszy raz brak gateway → prawdopodobnie zawieszenie routera
+                logEvent("Prawdopodobnie zawieszenie routera - wykonuję reset");
+                lastGatewayFailReset = true; // Zapamiętaj że resetujemy z powodu gateway
+            }
+            wykonajReset();
+        }
+        return config.pingInterval; // Nie sprawdzaj Internetu, skoro brama jest martwa
+    }
+    else
+    {
+        gatewayFailCount = 0;         // Brama żyje, można sprawdzać Internet
+        lastGatewayFailReset = false; // Reset OK, nie był problem z gateway
+    }
+
+    // Tryb serii: echa w kolejnych wybudzeniach zadania, werdykt po zakończeniu serii
+    if (config.burstCount > 1)
+    {
+        probeStart(config.burstCount, config.burstGapMs);
+        return 0; // Pierwsze echo w kolejnym obiegu
+    }
+
+    if (sprawdzInternet())
+    {
+        onProbeSuccess(lastPingMs, 1, 0);
+    }
+    else
+    {
+        // Lag (ping doszedł, ale za wolno) to nadal awaria, ale z pomiarem RTT
+        bool lagged = (lagCount > 0);
+        onProbeFailure(lagged ? lastPingMs : -1, 1, lagged ? 0 : 1, lagged ? INC_CAUSE_LAG : INC_CAUSE_UPSTREAM);
+    }
+    return config.pingInterval;
 }
 
 bool sprawdzInternet()
 {
+    PERF_SCOPE("ping.internet");
     if (simPingFail)
         return false;
 
@@ -566,18 +720,44 @@ bool sprawdzInternet()
             pingSuccess = true;
         }
 
+        // Statystyki RTT tylko z prawdziwych pomiarów - symulacja ich nie zaśmieca
+        bool simulated = simPingFail || simNoWiFi || simHighPing;
         if (!pingSuccess)
         {
             // Żaden host nie odpowiada - to nie lag, to brak pingu
+            if (!simulated)
+                rttStatsRecordLoss();
             return false;
         }
 
+        if (!simulated)
+            rttStatsRecord(pingMs);
+
         // Symulacja wysokiego pingu
         if (simHighPing)
             pingMs = config.maxPingMs + 100;
 
         lastPingMs = pingMs;
 
+        // Tryb P95: o lagu decyduje percentyl z okna 15 min, nie pojedyncze spike'i
+        // (symulowany lag idzie ścieżką spike'ów - nie ma go w statystykach)
+        if (config.lagUseP95 && !simHighPing)
+        {
+            uint16_t p95 = 0;
+            if (rttStatsP95Exceeds(config.maxPingMs, &p95))
+            {
+                lagCount++;
+                logEvent("LAG (P95 15 min): " + String(p95) + "ms > " + String(config.maxPingMs) + "ms");
+                return false;
+            }
+            if (lagCount > 0)
+            {
+                logEvent("Lag odzyskany: P95 " + String(p95) + "ms jest OK");
+                lagCount = 0;
+            }
+            return true;
+        }
+
         // Sprawdzenie czy ping jest wysoki
         if (pingMs > config.maxPingMs)
         {
@@ -611,18 +791,86 @@ bool sprawdzInternet()
     return false;
 }
 
-void safeDelay(unsigned long ms)
+// Czy reset wywołała symulacja (zapamiętane przed ewentualnym auto-wyłączeniem symulacji)
+static bool resetWasSimulation = false;
+
+// Zakończenie automatycznego resetu (wywoływane przez router_cycle po rozruchu routera)
+static void onAutoResetDone(RouterCycleKind kind, bool completed)
+{
+    (void)kind;
+    bool wasSimulation = resetWasSimulation;
+
+    if (!completed)
+    {
+        logEvent("Reset routera przerwany przez uzytkownika");
+        statusMsg = "Reset routera przerwany";
+    }
+
+    // Internet potwierdzony w trakcie rozruchu - bez dodatkowego grace period.
+    // W przeciwnym razie router jeszcze startuje - grace period obsłuży monitorInternetConnection()
+    RouterBootTiming bootTiming;
+    bool confirmed = completed && routerCycleLastTiming(bootTiming) && bootTiming.confirmed;
+    routerBootStartTime = confirmed ? 0 : millis();
+
+    // Liczniki są utrzymywane w sekcji .noinit; nie zapisujemy na Flash aby ograniczyć zużycie.
+    config.totalResets = totalResets;
+    config.totalResetsEver = totalResetsEver;
+    config.nextResetDelay = nextResetDelay;
+    config.firstResetTime = (firstResetTime == 0) ? millis() : firstResetTime;
+    config.lastResetTime = millis();
+    config.failCount = 0;
+    config.noWiFiStartTime = 0;
+
+    // Zapisz liczniki do konfiguracji
+    if (!saveConfig())
+    {
+        Serial.println("BŁĄD: Nie udało się zapisać config przed restartem!");
+        logEvent("BLAD ZAPISU CONFIG PRZED RESTARTEM");
+    }
+
+    // Przerwany reset lub symulacja - bez restartu ESP, wracamy do monitorowania
+    if (wasSimulation || !completed)
+    {
+        if (wasSimulation)
+        {
+            Serial.println("Tryb symulacji: Pomijam restart ESP.");
+            logEvent("Symulacja: Pominieto restart ESP");
+            simStatus = "Reset zakończony - wznawianie monitorowania...";
+        }
+        failCount = 0;
+        noWiFiStartTime = 0;
+        routerResetInProgress = false; // Odblokuj watchdog
+        return;
+    }
+
+    Serial.println("Restart ESP...");
+    historyFlush();
+    incidentsFlush();
+    ESP.restart();
+    // Tutaj kod już nie dotrze, i to jest OK.
+}
+
+unsigned long resetBackoffRemainingMs()
 {
-    elapsedMillis timer;
-    while (timer < ms)
+    if (resetBackoffUntil == 0)
+        return 0;
+    long remaining = (long)(resetBackoffUntil - millis()); // Odporne na przepełnienie millis()
+    if (remaining <= 0)
     {
-        ESP.wdtFeed();
-        delay(100); // Karmienie co 100 ms
+        resetBackoffUntil = 0;
+        return 0;
     }
+    return (unsigned long)remaining;
 }
 
 void wykonajReset()
 {
+    HEAP_SCOPE("wd.reset");
+
+    // Cykl zasilania już trwa - drugi reset nie ma sensu
+    if (routerCycleBusy())
+        return;
+
     // === SAFE MODE CHECK ===
     if (safeMode)
     {
@@ -633,6 +881,21 @@ void wykonajReset()
         return;
     }
 
+    // Okno ochronne po restarcie w cyklu awarii - kolejny reset dopiero po jego końcu
+    static bool backoffLogged = false;
+    unsigned long backoffRemaining = resetBackoffRemainingMs();
+    if (backoffRemaining > 0)
+    {
+        if (!backoffLogged)
+        {
+            logEvent("Reset wstrzymany - okno ochronne jeszcze " + String(backoffRemaining / 60000 + 1) + " min");
+            backoffLogged = true;
+        }
+        statusMsg = "Okno ochronne: reset za " + String(backoffRemaining / 1000) + "s";
+        return;
+    }
+    backoffLogged = false;
+
     // Dodatkowe zabezpieczenie: maksymalna liczba resetów w krótkim czasie
     const int MAX_RESETS_SHORT_TIME = 5;
     const unsigned long SHORT_TIME_WINDOW = 3600000UL; // 1 godzina
@@ -696,10 +959,12 @@ void wykonajReset()
         logEvent("AWARIA DOSTAWCY (Resety: " + String(totalResets) + ")");
         statusMsg = "Awaria dostawcy - zatrzymano resety";
         providerFailureNotified = true; // Zapobiegaj spamowaniu
+        incidentNoteAction(INC_ACTION_PROVIDER);
         return;                         // Nie wykonuj resetu
     }
 
     totalResets++;                // Zwiększamy licznik
+    incidentNoteReset();          // Reset w ramach trwającej awarii (rejestr incydentów)
     config.routerResetCount++;    // Licznik resetów routera
     routerResetInProgress = true; // Blokuj watchdog podczas resetu
 
@@ -716,162 +981,98 @@ void wykonajReset()
         simStatus = "Wyłączam router na " + String(config.routerOffTime / 1000) + "s...";
     }
 
-    // Wyłączenie rutera
-    digitalWrite(config.pinRelay, HIGH);
-    safeDelay(config.routerOffTime);
-    digitalWrite(config.pinRelay, LOW);
-
-    if (simPingFail || simNoWiFi || simHighPing)
-    {
-        simStatus = "Czekam na restart routera (" + String(config.baseBootTime / 1000) + "s)...";
-    }
-
-    // Czekanie na wstanie rutera
-    elapsedMillis bootTimer;
-    while (bootTimer < (unsigned long)config.baseBootTime)
-    {
-        ESP.wdtFeed();
-        delay(100); // Krótki delay w pętli - OK (pętla ma wyjście, karmi WDT)
-        if ((millis() / 500) % 2 == 0)
-            ledFail();
-        else
-            ledOK();
-    }
-
-    // Oznacz że router właśnie się włączył - grace period będzie obsługiwany w monitorInternetConnection()
-    routerBootStartTime = millis();
-
-    // Liczniki są utrzymywane w sekcji .noinit; nie zapisujemy na Flash aby ograniczyć zużycie.
-    config.totalResets = totalResets;
-    config.totalResetsEver = totalResetsEver;
-    config.nextResetDelay = nextResetDelay;
-    config.firstResetTime = (firstResetTime == 0) ? millis() : firstResetTime;
-    config.lastResetTime = millis();
-    config.failCount = 0;
-    config.noWiFiStartTime = 0;
-
-    // Zapisz liczniki do konfiguracji
-    if (!saveConfig())
-    {
-        Serial.println("BŁĄD: Nie udało się zapisać config przed restartem!");
-        logEvent("BLAD ZAPISU CONFIG PRZED RESTARTEM");
-    }
+    // Cykl zasilania w tle (router_cycle) - loop() i serwer WWW działają podczas resetu
+    resetWasSimulation = wasSimulation;
+    routerCycleStart(RC_KIND_AUTO, onAutoResetDone);
+}
 
-    if (wasSimulation)
-    {
-        Serial.println("Tryb symulacji: Pomijam restart ESP.");
-        logEvent("Symulacja: Pominieto restart ESP");
-        simStatus = "Reset zakończony - wznawianie monitorowania...";
-        failCount = 0;
-        noWiFiStartTime = 0;
-        routerResetInProgress = false; // Odblokuj watchdog
-        return;
-    }
+static bool factoryResetPending = false;     // Pliki usuwane po zakończeniu sygnalizacji LED
+static unsigned long factoryRestartAtMs = 0; // 0 = brak zaplanowanego restartu
 
-    Serial.println("Restart ESP...");
-    ESP.restart();
-    // Tutaj kod już nie dotrze, i to jest OK.
+static void factoryResetNow()
+{
+    // Usuwanie plików konfiguracyjnych
+    if (LittleFS.exists("/config.json"))
+        LittleFS.remove("/config.json");
+    if (LittleFS.exists("/wifi_config.txt"))
+        LittleFS.remove("/wifi_config.txt");
+    if (LittleFS.exists("/events.log"))
+        LittleFS.remove("/events.log");
+
+    Serial.println("Ustawienia usunięte. Restart...");
+    factoryRestartAtMs = millis() + 1000; // Czas na wysłanie logów Serial
+    if (factoryRestartAtMs == 0)
+        factoryRestartAtMs = 1;
 }
 
+// Obsługa przycisku - zdarzenia z modułu button (przerwanie + debounce), bez blokowania loop()
 void handleButtonPress()
 {
-    if (digitalRead(config.pinButton) == LOW)
+    buttonLoop();
+
+    // Kroki przywracania ustawień fabrycznych - po zakończeniu sygnalizacji LED
+    if (factoryResetPending && factoryRestartAtMs == 0 && !ledOverlayActive())
+        factoryResetNow();
+    if (factoryRestartAtMs != 0 && (long)(millis() - factoryRestartAtMs) >= 0)
+        ESP.restart();
+
+    // Wizualna sygnalizacja długiego naciśnięcia (>10s) - ostrzeżenie przed factory reset
+    static bool factoryWarnShown = false;
+    bool warn = !factoryResetPending && buttonHeldMs() > BUTTON_LONG_MS;
+    if (warn != factoryWarnShown)
     {
-        unsigned long pressStartTime = millis();
-        unsigned long pressDuration = 0;
-
-        // Debounce
-        delay(50);
-        if (digitalRead(config.pinButton) != LOW)
-            return;
-
-        Serial.println("Przycisk wciśnięty...");
-
-        // Czekaj na zwolnienie przycisku i mierz czas
-        while (digitalRead(config.pinButton) == LOW)
-        {
-            delay(100);
-            ESP.wdtFeed();
-            pressDuration = millis() - pressStartTime;
-
-            // Wizualna sygnalizacja długiego naciśnięcia (>10s)
-            if (pressDuration > 10000)
-            {
-                // Miganie jako ostrzeżenie przed factory reset
-                if ((pressDuration / 200) % 2 == 0)
-                {
-                    digitalWrite(config.pinRed, HIGH);
-                    digitalWrite(config.pinGreen, HIGH);
-                }
-                else
-                {
-                    digitalWrite(config.pinRed, LOW);
-                    digitalWrite(config.pinGreen, LOW);
-                }
-            }
-        }
-
-        // Oblicz finalny czas naciśnięcia
-        pressDuration = millis() - pressStartTime;
-
-        // === 3 POZIOMY NACIŚNIĘĆ ===
+        factoryWarnShown = warn;
+        if (warn)
+            ledPlay(PATTERN_FACTORY_WARN);
+        else if (!factoryResetPending)
+            ledStopOverlay();
+    }
 
-        if (pressDuration > 10000)
-        {
-            // DŁUGIE (>10s) -> Factory Reset
-            Serial.println("Wykryto długie wciśnięcie (>10s) - PRZYWRACANIE USTAWIEŃ FABRYCZNYCH!");
-            logEvent("PRZYCISK: Factory reset (>10s)");
+    ButtonEvent ev = buttonPoll();
+    if (ev == BTN_NONE || factoryResetPending)
+        return;
 
-            // Sygnalizacja LED
-            for (int i = 0; i < 5; i++)
-            {
-                digitalWrite(config.pinRed, HIGH);
-                digitalWrite(config.pinGreen, HIGH);
-                delay(100);
-                digitalWrite(config.pinRed, LOW);
-                digitalWrite(config.pinGreen, LOW);
-                delay(100);
-            }
+    Serial.printf("Przycisk: wciśnięcie %s\n", buttonEventName(ev));
 
-            // Usuwanie plików konfiguracyjnych
-            if (LittleFS.exists("/config.json"))
-                LittleFS.remove("/config.json");
-            if (LittleFS.exists("/wifi_config.txt"))
-                LittleFS.remove("/wifi_config.txt");
-            if (LittleFS.exists("/events.log"))
-                LittleFS.remove("/events.log");
-
-            Serial.println("Ustawienia usunięte. Restart...");
-            delay(1000);
-            ESP.restart();
-        }
-        else if (pressDuration > 3000)
-        {
-            // ŚREDNIE (3-10s) -> Tryb AP
-            Serial.println("Średnie wciśnięcie (3-10s) - uruchamiam tryb konfiguracyjny (AP)");
-            logEvent("PRZYCISK: Tryb AP ręczny (3-10s)");
-            WiFi.mode(WIFI_AP);
-            uruchomAP();
-            uruchommDNS();
-            statusMsg = "Tryb konfiguracyjny - ręczny";
-            ledFail();
-        }
+    // === 4 RODZAJE NACIŚNIĘĆ ===
+    switch (ev)
+    {
+    case BTN_LONG:
+        // DŁUGIE (>10s) -> Factory Reset (pliki usuwane po zakończeniu sygnalizacji)
+        Serial.println("Wykryto długie wciśnięcie (>10s) - PRZYWRACANIE USTAWIEŃ FABRYCZNYCH!");
+        logEvent("PRZYCISK: Factory reset (>10s)");
+        factoryResetPending = true;
+        ledStopOverlay();
+        ledPlay(PATTERN_FACTORY_RESET);
+        break;
+
+    case BTN_MEDIUM:
+        // ŚREDNIE (3-10s) -> Tryb AP
+        Serial.println("Średnie wciśnięcie (3-10s) - uruchamiam tryb konfiguracyjny (AP)");
+        logEvent("PRZYCISK: Tryb AP ręczny (3-10s)");
+        WiFi.mode(WIFI_AP);
+        uruchomAP();
+        uruchommDNS();
+        statusMsg = "Tryb konfiguracyjny - ręczny";
+        ledFail();
+        break;
+
+    case BTN_DOUBLE:
+        // PODWÓJNE -> Przerwanie trwającego cyklu zasilania routera
+        if (routerCycleAbort())
+            logEvent("PRZYCISK: Reset routera przerwany");
         else
-        {
-            // KRÓTKIE (<3s) -> Reset routera
-            Serial.println("Krótkie wciśnięcie (<3s) - RESET ROUTERA");
-            logEvent("PRZYCISK: Reset routera ręczny");
-
-            // Sygnalizacja (niebieska dioda mruga)
-            for (int i = 0; i < 3; i++)
-            {
-                digitalWrite(config.pinBlue, HIGH);
-                delay(100);
-                digitalWrite(config.pinBlue, LOW);
-                delay(100);
-            }
-
-            wykonajReset();
-        }
+            Serial.println("Podwójne kliknięcie - brak resetu do przerwania");
+        break;
+
+    case BTN_SHORT:
+    default:
+        // KRÓTKIE (<3s) -> Reset routera
+        Serial.println("Krótkie wciśnięcie (<3s) - RESET ROUTERA");
+        logEvent("PRZYCISK: Reset routera ręczny");
+        ledPlay(PATTERN_BUTTON_ACK); // Sygnalizacja (niebieska dioda mruga)
+        resetBackoffUntil = 0;       // Ręczny reset pomija okno ochronne
+        wykonajReset();
+        break;
     }
 }
\ No newline at end of file
@@ -7,10 +7,10 @@ extern int failCount;
 extern int totalResets;
 extern int totalResetsEver;
 extern unsigned long lastPingTime;
-extern unsigned long lastAPCheckTime;
 extern unsigned long apModeStartTime;    // Czas wejścia w AP mode
 extern int apModeAttempts;               // Licznik prób wyjścia z AP
 extern unsigned long apModeBackoffUntil; // Timestamp gdy kończy się backoff AP mode
+extern unsigned long resetBackoffUntil;  // Timestamp końca okna ochronnego (0 = brak), resety wstrzymane
 extern unsigned long lastResetTime;
 extern unsigned long nextResetDelay;
 extern unsigned long firstResetTime;
@@ -28,13 +28,24 @@ extern bool safeMode;                           // Tryb bezpieczeństwa - boot l
 extern bool ntpSyncLost;                        // Czy straciśmy synchronizację z NTP
 extern time_t estimatedOfflineTime;             // Szacunkowy czas offline
 
-void monitorInternetConnection();
+/**
+ * @brief Stan watchdoga: WiFi, grace period, sieć rezerwowa, zaplanowane resety (zadanie "mode")
+ * @return true gdy można testować internet - wtedy działa zadanie "ping"
+ */
+bool monitorInternetConnection();
+
+/**
+ * @brief Ping bramy i internetu albo kolejne echo serii (zadanie "ping")
+ * @return za ile ms wybudzić zadanie: kolejne echo serii albo następny ping wg pingInterval
+ */
+uint32_t watchdogPingStep();
+
 bool sprawdzInternet();
 bool pingGateway();
 bool shouldExecuteScheduledReset(time_t currentTime); // Funkcja do sprawdzania harmonogramu resetów (format HH:MM)
 void handleBackupNetworkSwitching();                  // Obsługa przełączania na sieć rezerwową
-void safeDelay(unsigned long ms);
 void wykonajReset();
+unsigned long resetBackoffRemainingMs(); // Pozostały czas okna ochronnego (0 = resety dozwolone)
 void handleButtonPress();
 
 #endif
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "constants.h"
 #include "app_globals.h" // Centralne extern deklaracje
 #include <ESP8266WebServer.h>
+#include <uri/UriBraces.h>
 #include <WiFiClientSecure.h>
 #include <LittleFS.h>
 #include <ArduinoJson.h>
@@ -15,6 +16,21 @@
 #include "version.h"
 #include "config_validation.h"   // Walidacja konfiguracji
 #include "html_form_helpers.h"   // Helpery do generowania formantów HTML
+#include "rtt_stats.h"           // Statystyki RTT (EWMA, jitter, percentyle)
+#include "history.h"             // Archiwum historii (RRD)
+#include "probe.h"               // Seria pingów (PROBE_MAX_COUNT)
+#include "incidents.h"           // Rejestr awarii (MTTR/MTBF)
+#include "router_cycle.h"        // Cykl zasilania routera (bez blokowania)
+#include "boot_model.h"          // Model czasu rozruchu routera
+#include "perf.h"                // Pomiary czasu wykonania (/api/perf)
+#include "scheduler.h"           // Statystyki zadań loop()
+#include "heap_stats.h"          // Telemetria sterty (/api/heap)
+#include "crash_log.h"           // Post-mortem awarii (/crashlog)
+#include "response_writer.h"     // Buforowane odpowiedzi (pełne segmenty TCP)
+#include "sse.h"                 // Powiadomienia na żywo (/api/events)
+#include "session_store.h"       // Sesje panelu (wylogowanie)
+#include "rate_limit.h"          // Limity żądań na adres IP (429)
+#include "async_http.h"          // Serwer na zdarzeniach lwIP (opcjonalny)
 void handleFactoryReset();       // Deklaracja funkcji
 void handleReboot();             // Deklaracja funkcji
 void handleSaveBrightness();     // Deklaracja funkcji - zapisuje jasność do Flash
@@ -25,192 +41,369 @@ void handleDownloadLogs();       // Pobranie pliku logów
 void handleClearLogs();          // Czyszczenie logów zdarzeń
 void handleClearResetCounters(); // Czyszczenie liczników resetów
 void handleWiFiPage();           // Strona konfiguracji WiFi
-void handleSaveBackupConfig();   // Zapis ustawień sieci rezerwowej
 void handleListWiFi();           // Zwraca listę zapisanych sieci (JSON)
+void handleApiRtt();             // Statystyki RTT (JSON)
+void handleApiHistory();         // Archiwum historii (binarnie)
+void handleApiIncidents();       // Rejestr awarii (JSON)
+void handleResetAbort();         // Przerwanie resetu routera
+void handleApiPerf();            // Pomiary czasu wykonania (JSON)
+void handleApiHeap();            // Telemetria sterty (JSON)
+void handleApiPerfReset();       // Zerowanie pomiarów
+void handlePerfPage();           // Strona diagnostyczna pomiarów
+void handleCrashLogPage();       // Rekordy awarii ESP (post-mortem)
+void handleCrashLogClear();      // Usunięcie rekordów awarii
+void handleStaticCss();          // /static/app.css (gzip, PROGMEM)
+void handleStaticJs();           // /static/app.js (gzip, PROGMEM)
+void handleStaticIcon();         // /static/icon.svg (gzip, PROGMEM)
+void handleStaticDashboardJs();  // /static/dashboard.js (gzip, PROGMEM)
+void handleStaticConfigJs();     // /static/config.js (gzip, PROGMEM)
+void handleApiConfig();          // Sekcje konfiguracji (JSON, odczyt i zapis)
+void handleApiStatus();          // Stan dla strony głównej (JSON)
+void handleApiEvents();          // Powiadomienia na żywo (Server-Sent Events)
+static void sendStaticAsset(const uint8_t *data, size_t len, const char *contentType, const char *version, bool immutable);
 
 // Pozostałe funkcje i zmienne (tablica, uaktualnijTablicePlik itp.) są dostępne dzięki #include "WiFiConfig.h"
 
-ESP8266WebServer server(80);
+ESP8266WebServer server(HTTP_SYNC_PORT);
 
 // ============================================================================
-// FUNKCJE POMOCNICZE DO PARSOWANIA I WALIDACJI KONFIGURACJI
+// SEKCJE KONFIGURACJI (/api/config/<sekcja>)
 // ============================================================================
+// Strona /config jest statyczna (web/config.html) - każda sekcja pobierana jest
+// przy pierwszym rozwinięciu i zapisywana osobno. Klucze JSON = nazwy pól
+// formularza. Zapis zmienia tylko pola danej sekcji (pozostałe zostają bez zmian).
 
-/// Parsuje parametry konfiguracji z żądania POST
-/// Zwraca false jeśli walidacja nie powiedzie się i wysyła błąd
-bool parseAndValidateConfigParams(ESP8266WebServer &srv, Config &cfg)
-{
-    Serial.println(F("\n┌────────────────────────────────────────┐"));
-    Serial.println(F("│ [PARSER] CZYTAM DANE Z POST /saveconfig │"));
-    Serial.println(F("└────────────────────────────────────────┘"));
-
-    Serial.println(F("\n[PARSER] Otrzymane wartości POST:"));
-    // Parsowanie parametrów numerycznych
-    cfg.pingInterval = srv.arg("pingInterval").toInt();
-    Serial.print(F("  • pingInterval: "));
-    Serial.println(cfg.pingInterval);
-    cfg.failLimit = srv.arg("failLimit").toInt();
-    Serial.print(F("  • failLimit: "));
-    Serial.println(cfg.failLimit);
-    cfg.providerFailureLimit = srv.arg("providerFailureLimit").toInt();
-    Serial.print(F("  • providerFailureLimit: "));
-    Serial.println(cfg.providerFailureLimit);
-    cfg.autoResetCountersHours = srv.arg("autoResetCountersHours").toInt();
-    Serial.print(F("  • autoResetCountersHours: "));
-    Serial.println(cfg.autoResetCountersHours);
-    cfg.maxPingMs = srv.arg("maxPingMs").toInt();
-    Serial.print(F("  • maxPingMs: "));
-    Serial.println(cfg.maxPingMs);
-    cfg.lagRetries = srv.arg("lagRetries").toInt();
-    Serial.print(F("  • lagRetries: "));
-    Serial.println(cfg.lagRetries);
-    cfg.routerOffTime = srv.arg("routerOffTime").toInt();
-    Serial.print(F("  • routerOffTime: "));
-    Serial.println(cfg.routerOffTime);
-    cfg.baseBootTime = srv.arg("baseBootTime").toInt();
-    Serial.print(F("  • baseBootTime: "));
-    Serial.println(cfg.baseBootTime);
-    cfg.bootLoopWindowSeconds = srv.arg("bootLoopWindowSeconds").toInt();
-    Serial.print(F("  • bootLoopWindowSeconds: "));
-    Serial.println(cfg.bootLoopWindowSeconds);
-    cfg.noWiFiTimeout = srv.arg("noWiFiTimeout").toInt();
-    Serial.print(F("  • noWiFiTimeout: "));
-    Serial.println(cfg.noWiFiTimeout);
-    cfg.apConfigTimeout = srv.arg("apConfigTimeout").toInt();
-    Serial.print(F("  • apConfigTimeout: "));
-    Serial.println(cfg.apConfigTimeout);
-    cfg.apMaxAttempts = srv.arg("apMaxAttempts").toInt();
-    Serial.print(F("  • apMaxAttempts: "));
-    Serial.println(cfg.apMaxAttempts);
-    cfg.apBackoffMs = srv.arg("apBackoffMs").toInt();
-    Serial.print(F("  • apBackoffMs: "));
-    Serial.println(cfg.apBackoffMs);
-    cfg.dhcpTimeoutMs = srv.arg("dhcpTimeoutMs").toInt();
-    Serial.print(F("  • dhcpTimeoutMs: "));
-    Serial.println(cfg.dhcpTimeoutMs);
-    cfg.awakeWindowMs = srv.arg("awakeWindowMs").toInt();
-    Serial.print(F("  • awakeWindowMs: "));
-    Serial.println(cfg.awakeWindowMs);
-    cfg.sleepWindowMs = srv.arg("sleepWindowMs").toInt();
-    Serial.print(F("  • sleepWindowMs: "));
-    Serial.println(cfg.sleepWindowMs);
-    cfg.ledBrightness = constrain(srv.arg("ledBrightness").toInt(), 0, 255);
-    Serial.print(F("  • ledBrightness: "));
-    Serial.println(cfg.ledBrightness);
-
-    // Parsowanie checkboxów
-    Serial.println(F("\n[PARSER] Checkboxy:"));
-    cfg.scheduledResetsEnabled = srv.hasArg("scheduledResetsEnabled");
-    Serial.print(F("  • scheduledResetsEnabled: "));
-    Serial.println(cfg.scheduledResetsEnabled ? "ON" : "OFF");
-    cfg.watchdogEnabled = srv.hasArg("watchdogEnabled");
-    Serial.print(F("  • watchdogEnabled: "));
-    Serial.println(cfg.watchdogEnabled ? "ON" : "OFF");
-    cfg.noWiFiBackoff = srv.hasArg("noWiFiBackoff");
-    Serial.print(F("  • noWiFiBackoff: "));
-    Serial.println(cfg.noWiFiBackoff ? "ON" : "OFF");
+// Liczba z żądania - tylko gdy pole przyszło (wyłączone pola formularza nie są wysyłane)
+template <typename T>
+static void readArg(ESP8266WebServer &srv, const char *name, T &field)
+{
+    if (srv.hasArg(name))
+        field = srv.arg(name).toInt();
+}
+
+template <typename T>
+static void readArg(ESP8266WebServer &srv, const char *name, T &field, long minVal, long maxVal)
+{
+    if (srv.hasArg(name))
+        field = constrain(srv.arg(name).toInt(), minVal, maxVal);
+}
+
+static void readArgStr(ESP8266WebServer &srv, const char *name, String &field)
+{
+    if (srv.hasArg(name))
+        field = srv.arg(name);
+}
+
+// --- Ogólne: motyw, jednostki, jasność diod ---
+static void configGeneralRead(JsonObject o)
+{
+    o["darkMode"] = config.darkMode;
+    o["globalUnit"] = config.globalUnit;
+    o["globalUnitValue"] = config.globalUnit;
+    o["ledBrightness"] = config.ledBrightness;
+}
+
+static void configGeneralApply(ESP8266WebServer &srv, Config &cfg)
+{
     cfg.darkMode = srv.hasArg("darkMode");
-    Serial.print(F("  • darkMode: "));
-    Serial.println(cfg.darkMode ? "ON" : "OFF");
-    cfg.useGatewayOverride = srv.hasArg("useGatewayOverride");
-    Serial.print(F("  • useGatewayOverride: "));
-    Serial.println(cfg.useGatewayOverride ? "ON" : "OFF");
-    cfg.enableBackupNetwork = srv.hasArg("enableBackupNetwork");
-    Serial.print(F("  • enableBackupNetwork: "));
-    Serial.println(cfg.enableBackupNetwork ? "ON" : "OFF");
-
-    // Parsowanie trybu pracy
-    cfg.intermittentMode = (srv.arg("workMode") == "intermittent");
-    Serial.print(F("\n[PARSER] Tryb pracy (workMode): "));
-    Serial.println(cfg.intermittentMode ? "intermittent" : "normal");
-
-    // Parsowanie adresów IP i haseł
-    Serial.println(F("\n[PARSER] Adresy IP i hasła:"));
-    cfg.host1 = srv.arg("host1");
-    Serial.print(F("  • host1: "));
-    Serial.println(cfg.host1);
-    cfg.host2 = srv.arg("host2");
-    Serial.print(F("  • host2: "));
-    Serial.println(cfg.host2);
-    cfg.gatewayOverride = srv.arg("gatewayOverride");
-    Serial.print(F("  • gatewayOverride: "));
-    Serial.println(cfg.gatewayOverride);
-    cfg.adminUser = srv.arg("adminUser");
-    Serial.print(F("  • adminUser: "));
-    Serial.println(cfg.adminUser);
-    cfg.adminPass = srv.arg("adminPass");
-    Serial.print(F("  • adminPass: [***] (length: "));
-    Serial.print(cfg.adminPass.length());
-    Serial.println(")");
-
-    // Jednostka globalna (ms/s/min) używana do konwersji pól czasowych
-    String unitArg = srv.arg("globalUnitValue");
-    cfg.globalUnit = unitArg.length() ? unitArg.toInt() : 1000;
+    readArg(srv, "ledBrightness", cfg.ledBrightness, 0, 255);
+    // Jednostka globalna (ms/s/min) używana do wyświetlania pól czasowych
+    readArg(srv, "globalUnitValue", cfg.globalUnit);
     if (cfg.globalUnit != 1 && cfg.globalUnit != 1000 && cfg.globalUnit != 60000)
         cfg.globalUnit = 1000;
-    Serial.print(F("  • globalUnitValue: "));
-    Serial.println(cfg.globalUnit);
-
-    // Parsowanie sieci rezerwowej
-    cfg.backupNetworkFailLimit = constrain(srv.arg("backupNetworkFailLimit").toInt(), 1, 10);
-    cfg.backupNetworkRetryInterval = srv.arg("backupNetworkRetryInterval").toInt();
-    if (cfg.backupNetworkRetryInterval <= 0)
-        cfg.backupNetworkRetryInterval = 600000; // Default 10 min
-    cfg.pinRelayBackup = srv.arg("pinRelayBackup").toInt();
-    Serial.println(F("\n[PARSER] Sieć rezerwowa:"));
-    Serial.print(F("  • backupNetworkFailLimit: "));
-    Serial.println(cfg.backupNetworkFailLimit);
-    Serial.print(F("  • backupNetworkRetryInterval: "));
-    Serial.println(cfg.backupNetworkRetryInterval);
-    Serial.print(F("  • pinRelayBackup: "));
-    Serial.println(cfg.pinRelayBackup);
-
-    // Parsowanie zaplanowanych czasów resetów
-    Serial.println(F("\n[PARSER] Harmonogram resetów:"));
-    for (int i = 0; i < 5; i++)
-    {
-        String argName = "resetTime" + String(i);
-        if (srv.hasArg(argName))
-        {
-            String timeStr = srv.arg(argName);
-            // Walidacja formatu HH:MM
-            if (timeStr.length() == 5 && timeStr[2] == ':')
-            {
-                cfg.scheduledResetTimes[i] = timeStr;
-                Serial.print(F("  • resetTime["));
-                Serial.print(i);
-                Serial.print(F("]: "));
-                Serial.println(timeStr);
-            }
-            else
-            {
-                cfg.scheduledResetTimes[i] = "";
-                Serial.print(F("  • resetTime["));
-                Serial.print(i);
-                Serial.println(F("]: (pusty)"));
-            }
-        }
-        else
-        {
-            cfg.scheduledResetTimes[i] = "";
-            Serial.print(F("  • resetTime["));
-            Serial.print(i);
-            Serial.println(F("]: (brak w POST)"));
-        }
+}
+
+// --- 1. Monitoring ---
+static void configMonitorRead(JsonObject o)
+{
+    o["pingInterval"] = config.pingInterval;
+    o["failLimit"] = config.failLimit;
+    o["useGatewayOverride"] = config.useGatewayOverride;
+    o["gatewayOverride"] = config.gatewayOverride.length() > 0 ? config.gatewayOverride : WiFi.gatewayIP().toString();
+    o["host1"] = config.host1;
+    o["host2"] = config.host2;
+    o["detectedGateway"] = WiFi.gatewayIP().toString();
+}
+
+static void configMonitorApply(ESP8266WebServer &srv, Config &cfg)
+{
+    readArg(srv, "pingInterval", cfg.pingInterval);
+    readArg(srv, "failLimit", cfg.failLimit);
+    cfg.useGatewayOverride = srv.hasArg("useGatewayOverride");
+    readArgStr(srv, "gatewayOverride", cfg.gatewayOverride);
+    readArgStr(srv, "host1", cfg.host1);
+    readArgStr(srv, "host2", cfg.host2);
+}
+
+// --- 2. Reset routera (z modelem czasu rozruchu) ---
+static void configResetRead(JsonObject o)
+{
+    o["routerOffTime"] = config.routerOffTime;
+    o["baseBootTime"] = config.baseBootTime;
+    o["bootAutoTune"] = config.bootAutoTune;
+    o["bootTuneMarginSec"] = config.bootTuneMarginSec;
+    o["bootTuneMinSec"] = config.bootTuneMinSec;
+    o["bootTuneMaxSec"] = config.bootTuneMaxSec;
+
+    BootModelStats st;
+    bootModelStats(st);
+    JsonObject m = o["bootModel"].to<JsonObject>();
+    m["samples"] = st.samples;
+    m["timeouts"] = st.timeouts;
+    m["suggestedMs"] = st.suggestedBootMs;
+    m["currentMs"] = config.baseBootTime;
+    m["minSamples"] = BOOT_MODEL_MIN_SAMPLES;
+    JsonArray phases = m["phases"].to<JsonArray>();
+    for (uint8_t p = 0; p < BOOT_PHASE_COUNT; p++)
+    {
+        JsonObject ph = phases.add<JsonObject>();
+        ph["samples"] = st.phase[p].samples;
+        ph["p50Ms"] = st.phase[p].p50Ms;
+        ph["p95Ms"] = st.phase[p].p95Ms;
+        ph["maxMs"] = st.phase[p].maxMs;
+    }
+}
+
+static void configResetApply(ESP8266WebServer &srv, Config &cfg)
+{
+    readArg(srv, "routerOffTime", cfg.routerOffTime);
+    readArg(srv, "baseBootTime", cfg.baseBootTime);
+    cfg.bootAutoTune = srv.hasArg("bootAutoTune");
+    readArg(srv, "bootTuneMarginSec", cfg.bootTuneMarginSec, 0, 600);
+    readArg(srv, "bootTuneMinSec", cfg.bootTuneMinSec, 10, 1800);
+    readArg(srv, "bootTuneMaxSec", cfg.bootTuneMaxSec, cfg.bootTuneMinSec, 1800);
+}
+
+// --- Tryb bezpieczny (boot loop) ---
+static void configSafetyRead(JsonObject o)
+{
+    o["bootLoopWindowSeconds"] = config.bootLoopWindowSeconds;
+    o["safeModeActive"] = config.safeModeActive;
+}
+
+static void configSafetyApply(ESP8266WebServer &srv, Config &cfg)
+{
+    readArg(srv, "bootLoopWindowSeconds", cfg.bootLoopWindowSeconds);
+}
+
+// --- 3. AP / WiFi ---
+static void configApRead(JsonObject o)
+{
+    o["noWiFiTimeout"] = config.noWiFiTimeout;
+    o["apConfigTimeout"] = config.apConfigTimeout;
+    o["apMaxAttempts"] = config.apMaxAttempts;
+    o["apBackoffMs"] = config.apBackoffMs;
+    o["dhcpTimeoutMs"] = config.dhcpTimeoutMs;
+}
+
+static void configApApply(ESP8266WebServer &srv, Config &cfg)
+{
+    readArg(srv, "noWiFiTimeout", cfg.noWiFiTimeout);
+    readArg(srv, "apConfigTimeout", cfg.apConfigTimeout);
+    readArg(srv, "apMaxAttempts", cfg.apMaxAttempts);
+    readArg(srv, "apBackoffMs", cfg.apBackoffMs);
+    readArg(srv, "dhcpTimeoutMs", cfg.dhcpTimeoutMs);
+}
+
+// --- Awaria dostawcy ---
+static void configProviderRead(JsonObject o)
+{
+    o["providerFailureLimit"] = config.providerFailureLimit;
+    o["noWiFiBackoff"] = config.noWiFiBackoff;
+}
+
+static void configProviderApply(ESP8266WebServer &srv, Config &cfg)
+{
+    readArg(srv, "providerFailureLimit", cfg.providerFailureLimit);
+    cfg.noWiFiBackoff = srv.hasArg("noWiFiBackoff");
+}
+
+// --- 4. Lag / seria pingów ---
+static void configLagRead(JsonObject o)
+{
+    o["maxPingMs"] = config.maxPingMs;
+    o["lagRetries"] = config.lagRetries;
+    o["lagUseP95"] = config.lagUseP95;
+    o["burstCount"] = config.burstCount;
+    o["burstGapMs"] = config.burstGapMs;
+    o["lossFailPct"] = config.lossFailPct;
+    o["lossWarnPct"] = config.lossWarnPct;
+}
+
+static void configLagApply(ESP8266WebServer &srv, Config &cfg)
+{
+    readArg(srv, "maxPingMs", cfg.maxPingMs);
+    readArg(srv, "lagRetries", cfg.lagRetries);
+    cfg.lagUseP95 = srv.hasArg("lagUseP95");
+    readArg(srv, "burstCount", cfg.burstCount, 1, PROBE_MAX_COUNT);
+    readArg(srv, "burstGapMs", cfg.burstGapMs, 0, 5000);
+    readArg(srv, "lossFailPct", cfg.lossFailPct, 1, 100);
+    readArg(srv, "lossWarnPct", cfg.lossWarnPct, 0, 100);
+}
+
+// --- 5. Harmonogram ---
+static void configScheduleRead(JsonObject o)
+{
+    o["scheduledResetsEnabled"] = config.scheduledResetsEnabled;
+    char key[] = "resetTime0";
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        key[9] = '0' + i;
+        o[key] = config.scheduledResetTimes[i];
     }
+    o["autoResetCountersHours"] = config.autoResetCountersHours;
+}
+
+static void configScheduleApply(ESP8266WebServer &srv, Config &cfg)
+{
+    cfg.scheduledResetsEnabled = srv.hasArg("scheduledResetsEnabled");
+    char key[] = "resetTime0";
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        key[9] = '0' + i;
+        // Format HH:MM, wszystko inne = pozycja nieużywana
+        String timeStr = srv.arg(key);
+        cfg.scheduledResetTimes[i] = (timeStr.length() == 5 && timeStr[2] == ':') ? timeStr : String();
+    }
+    readArg(srv, "autoResetCountersHours", cfg.autoResetCountersHours);
+}
+
+// --- Watchdog i tryb pracy ---
+static void configWatchdogRead(JsonObject o)
+{
+    o["watchdogEnabled"] = config.watchdogEnabled;
+}
+
+static void configWatchdogApply(ESP8266WebServer &srv, Config &cfg)
+{
+    cfg.watchdogEnabled = srv.hasArg("watchdogEnabled");
+}
+
+static void configModeRead(JsonObject o)
+{
+    o["workMode"] = config.intermittentMode ? "intermittent" : "continuous";
+    o["awakeWindowMs"] = config.awakeWindowMs;
+    o["sleepWindowMs"] = config.sleepWindowMs;
+}
+
+static void configModeApply(ESP8266WebServer &srv, Config &cfg)
+{
+    if (srv.hasArg("workMode"))
+        cfg.intermittentMode = (srv.arg("workMode") == "intermittent");
+    readArg(srv, "awakeWindowMs", cfg.awakeWindowMs);
+    readArg(srv, "sleepWindowMs", cfg.sleepWindowMs);
+}
 
-    Serial.print("[WEBSERVER] Parsed config - ledBrightness=");
-    Serial.print(cfg.ledBrightness);
-    Serial.print(", darkMode=");
-    Serial.print(cfg.darkMode);
-    Serial.print(", pingInterval=");
-    Serial.println(cfg.pingInterval);
+// --- Sieć rezerwowa ---
+static void configBackupRead(JsonObject o)
+{
+    o["enableBackupNetwork"] = config.enableBackupNetwork;
+    o["backupNetworkFailLimit"] = config.backupNetworkFailLimit;
+    o["backupNetworkRetryInterval"] = config.backupNetworkRetryInterval;
+    o["pinRelayBackup"] = config.pinRelayBackup;
+}
 
-    Serial.println(F("\n[PARSER] ✅ Parsowanie zakończone - wszystkie pola odczytane"));
-    Serial.println(F("  Ilość parametrów: 33"));
+static void configBackupApply(ESP8266WebServer &srv, Config &cfg)
+{
+    cfg.enableBackupNetwork = srv.hasArg("enableBackupNetwork");
+    readArg(srv, "backupNetworkFailLimit", cfg.backupNetworkFailLimit, 1, 10);
+    readArg(srv, "backupNetworkRetryInterval", cfg.backupNetworkRetryInterval);
+    if (cfg.backupNetworkRetryInterval < 1000)
+        cfg.backupNetworkRetryInterval = 1000;
+    readArg(srv, "pinRelayBackup", cfg.pinRelayBackup, 0, 16);
+}
+
+// --- Zabezpieczenia ---
+static void configAdminRead(JsonObject o)
+{
+    o["adminUser"] = config.adminUser;
+    o["adminPass"] = config.adminPass;
+}
+
+static void configAdminApply(ESP8266WebServer &srv, Config &cfg)
+{
+    readArgStr(srv, "adminUser", cfg.adminUser);
+    readArgStr(srv, "adminPass", cfg.adminPass);
+}
 
-    // Walidacja wszystkich parametrów
-    String validationError = validateAllConfigParams(
+// --- Diagnostyka (tylko odczyt): liczniki resetów, diody, symulacje ---
+static void configDiagRead(JsonObject o)
+{
+    o["resetDefault"] = config.resetDefault;
+    o["resetWdt"] = config.resetWdt;
+    o["resetSoftWdt"] = config.resetSoftWdt;
+    o["resetException"] = config.resetException;
+    o["resetSoft"] = config.resetSoft;
+    o["resetDeepSleep"] = config.resetDeepSleep;
+    o["resetExt"] = config.resetExt;
+    o["routerResetCount"] = config.routerResetCount;
+    o["crashLogCount"] = crashLogCount();
+
+    const bool apMode = (WiFi.getMode() == WIFI_AP);
+    const bool ledRed = (!apMode && (failCount > 0 || WiFi.status() != WL_CONNECTED || simNoWiFi));
+    o["led"] = apMode ? "blue" : (ledRed ? "red" : "green");
+    o["apMode"] = apMode;
+
+    o["simActive"] = simPingFail || simNoWiFi || simHighPing;
+    if (simPingFail)
+        o["simLabel"] = "Awaria Ping (Aktywna)";
+    else if (simNoWiFi)
+        o["simLabel"] = "Brak WiFi (Aktywna)";
+    else if (simHighPing)
+        o["simLabel"] = "Wysoki Ping (Aktywna)";
+    else
+        o["simLabel"] = "Brak (Normalna praca)";
+    o["simStatus"] = simStatus;
+    o["appVersion"] = APP_VERSION;
+}
+
+struct ConfigSection
+{
+    const char *name;
+    void (*read)(JsonObject);
+    void (*apply)(ESP8266WebServer &, Config &); // nullptr = sekcja tylko do odczytu
+};
+
+static const ConfigSection CONFIG_SECTIONS[] = {
+    {"general", configGeneralRead, configGeneralApply},
+    {"monitor", configMonitorRead, configMonitorApply},
+    {"reset", configResetRead, configResetApply},
+    {"safety", configSafetyRead, configSafetyApply},
+    {"ap", configApRead, configApApply},
+    {"provider", configProviderRead, configProviderApply},
+    {"lag", configLagRead, configLagApply},
+    {"schedule", configScheduleRead, configScheduleApply},
+    {"watchdog", configWatchdogRead, configWatchdogApply},
+    {"mode", configModeRead, configModeApply},
+    {"backup", configBackupRead, configBackupApply},
+    {"admin", configAdminRead, configAdminApply},
+    {"diag", configDiagRead, nullptr},
+};
+
+static const ConfigSection *findConfigSection(const char *name)
+{
+    for (const ConfigSection &s : CONFIG_SECTIONS)
+    {
+        if (strcmp(name, s.name) == 0)
+            return &s;
+    }
+    return nullptr;
+}
+
+bool apiJsonConfig(JsonDocument &doc, const char *section)
+{
+    const ConfigSection *s = findConfigSection(section);
+    if (!s)
+        return false;
+    s->read(doc.to<JsonObject>());
+    return true;
+}
+
+/// Walidacja całej konfiguracji (po zmianie jednej sekcji - reguły obejmują kilka sekcji)
+/// Zwraca pusty String, jeśli konfiguracja jest poprawna
+static String validateConfig(const Config &cfg)
+{
+    return validateAllConfigParams(
         cfg.pingInterval, cfg.failLimit, cfg.providerFailureLimit,
         cfg.autoResetCountersHours, cfg.maxPingMs, cfg.lagRetries,
         cfg.bootLoopWindowSeconds, cfg.apMaxAttempts, cfg.routerOffTime,
@@ -218,177 +411,400 @@ bool parseAndValidateConfigParams(ESP8266WebServer &srv, Config &cfg)
         cfg.awakeWindowMs, cfg.sleepWindowMs, cfg.host1, cfg.host2,
         cfg.gatewayOverride, cfg.useGatewayOverride, cfg.adminUser,
         cfg.adminPass, cfg.maxTotalResetsEver);
+}
 
-    if (validationError.length() > 0)
+// Klasa limitu żądań trasy (rate_limit.h) - ustalana raz, przy rejestracji
+static uint8_t routeRateClass(const char *uri, HTTPMethod method)
+{
+    // Akcje z efektem ubocznym (dokładne URI, /test/* jako prefiks)
+    static const char *const ACTION_ROUTES[] = {"/reset", "/reboot", "/factoryreset", "/clearlogs",
+                                                "/clearresetcounters", "/manualconfig", "/crashlog/clear",
+                                                "/api/perf/reset"};
+
+    if (strncmp(uri, "/static/", 8) == 0)
+        return RATE_EXEMPT;
+    // Przerwanie resetu przywraca zasilanie routera - nie może czekać na limit akcji
+    if (strcmp(uri, "/reset/abort") == 0)
+        return RATE_EXEMPT;
+    if (strcmp(uri, "/login") == 0 && method == HTTP_POST)
+        return RATE_LOGIN;
+    // Limit OTA sprawdza handleUpdateUpload przed Update.begin() - po zapisie obrazu
+    // odrzucenie 429 pominęłoby restart, a nowy firmware czekałby na przypadkowy reboot
+    if (strcmp(uri, "/update") == 0 && method == HTTP_POST)
+        return RATE_EXEMPT;
+    if (strncmp(uri, "/test/", 6) == 0)
+        return RATE_ACTION;
+    for (const char *route : ACTION_ROUTES)
     {
-        sendErrorPage(srv, "❌ Błąd walidacji", validationError.c_str(), "/config",
-                      "Powrót do konfiguracji", cfg.darkMode);
-        return false;
+        if (strcmp(uri, route) == 0)
+            return RATE_ACTION;
     }
-
-    return true;
+    return RATE_PAGE;
 }
 
-void setupWebServer()
+// Odrzucenie przed handlerem - bez sprawdzania sesji, pomiaru sterty i generowania strony
+static bool rateCheck(uint8_t cls)
 {
-    server.on("/", handleRoot);
-    server.on("/login", HTTP_GET, handleLoginPage);
-    server.on("/login", HTTP_POST, handleLoginSubmit);
-    server.on("/reset", handleManualReset);
-    server.on("/reboot", handleReboot);
-    server.on("/config", handleConfig);
-    server.on("/wifi", handleWiFiPage);
-    server.on("/clearlogs", handleClearLogs);
-    server.on("/clearresetcounters", handleClearResetCounters);
-    server.on("/saveconfig", HTTP_POST, handleSaveConfig);
-    server.on("/addwifi", HTTP_POST, handleAddWiFi);
-    server.on("/listwifi", HTTP_GET, handleListWiFi);
-    server.on("/removewifi", HTTP_POST, handleRemoveWiFi);
-    server.on("/savebackup", HTTP_POST, handleSaveBackupConfig);
-    server.on("/manualconfig", handleManualConfig);
-    server.on("/logout", handleLogout);
-    server.on("/factoryreset", handleFactoryReset);
-    server.on("/update", HTTP_GET, handleUpdatePage);
-    server.on("/update", HTTP_POST, handleUpdateResult, handleUpdateUpload);
-    server.on("/test/pingfail", handleSimPingFail);
-    server.on("/test/nowifi", handleSimNoWiFi);
-    server.on("/test/highping", handleSimHighPing);
-    server.on("/test/stop", handleStopSim);
-    server.on("/setbrightness", handleSetBrightness);
-    server.on("/savebrightness", handleSaveBrightness);
-    server.on("/downloadlogs", handleDownloadLogs);
-    server.begin();
+    if (cls == RATE_EXEMPT)
+        return true;
+    uint32_t retryMs;
+    if (rateAllow(server.client().remoteIP(), cls, millis(), retryMs))
+        return true;
+
+    char retry[12];
+    snprintf(retry, sizeof(retry), "%lu", (unsigned long)((retryMs + 999) / 1000));
+    server.sendHeader("Retry-After", retry);
+    server.send(429, "text/plain", "");
+    return false;
 }
 
-void handleRoot()
+// Rejestracja trasy z pomiarem sterty (miejsce pomiaru = URI, wszystkie metody razem).
+// Lambda przechwytuje tylko wskaźnik i indeksy - mieści się w std::function bez alokacji.
+static void onRoute(const Uri &uri, const char *siteName, HTTPMethod method, void (*fn)(), void (*upload)() = nullptr)
 {
-    sendHtmlHeader(server, "Strażnik Internetu", config.darkMode);
-
-    String html = F("</head><body");
-    html += F(" onload=\"initTheme()\"");
-    html += F("><div class='container'>");
-    html.reserve(2048);
+    int8_t site = heapRegister(siteName);
+    uint8_t rateClass = routeRateClass(siteName, method);
+    auto handler = [site, rateClass, fn]()
+    {
+        if (!rateCheck(rateClass))
+            return;
+        HeapScope scope(site);
+        server.client().setTimeout(HTTP_CLIENT_TIMEOUT_MS);
+        fn();
+    };
+    if (upload)
+        server.on(uri, method, handler, upload);
+    else
+        server.on(uri, method, handler);
+}
 
-    // Przełącznik trybu ciemnego
-    html += F("<div style='display:flex; justify-content:flex-end; align-items:center; gap:20px;'>");
-    html += F("<div class='switch-wrap'><span>Tryb ciemny</span><label class='switch'><input type='checkbox' id='themeSwitch' onchange='toggleTheme(this.checked)'");
-    if (config.darkMode)
-        html += F(" checked");
-    html += F("><span class='slider'></span></label></div></div>");
+static void onRoute(const char *uri, HTTPMethod method, void (*fn)(), void (*upload)() = nullptr)
+{
+    onRoute(Uri(uri), uri, method, fn, upload);
+}
 
-    html += F("<h1>Strażnik Internetu</h1>");
+void setupWebServer()
+{
+    onRoute("/", HTTP_ANY, handleRoot);
+    onRoute("/static/app.css", HTTP_GET, handleStaticCss);
+    onRoute("/static/app.js", HTTP_GET, handleStaticJs);
+    onRoute("/static/icon.svg", HTTP_GET, handleStaticIcon);
+    onRoute("/static/dashboard.js", HTTP_GET, handleStaticDashboardJs);
+    onRoute("/api/status", HTTP_GET, handleApiStatus);
+    onRoute("/api/events", HTTP_GET, handleApiEvents);
+    onRoute("/login", HTTP_GET, handleLoginPage);
+    onRoute("/login", HTTP_POST, handleLoginSubmit);
+    onRoute("/reset", HTTP_ANY, handleManualReset);
+    onRoute("/reset/abort", HTTP_ANY, handleResetAbort);
+    onRoute("/reboot", HTTP_ANY, handleReboot);
+    onRoute("/config", HTTP_ANY, handleConfig);
+    onRoute("/static/config.js", HTTP_GET, handleStaticConfigJs);
+    onRoute(UriBraces("/api/config/{}"), "/api/config", HTTP_ANY, handleApiConfig);
+    onRoute("/wifi", HTTP_ANY, handleWiFiPage);
+    onRoute("/clearlogs", HTTP_ANY, handleClearLogs);
+    onRoute("/clearresetcounters", HTTP_ANY, handleClearResetCounters);
+    onRoute("/addwifi", HTTP_POST, handleAddWiFi);
+    onRoute("/listwifi", HTTP_GET, handleListWiFi);
+    onRoute("/removewifi", HTTP_POST, handleRemoveWiFi);
+    onRoute("/manualconfig", HTTP_ANY, handleManualConfig);
+    onRoute("/logout", HTTP_ANY, handleLogout);
+    onRoute("/factoryreset", HTTP_ANY, handleFactoryReset);
+    onRoute("/update", HTTP_GET, handleUpdatePage);
+    onRoute("/update", HTTP_POST, handleUpdateResult, handleUpdateUpload);
+    onRoute("/test/pingfail", HTTP_ANY, handleSimPingFail);
+    onRoute("/test/nowifi", HTTP_ANY, handleSimNoWiFi);
+    onRoute("/test/highping", HTTP_ANY, handleSimHighPing);
+    onRoute("/test/stop", HTTP_ANY, handleStopSim);
+    onRoute("/setbrightness", HTTP_ANY, handleSetBrightness);
+    onRoute("/savebrightness", HTTP_ANY, handleSaveBrightness);
+    onRoute("/downloadlogs", HTTP_ANY, handleDownloadLogs);
+    onRoute("/api/rtt", HTTP_GET, handleApiRtt);
+    onRoute("/api/history", HTTP_GET, handleApiHistory);
+    onRoute("/api/incidents", HTTP_GET, handleApiIncidents);
+    onRoute("/api/perf", HTTP_GET, handleApiPerf);
+    onRoute("/api/perf/reset", HTTP_POST, handleApiPerfReset);
+    onRoute("/perf", HTTP_GET, handlePerfPage);
+    onRoute("/api/heap", HTTP_GET, handleApiHeap);
+    onRoute("/crashlog", HTTP_GET, handleCrashLogPage);
+    onRoute("/crashlog/clear", HTTP_POST, handleCrashLogClear);
+    server.begin();
 
-    // Sekcja Statusu
-    html += F("<div class='section'><h2>Status</h2>");
+    // Krótsza kolejka oczekujących połączeń niż domyślne 5 - przy jednym
+    // obsługiwanym naraz dłuższa i tak przekroczyłaby czas w przeglądarce,
+    // a każde czekające połączenie trzyma gniazdo lwIP i bufory
+    server.getServer().close();
+    server.getServer().begin(HTTP_SYNC_PORT, HTTP_LISTEN_BACKLOG);
+    server.getServer().setNoDelay(true);
 
-    if (failCount == 0)
+#if HTTP_ASYNC_ENABLED
+    asyncHttpBegin(); // Port 80: strona główna i API do odczytu, reszta przekierowana tutaj
+    if (!asyncHttpListening())
     {
-        html += F("<div class='alert alert-ok'><b>INTERNET DOSTĘPNY</b></div>");
+        // Bez nasłuchu na porcie 80 urządzenie wyglądałoby na martwe pod zwykłym adresem -
+        // wszystkie trasy przejmuje ESP8266WebServer na HTTP_PORT
+        server.getServer().close();
+        server.getServer().begin(HTTP_PORT, HTTP_LISTEN_BACKLOG);
+        logEvent("HTTP: serwer asynchroniczny niedostepny - wszystko na porcie " + String(HTTP_PORT));
     }
+#endif
+}
+
+// Czas trwania w czytelnej postaci (np. "2d 3h", "1h 05m", "42s")
+static String formatDurationSec(uint32_t sec)
+{
+    char buf[16];
+    if (sec >= 86400UL)
+        snprintf(buf, sizeof(buf), "%lud %luh", (unsigned long)(sec / 86400UL), (unsigned long)(sec % 86400UL / 3600UL));
+    else if (sec >= 3600UL)
+        snprintf(buf, sizeof(buf), "%luh %02lum", (unsigned long)(sec / 3600UL), (unsigned long)(sec % 3600UL / 60UL));
+    else if (sec >= 60UL)
+        snprintf(buf, sizeof(buf), "%lum %02lus", (unsigned long)(sec / 60UL), (unsigned long)(sec % 60UL));
     else
+        snprintf(buf, sizeof(buf), "%lus", (unsigned long)sec);
+    return String(buf);
+}
+
+// Strona główna jest statyczna (web/index.html) - dane pobiera sama z /api/status
+void handleRoot()
+{
+#if HTTP_ASYNC_ENABLED
+    // Strona główna i jej API działają na porcie 80 (async_http.h) - tam wraca np. po zalogowaniu
+    if (asyncHttpListening())
     {
-        html += F("<div class='alert alert-bad'><b>PROBLEMY Z SIECIĄ (");
-        html += failCount;
-        html += F("/");
-        html += config.failLimit;
-        html += F(")</b></div>");
-    }
-
-    html += F("<p>Ostatni Ping: <b>");
-    html += lastPingMs;
-    html += F(" ms</b></p>");
-    html += F("<p>Liczba resetów routera: <b>");
-    html += totalResets;
-    html += F("</b></p>");
-    html += F("<p>Komunikat: <span class='status-msg'>");
-    html += statusMsg;
-    html += F("</span></p>");
-    html += F("<p>Czas pracy (Uptime): <b>");
-    html += (millis() / 1000 / 60);
-    html += F(" min</b></p>");
-
-    // Status Sieci Rezerwowej (Backup Network) - v1.1.2+
-    if (config.enableBackupNetwork)
+        String host = server.hostHeader();
+        int colon = host.indexOf(':');
+        if (colon >= 0)
+            host.remove(colon);
+        if (host.length() == 0)
+            host = server.client().localIP().toString();
+        server.sendHeader("Location", "http://" + host + "/");
+        server.send(307);
+        return;
+    }
+#endif
+    sendStaticAsset(STATIC_INDEX_HTML_GZ, STATIC_INDEX_HTML_GZ_LEN, "text/html; charset=utf-8", STATIC_INDEX_HTML_VER, false);
+}
+
+// Ostatnie wpisy logu zdarzeń (od najstarszego). Czytany jest tylko koniec pliku.
+static uint8_t readRecentEvents(String *lines, uint8_t max)
+{
+    File f = LittleFS.open(LOG_FILE, "r");
+    if (!f)
+        return 0;
+    if (f.size() > STATUS_EVENTS_TAIL_BYTES)
     {
-        html += F("<p>Sieć rezerwowa: <b style='");
-        if (config.backupNetworkActive)
-            html += "color:#ff9800;"; // Pomarańczowy = rezerwowa
-        else
-            html += "color:#4caf50;"; // Zielony = główna
-        html += F("'>");
-        html += (config.backupNetworkActive ? "AKTYWNA (Backup)" : "Wyłączona (Główna)");
-        html += F("</b></p>");
+        f.seek(f.size() - STATUS_EVENTS_TAIL_BYTES, SeekSet);
+        f.readStringUntil('\n'); // Pomiń niepełną pierwszą linię
+    }
 
-        if (config.backupNetworkActive)
+    uint8_t count = 0;
+    while (f.available())
+    {
+        String line = f.readStringUntil('\n');
+        if (line.length() == 0)
+            continue;
+        if (count == max)
         {
-            html += F("<p>Błędy backupu: <b>");
-            html += config.backupNetworkFailCount;
-            html += F("/");
-            html += config.backupNetworkFailLimit;
-            html += F("</b></p>");
+            // Przesuń okno o jeden wpis (max jest mały)
+            for (uint8_t i = 1; i < max; i++)
+                lines[i - 1] = lines[i];
+            count--;
         }
+        lines[count++] = line;
     }
+    f.close();
+    return count;
+}
 
-    html += F("</div>"); // Koniec sekcji Status
+// --- STAN DLA STRONY GŁÓWNEJ (JSON) ---
+// Migawka wspólna dla /api/status i zdarzenia "status" w /api/events
+static void buildStatus(JsonDocument &doc)
+{
+    doc["failCount"] = failCount;
+    doc["failLimit"] = config.failLimit;
+    doc["lastPingMs"] = lastPingMs;
+    doc["ewmaMs"] = rttStatsEwma();
+    doc["jitterMs"] = rttStatsJitter();
+    doc["totalResets"] = totalResets;
+    doc["msg"] = statusMsg;
+    doc["uptimeSec"] = millis() / 1000;
+    doc["backoffSec"] = resetBackoffRemainingMs() / 1000;
+
+    if (config.burstCount > 1 && probeResult().sent > 0)
+    {
+        const ProbeResult &r = probeResult();
+        JsonObject burst = doc["burst"].to<JsonObject>();
+        burst["sent"] = r.sent;
+        burst["lost"] = r.sent - r.received;
+        burst["lossPct"] = r.lossPct;
+    }
 
-    // Sekcja Zdarzeń
-    html += F("<div class='section'><h2>Ostatnie zdarzenia</h2>");
-    html += F("<div style='background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:5px; max-height:200px; overflow-y:auto; font-family:monospace; font-size:0.9em;'>");
-    File logFile = LittleFS.open(LOG_FILE, "r");
-    if (logFile)
+    if (config.enableBackupNetwork)
     {
-        // Przechowuj tylko ostatnie 8 wpisów w buforze pierścieniowym (mniej Stringów = mniej RAM)
-        const int maxShow = 8;
-        String last[maxShow];
-        int count = 0;
-        while (logFile.available())
-        {
-            String line = logFile.readStringUntil('\n');
-            if (line.length() == 0)
-                continue;
-            last[count % maxShow] = line;
-            count++;
-        }
-        logFile.close();
+        JsonObject backup = doc["backup"].to<JsonObject>();
+        backup["active"] = config.backupNetworkActive;
+        backup["failCount"] = config.backupNetworkFailCount;
+        backup["failLimit"] = config.backupNetworkFailLimit;
+    }
 
-        int toShow = (count < maxShow) ? count : maxShow;
-        int start = (count >= maxShow) ? (count % maxShow) : 0;
-        for (int i = 0; i < toShow; i++)
-        {
-            String line = last[(start + i) % maxShow];
-            String lower = line;
-            lower.toLowerCase();
-            String style = "padding: 2px; border-bottom: 1px solid #eee;";
-            if (lower.indexOf("blad") >= 0 || lower.indexOf("reset") >= 0 || lower.indexOf("brak") >= 0 || lower.indexOf("ota") >= 0)
-            {
-                style += "color:#dc3545; font-weight:bold;";
-            }
-            html += "<div style='" + style + "'>" + line + "</div>";
-        }
+    RouterBootTiming boot;
+    if (routerCycleBusy())
+    {
+        const RouterBootTiming &bt = routerCycleCurrentTiming();
+        JsonObject router = doc["router"].to<JsonObject>();
+        router["state"] = routerCycleStateName(routerCycleState());
+        router["remainingSec"] = routerCycleRemainingMs() / 1000;
+        router["progressPct"] = routerCycleProgressPct();
+        router["waitBoot"] = (routerCycleState() == RC_WAIT_BOOT);
+        router["wifiSec"] = bt.wifiMs / 1000;
+        router["gatewaySec"] = bt.gatewayMs / 1000;
     }
-    else
+    else if (routerCycleLastTiming(boot))
     {
-        html += F("Brak logów.");
+        JsonObject last = doc["lastBoot"].to<JsonObject>();
+        last["confirmed"] = boot.confirmed;
+        last["internetSec"] = boot.internetMs / 1000;
+        last["wifiSec"] = boot.wifiMs / 1000;
+        last["gatewaySec"] = boot.gatewayMs / 1000;
+        last["limitSec"] = config.baseBootTime / 1000;
     }
-    html += F("</div>");
-    html += F("</div>"); // Koniec sekcji Zdarzenia
 
-    // Sekcja Akcji
-    html += F("<div class='section'><h2>Akcje</h2>");
-    html += F("<div style='display:flex; justify-content:center; gap:12px;'>");
-    html += F("<a href='/config'><button>Konfiguracja</button></a>");
-    html += F("<a href='/'><button class='btn-grey'>Odśwież</button></a>");
-    html += F("</div></div>");
+    JsonArray rtt = doc["rtt"].to<JsonArray>();
+    for (int w = 0; w < RTT_WIN_COUNT; w++)
+    {
+        RttWindowSummary s;
+        rttStatsSummary((RttWindow)w, s);
+        uint32_t probes = s.samples + s.lost;
+        JsonObject win = rtt.add<JsonObject>();
+        win["win"] = rttWindowName((RttWindow)w);
+        win["samples"] = s.samples;
+        win["lost"] = s.lost;
+        win["lossPct"] = probes ? (100.0f * s.lost / probes) : 0.0f;
+        win["p50"] = s.p50;
+        win["p95"] = s.p95;
+        win["p99"] = s.p99;
+        win["maxMs"] = s.maxMs;
+    }
 
-    // Stopka z wersją oprogramowania (kontener jak w konfiguracji)
-    html += F("<div class='section' style='text-align:center; border-top:1px solid var(--brd); padding-top:16px; color:#777; font-size:0.9em;'>Wersja oprogramowania: <b>");
-    html += APP_VERSION;
-    html += F("</b></div>");
+    IncidentSummary inc;
+    incidentsSummary(inc);
+    JsonObject incidents = doc["incidents"].to<JsonObject>();
+    incidents["availabilityPct"] = inc.availabilityPct;
+    incidents["count"] = inc.incidents;
+    incidents["mttrSec"] = inc.mttrSec;
+    incidents["mtbfSec"] = inc.mtbfSec;
+    incidents["observedSec"] = inc.observedSec;
+    incidents["resets"] = inc.resets;
+    incidents["resetsFixed"] = inc.resetsFixed;
+    JsonArray causes = incidents["causes"].to<JsonArray>();
+    for (uint8_t c = 0; c < INC_CAUSE_COUNT; c++)
+    {
+        if (inc.causeCount[c] == 0)
+            continue;
+        JsonObject cause = causes.add<JsonObject>();
+        cause["name"] = incidentCauseName(c);
+        cause["count"] = inc.causeCount[c];
+        cause["downSec"] = inc.causeDowntimeSec[c];
+    }
+    IncidentRecord openInc;
+    if (incidentIsOpen(&openInc))
+    {
+        JsonObject open = incidents["open"].to<JsonObject>();
+        open["cause"] = incidentCauseName(openInc.cause);
+        open["durationSec"] = openInc.durationSec;
+        open["resets"] = openInc.resets;
+    }
 
-    html += F("</div></body></html>");
+    doc["eventSeq"] = logEventSeq;
+    doc["darkMode"] = config.darkMode;
+    doc["perf"] = (bool)PERF_ENABLED;
+    doc["version"] = APP_VERSION;
+}
 
-    server.sendContent(html);
-    server.sendContent(""); // Koniec transmisji
+// Odpowiedź API bez buforowania w przeglądarce, serializowana prosto w segmenty TCP
+static void sendApiJson(JsonDocument &doc)
+{
+    server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    ResponseWriter out(server);
+    out.begin(200, "application/json");
+    serializeJson(doc, out);
+    out.end();
+}
+
+void apiJsonStatus(JsonDocument &doc, bool withEvents)
+{
+    PERF_SCOPE("http.status");
+    buildStatus(doc);
+    if (!withEvents)
+        return;
+    String lines[STATUS_EVENTS_MAX];
+    uint8_t n = readRecentEvents(lines, STATUS_EVENTS_MAX);
+    JsonArray events = doc["events"].to<JsonArray>();
+    for (uint8_t i = 0; i < n; i++)
+        events.add(lines[i]);
+}
+
+// Kilkaset bajtów zamiast pełnej strony HTML przy każdym odświeżeniu. Lista
+// zdarzeń tylko, gdy klient ma inną jej wersję (?ev=<eventSeq>).
+void handleApiStatus()
+{
+    JsonDocument doc;
+    apiJsonStatus(doc, !server.hasArg("ev") || server.arg("ev").toInt() != (long)logEventSeq);
+    sendApiJson(doc);
+}
+
+// --- POWIADOMIENIA NA ŻYWO (SSE) ---
+// Połączenie zostaje otwarte po powrocie z handlera (kopia klienta w sse.cpp)
+void handleApiEvents()
+{
+    WiFiClient client = server.client();
+    if (!sseAccept(client))
+    {
+        server.sendHeader("Retry-After", "30");
+        server.send(503, "text/plain", "Limit połączeń na żywo - strona przejdzie na odpytywanie");
+        return;
+    }
+    sseMarkDirty(); // Nowy subskrybent dostaje stan od razu
+}
+
+void webLiveLoop()
+{
+    sseLoop();
+    if (sseClientCount() == 0)
+        return;
+
+    // Postęp resetu routera zmienia się bez zdarzeń - publikuj przy każdej zmianie procentu
+    static int8_t lastProgress = -1;
+    int8_t progress = routerCycleBusy() ? routerCycleProgressPct() : -1;
+    if (progress != lastProgress)
+    {
+        lastProgress = progress;
+        sseMarkDirty();
+    }
+
+    if (!sseSnapshotDue())
+        return;
+    PERF_SCOPE("sse.status");
+    JsonDocument doc;
+    buildStatus(doc);
+    ssePublishSnapshot(doc); // Całość tylko dla nowych subskrybentów, reszta dostaje zmiany
+}
+
+// Zakończenie ręcznego resetu (wywoływane przez router_cycle)
+static void onManualResetDone(RouterCycleKind kind, bool completed)
+{
+    (void)kind;
+    // Odblokuj watchdog jak tylko WiFi wróci lub timeout
+    routerResetInProgress = false;
+    failCount = 0;       // Wyzeruj licznik błędów
+    noWiFiStartTime = 0; // Wyzeruj licznik braku WiFi
+
+    if (!completed)
+        routerBootStartTime = millis(); // Router dopiero startuje - niech watchdog odczeka grace period
+    else if (WiFi.status() == WL_CONNECTED)
+        logEvent("Router powrócił do sieci WiFi");
+    else
+        logEvent("RECZNY RESET ROUTERA zakonczony - router restartuje");
 }
 
 void handleManualReset()
@@ -397,6 +813,12 @@ void handleManualReset()
     {
         return;
     }
+    if (routerCycleBusy())
+    {
+        server.sendHeader("Location", "/", true);
+        server.send(303, "text/plain", "");
+        return;
+    }
     Serial.println("RĘCZNY RESET ROUTERA!");
     logEvent("RECZNY RESET ROUTERA");
 
@@ -411,45 +833,21 @@ void handleManualReset()
         logEvent("BLAD ZAPISU CONFIG PO RECZNYM RESECIE");
     }
 
-    // Oblicz całkowity czas resetu (wyłączenie + rozruch)
-    int totalTime = (config.routerOffTime + config.baseBootTime) / 1000;
-    String message = "Router jest resetowany. Wyłączenie na " + String(config.routerOffTime / 1000) + "s + rozruch " + String(config.baseBootTime / 1000) + "s.";
-
-    // Wyświetl stronę z odliczaniem
-    sendCountdownPage(server, "🔌 Reset routera",
-                      message.c_str(),
-                      totalTime, "/", config.darkMode);
-
-    delay(500);
-    digitalWrite(config.pinRelay, HIGH);
-    safeDelay(config.routerOffTime); // Karmi WDT zamiast blokować
-    digitalWrite(config.pinRelay, LOW);
-    logEvent("RECZNY RESET ROUTERA zakonczony - router restartuje");
-
-    // Czekaj na powrót WiFi lub timeout boot'u
-    unsigned long resetStartTime = millis();
-    bool wifiResumed = false;
-    while (millis() - resetStartTime < (unsigned long)config.baseBootTime)
-    {
-        delay(100);
-        // Sprawdzaj czy WiFi wróciło online
-        if (WiFi.status() == WL_CONNECTED)
-        {
-            wifiResumed = true;
-            delay(1000); // Czekaj jeszcze 1s na stabilizację
-            break;
-        }
-    }
-
-    // Odblokuj watchdog jak tylko WiFi wróci lub timeout
-    routerResetInProgress = false;
-    failCount = 0;       // Wyzeruj licznik błędów
-    noWiFiStartTime = 0; // Wyzeruj licznik braku WiFi
+    // Cykl zasilania w tle - postęp i przycisk przerwania na stronie głównej
+    routerCycleStart(RC_KIND_MANUAL, onManualResetDone);
+    server.sendHeader("Location", "/", true);
+    server.send(303, "text/plain", "");
+}
 
-    if (wifiResumed)
-    {
-        logEvent("Router powrócił do sieci WiFi");
-    }
+// Przerwanie trwającego resetu routera - zasilanie wraca od razu
+void handleResetAbort()
+{
+    if (!checkAuth())
+        return;
+    if (routerCycleAbort())
+        logEvent("Reset routera przerwany z WWW");
+    server.sendHeader("Location", "/", true);
+    server.send(303, "text/plain", "");
 }
 
 void handleClearLogs()
@@ -459,6 +857,7 @@ void handleClearLogs()
     File file = LittleFS.open(LOG_FILE, "w");
     if (file)
         file.close(); // Otwarcie w trybie "w" czyści plik
+    logEventSeq++;    // Strona główna pobierze pustą listę
     redirectTo(server, "/");
 }
 
@@ -508,24 +907,28 @@ void handleDownloadLogs()
     server.setContentLength(file.size());
     server.send(200);
 
+    // Plik kopiowany blokami przez bufor - pełne segmenty zamiast porcji na linię
+    ResponseWriter out(server);
+    uint8_t chunk[128];
     while (file.available())
     {
-        String line = file.readStringUntil('\n');
-        server.sendContent(line + "\n");
+        size_t n = file.read(chunk, sizeof(chunk));
+        if (n == 0)
+            break;
+        out.write(chunk, n);
     }
     file.close();
-    server.sendContent("");
+    out.end();
 }
 
 void handleLogout()
 {
     DIAG_PRINTLN(F("\n========== handleLogout START =========="));
-    DIAG_PRINT(F("[LOGOUT] Session Active BEFORE logout: "));
-    DIAG_PRINTLN(isSessionActive ? "TRUE" : "FALSE");
 
-    isSessionActive = false;
-    lastSessionActivity = 0;
-    sessionToken = "";
+    // Tylko sesja tej przeglądarki - inne zalogowane zostają
+    char token[SESSION_TOKEN_LENGTH + 1];
+    if (requestSessionToken(token, sizeof(token)))
+        sessionEnd(token);
 
     DIAG_PRINTLN(F("[LOGOUT] Session destroyed on server"));
 
@@ -597,988 +1000,74 @@ void handleStopSim()
 }
 
 // --- STRONA KONFIGURACYJNA ---
+// Statyczna powłoka (web/config.html) - wartości pobiera sama z /api/config/<sekcja>.
+// ETag zależy tylko od treści pliku: powłoka nie zawiera ustawień, więc zmiana
+// konfiguracji (także jasność z /setbrightness) nie wymaga unieważniania strony,
+// a świeże wartości dają odpowiedzi API wysyłane jako no-store.
 void handleConfig()
 {
-    Serial.println(F("\n┌────────────────────────────────────────┐"));
-    Serial.println(F("│ [DISPLAY] GENERUJĘ HTML FORMULARZA     │"));
-    Serial.println(F("└────────────────────────────────────────┘"));
-
-    Serial.println(F("\n[DISPLAY] Wartości do wyświetlenia:"));
-    Serial.print(F("  • config.pingInterval: "));
-    Serial.println(config.pingInterval);
-    Serial.print(F("  • config.failLimit: "));
-    Serial.println(config.failLimit);
-    Serial.print(F("  • config.providerFailureLimit: "));
-    Serial.println(config.providerFailureLimit);
-    Serial.print(F("  • config.autoResetCountersHours: "));
-    Serial.println(config.autoResetCountersHours);
-    Serial.print(F("  • config.maxPingMs: "));
-    Serial.println(config.maxPingMs);
-    Serial.print(F("  • config.lagRetries: "));
-    Serial.println(config.lagRetries);
-    Serial.print(F("  • config.routerOffTime: "));
-    Serial.println(config.routerOffTime);
-    Serial.print(F("  • config.baseBootTime: "));
-    Serial.println(config.baseBootTime);
-    Serial.print(F("  • config.apMaxAttempts: "));
-    Serial.println(config.apMaxAttempts);
-    Serial.print(F("  • config.sleepWindowMs: "));
-    Serial.println(config.sleepWindowMs);
-    Serial.print(F("  • config.awakeWindowMs: "));
-    Serial.println(config.awakeWindowMs);
-    Serial.print(F("  • config.darkMode: "));
-    Serial.println(config.darkMode ? "ON" : "OFF");
-    Serial.print(F("  • config.ledBrightness: "));
-    Serial.println(config.ledBrightness);
-    Serial.print(F("  • config.host1: "));
-    Serial.println(config.host1);
-    Serial.print(F("  • config.host2: "));
-    Serial.println(config.host2);
-    Serial.print(F("  • config.gatewayOverride: "));
-    Serial.println(config.gatewayOverride);
-    Serial.print(F("  • config.useGatewayOverride: "));
-    Serial.println(config.useGatewayOverride ? "ON" : "OFF");
-    Serial.print(F("  • config.intermittentMode: "));
-    Serial.println(config.intermittentMode ? "ON" : "OFF");
-    Serial.print(F("  • config.watchdogEnabled: "));
-    Serial.println(config.watchdogEnabled ? "ON" : "OFF");
-    Serial.print(F("  • config.noWiFiBackoff: "));
-    Serial.println(config.noWiFiBackoff ? "ON" : "OFF");
-    Serial.print(F("  • config.bootLoopWindowSeconds: "));
-    Serial.println(config.bootLoopWindowSeconds);
-    Serial.print(F("  • config.adminUser: "));
-    Serial.println(config.adminUser);
-    Serial.println(F("\n[DISPLAY] Harmonogram resetów:"));
-    Serial.print(F("  • config.scheduledResetsEnabled: "));
-    Serial.println(config.scheduledResetsEnabled ? "ON" : "OFF");
-    for (int i = 0; i < 5; i++)
-    {
-        Serial.print(F("  • config.scheduledResetTimes["));
-        Serial.print(i);
-        Serial.print(F("]: "));
-        Serial.println(config.scheduledResetTimes[i].length() > 0 ? config.scheduledResetTimes[i] : "(pusty)");
-    }
-
-    DIAG_PRINTLN(F("\n========== handleConfig START =========="));
-    DIAG_PRINT(F("[CONFIG] Client IP: "));
-    DIAG_PRINTLN(server.client().remoteIP().toString());
-    DIAG_PRINT(F("[CONFIG] Session Active BEFORE checkAuth: "));
-    DIAG_PRINTLN(isSessionActive ? "TRUE" : "FALSE");
-
     if (!checkAuth())
-    {
-        DIAG_PRINTLN(F("[CONFIG] checkAuth returned FALSE - access DENIED"));
-        DIAG_PRINTLN(F("========== handleConfig END (denied) ==========\n"));
         return;
-    }
-
-    DIAG_PRINTLN(F("[CONFIG] checkAuth returned TRUE - access GRANTED"));
-    DIAG_PRINT(F("[CONFIG] Session Active AFTER checkAuth: "));
-    DIAG_PRINTLN(isSessionActive ? "TRUE" : "FALSE");
-    DIAG_PRINTLN(F("[CONFIG] Generating configuration page..."));
-
-    Serial.print("[WEBSERVER] handleConfig: Current config values - ledBrightness=");
-    Serial.print(config.ledBrightness);
-    Serial.print(", darkMode=");
-    Serial.print(config.darkMode);
-    Serial.print(", pingInterval=");
-    Serial.println(config.pingInterval);
-
-    // Rozpocznij wysyłanie strumieniowe z zunifikowanym nagłówkiem
-    sendHtmlHeader(server, "Konfiguracja - Strażnik Internetu", config.darkMode);
-
-    // Rozpocznij body
-    String html = F(R"rawliteral(
-</head>
-<body>
-    <div class="container">
-        <h1>Konfiguracja Strażnika Internetu</h1>
-        <form id="configForm" action="/saveconfig" method="POST">
-        <div style="display:flex; justify-content:flex-end; margin-bottom:15px;">
-            <div class="switch-wrap" style="flex-direction:column; align-items:flex-end; gap:6px;">
-                <div style="display:flex; align-items:center; gap:10px;">
-                    <span>Tryb ciemny</span>
-                    <label class="switch">
-                        <input type="checkbox" id="themeSwitch" name="darkMode" onchange="toggleTheme(this.checked)")rawliteral");
-    if (config.darkMode)
-        html += F(R"rawliteral( checked)rawliteral");
-    html += F(R"rawliteral(>
-                        <span class="slider"></span>
-                    </label>
-                </div>
-                <label style="font-size:0.95em;">Jednostki globalne: <select id="globalUnit" name="globalUnit" onchange="setGlobalUnit(this.value)" style="margin-left:5px; padding:4px;">
-                    <option value="1" )rawliteral");
-    html += (config.globalUnit == 1) ? "selected" : "";
-    html += F(R"rawliteral(>ms</option>
-                    <option value="1000" )rawliteral");
-    html += (config.globalUnit == 1000) ? "selected" : "";
-    html += F(R"rawliteral(>s</option>
-                    <option value="60000" )rawliteral");
-    html += (config.globalUnit == 60000) ? "selected" : "";
-    html += F(R"rawliteral(>min</option>
-                </select></label>
-                <input type="hidden" id="globalUnitValue" name="globalUnitValue" value=")rawliteral");
-    html += config.globalUnit;
-    html += F(R"rawliteral(">
-            </div>
-        </div>
-
-        <div class="section">
-            <h2>Diagnostyka resetów</h2>
-            <div style="display:grid; grid-template-columns: repeat(auto-fit, minmax(180px, 1fr)); gap:8px;">
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Włączenie zasilania: <b>)rawliteral");
-    html += config.resetDefault;
-    html += F(R"rawliteral(</b></div>
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Watchdog sprzętowy: <b>)rawliteral");
-    html += config.resetWdt;
-    html += F(R"rawliteral(</b></div>
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Watchdog programowy: <b>)rawliteral");
-    html += config.resetSoftWdt;
-    html += F(R"rawliteral(</b></div>
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Wyjątek/Crash: <b>)rawliteral");
-    html += config.resetException;
-    html += F(R"rawliteral(</b></div>
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Soft restart: <b>)rawliteral");
-    html += config.resetSoft;
-    html += F(R"rawliteral(</b></div>
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Wybudzenie z deep sleep: <b>)rawliteral");
-    html += config.resetDeepSleep;
-    html += F(R"rawliteral(</b></div>
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Reset zewnętrzny: <b>)rawliteral");
-    html += config.resetExt;
-    html += F(R"rawliteral(</b></div>
-                <div style="background:var(--inp); padding:10px; border:1px solid var(--brd); border-radius:6px;">Resety routera (łącznie): <b>)rawliteral");
-    html += config.routerResetCount;
-    html += F(R"rawliteral(</b></div>
-            </div>
-            <p style="font-size:0.85em; color:#666; margin-top:6px;">Liczby zapisywane w config.json na każdym starcie – pomagają wykryć WDT/exception vs. normalne resety. <b>Resety routera</b> to wszystkie resety routera wykonane przez ESP (automatyczne + ręczne).</p>
-        </div>
-
-        <div class="section">
-            <h2>Legenda Diod LED</h2>
-                <div style="display: flex; gap: 10px; flex-wrap: wrap;">
-    )rawliteral");
-
-    bool isBlue = (WiFi.getMode() == WIFI_AP);
-    bool isRed = (!isBlue && (failCount > 0 || WiFi.status() != WL_CONNECTED || simNoWiFi));
-    bool isGreen = (!isBlue && !isRed);
-
-    html += F("<div style='display:flex; align-items:center; padding: 5px;");
-    html += F("'><span class='dot dot-green");
-    if (isGreen)
-        html += F(" glow-green");
-    html += F("'></span> <b>Zielona:</b> Internet OK</div>");
-
-    html += F("<div style='display:flex; align-items:center; padding: 5px;");
-    html += F("'><span class='dot dot-red");
-    if (isRed)
-        html += F(" glow-red");
-    html += F("'></span> <b>Czerwona:</b> Awaria / Reset</div>");
-
-    html += F("<div style='display:flex; align-items:center; padding: 5px;");
-    html += F("'><span class='dot dot-blue");
-    if (isBlue)
-        html += F(" glow-blue");
-    html += F("'></span> <b>Niebieska:</b> Tryb AP / Oczekiwanie</div>");
-
-    html += F(R"rawliteral(
-            </div>
-            <p style="font-size: 0.9em; color: #666;">Dioda niebieska sygnalizuje tryb konfiguracyjny lub okres karencji po włączeniu zasilania.</p>
-            <label for="ledBrightness" style="margin-top:12px;">Jasność diod LED:</label>
-            <div style="display:flex; align-items:center; gap:10px;">
-                <input type="range" id="ledBrightness" name="ledBrightness" min="0" max="255" value=")rawliteral");
-    html += config.ledBrightness;
-    html += F(R"rawliteral(" oninput="updateBrightness(this.value);">
-                <span id="ledBrightnessVal">)rawliteral");
-    html += config.ledBrightness;
-    html += F(R"rawliteral(</span>
-            </div>
-            <p style="font-size: 0.85em; color:#666; margin-top:5px; margin-bottom:0px;">Dotyczy wszystkich diod (RGB). 0 = wyłączone, 255 = pełna jasność.</p>
-        </div>
-
-        
-
-        <div class="section">
-            <h2>⚙️ Parametry Watchdog - Ustawienia zaawansowane</h2>
-            <p style="font-size:0.9em; color:#666; margin-bottom:20px;">Parametry podzielone według scenariuszy - kliknij aby rozwinąć sekcję.</p>
-
-            <details class="accordion">
-                <summary><b>📡 1. Podstawowe ustawienia monitoringu</b></summary>
-                <div class="accordion-content">
-                    <label for="pingInterval">Interwał ping: <span class="tooltip">?<span class="tooltiptext">Czas odstępu między sprawdzaniem połączenia.</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="pingInterval_disp" step="0.1" min="0" oninput="updateHidden('pingInterval')" value=")rawliteral");
-    html += config.pingInterval;
-    html += F(R"rawliteral(">
-                        <select id="pingInterval_unit" class="unit-select" onchange="convertUnit('pingInterval')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="pingInterval" name="pingInterval" value=")rawliteral");
-    html += config.pingInterval;
-    html += F(R"rawliteral(">
-                    
-                    <label for="failLimit">Limit błędów przed resetem: <span class="tooltip">?<span class="tooltiptext">Liczba nieudanych prób ping przed resetem routera.</span></span></label>
-                    <input type="number" id="failLimit" name="failLimit" value=")rawliteral");
-    html += config.failLimit;
-    html += F(R"rawliteral(" min="1" required>
-                
-                    
-                    <h4>Sprawdzanie połączenia</h4>
-                    <div style="margin-bottom:8px; font-size:0.9em; color:#555;">
-                        Wykryta brama DHCP: <b>)rawliteral");
-    String detectedGw = WiFi.gatewayIP().toString();
-    html += detectedGw;
-    html += F(R"rawliteral(</b> (używana, gdy nie podasz własnej)
-                    </div>
-
-                    <div class="switch-wrap" style="justify-content: flex-start; margin-bottom:8px;">
-                        <label class="switch">
-                            <input type="checkbox" id="useGatewayOverride" name="useGatewayOverride" )rawliteral");
-    if (config.useGatewayOverride)
-        html += "checked";
-    html += F(R"rawliteral(>
-                            <span class="slider"></span>
-                        </label>
-                        <span style="margin-left: 10px;">Użyj własnego adresu bramy</span>
-                    </div>
-
-                    <label for="gatewayOverride">Adres bramy (opcjonalnie): <span class="tooltip">?<span class="tooltiptext">Gdy włączysz przełącznik, watchdog pinguje ten adres zamiast bramy z DHCP.</span></span></label>
-                    <input type="text" id="gatewayOverride" name="gatewayOverride" value=")rawliteral");
-    html += (config.gatewayOverride.length() > 0 ? config.gatewayOverride : detectedGw);
-    html += F(R"rawliteral(" pattern="^((25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.){3}(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$" title="Wprowadź poprawny adres IPv4 (np. 192.168.1.1)">
-
-                    <label for="host1">Host 1 (serwer testowy): <span class="tooltip">?<span class="tooltiptext">Adres IP serwera do sprawdzania (np. 8.8.8.8).</span></span></label>
-                    <input type="text" id="host1" name="host1" value=")rawliteral");
-    html += config.host1;
-    html += F(R"rawliteral(" required pattern="^((25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.){3}(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$" title="Wprowadź poprawny adres IPv4 (np. 8.8.8.8)">
-                    
-                    <label for="host2">Host 2 (zapasowy): <span class="tooltip">?<span class="tooltiptext">Zapasowy adres IP do sprawdzania.</span></span></label>
-                    <input type="text" id="host2" name="host2" value=")rawliteral");
-    html += config.host2;
-    html += F(R"rawliteral(" required pattern="^((25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)\.){3}(25[0-5]|2[0-4][0-9]|[01]?[0-9][0-9]?)$" title="Wprowadź poprawny adres IPv4 (np. 1.1.1.1)">
-                </div>
-            </details>
-
-            <details class="accordion">
-                <summary><b>🔄 2. Parametry resetu routera</b></summary>
-                <div class="accordion-content">
-                    <label for="routerOffTime">Czas wyłączenia routera: <span class="tooltip">?<span class="tooltiptext">Czas odcięcia zasilania routera (długość resetu).</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="routerOffTime_disp" step="0.1" min="0" oninput="updateHidden('routerOffTime')" value=")rawliteral");
-    html += config.routerOffTime;
-    html += F(R"rawliteral(">
-                        <select id="routerOffTime_unit" class="unit-select" onchange="convertUnit('routerOffTime')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="routerOffTime" name="routerOffTime" value=")rawliteral");
-    html += config.routerOffTime;
-    html += F(R"rawliteral(">
-                    
-                    <label for="baseBootTime">Czas rozruchu routera (grace period): <span class="tooltip">?<span class="tooltiptext">Czas na uruchomienie routera po włączeniu zasilania. ESP nie testuje internetu przez ten okres.</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="baseBootTime_disp" step="0.1" min="0" oninput="updateHidden('baseBootTime')" value=")rawliteral");
-    html += config.baseBootTime;
-    html += F(R"rawliteral(">
-                        <select id="baseBootTime_unit" class="unit-select" onchange="convertUnit('baseBootTime')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="baseBootTime" name="baseBootTime" value=")rawliteral");
-    html += config.baseBootTime;
-    html += F(R"rawliteral(">
-                </div>
-            </details>
-
-            <details class="accordion">
-                <summary><b>🛡️ 3. Ochrona przed boot loop (Safety Mode)</b></summary>
-                <div class="accordion-content">
-                    <label for="bootLoopWindowSeconds">Okno detekcji boot loop (w sekundach): <span class="tooltip">?<span class="tooltiptext">Jeśli ESP zresetuje się 5 razy w ciągu tego czasu, aktywuje się Safe Mode (router zablokowany, tryb AP). Domyślnie 1200s = 20 minut.</span></span></label>
-                    <input type="number" id="bootLoopWindowSeconds" name="bootLoopWindowSeconds" value=")rawliteral");
-    html += config.bootLoopWindowSeconds;
-    html += F(R"rawliteral(" min="60" required>
-                    <p style="font-size:0.85em; color:#666; margin-top:5px;">Formuła: (routerOffTime + baseBootTime + grace + testTime) × 5 resetów. Przykład: (60 + 150 + 150 + 30) × 5 = 1950s ≈ 32 min.</p>
-                    
-                    <div style="background:#fff3cd; padding:12px; border-radius:6px; margin-top:10px; border:1px solid #daa520;">
-                        <b>Status Safe Mode:</b> <span style="color:)rawliteral");
-    html += config.safeModeActive ? "red; font-weight:bold;\">⚠️ AKTYWNY - Router zablokowany!" : "green;\">✓ Nieaktywny";
-    html += F(R"rawliteral(</span>
-                    </div>
-                </div>
-            </details>
-
-            <details class="accordion">
-                <summary><b>📶 4. Problemy z WiFi i tryb AP</b></summary>
-                <div class="accordion-content">
-                    <label for="noWiFiTimeout">Czas oczekiwania na WiFi przed resetem: <span class="tooltip">?<span class="tooltiptext">Po jakim czasie braku WiFi zresetować router.</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="noWiFiTimeout_disp" step="0.1" min="0" oninput="updateHidden('noWiFiTimeout')" value=")rawliteral");
-    html += config.noWiFiTimeout;
-    html += F(R"rawliteral(">
-                        <select id="noWiFiTimeout_unit" class="unit-select" onchange="convertUnit('noWiFiTimeout')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="noWiFiTimeout" name="noWiFiTimeout" value=")rawliteral");
-    html += config.noWiFiTimeout;
-    html += F(R"rawliteral(">
-
-                    <label for="apConfigTimeout">Timeout w trybie AP (oczekiwanie na konfigurację): <span class="tooltip">?<span class="tooltiptext">Po jakim czasie braku aktywności w AP, spróbować ponownie normalnego trybu STA.</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="apConfigTimeout_disp" step="0.1" min="0" oninput="updateHidden('apConfigTimeout')" value=")rawliteral");
-    html += config.apConfigTimeout;
-    html += F(R"rawliteral(">
-                        <select id="apConfigTimeout_unit" class="unit-select" onchange="convertUnit('apConfigTimeout')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="apConfigTimeout" name="apConfigTimeout" value=")rawliteral");
-    html += config.apConfigTimeout;
-    html += F(R"rawliteral(">
-                    
-                    <label for="apMaxAttempts">Maksymalna liczba prób wyjścia z AP: <span class="tooltip">?<span class="tooltiptext">Po ilu nieudanych próbach połączenia z WiFi, zamiast trybu AP wykonać reset routera. Domyślnie 4.</span></span></label>
-                    <input type="number" id="apMaxAttempts" name="apMaxAttempts" value=")rawliteral");
-    html += config.apMaxAttempts;
-    html += F(R"rawliteral(" min="1" required>
-                    
-                    <label for="apBackoffMs">Backoff po porażce AP (okno ochronne): <span class="tooltip">?<span class="tooltiptext">Czas oczekiwania po nieudanej próbie wyjścia z AP przed kolejną próbą. Domyślnie 60 minut.</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="apBackoffMs_disp" step="0.1" min="0" oninput="updateHidden('apBackoffMs')" value=")rawliteral");
-    html += config.apBackoffMs;
-    html += F(R"rawliteral(">
-                        <select id="apBackoffMs_unit" class="unit-select" onchange="convertUnit('apBackoffMs')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="apBackoffMs" name="apBackoffMs" value=")rawliteral");
-    html += config.apBackoffMs;
-    html += F(R"rawliteral(">
-                    
-                    <label for="dhcpTimeoutMs">Timeout DHCP: <span class="tooltip">?<span class="tooltiptext">Maksymalny czas oczekiwania na przydzielenie adresu IP przez DHCP. Domyślnie 5 minut.</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="dhcpTimeoutMs_disp" step="0.1" min="0" oninput="updateHidden('dhcpTimeoutMs')" value=")rawliteral");
-    html += config.dhcpTimeoutMs;
-    html += F(R"rawliteral(">
-                        <select id="dhcpTimeoutMs_unit" class="unit-select" onchange="convertUnit('dhcpTimeoutMs')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="dhcpTimeoutMs" name="dhcpTimeoutMs" value=")rawliteral");
-    html += config.dhcpTimeoutMs;
-    html += F(R"rawliteral(">
-                </div>
-            </details>
-
-            <details class="accordion">
-                <summary><b>🌐 5. Awarie dostawcy internetu</b></summary>
-                <div class="accordion-content">
-                    <label for="providerFailureLimit">Limit resetów dla awarii dostawcy: <span class="tooltip">?<span class="tooltiptext">Po ilu resetach bez sukcesu uznać awarię po stronie dostawcy (zamiast problemu z routerem).</span></span></label>
-                    <input type="number" id="providerFailureLimit" name="providerFailureLimit" value=")rawliteral");
-    html += config.providerFailureLimit;
-    html += F(R"rawliteral(" min="1" required>
-                    
-                    <div class="switch-wrap" style="justify-content: flex-start; margin-top: 10px;">
-                        <label class="switch">
-                            <input type="checkbox" id="noWiFiBackoff" name="noWiFiBackoff" )rawliteral");
-    if (config.noWiFiBackoff)
-        html += "checked";
-    html += F(R"rawliteral(>
-                            <span class="slider"></span>
-                        </label>
-                        <span style="margin-left: 10px;">Wydłużaj czas przy powtarzającej się awarii (Exponential Backoff)</span>
-                    </div>
-                </div>
-            </details>
-
-            <details class="accordion">
-                <summary><b>⏱️ 6. Detekcja opóźnień (Lag Watchdog)</b></summary>
-                <div class="accordion-content">
-                    <label for="maxPingMs">Maksymalny czas ping (próg lagu): <span class="tooltip">?<span class="tooltiptext">Próg detekcji wysokiego opóźnienia. Jeśli ping przekroczy tę wartość wielokrotnie, router zostaje zresetowany.</span></span></label>
-                    <div class="time-group">
-                        <input type="number" id="maxPingMs_disp" step="0.1" min="0" oninput="updateHidden('maxPingMs')" value=")rawliteral");
-    html += config.maxPingMs;
-    html += F(R"rawliteral(">
-                        <select id="maxPingMs_unit" class="unit-select" onchange="convertUnit('maxPingMs')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="maxPingMs" name="maxPingMs" value=")rawliteral");
-    html += config.maxPingMs;
-    html += F(R"rawliteral(">
-                    
-                    <label for="lagRetries">Liczba spike'ów do potwierdzenia lagu: <span class="tooltip">?<span class="tooltiptext">Ile kolejnych pingów musi przekroczyć próg, aby uznać że to rzeczywisty lag (nie pojedynczy spike). Domyślnie 3.</span></span></label>
-                    <input type="number" id="lagRetries" name="lagRetries" value=")rawliteral");
-    html += config.lagRetries;
-    html += F(R"rawliteral(" min="1" required>
-                </div>
-            </details>
-
-            <details class="accordion">
-                <summary><b>📅 7. Zaplanowane resety i auto-reset liczników</b></summary>
-                <div class="accordion-content">
-                    <label for="scheduledResetsEnabled">Włącz zaplanowane resety: <span class="tooltip">?<span class="tooltiptext">Resetuj router o określonych czasach (HH:MM) niezależnie od stanu łącza - proaktywna konserwacja.</span></span></label>
-                    <input type="checkbox" id="scheduledResetsEnabled" name="scheduledResetsEnabled" )rawliteral");
-    html += config.scheduledResetsEnabled ? "checked" : "";
-    html += F(R"rawliteral(>
-                    
-                    <label style="margin-top:10px;">Czasy zaplanowanych resetów (format HH:MM, puste = wyłączone):</label>
-                    <div style="display: grid; grid-template-columns: repeat(5, 1fr); gap: 10px;">)rawliteral");
-
-    for (int i = 0; i < 5; i++)
-    {
-        html += F(R"rawliteral(
-                        <div>
-                            <label for="resetTime)rawliteral");
-        html += String(i);
-        html += F(R"rawliteral(">Reset )rawliteral");
-        html += String(i + 1);
-        html += F(R"rawliteral(:</label>
-                            <input type="text" id="resetTime)rawliteral");
-        html += String(i);
-        html += F(R"rawliteral(" name="resetTime)rawliteral");
-        html += String(i);
-        html += F(R"rawliteral(" value=")rawliteral");
-        html += config.scheduledResetTimes[i];
-        html += F(R"rawliteral(" placeholder="HH:MM" maxlength="5" pattern="\d{2}:\d{2}">
-                        </div>)rawliteral");
-    }
-
-    html += F(R"rawliteral(
-                    </div>
-                    
-                    <label for="autoResetCountersHours" style="margin-top:15px;">Auto-reset liczników po X godzinach (0=wyłączony): <span class="tooltip">?<span class="tooltiptext">Jeśli urządzenie akumuluje czas awarii przez określoną liczbę godzin, wszystkie liczniki awarii zostaną zresetowane - "czysta karta". 0 = wyłączone.</span></span></label>
-                    <input type="number" id="autoResetCountersHours" name="autoResetCountersHours" value=")rawliteral");
-    html += config.autoResetCountersHours;
-    html += F(R"rawliteral(" min="0" required>
-                </div>
-            </details>
-        </div>
-    )rawliteral");
-
-    server.sendContent(html);
-    html = "";
-
-    // --- Watchdog Control ---
-    html += F(R"rawliteral(
-        <details class="section accordion">
-            <summary><h2 style="margin:0;">🛡️ Kontrola Strażnika (Monitorowanie)</h2></summary>
-            <div class="accordion-content">
-                <div style="background:#1a3a1a; color:#a8f5a8; padding:12px; border-radius:6px; margin-bottom:15px; border:1px solid #4ade80;">
-                    <b>⚠️ OSTRZEŻENIE - Dezaktywacja Watchdog:</b><br>
-                    • Wyłączenie watchdog <b>WYŁĄCZA</b> monitorowanie awarii internetu<br>
-                    • <b>BRAK automatycznych resetów</b> przy braku internetu<br>
-                    • Router będzie resetowany <b>TYLKO</b> ręcznie<br>
-                    • Zaplanowane resety mogą być ignorowane<br>
-                    <b>Używaj TYLKO dla testów lub gdy monitorowanie jest obsługiwane inaczej!</b>
-                </div>
-                <label for="watchdogEnabled">Włącz Watchdog (Automatyczne resety): <span class="tooltip">?<span class="tooltiptext">Jeśli wyłączone, urządzenie nie będzie monitorować połączenia i nie będzie resetować routera automatycznie. Brak internetu nie spowoduje żadnych działań.</span></span></label>
-                <input type="checkbox" id="watchdogEnabled" name="watchdogEnabled" )rawliteral");
-    html += config.watchdogEnabled ? "checked" : "";
-    html += F(R"rawliteral(>
-            </div>
-        </details>
-    )rawliteral");
-
-    // --- Tryb pracy ---
-    html += F(R"rawliteral(
-        <details class="section accordion">
-            <summary><h2 style="margin:0;">⚙️ Tryb pracy</h2></summary>
-            <div class="accordion-content">
-                <div style="background:#3a2f0f; color:#f8e7a1; padding:12px; border-radius:6px; margin-bottom:15px; border:1px solid #c59f2b;">
-                    <b>⚠️ WAŻNE - Tryb przerywany:</b><br>
-                    Deep sleep <b>WYŁĄCZA</b> funkcję watchdog internetu! ESP śpi i nie monitoruje połączenia.<br>
-                    • Router <b>NIE zostanie zresetowany</b> podczas snu ESP<br>
-                    • Scheduled resety mogą być pominięte jeśli przypadną na czas snu<br>
-                    • WebUI będzie niedostępne podczas snu<br>
-                    <b>Użyj tylko jeśli priorytetem jest oszczędność energii, nie monitoring 24/7!</b>
-                </div>
-                <div style="display:flex; gap:20px; align-items:center; flex-wrap:wrap;">
-                    <label><input type="radio" name="workMode" value="continuous" )rawliteral");
-    if (!config.intermittentMode)
-        html += F("checked ");
-    html += F(R"rawliteral(/> Praca ciągła (Watchdog 24/7)</label>
-                    <label><input type="radio" name="workMode" value="intermittent" )rawliteral");
-    if (config.intermittentMode)
-        html += F("checked ");
-    html += F(R"rawliteral(/> Praca przerywana (Deep sleep - BEZ watchdog!)</label>
-                </div>
-                <div id="dutyFields" style="margin-top:12px; padding:12px; border:1px solid var(--brd); border-radius:6px; background:var(--inp); opacity:1; transition:opacity 0.3s; pointer-events:auto;">
-                    <label for="awakeWindowMs">Czas aktywności przed snem:</label>
-                    <div class="time-group">
-                        <input type="number" id="awakeWindowMs_disp" step="0.1" min="0" oninput="updateHidden('awakeWindowMs')" value=")rawliteral");
-    html += config.awakeWindowMs;
-    html += F(R"rawliteral(">
-                        <select id="awakeWindowMs_unit" class="unit-select" onchange="convertUnit('awakeWindowMs')">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="awakeWindowMs" name="awakeWindowMs" value=")rawliteral");
-    html += config.awakeWindowMs;
-    html += F(R"rawliteral(">
-
-                    <label for="sleepWindowMs" style="margin-top:10px;">Czas uśpienia ESP: <span style="color:#c00; font-weight:bold;">*</span></label>
-                    <div class="time-group">
-                        <input type="number" id="sleepWindowMs_disp" step="0.1" min="0" oninput="updateHidden('sleepWindowMs'); validateSleepTimes();" value=")rawliteral");
-    html += config.sleepWindowMs;
-    html += F(R"rawliteral(">
-                        <select id="sleepWindowMs_unit" class="unit-select" onchange="convertUnit('sleepWindowMs'); validateSleepTimes();">
-                            <option value="1">ms</option>
-                            <option value="1000">s</option>
-                            <option value="60000">min</option>
-                        </select>
-                    </div>
-                    <input type="hidden" id="sleepWindowMs" name="sleepWindowMs" value=")rawliteral");
-    html += config.sleepWindowMs;
-    html += F(R"rawliteral(">
-                    <div style="background:#3a2f0f; color:#f8e7a1; padding:10px; border-radius:4px; margin-top:10px; font-size:0.85em; border:1px solid #c59f2b;">
-                      <b>⚠️ Obowiązkowe zakresy:</b><br>
-                      • Minimalny czas: <b>5 minut</b> (300s) – aby ESP8266 zdążył się wybudzić<br>
-                      • Maksymalny czas: <b>60 minut</b> (3600s) – limit deep sleep ESP8266
-                    </div>
-                    <p style="font-size:0.85em; color:#666; margin-top:8px;">Uśpienie korzysta z deep sleep (wymaga połączenia GPIO16→RST do RST). Wybudzenie przez timer lub ręczny reset.</p>
-                </div>
-            </div>
-        </details>
-    )rawliteral");
-
-    server.sendContent(html);
-    html = F(R"rawliteral(
-        <details class="section accordion">
-            <summary style="cursor:pointer;" onclick="event.preventDefault(); window.location.href='/wifi';">
-                <h2 style="margin:0;">📶 Sieci WiFi</h2>
-            </summary>
-            <div class="accordion-content">
-                <p>Konfiguracja WiFi została przeniesiona do osobnej strony.</p>
-                <button type="button" class="btn-blue btn-wide" onclick="window.location.href='/wifi';">Otwórz konfigurację WiFi</button>
-            </div>
-        </details>
-
-    )rawliteral");
-    server.sendContent(html);
-    html = F(R"rawliteral(
-        <details class="section accordion">
-            <summary><h2 style="margin:0;">🔒 Zabezpieczenia (Panel i OTA)</h2></summary>
-            <div class="accordion-content">
-                <label for="adminUser">Login administratora: <span class="tooltip">?<span class="tooltiptext">Nazwa użytkownika do logowania w panelu.</span></span></label>
-                <input type="text" id="adminUser" name="adminUser" value=")rawliteral");
-    html += config.adminUser;
-    html += F(R"rawliteral(" placeholder="admin">
-                
-                <label for="adminPass">Hasło administratora: <span class="tooltip">?<span class="tooltiptext">Hasło do panelu administratora.</span></span></label>
-                <div class="time-group">
-                    <input type="password" id="adminPass" name="adminPass" value=")rawliteral");
-    html += config.adminPass;
-    html += F(R"rawliteral(" placeholder="admin">
-                    <button type="button" onclick="togglePassword('adminPass')">👁️</button>
-                </div>
-
-            </div>
-        </details>
-
-        <div style="text-align: center; margin-top: 20px; margin-bottom: 30px;">
-            <button type="submit" class="btn-green btn-lg">Zapisz konfigurację</button>
-        </div>
-
-        <!-- Pływający przycisk zapisu (pokazywany gdy są niezapisane zmiany) -->
-        <button type="button" id="fabSave" class="fab btn-green" title="Zapisz zmiany">💾 Zapisz</button>
-
-        <div class="section">
-            <h3>Diagnostyka i Testy</h3>
-                <p>Scenariusze testowe pozwalają sprawdzić reakcję urządzenia.</p>
-                <p style="font-size:0.9em; color:#666; margin-top:5px;">ℹ️ Symulacje kończą się automatycznie po 3 resetach lub można je zakończyć ręcznie przyciskiem "Symuluj powrót internetu".</p>
-    )rawliteral");
-    server.sendContent(html);
-    html = F(R"rawliteral(
-                
-                <div style="margin-bottom: 15px; padding: 10px; border: 1px solid #ccc; border-radius: 5px; background-color: var(--inp);">
-                    <b>Status symulacji:</b> 
-                    <span style="font-weight:bold; color: )rawliteral");
-    if (simPingFail || simNoWiFi || simHighPing)
-        html += "red";
-    else
-        html += "green";
-    html += F(R"rawliteral(">)rawliteral");
-    if (simPingFail)
-        html += "Awaria Ping (Aktywna)";
-    else if (simNoWiFi)
-        html += "Brak WiFi (Aktywna)";
-    else if (simHighPing)
-        html += "Wysoki Ping (Aktywna)";
-    else
-        html += "Brak (Normalna praca)";
-    html += F(R"rawliteral(</span>)rawliteral");
-    if (simStatus.length() > 0)
-    {
-        html += F(R"rawliteral(<br><span style="font-size:0.9em; color:#666;">)rawliteral");
-        html += simStatus;
-        html += F(R"rawliteral(</span>)rawliteral");
-    }
-    html += F(R"rawliteral(
-                </div>
-
-                <div class="btn-row">
-                    <a href="/test/pingfail"><button type="button" class="btn-red">Symuluj awarię Ping</button></a>
-                    <a href="/test/highping"><button type="button" class="btn-yellow">Symuluj wysoki ping (lag)</button></a>
-                    <a href="/test/nowifi"><button type="button" class="btn-orange">Symuluj brak WiFi (1 min)</button></a>
-                    <a href="/test/stop"><button type="button" class="btn-green">✓ Symuluj powrót internetu</button></a>
-                </div>
-                
-                <h3 style="margin-top: 30px;">Inne opcje</h3>
-                <div class="btn-row">
-                    <a href="/reset" onclick="return confirm('Czy na pewno chcesz zresetować router?')"><button type="button" class="btn-pink">Reset routera</button></a>
-                    <a href="/reboot" onclick="return confirm('Czy na pewno chcesz zrestartować urządzenie (ESP)?')"><button type="button" class="btn-red">Restart urządzenia (ESP)</button></a>
-                    <a href="/factoryreset" onclick="return confirm('Czy na pewno chcesz przywrócić ustawienia fabryczne? Spowoduje to usunięcie konfiguracji WiFi i wszystkich ustawień.')"><button type="button" class="btn-red">Przywróć ustawienia fabryczne</button></a>
-    )rawliteral");
-
-    // Wyświetl przycisk tylko jeśli NIE jesteśmy w trybie AP (czyli jesteśmy połączeni z routerem)
-    if (WiFi.getMode() != WIFI_AP)
-    {
-        html += F(R"rawliteral(
-                    <a href="/manualconfig"><button type="button">Ręczny tryb konfiguracyjny (Wymuś AP)</button></a>)rawliteral");
-    }
-
-    html += F(R"rawliteral(
-                    <a href="/downloadlogs"><button type="button" class="btn-blue">Pobierz logi</button></a>
-                    <a href="/clearresetcounters" onclick="return confirm('Czy na pewno wyczyścić liczniki resetów? To odblokuje ESP do normalnego działania.')"><button type="button" class="btn-amber">Wyczyść liczniki resetów</button></a>
-                    <a href="/update"><button type="button" class="btn-cyan">Aktualizacja (OTA)</button></a>
-                </div>
-                <div class="btn-row mt-10">
-                    <a href="/logout"><button type="button" class="btn-grey">Wyloguj</button></a>
-                </div>
-            </form>
-            <div style="text-align:center; border-top:1px solid var(--brd); padding-top:16px; margin-top:20px; color:#777; font-size:0.9em;">Wersja oprogramowania: <b>)rawliteral");
-    html += APP_VERSION;
-    html += F(R"rawliteral(</b></div>
-        </div>
-    </div>
-    )rawliteral");
-    server.sendContent(html);
-    html = F(R"rawliteral(
-    <script>
-    console.log("Config page script loaded");
-    const SESSION_MS = 300000; // 5 minut
-    let sessionEndsAt = Date.now() + SESSION_MS;
-    let warnedExpiring = false;
-    let countdownInterval = null;
-    
-    function updateSessionCountdown() {
-        const msLeft = sessionEndsAt - Date.now();
-        
-        if (msLeft <= 0) {
-            if (countdownInterval) clearInterval(countdownInterval);
-            alert('Twoja sesja wygasła. Zostaniesz wylogowany.');
-            window.location.href = '/';
-            return;
-        }
-
-        // Alert ~20 s przed końcem i pozwól użytkownikowi przedłużyć timer lokalnie
-        if (msLeft <= 20000 && !warnedExpiring) {
-            warnedExpiring = true;
-            const extend = confirm('Sesja wygaśnie za 20 sekund. Przedłużyć o kolejne 5 minut?');
-            if (extend) {
-                sessionEndsAt = Date.now() + SESSION_MS;
-                warnedExpiring = false;
-                updateSessionCountdown();
-                return;
-            }
-        }
-        
-        const totalSec = Math.ceil(msLeft / 1000);
-        const minutes = Math.floor(totalSec / 60);
-        const seconds = totalSec % 60;
-        const timeStr = minutes + ':' + (seconds < 10 ? '0' : '') + seconds;
-        const timeElTop = document.getElementById('timeLeftTop');
-        if (timeElTop) {
-            timeElTop.textContent = timeStr;
-        }
-    }
-    
-    function startSessionCountdown() {
-        if (!countdownInterval) {
-            sessionEndsAt = Date.now() + SESSION_MS;
-            updateSessionCountdown();
-            countdownInterval = setInterval(updateSessionCountdown, 1000);
-        }
-    }
-
-    // Upewnij się, że pola i powiadomienia inicjalizują się po pełnym załadowaniu DOM
-    document.addEventListener('DOMContentLoaded', () => {
-        initFields();
-        setupFormHandlers();
-        initTheme();
-        showSaveNotice();
-        startSessionCountdown();
-        // Wymuś przeliczenie pól na zapisaną jednostkę globalną po odświeżeniu
-        const gu = document.getElementById('globalUnit');
-        if (gu) {
-            setGlobalUnit(parseInt(gu.value || '1000'));
-        }
-    });
-
-    // ========== FAB Save (pływający przycisk zapisu) ==========
-    (function(){
-        const form = document.getElementById('configForm');
-        const fab = document.getElementById('fabSave');
-        if (!form || !fab) return;
-        let dirty = false;
-        let beforeHandlerBound = false;
-
-        function showFab(){ fab.classList.add('show'); }
-        function hideFab(){ fab.classList.remove('show'); }
-        function beforeUnloadHandler(e){ if(!dirty) return; e.preventDefault(); e.returnValue=''; }
-        function markDirty(){
-            if (!dirty){ dirty = true; showFab(); if(!beforeHandlerBound){ window.addEventListener('beforeunload', beforeUnloadHandler); beforeHandlerBound = true; } }
-        }
-        function clearDirty(){ dirty = false; hideFab(); if(beforeHandlerBound){ window.removeEventListener('beforeunload', beforeUnloadHandler); beforeHandlerBound = false; } }
-
-        const fields = form.querySelectorAll('input, select, textarea');
-        fields.forEach(el => { el.addEventListener('input', markDirty); el.addEventListener('change', markDirty); });
-
-        fab.addEventListener('click', () => { if (form.requestSubmit) form.requestSubmit(); else form.submit(); });
-        form.addEventListener('submit', () => { clearDirty(); });
-    })();
-
-    // Funkcja do dodawania sieci WiFi
-    function addWiFiNetwork() {
-        console.log("addWiFiNetwork called");
-        const ssid = document.getElementById('ssid').value.trim();
-        const pass = document.getElementById('wifipass').value;
-        const networkType = document.getElementById('networkType').value;
-        
-        if (!ssid || ssid.trim() === '') {
-            alert('Podaj nazwę sieci (SSID)!');
-            return;
-        }
-        
-        const formData = new URLSearchParams();
-        formData.append('ssid', ssid);
-        formData.append('pass', pass);
-        formData.append('networkType', networkType);
-        
-        fetch('/addwifi', {
-            method: 'POST',
-            headers: {
-                'Content-Type': 'application/x-www-form-urlencoded',
-            },
-            credentials: 'include',
-            body: formData.toString()
-        })
-        .then(async response => {
-            const message = await response.text();
-            if (!response.ok) {
-                throw new Error(message || 'Błąd podczas dodawania sieci WiFi.');
-            }
+    sendStaticAsset(STATIC_CONFIG_HTML_GZ, STATIC_CONFIG_HTML_GZ_LEN, "text/html; charset=utf-8", STATIC_CONFIG_HTML_VER, false);
+}
 
-            // Wyczyść pola
-            document.getElementById('ssid').value = '';
-            document.getElementById('wifipass').value = '';
-
-            alert(message || 'Sieć WiFi została dodana!');
-            // Odśwież stronę aby pokazać zaktualizowaną listę
-            window.location.reload();
-        })
-        .catch(error => {
-            console.error('Error:', error);
-            alert(error.message || 'Wystąpił błąd podczas komunikacji z urządzeniem.');
-        });
-    }
-
-    function removeWiFiNetwork(index) {
-        const formData = new URLSearchParams();
-        formData.append('index', index);
-
-        fetch('/removewifi', {
-            method: 'POST',
-            headers: {
-                'Content-Type': 'application/x-www-form-urlencoded',
-            },
-            credentials: 'include',
-            body: formData.toString()
-        })
-        .then(async response => {
-            const message = await response.text();
-            if (!response.ok) {
-                throw new Error(message || 'Błąd podczas usuwania sieci WiFi.');
-            }
+static void sendConfigError(int code, const String &msg)
+{
+    JsonDocument doc;
+    doc["error"] = msg;
+    String json;
+    serializeJson(doc, json);
+    server.send(code, "application/json", json);
+}
 
-            alert(message || 'Sieć została usunięta.');
-            window.location.reload();
-        })
-        .catch(error => {
-            console.error('Error:', error);
-            alert(error.message || 'Wystąpił błąd podczas komunikacji z urządzeniem.');
-        });
-    }
-    
-    function initFields() {
-        // Przywróć pola czasu
-        initTimeField('pingInterval', )rawliteral");
-    html += String(config.pingInterval);
-    html += F(R"rawliteral();
-        initTimeField('routerOffTime', )rawliteral");
-    html += String(config.routerOffTime);
-    html += F(R"rawliteral();
-        initTimeField('baseBootTime', )rawliteral");
-    html += String(config.baseBootTime);
-    html += F(R"rawliteral();
-        initTimeField('noWiFiTimeout', )rawliteral");
-    html += String(config.noWiFiTimeout);
-    html += F(R"rawliteral();
-        initTimeField('apConfigTimeout', )rawliteral");
-    html += String(config.apConfigTimeout);
-    html += F(R"rawliteral();
-        initTimeField('awakeWindowMs', )rawliteral");
-    html += String(config.awakeWindowMs);
-    html += F(R"rawliteral();
-        initTimeField('sleepWindowMs', )rawliteral");
-    html += String(config.sleepWindowMs);
-    html += F(R"rawliteral();
-        initTimeField('maxPingMs', )rawliteral");
-    html += String(config.maxPingMs);
-    html += F(R"rawliteral();
-        initTimeField('apBackoffMs', )rawliteral");
-    html += String(config.apBackoffMs);
-    html += F(R"rawliteral();
-        initTimeField('dhcpTimeoutMs', )rawliteral");
-    html += String(config.dhcpTimeoutMs);
-    html += F(R"rawliteral();
-
-        // Ustaw i zapamiętaj wybraną globalną jednostkę
-        var gu = document.getElementById('globalUnit').value || '1000';
-        setGlobalUnit(parseInt(gu));
-        document.getElementById('globalUnitValue').value = gu;
-        
-        // Załaduj harmonogram resetów
-        console.log('[JS] Wczytywanie harmonogramu resetów...');
-        for (let i = 0; i < 5; i++) {
-            let field = document.getElementById('resetTime' + i);
-            if (field) {
-                console.log('[JS] resetTime' + i + ' = "' + field.value + '"');
-            }
-        }
-        
-        // Event listener dla zmian trybu pracy
-        document.querySelectorAll('input[name="workMode"]').forEach(r => r.addEventListener('change', toggleDutyFields));
-        
-        toggleDutyFields();
-        initTheme();
-    }
-    
-    function toggleDutyFields() {
-        const intermittent = document.querySelector('input[name="workMode"][value="intermittent"]').checked;
-        const dutyDiv = document.getElementById('dutyFields');
-        
-        if (intermittent) {
-            dutyDiv.style.display = 'block';
-            dutyDiv.style.opacity = '1';
-            dutyDiv.style.pointerEvents = 'auto';
-            dutyDiv.style.filter = 'none';
-        } else {
-            dutyDiv.style.display = 'none';
-            dutyDiv.style.opacity = '0.4';
-            dutyDiv.style.pointerEvents = 'none';
-            dutyDiv.style.filter = 'grayscale(1)';
-        }
-        
-        const inputs = dutyDiv.querySelectorAll('input, select');
-        inputs.forEach(input => {
-            input.disabled = !intermittent;
-        });
-    }
-    
-    // ========== GWARANCJA AKTUALIZACJI PÓL UKRYTYCH PRZED SUBMIT ==========
-    function setupFormHandlers() {
-        // To rozwiązanie zapewnia, że pole ukryte (hidden) będzie zawsze mieć
-        // prawidłową wartość zanim formularz zostanie wysłany do serwera.
-        // Zapobiega problemowi "stare wartości po zapisie".
-        var configForm = document.getElementById('configForm');
-        if (!configForm) {
-            console.error('[JS] Nie znaleziono formularza configForm!');
-            return;
-        }
-        
-        configForm.addEventListener('submit', function(e) {
-            var timeFields = ['pingInterval', 'routerOffTime', 'baseBootTime', 'noWiFiTimeout',
-                             'apConfigTimeout', 'awakeWindowMs', 'sleepWindowMs', 'maxPingMs',
-                             'apBackoffMs', 'dhcpTimeoutMs'];
-            
-            timeFields.forEach(function(fieldId) {
-                var dispInput = document.getElementById(fieldId + '_disp');
-                var unitSelect = document.getElementById(fieldId + '_unit');
-                var hiddenInput = document.getElementById(fieldId);
-                
-                if (dispInput && unitSelect && hiddenInput) {
-                    var disp = parseFloat(dispInput.value) || 0;
-                    var unit = parseInt(unitSelect.value) || 1;
-                    var valueMs = Math.round(disp * unit);
-                    hiddenInput.value = valueMs;
-                }
-            });
-            
-            console.log('[JS] Formularz przygotowany do wysłania');
-            // Formularz może być wysłany z gwarancją że wszystkie pola są aktualne
-            return true;
-        });
-        console.log('[JS] Submit handler zarejestrowany');
-    }
-    </script>
-</body>
-</html>
-)rawliteral");
-
-    server.sendContent(html);
-    server.sendContent(""); // Koniec transmisji
-
-    Serial.println(F("\n[DISPLAY] ✅ Formularz HTML wygenerowany i wysłany"));
-    Serial.println(F("  JavaScript initFields() będzie uzupełniać pola wartościami"));
-}
-
-void handleSaveConfig()
+// GET: wartości sekcji. POST: zmiana pól sekcji na kopii konfiguracji, walidacja
+// całości i zapis - w odpowiedzi wartości po zapisie (np. po przycięciu do zakresu).
+void handleApiConfig()
 {
-    if (!checkAuth())
+    PERF_SCOPE("http.config");
+    if (!checkAuth(true))
         return;
 
-    if (server.method() != HTTP_POST)
+    const ConfigSection *section = findConfigSection(server.pathArg(0).c_str());
+    if (!section)
     {
-        server.send(405, "text/plain", "Method Not Allowed");
+        sendConfigError(404, "Nieznana sekcja konfiguracji");
         return;
     }
 
-    Serial.println("[WEBSERVER] Received config save request");
+    if (server.method() == HTTP_POST)
+    {
+        if (!section->apply)
+        {
+            sendConfigError(405, "Sekcja tylko do odczytu");
+            return;
+        }
 
-    // Parsowanie i walidacja wszystkich parametrów
-    if (!parseAndValidateConfigParams(server, config))
-        return; // Błąd został obsłużony w parseAndValidateConfigParams
+        Config next = config;
+        section->apply(server, next);
+        String validationError = validateConfig(next);
+        if (validationError.length() > 0)
+        {
+            sendConfigError(400, validationError);
+            return;
+        }
 
-    // Zapis do pamięci Flash
-    if (!saveConfig())
-    {
-        sendErrorPage(server, "❌ Błąd zapisu", "Błąd zapisu konfiguracji! Sprawdź miejsce w pamięci.",
-                      "/config", "Powrót do konfiguracji", config.darkMode);
-        return;
+        config = next;
+        if (!saveConfig())
+        {
+            sendConfigError(500, "Błąd zapisu konfiguracji! Sprawdź miejsce w pamięci.");
+            return;
+        }
+        DIAG_PRINTF("[CONFIG] Zapisano sekcję %s\n", section->name);
     }
 
-    // Konfiguracja zapisana - przekieruj z flagą sukcesu
-    redirectTo(server, "/config?saved=1");
+    JsonDocument doc;
+    apiJsonConfig(doc, section->name);
+    server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
+    ResponseWriter out(server);
+    out.begin(200, "application/json");
+    serializeJson(doc, out);
+    out.end();
 }
 
 void handleWiFiPage()
@@ -1592,50 +1081,49 @@ void handleWiFiPage()
     server.sendHeader("Pragma", "no-cache");
     server.sendHeader("Expires", "0");
 
-    sendHtmlHeader(server, "Sieci WiFi - Strażnik Internetu", config.darkMode);
+    ResponseWriter out(server);
+    sendHtmlHeader(out, "Sieci WiFi - Strażnik Internetu", config.darkMode);
 
-    String html;
-    html.reserve(2048);
 
-    html += F("</head><body><div class='container'>");
-    html += F("<div style='text-align:center; margin-bottom:10px;'>");
-    html += F("<h1 style='margin:0;'>📶 Konfiguracja sieci WiFi</h1>");
-    html += F("</div>");
+    out.print(F("</head><body><div class='container'>"));
+    out.print(F("<div style='text-align:center; margin-bottom:10px;'>"));
+    out.print(F("<h1 style='margin:0;'>📶 Konfiguracja sieci WiFi</h1>"));
+    out.print(F("</div>"));
 
-    html += F("<div class='section' style='margin-top:10px;'>");
-    html += F("<label for='ssid'>Nazwa sieci (SSID):</label>");
-    html += F("<input type='text' id='ssid' name='ssid' placeholder='Wprowadź SSID sieci WiFi'>");
+    out.print(F("<div class='section' style='margin-top:10px;'>"));
+    out.print(F("<label for='ssid'>Nazwa sieci (SSID):</label>"));
+    out.print(F("<input type='text' id='ssid' name='ssid' placeholder='Wprowadź SSID sieci WiFi'>"));
 
-    html += F("<label for='wifipass'>Hasło sieci:</label>");
-    html += F("<div class='time-group'>");
-    html += F("<input type='password' id='wifipass' name='pass' placeholder='Hasło WiFi'>");
-    html += F("<button type='button' onclick=\"togglePassword('wifipass')\">👁️</button>");
-    html += F("</div>");
+    out.print(F("<label for='wifipass'>Hasło sieci:</label>"));
+    out.print(F("<div class='time-group'>"));
+    out.print(F("<input type='password' id='wifipass' name='pass' placeholder='Hasło WiFi'>"));
+    out.print(F("<button type='button' onclick=\"togglePassword('wifipass')\">👁️</button>"));
+    out.print(F("</div>"));
 
-    html += F("<label for='networkType'>Typ sieci:</label>");
-    html += F("<select id='networkType' name='networkType'>");
-    html += F("<option value='0'>🟢 Główna (Primary)</option>");
-    html += F("<option value='1'>🔴 Rezerwowa (Backup)</option>");
-    html += F("</select>");
-    html += F("</div>");
+    out.print(F("<label for='networkType'>Typ sieci:</label>"));
+    out.print(F("<select id='networkType' name='networkType'>"));
+    out.print(F("<option value='0'>🟢 Główna (Primary)</option>"));
+    out.print(F("<option value='1'>🔴 Rezerwowa (Backup)</option>"));
+    out.print(F("</select>"));
+    out.print(F("</div>"));
 
-    html += F("<div style='text-align:center; margin-top:20px; display:flex; flex-direction:column; gap:14px; align-items:center;'>");
-    html += F("<button type='button' id='saveWiFi' class='btn-blue btn-wide'>💾 Zapisz sieć WiFi</button>");
+    out.print(F("<div style='text-align:center; margin-top:20px; display:flex; flex-direction:column; gap:14px; align-items:center;'>"));
+    out.print(F("<button type='button' id='saveWiFi' class='btn-blue btn-wide'>💾 Zapisz sieć WiFi</button>"));
 
-    html += F("<div class='section' style='width:100%;'>");
-    html += F("<h3 style='text-align:center;'>Zapisane sieci WiFi</h3>");
-    html += F("<div id='wifiList' style='display:flex; flex-direction:column; gap:8px;'></div>");
-    html += F("</div>");
+    out.print(F("<div class='section' style='width:100%;'>"));
+    out.print(F("<h3 style='text-align:center;'>Zapisane sieci WiFi</h3>"));
+    out.print(F("<div id='wifiList' style='display:flex; flex-direction:column; gap:8px;'></div>"));
+    out.print(F("</div>"));
 
-    html += F("<div style='display:flex; gap:10px; flex-wrap:wrap; justify-content:center;'>");
-    html += F("<a href='/config'><button type='button'>⟵ Powrót do konfiguracji</button></a>");
-    html += F("<a href='/'><button type='button'>Status</button></a>");
-    html += F("</div>");
-    html += F("</div>");
+    out.print(F("<div style='display:flex; gap:10px; flex-wrap:wrap; justify-content:center;'>"));
+    out.print(F("<a href='/config'><button type='button'>⟵ Powrót do konfiguracji</button></a>"));
+    out.print(F("<a href='/'><button type='button'>Status</button></a>"));
+    out.print(F("</div>"));
+    out.print(F("</div>"));
 
-    html += F("</div>");
+    out.print(F("</div>"));
 
-    html += F(R"rawliteral(
+    out.print(F(R"rawliteral(
 <script>
 function togglePassword(id){
     const el=document.getElementById(id);
@@ -1719,37 +1207,12 @@ document.addEventListener('DOMContentLoaded',()=>{
 });
 </script>
 </body></html>
-)rawliteral");
+)rawliteral"));
 
-    server.sendContent(html);
+    out.end();
     Serial.println("[WEBSERVER] handleWiFiPage: Zakończono wysyłanie");
 }
 
-void handleSaveBackupConfig()
-{
-    if (!checkAuth())
-        return;
-    if (server.method() != HTTP_POST)
-    {
-        server.send(405, "text/plain", "Method Not Allowed");
-        return;
-    }
-
-    config.enableBackupNetwork = server.hasArg("enableBackupNetwork");
-    config.backupNetworkFailLimit = constrain(server.arg("backupNetworkFailLimit").toInt(), 1, 10);
-    config.backupNetworkRetryInterval = server.arg("backupNetworkRetryInterval").toInt();
-    if (config.backupNetworkRetryInterval < 1000)
-        config.backupNetworkRetryInterval = 1000;
-    config.pinRelayBackup = server.arg("pinRelayBackup").toInt();
-
-    if (!saveConfig())
-    {
-        server.send(500, "text/plain", "Błąd zapisu konfiguracji sieci rezerwowej.");
-        return;
-    }
-
-    server.send(200, "text/plain", "Zapisano ustawienia sieci rezerwowej.");
-}
 
 void handleAddWiFi()
 {
@@ -1819,6 +1282,521 @@ void handleListWiFi()
     server.send(200, "application/json", json);
 }
 
+// --- STATYSTYKI RTT (JSON) ---
+void apiJsonRtt(JsonDocument &doc)
+{
+    doc["lastMs"] = lastPingMs;
+    doc["ewmaMs"] = rttStatsEwma();
+    doc["jitterMs"] = rttStatsJitter();
+    doc["lagUseP95"] = config.lagUseP95;
+    doc["maxPingMs"] = config.maxPingMs;
+
+    // Ostatnia seria pingów (tylko w trybie serii)
+    if (config.burstCount > 1)
+    {
+        const ProbeResult &r = probeResult();
+        JsonObject burst = doc["burst"].to<JsonObject>();
+        burst["sent"] = r.sent;
+        burst["received"] = r.received;
+        burst["lossPct"] = r.lossPct;
+        burst["minMs"] = r.rttMin;
+        burst["avgMs"] = r.rttAvg;
+        burst["maxMs"] = r.rttMax;
+        burst["host"] = r.usedHost2 ? config.host2 : config.host1;
+    }
+
+    JsonObject windows = doc["windows"].to<JsonObject>();
+    for (int w = 0; w < RTT_WIN_COUNT; w++)
+    {
+        RttWindowSummary s;
+        JsonObject win = windows[rttWindowName((RttWindow)w)].to<JsonObject>();
+        rttStatsSummary((RttWindow)w, s);
+        uint32_t probes = s.samples + s.lost;
+        win["samples"] = s.samples;
+        win["lost"] = s.lost;
+        win["lossPct"] = probes ? (100.0f * s.lost / probes) : 0.0f;
+        win["minMs"] = s.samples ? s.minMs : 0;
+        win["maxMs"] = s.maxMs;
+        win["p50"] = s.p50;
+        win["p95"] = s.p95;
+        win["p99"] = s.p99;
+    }
+}
+
+void handleApiRtt()
+{
+    if (!checkAuth(true))
+        return;
+    JsonDocument doc;
+    apiJsonRtt(doc);
+    sendApiJson(doc);
+}
+
+// --- ARCHIWUM HISTORII (BINARNIE) ---
+// Strumieniowanie kubełków prosto z pliku w porcjach, bez budowania String.
+// Publiczne jak "/" i /api/status - wykres historii na stronie głównej bez logowania
+void handleApiHistory()
+{
+    PERF_SCOPE("http.history");
+    HistTier tier = historyTierByName(server.arg("res").c_str());
+    HistoryStream stream;
+    uint8_t header[HISTORY_STREAM_HEADER];
+    if (!historyStreamOpen(stream, tier, header))
+    {
+        server.send(503, "text/plain", "Historia niedostepna");
+        return;
+    }
+
+    server.sendHeader("Cache-Control", "no-cache");
+    server.setContentLength(historyStreamLength(tier));
+    server.send(200, "application/octet-stream", "");
+    server.sendContent((const char *)header, sizeof(header));
+
+    const uint16_t CHUNK = 32;
+    HistBucket buf[CHUNK];
+    uint16_t n;
+    while ((n = historyStreamRead(stream, buf, CHUNK)) > 0)
+    {
+        server.sendContent((const char *)buf, n * sizeof(HistBucket));
+        ESP.wdtFeed();
+    }
+}
+
+// --- REJESTR AWARII (JSON) ---
+void apiJsonIncidents(JsonDocument &doc)
+{
+    IncidentSummary inc;
+    incidentsSummary(inc);
+
+    doc["observedSec"] = inc.observedSec;
+    doc["downtimeSec"] = inc.downtimeSec;
+    doc["incidents"] = inc.incidents;
+    doc["resets"] = inc.resets;
+    doc["resetsFixed"] = inc.resetsFixed;
+    doc["mttrSec"] = inc.mttrSec;
+    doc["mtbfSec"] = inc.mtbfSec;
+    doc["availabilityPct"] = inc.availabilityPct;
+
+    JsonObject causes = doc["causes"].to<JsonObject>();
+    for (uint8_t c = 0; c < INC_CAUSE_COUNT; c++)
+    {
+        JsonObject cause = causes[incidentCauseName(c)].to<JsonObject>();
+        cause["count"] = inc.causeCount[c];
+        cause["downtimeSec"] = inc.causeDowntimeSec[c];
+    }
+
+    IncidentRecord rec;
+    if (incidentIsOpen(&rec))
+    {
+        JsonObject open = doc["open"].to<JsonObject>();
+        open["start"] = rec.start;
+        open["durationSec"] = rec.durationSec;
+        open["cause"] = incidentCauseName(rec.cause);
+        open["actions"] = rec.actions;
+        open["resets"] = rec.resets;
+    }
+
+    // Od najnowszego
+    JsonArray list = doc["recent"].to<JsonArray>();
+    for (uint8_t i = 0; i < incidentsCount(); i++)
+    {
+        if (!incidentsRead(i, rec))
+            break;
+        JsonObject item = list.add<JsonObject>();
+        item["start"] = rec.start;
+        item["durationSec"] = rec.durationSec;
+        item["cause"] = incidentCauseName(rec.cause);
+        item["actions"] = rec.actions;
+        item["resets"] = rec.resets;
+        item["fixedByReset"] = (rec.flags & INC_FLAG_FIXED_BY_RESET) != 0;
+    }
+}
+
+void handleApiIncidents()
+{
+    if (!checkAuth(true))
+        return;
+    JsonDocument doc;
+    apiJsonIncidents(doc);
+    sendApiJson(doc);
+}
+
+void apiJsonPerf(JsonDocument &doc)
+{
+    doc["enabled"] = PERF_ENABLED != 0;
+    doc["cpuMHz"] = ESP.getCpuFreqMHz();
+    doc["uptimeMs"] = millis();
+
+    // Górne granice przedziałów histogramu (ostatni przedział otwarty)
+    JsonArray edges = doc["histUpperUs"].to<JsonArray>();
+    for (uint8_t b = 0; b < PERF_HIST_BUCKETS - 1; b++)
+        edges.add(perfBucketUpperUs(b));
+
+    JsonArray list = doc["sites"].to<JsonArray>();
+    PerfSiteStats ps;
+    for (uint8_t i = 0; perfStats(i, ps); i++)
+    {
+        JsonObject site = list.add<JsonObject>();
+        site["name"] = ps.name;
+        site["count"] = ps.count;
+        site["totalUs"] = ps.totalUs;
+        site["avgUs"] = ps.count ? (uint32_t)(ps.totalUs / ps.count) : 0;
+        site["maxUs"] = ps.maxUs;
+        JsonArray hist = site["hist"].to<JsonArray>();
+        for (uint8_t b = 0; b < PERF_HIST_BUCKETS; b++)
+            hist.add(ps.hist[b]);
+    }
+
+    // Zadania harmonogramu loop() - budżety i przekroczenia
+    JsonArray tasks = doc["tasks"].to<JsonArray>();
+    SchedTaskStats ts;
+    for (uint8_t i = 0; schedStats(i, ts); i++)
+    {
+        JsonObject task = tasks.add<JsonObject>();
+        task["name"] = ts.name;
+        task["periodMs"] = ts.periodMs;
+        task["budgetUs"] = ts.budgetUs;
+        task["runs"] = ts.runs;
+        task["overruns"] = ts.overruns;
+        task["lastUs"] = ts.lastUs;
+        task["maxUs"] = ts.maxUs;
+        task["totalMs"] = ts.totalMs;
+        task["lateMaxMs"] = ts.lateMaxMs;
+        task["lateAvgMs"] = ts.runs ? (float)ts.lateTotalMs / ts.runs : 0;
+        task["enabled"] = ts.enabled;
+    }
+
+    // Powiadomienia na żywo - subskrybenci i rozłączenia wolnych klientów
+    uint32_t ssePublished, sseRejected, sseDropped;
+    sseCounters(ssePublished, sseRejected, sseDropped);
+    JsonObject live = doc["sse"].to<JsonObject>();
+    live["clients"] = sseClientCount();
+    live["maxClients"] = SSE_MAX_CLIENTS;
+    live["published"] = ssePublished;
+    live["rejected"] = sseRejected;
+    live["dropped"] = sseDropped;
+
+#if HTTP_ASYNC_ENABLED
+    // Serwer na zdarzeniach lwIP - połączenia, odmowy (limit) i przekierowania
+    AsyncHttpCounters ac;
+    asyncHttpCounters(ac);
+    JsonObject async = doc["httpAsync"].to<JsonObject>();
+    async["active"] = asyncHttpActive();
+    async["maxConns"] = HTTP_ASYNC_MAX_CONNS;
+    async["maxActive"] = ac.maxActive;
+    async["accepted"] = ac.accepted;
+    async["refused"] = ac.refused;
+    async["served"] = ac.served;
+    async["redirected"] = ac.redirected;
+    async["timeouts"] = ac.timeouts;
+    async["errors"] = ac.errors;
+#endif
+
+    // Limity żądań - przepuszczone i odrzucone (429) w każdej klasie tras
+    RateLimitCounters rl;
+    rateCounters(rl);
+    JsonObject limits = doc["rateLimit"].to<JsonObject>();
+    limits["clients"] = rl.clients;
+    limits["lockouts"] = rl.lockouts;
+    JsonArray classes = limits["classes"].to<JsonArray>();
+    for (uint8_t i = 0; i < RATE_CLASS_COUNT; i++)
+    {
+        JsonObject c = classes.add<JsonObject>();
+        c["name"] = rateClassName(i);
+        c["allowed"] = rl.allowed[i];
+        c["rejected"] = rl.rejected[i];
+    }
+}
+
+void handleApiPerf()
+{
+    if (!checkAuth(true))
+        return;
+    JsonDocument doc;
+    apiJsonPerf(doc);
+    sendApiJson(doc);
+}
+
+void apiJsonHeap(JsonDocument &doc)
+{
+    heapCheckpoint();
+
+    doc["freeHeap"] = ESP.getFreeHeap();
+    doc["maxBlock"] = ESP.getMaxFreeBlockSize();
+    doc["fragPct"] = ESP.getHeapFragmentation();
+    doc["lowWater"] = heapLowWater();
+    doc["sampleSec"] = HEAP_SAMPLE_MS / 1000;
+
+    // Próbki od najstarszej: [uptime s, wolna, największy blok, fragmentacja %]
+    JsonArray samples = doc["samples"].to<JsonArray>();
+    HeapSample hs;
+    for (uint8_t i = 0; heapSample(i, hs); i++)
+    {
+        JsonArray row = samples.add<JsonArray>();
+        row.add(hs.uptimeSec);
+        row.add(hs.freeHeap);
+        row.add(hs.maxBlock);
+        row.add(hs.fragPct);
+    }
+
+    // Miejsca pomiaru: trasy HTTP (URI) i fazy watchdoga (wd.*)
+    JsonArray list = doc["sites"].to<JsonArray>();
+    HeapSiteStats st;
+    for (uint8_t i = 0; heapSiteStats(i, st); i++)
+    {
+        if (st.calls == 0)
+            continue;
+        JsonObject site = list.add<JsonObject>();
+        site["name"] = st.name;
+        site["calls"] = st.calls;
+        site["minFree"] = st.minFree;
+        site["maxUsed"] = st.maxUsed;
+        site["minBlock"] = st.minBlock;
+        site["maxFrag"] = st.maxFrag;
+    }
+}
+
+void handleApiHeap()
+{
+    if (!checkAuth(true))
+        return;
+    JsonDocument doc;
+    apiJsonHeap(doc);
+    sendApiJson(doc);
+}
+
+void handleApiPerfReset()
+{
+    if (!checkAuth())
+        return;
+    perfReset();
+    schedResetStats();
+#if HTTP_ASYNC_ENABLED
+    asyncHttpResetCounters();
+#endif
+    server.sendHeader("Location", "/perf", true);
+    server.send(303, "text/plain", "");
+}
+
+// Strona diagnostyczna: tabele pomiarów i zadań (bez JS - odświeżenie przeładowuje)
+void handlePerfPage()
+{
+    if (!checkAuth())
+        return;
+
+    ResponseWriter out(server);
+    sendHtmlHeader(out, "Wydajność - Strażnik Internetu", config.darkMode);
+
+    out.print(F("</head><body><div class='container'>"));
+    out.print(F("<h1 style='text-align:center;'>⏱️ Wydajność</h1>"));
+
+    out.print(F("<div class='section'><h2>Miejsca pomiaru</h2>"));
+    if (perfCount() == 0)
+        out.print(F("<p>Pomiary wyłączone (PERF_ENABLED = 0) lub brak danych.</p>"));
+    else
+    {
+        out.print(F("<table style='width:100%; text-align:center;'><tr><th>Miejsce</th><th>Wywołania</th><th>Średnio</th><th>Max</th><th>Łącznie</th></tr>"));
+        PerfSiteStats ps;
+        for (uint8_t i = 0; perfStats(i, ps); i++)
+        {
+            out.print(F("<tr><td>"));
+            out.print(ps.name);
+            out.print(F("</td><td>"));
+            out.print(ps.count);
+            out.print(F("</td><td>"));
+            out.print(ps.count ? (uint32_t)(ps.totalUs / ps.count) : 0);
+            out.print(F(" µs</td><td>"));
+            out.print(ps.maxUs);
+            out.print(F(" µs</td><td>"));
+            out.print((uint32_t)(ps.totalUs / 1000));
+            out.print(F(" ms</td></tr>"));
+        }
+        out.print(F("</table>"));
+    }
+    out.print(F("</div>"));
+
+    out.print(F("<div class='section'><h2>Zadania loop()</h2>"));
+    out.print(F("<table style='width:100%; text-align:center;'><tr><th>Zadanie</th><th>Okres</th><th>Wywołania</th><th>Max</th><th>Budżet</th><th>Przekroczenia</th><th>Opóźnienie śr./max</th></tr>"));
+    SchedTaskStats ts;
+    for (uint8_t i = 0; schedStats(i, ts); i++)
+    {
+        out.print(F("<tr><td>"));
+        out.print(ts.name);
+        out.print(F("</td><td>"));
+        out.print(ts.periodMs);
+        out.print(F(" ms</td><td>"));
+        out.print(ts.runs);
+        out.print(F("</td><td>"));
+        out.print(ts.maxUs);
+        out.print(F(" µs</td><td>"));
+        out.print(ts.budgetUs);
+        out.print(F(" µs</td><td>"));
+        out.print(ts.overruns);
+        out.print(F("</td><td>"));
+        out.print(ts.runs ? ts.lateTotalMs / ts.runs : 0);
+        out.print(F(" / "));
+        out.print(ts.lateMaxMs);
+        out.print(F(" ms</td></tr>"));
+    }
+    out.print(F("</table></div>"));
+
+    out.print(F("<div class='section'><div style='display:flex; justify-content:center; gap:12px;'>"));
+    out.print(F("<form method='POST' action='/api/perf/reset' style='margin:0;'><button type='submit'>Zeruj pomiary</button></form>"));
+    out.print(F("<a href='/perf'><button class='btn-grey'>Odśwież</button></a>"));
+    out.print(F("<a href='/'><button class='btn-grey'>Powrót</button></a>"));
+    out.print(F("</div><p style='text-align:center; font-size:0.85em; color:#777;'>Dane w formacie JSON (z histogramem): <a href='/api/perf'>/api/perf</a></p></div>"));
+
+    out.print(F("</div></body></html>"));
+    out.end();
+}
+
+// Zasób statyczny z PROGMEM (zawsze gzip - jak serveStatic z core). Bez autoryzacji:
+// strona logowania też potrzebuje stylów. ETag = wersja treści, więc przy zgodnym
+// If-None-Match odpowiadamy 304 bez treści. Zasoby z ?v= w adresie są niezmienne;
+// pozostałe (strona główna pod stałym adresem) przeglądarka sprawdza przy każdym
+// wejściu - zwykle kończy się na 304.
+static void sendStaticAsset(const uint8_t *data, size_t len, const char *contentType, const char *version, bool immutable)
+{
+    String etag = "\"";
+    etag += version;
+    etag += '"';
+
+    server.sendHeader("ETag", etag);
+    server.sendHeader("Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    if (server.header("If-None-Match") == etag)
+    {
+        server.send(304);
+        return;
+    }
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, contentType, (PGM_P)data, len);
+}
+
+void handleStaticCss()
+{
+    sendStaticAsset(STATIC_APP_CSS_GZ, STATIC_APP_CSS_GZ_LEN, "text/css", STATIC_APP_CSS_VER, true);
+}
+
+void handleStaticJs()
+{
+    sendStaticAsset(STATIC_APP_JS_GZ, STATIC_APP_JS_GZ_LEN, "application/javascript", STATIC_APP_JS_VER, true);
+}
+
+void handleStaticConfigJs()
+{
+    sendStaticAsset(STATIC_CONFIG_JS_GZ, STATIC_CONFIG_JS_GZ_LEN, "application/javascript", STATIC_CONFIG_JS_VER, true);
+}
+
+void handleStaticDashboardJs()
+{
+    sendStaticAsset(STATIC_DASHBOARD_JS_GZ, STATIC_DASHBOARD_JS_GZ_LEN, "application/javascript", STATIC_DASHBOARD_JS_VER, true);
+}
+
+void handleStaticIcon()
+{
+    sendStaticAsset(STATIC_ICON_SVG_GZ, STATIC_ICON_SVG_GZ_LEN, "image/svg+xml", STATIC_ICON_SVG_VER, true);
+}
+
+// Rekordy awarii ESP zapisane przy starcie po Exception / WDT (najnowszy na górze)
+void handleCrashLogPage()
+{
+    if (!checkAuth())
+        return;
+
+    ResponseWriter out(server);
+    sendHtmlHeader(out, "Awarie ESP - Strażnik Internetu", config.darkMode);
+
+    out.print(F("</head><body><div class='container'>"));
+    out.print(F("<h1 style='text-align:center;'>💥 Awarie ESP</h1>"));
+
+    // Rekordy od najnowszego: plik jest krótki (CRASH_LOG_MAX linii)
+    String lines[CRASH_LOG_MAX];
+    uint8_t count = 0;
+    File f = LittleFS.open(CRASH_LOG_FILE, "r");
+    if (f)
+    {
+        while (f.available() && count < CRASH_LOG_MAX)
+        {
+            String l = f.readStringUntil('\n');
+            if (l.length() > 0)
+                lines[count++] = l;
+        }
+        f.close();
+    }
+
+    if (count == 0)
+        out.print(F("<div class='section'><p>Brak zapisanych awarii.</p></div>"));
+
+    for (int8_t i = count - 1; i >= 0; i--)
+    {
+        JsonDocument doc;
+        if (deserializeJson(doc, lines[i]))
+            continue;
+
+        out.print(F("<div class='section'><h2>"));
+        out.print(doc["reason"].as<const char *>());
+        out.print(F("</h2><table style='width:100%;'>"));
+        out.print(F("<tr><td>Zadanie</td><td><b>"));
+        out.print(doc["task"].as<const char *>());
+        out.print(doc["inTask"].as<bool>() ? F("</b> (w trakcie)") : F("</b> (po zakończeniu)"));
+        out.print(F("</td></tr>"));
+        if (!doc["uptimeMs"].isNull())
+        {
+            out.print(F("<tr><td>Czas pracy</td><td>"));
+            out.print(formatDurationSec(doc["uptimeMs"].as<uint32_t>() / 1000));
+            out.print(F("</td></tr>"));
+        }
+        out.print(F("<tr><td>exccause</td><td>"));
+        out.print(doc["exccause"].as<uint32_t>());
+        out.print(F("</td></tr><tr><td>epc1 / epc2 / epc3</td><td><code>"));
+        out.print(doc["epc1"].as<const char *>());
+        out.print(' ');
+        out.print(doc["epc2"].as<const char *>());
+        out.print(' ');
+        out.print(doc["epc3"].as<const char *>());
+        out.print(F("</code></td></tr><tr><td>excvaddr / depc</td><td><code>"));
+        out.print(doc["excvaddr"].as<const char *>());
+        out.print(' ');
+        out.print(doc["depc"].as<const char *>());
+        out.print(F("</code></td></tr>"));
+        if (doc["stack"].size() > 0)
+        {
+            out.print(F("<tr><td>Stos</td><td><code>"));
+            for (JsonVariant a : doc["stack"].as<JsonArray>())
+            {
+                out.print(a.as<const char *>());
+                out.print(' ');
+            }
+            out.print(F("</code></td></tr>"));
+        }
+        out.print(F("</table>"));
+
+        out.print(F("<p style='margin-bottom:4px;'>Ostatnie zdarzenia:</p><pre style='white-space:pre-wrap; font-size:0.85em;'>"));
+        for (JsonVariant e : doc["events"].as<JsonArray>())
+        {
+            out.printEscaped(e.as<const char *>());
+            out.print('\n');
+        }
+        out.print(F("</pre></div>"));
+    }
+
+    out.print(F("<div class='section'><div style='display:flex; justify-content:center; gap:12px;'>"));
+    if (count > 0)
+        out.print(F("<form method='POST' action='/crashlog/clear' style='margin:0;'><button type='submit' class='btn-red'>Usuń rekordy</button></form>"));
+    out.print(F("<a href='/config'><button class='btn-grey'>Powrót</button></a>"));
+    out.print(F("</div><p style='text-align:center; font-size:0.85em; color:#777;'>Adresy dekoduje EspExceptionDecoder / addr2line z plikiem firmware.elf tej samej wersji.</p></div>"));
+    out.print(F("</div></body></html>"));
+    out.end();
+}
+
+void handleCrashLogClear()
+{
+    if (!checkAuth())
+        return;
+    crashLogClear();
+    redirectTo(server, "/crashlog");
+}
+
 void handleRemoveWiFi()
 {
     if (!checkAuth())
@@ -1849,67 +1827,66 @@ void handleUpdatePage()
     {
         return;
     }
-    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
-    server.send(200, "text/html; charset=utf-8", "");
-
-    String html;
-    html.reserve(1200);
-    html = F("<!DOCTYPE html><html lang='pl'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1.0'><title>Aktualizacja OTA</title>");
-    html += F("<link rel='icon' href='data:image/svg+xml;base64,PHN2ZyB4bWxucz0iaHR0cDovL3d3dy53My5vcmcvMjAwMC9zdmciIHZpZXdCb3g9IjAgMCAyNCAyNCI+PHBhdGggZmlsbD0iIzAwN2JmZiIgZD0iTTEyIDFMMyA1djZjMCA1LjU1IDMuODQgMTAuNzQgOSAxMiA1LjE2LTEuMjYgOS02LjQ1IDktMTJWNWwtOS00eiIvPjwvc3ZnPg=='>");
-    html += F("<style>");
-    server.sendContent(html);
-    server.sendContent_P(HTML_THEME_STYLES);
-
-    html = F(".container{max-width:640px;margin:auto;background:var(--card);padding:22px;border-radius:10px;box-shadow:0 10px 30px rgba(0,0,0,0.08);}h1{text-align:center;margin-bottom:10px;}p.subtitle{color:#666;margin-top:0;margin-bottom:16px;text-align:center;} .info{background:var(--inp);border:1px solid var(--brd);padding:10px;border-radius:6px;margin-bottom:12px;font-size:0.95em;}");
-    html += F(".dropzone{margin-top:10px;border:2px dashed #007bff;border-radius:10px;padding:28px;text-align:center;background:rgba(0,123,255,0.05);color:var(--fg);transition:all 0.2s ease;} .dropzone.active{background:rgba(0,123,255,0.12);border-color:#0056b3;} .file-name{margin-top:10px;color:#666;font-size:0.9em;}");
-    html += F(".btn-row{display:flex;gap:10px;flex-wrap:wrap;justify-content:center;margin-top:12px;}button{padding:10px 14px;background-color:var(--btn);color:white;border:none;border-radius:6px;cursor:pointer;}button:hover{background-color:var(--btn-hover);} .ghost{background:#6c757d;} .ghost:hover{background:#5a6268;}");
-    html += F("#progress-wrap{width:100%;background-color:var(--inp);border:1px solid var(--brd);margin-top:20px;display:none;border-radius:6px;overflow:hidden;}#progress-bar{width:0%;height:18px;background-color:#28a745;text-align:center;line-height:18px;color:white;transition:width 0.2s ease;}");
-    html += F(".muted{color:#777;font-size:0.9em;} .version{font-size:0.95em;color:#555;margin-bottom:8px;text-align:center;}");
-    html += F("</style>");
-    server.sendContent(html);
-
-    server.sendContent(getThemeScript(config.darkMode));
-    server.sendContent(F("</head><body>"));
-
-    html = F("<div class='container'>");
-    html += F("<h1>Aktualizacja OTA</h1>");
-    html += F("<p class='version'>Aktualna wersja: <b>");
-    html += APP_VERSION;
-    html += F("</b></p>");
-    html += F("<p class='subtitle'>Przeciągnij i upuść plik firmware (.bin) lub wybierz go ręcznie.</p>");
-    html += F("<div class='info'>Podczas aktualizacji nie odłączaj zasilania. Po zakończeniu urządzenie zrestartuje się automatycznie.</div>");
-    html += F("<div id='dropzone' class='dropzone' ondrop='handleDrop(event)' ondragover='handleDrag(event)' ondragleave='handleLeave(event)' onclick=\"document.getElementById('file').click();\">");
-    html += F("<p style='margin:0 0 8px 0;'><b>📁 Przeciągnij i upuść</b> plik .bin tutaj</p>");
-    html += F("<p class='muted' style='margin:0 0 8px 0; font-size:0.95em;'>lub <b style='color:#007bff; text-decoration:underline; cursor:pointer;'>kliknij tutaj</b>, aby wybrać plik</p>");
-    html += F("<p id='fileName' class='file-name muted'>Nie wybrano pliku</p>");
-    html += F("<input type='file' id='file' name='update' accept='.bin' style='display:none'>");
-    html += F("</div>");
-    html += F("<div class='btn-row'><button onclick='upload()'>Wgraj aktualizację</button><a href='/config'><button class='ghost'>Powrót</button></a></div>");
-    html += F("<div id='progress-wrap'><div id='progress-bar'>0%</div></div>");
-    html += F("</div>");
-
-    html += F("<script>");
-    html += F("let selectedFile = null;\n");
-    html += F("const drop = document.getElementById('dropzone');\nconst fileInput = document.getElementById('file');\nconst fileNameEl = document.getElementById('fileName');\n");
-    html += F("fileInput.addEventListener('change', ()=>{ if(fileInput.files.length){ setFile(fileInput.files[0]); } });\n");
-    html += F("function setFile(f){ selectedFile = f; fileNameEl.textContent = 'Wybrano: ' + f.name; drop.classList.add('active'); }\n");
-    html += F("function handleDrag(e){ e.preventDefault(); e.stopPropagation(); drop.classList.add('active'); }\n");
-    html += F("function handleLeave(e){ e.preventDefault(); e.stopPropagation(); drop.classList.remove('active'); }\n");
-    html += F("function handleDrop(e){ e.preventDefault(); e.stopPropagation(); drop.classList.add('active'); if(e.dataTransfer.files.length){ setFile(e.dataTransfer.files[0]); } }\n");
-    html += F("function upload(){ if(!selectedFile){ alert('Wybierz plik .bin'); return; } if(!selectedFile.name.endsWith('.bin')){ alert('Błąd: Wymagany jest plik .bin'); return; } const formData = new FormData(); formData.append('update', selectedFile); const xhr = new XMLHttpRequest(); document.getElementById('progress-wrap').style.display='block'; xhr.upload.addEventListener('progress', function(e){ if(e.lengthComputable){ const percent = Math.round((e.loaded/e.total)*100); const bar = document.getElementById('progress-bar'); bar.style.width = percent + '%'; bar.innerText = percent + '%'; }}); xhr.onload = function(){ if(xhr.status === 200){ document.getElementById('progress-bar').innerText = 'Sukces! Restart...'; setTimeout(()=>{ window.location.href='/'; }, 15000); } else { alert('Błąd aktualizacji!'); } }; xhr.open('POST','/update'); xhr.send(formData); }\n");
-    html += F("</script>");
-    html += F("</body></html>");
-
-    server.sendContent(html);
-    server.sendContent(""); // zakończ transmisję
+    ResponseWriter out(server);
+    out.begin(200, "text/html; charset=utf-8");
+
+    out.print(F("<!DOCTYPE html><html lang='pl'><head><meta charset='UTF-8'><meta name='viewport' content='width=device-width, initial-scale=1.0'><title>Aktualizacja OTA</title>"));
+    out.print(F(HTML_ASSET_LINKS));
+    out.print(F("<style>"));
+    out.print(F(".container{max-width:640px;margin:auto;background:var(--card);padding:22px;border-radius:10px;box-shadow:0 10px 30px rgba(0,0,0,0.08);}h1{text-align:center;margin-bottom:10px;}p.subtitle{color:#666;margin-top:0;margin-bottom:16px;text-align:center;} .info{background:var(--inp);border:1px solid var(--brd);padding:10px;border-radius:6px;margin-bottom:12px;font-size:0.95em;}"));
+    out.print(F(".dropzone{margin-top:10px;border:2px dashed #007bff;border-radius:10px;padding:28px;text-align:center;background:rgba(0,123,255,0.05);color:var(--fg);transition:all 0.2s ease;} .dropzone.active{background:rgba(0,123,255,0.12);border-color:#0056b3;} .file-name{margin-top:10px;color:#666;font-size:0.9em;}"));
+    out.print(F(".btn-row{display:flex;gap:10px;flex-wrap:wrap;justify-content:center;margin-top:12px;}button{padding:10px 14px;background-color:var(--btn);color:white;border:none;border-radius:6px;cursor:pointer;}button:hover{background-color:var(--btn-hover);} .ghost{background:#6c757d;} .ghost:hover{background:#5a6268;}"));
+    out.print(F("#progress-wrap{width:100%;background-color:var(--inp);border:1px solid var(--brd);margin-top:20px;display:none;border-radius:6px;overflow:hidden;}#progress-bar{width:0%;height:18px;background-color:#28a745;text-align:center;line-height:18px;color:white;transition:width 0.2s ease;}"));
+    out.print(F(".muted{color:#777;font-size:0.9em;} .version{font-size:0.95em;color:#555;margin-bottom:8px;text-align:center;}"));
+    out.print(F("</style>"));
+
+    printThemeScript(out, config.darkMode);
+    out.print(F("</head><body>"));
+
+    out.print(F("<div class='container'>"));
+    out.print(F("<h1>Aktualizacja OTA</h1>"));
+    out.print(F("<p class='version'>Aktualna wersja: <b>"));
+    out.print(APP_VERSION);
+    out.print(F("</b></p>"));
+    out.print(F("<p class='subtitle'>Przeciągnij i upuść plik firmware (.bin) lub wybierz go ręcznie.</p>"));
+    out.print(F("<div class='info'>Podczas aktualizacji nie odłączaj zasilania. Po zakończeniu urządzenie zrestartuje się automatycznie.</div>"));
+    out.print(F("<div id='dropzone' class='dropzone' ondrop='handleDrop(event)' ondragover='handleDrag(event)' ondragleave='handleLeave(event)' onclick=\"document.getElementById('file').click();\">"));
+    out.print(F("<p style='margin:0 0 8px 0;'><b>📁 Przeciągnij i upuść</b> plik .bin tutaj</p>"));
+    out.print(F("<p class='muted' style='margin:0 0 8px 0; font-size:0.95em;'>lub <b style='color:#007bff; text-decoration:underline; cursor:pointer;'>kliknij tutaj</b>, aby wybrać plik</p>"));
+    out.print(F("<p id='fileName' class='file-name muted'>Nie wybrano pliku</p>"));
+    out.print(F("<input type='file' id='file' name='update' accept='.bin' style='display:none'>"));
+    out.print(F("</div>"));
+    out.print(F("<div class='btn-row'><button onclick='upload()'>Wgraj aktualizację</button><a href='/config'><button class='ghost'>Powrót</button></a></div>"));
+    out.print(F("<div id='progress-wrap'><div id='progress-bar'>0%</div></div>"));
+    out.print(F("</div>"));
+
+    out.print(F("<script>"));
+    out.print(F("let selectedFile = null;\n"));
+    out.print(F("const drop = document.getElementById('dropzone');\nconst fileInput = document.getElementById('file');\nconst fileNameEl = document.getElementById('fileName');\n"));
+    out.print(F("fileInput.addEventListener('change', ()=>{ if(fileInput.files.length){ setFile(fileInput.files[0]); } });\n"));
+    out.print(F("function setFile(f){ selectedFile = f; fileNameEl.textContent = 'Wybrano: ' + f.name; drop.classList.add('active'); }\n"));
+    out.print(F("function handleDrag(e){ e.preventDefault(); e.stopPropagation(); drop.classList.add('active'); }\n"));
+    out.print(F("function handleLeave(e){ e.preventDefault(); e.stopPropagation(); drop.classList.remove('active'); }\n"));
+    out.print(F("function handleDrop(e){ e.preventDefault(); e.stopPropagation(); drop.classList.add('active'); if(e.dataTransfer.files.length){ setFile(e.dataTransfer.files[0]); } }\n"));
+    out.print(F("function upload(){ if(!selectedFile){ alert('Wybierz plik .bin'); return; } if(!selectedFile.name.endsWith('.bin')){ alert('Błąd: Wymagany jest plik .bin'); return; } const formData = new FormData(); formData.append('update', selectedFile); const xhr = new XMLHttpRequest(); document.getElementById('progress-wrap').style.display='block'; xhr.upload.addEventListener('progress', function(e){ if(e.lengthComputable){ const percent = Math.round((e.loaded/e.total)*100); const bar = document.getElementById('progress-bar'); bar.style.width = percent + '%'; bar.innerText = percent + '%'; }}); xhr.onload = function(){ if(xhr.status === 200){ document.getElementById('progress-bar').innerText = 'Sukces! Restart...'; setTimeout(()=>{ window.location.href='/'; }, 15000); } else { alert('Błąd aktualizacji!'); } }; xhr.open('POST','/update'); xhr.send(formData); }\n"));
+    out.print(F("</script>"));
+    out.print(F("</body></html>"));
+
+    out.end();
 }
 
+static bool otaReject = false; // Upload odrzucony (odpowiedź już wysłana) - bez restartu
+
 void handleUpdateResult()
 {
     if (!checkAuth())
     {
         return;
     }
+    if (otaReject)
+    {
+        return; // handleUpdateUpload odpowiedział 400/429, Update.begin() nie ruszał flasha
+    }
     server.sendHeader("Connection", "close");
     if (Update.hasError())
     {
@@ -1923,6 +1900,8 @@ void handleUpdateResult()
 
     // Upewnij się, że system plików zapisał wszystkie dane przed restartem
     // (flush + unmount, kolejny start sam zamontuje FS)
+    historyFlush();
+    incidentsFlush();
     LittleFS.end();
     delay(100);
 
@@ -1937,7 +1916,6 @@ void handleUpdateUpload()
         return;
     }
     HTTPUpload &upload = server.upload();
-    static bool otaReject = false; // odrzuć kolejne chunki po błędzie
     static size_t otaBytes = 0;    // zlicz zapisane bajty
     static String otaName;         // nazwa pliku do walidacji rozszerzenia
     if (upload.status == UPLOAD_FILE_START)
@@ -1947,6 +1925,14 @@ void handleUpdateUpload()
         otaBytes = 0;
         otaName = upload.filename;
 
+        // Limit akcji przed Update.begin() - odrzucenie nie zostawia zapisanego obrazu
+        if (!rateCheck(RATE_ACTION))
+        {
+            otaReject = true;
+            logEvent("OTA: Odrzucono - limit zadan (429)");
+            return;
+        }
+
         // Prosta walidacja: wymagane rozszerzenie .bin
         if (!otaName.endsWith(".bin"))
         {
@@ -1996,6 +1982,7 @@ void handleUpdateUpload()
             Serial.println("[OTA] Empty file uploaded");
             logEvent("OTA: BLAD - plik pusty (0 bajtow)");
             server.send(400, "text/plain", "Plik pusty / rozmiar 0");
+            otaReject = true;
             Update.end(false); // Anuluj aktualizację (ESP8266 nie ma abort())
             Serial.setDebugOutput(false);
             return;
@@ -2023,8 +2010,7 @@ void handleManualConfig()
     WiFi.mode(WIFI_AP);
     uruchomAP();
     uruchommDNS();
-    statusMsg = "Tryb konfiguracyjny - ręczny";
-    lastAPCheckTime = millis();
+    statusMsg = "Tryb konfiguracyjny - ręczny"; // Pierwsza próba wyjścia z AP za apConfigTimeout (taskMode)
     server.send(200, "text/html; charset=utf-8", "<h1>Tryb konfiguracyjny uruchomiony!</h1><p>Połącz się z siecią ESP8266_Config.</p><a href='/config'>Konfiguracja</a>");
 }
 
@@ -2055,6 +2041,8 @@ void handleReboot()
     sendCountdownPage(server, "🔄 Restartowanie urządzenia",
                       "Urządzenie uruchamia się ponownie. Za chwilę nastąpi automatyczne przekierowanie...",
                       15, "/", config.darkMode);
+    historyFlush();
+    incidentsFlush();
     delay(500);
     ESP.restart();
 }
@@ -2,16 +2,15 @@
 #define WEBSERVER_H
 
 #include <ESP8266WebServer.h>
+#include <ArduinoJson.h>
 
 extern ESP8266WebServer server;
-extern unsigned long lastSessionActivity;
 extern const unsigned long SESSION_TIMEOUT;
 
 void setupWebServer();
 void handleRoot();
 void handleLogin();
 void handleLogout();
-void handleSaveConfig();
 void handleReset();
 void handleManualReset();
 void handleConfig();
@@ -30,9 +29,19 @@ void handleNotFound();
 void handleSetBrightness();
 void handleSaveBrightness();
 
+// Zadanie harmonogramu: migawka stanu dla subskrybentów /api/events
+void webLiveLoop();
+
+// Treść tras API - wspólna dla ESP8266WebServer i serwera na zdarzeniach lwIP (async_http.h).
+// Sprawdzenie sesji i wysłanie odpowiedzi należą do wywołującego.
+void apiJsonStatus(JsonDocument &doc, bool withEvents); // /api/status (lista zdarzeń opcjonalnie)
+void apiJsonRtt(JsonDocument &doc);                     // /api/rtt
+void apiJsonIncidents(JsonDocument &doc);               // /api/incidents
+void apiJsonPerf(JsonDocument &doc);                    // /api/perf
+void apiJsonHeap(JsonDocument &doc);                    // /api/heap
+bool apiJsonConfig(JsonDocument &doc, const char *section); // /api/config/<sekcja> (false = nieznana)
+
 // Funkcje LED z main.cpp
-extern void setLed(bool rOn, bool gOn, bool bOn);
-extern int ledBrightness();
 extern void refreshLed();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <ArduinoJson.h>
+#include "webserver.h"
+#include "response_writer.h"
+#include "static_assets.h"
+
+// ----------------------------------------------------------------------------
+// /config: dotychczasowa strona składana w jednym String (html += ... dla
+// każdego pola) kontra obecna - statyczna powłoka z PROGMEM (send_P) i sekcje
+// z /api/config/<sekcja>, każda w osobnym żądaniu. Mierzymy czas (cykle CPU)
+// i największy spadek wolnego heapu w trakcie generowania.
+// ----------------------------------------------------------------------------
+
+// Sekcje jak w CONFIG_SECTIONS (webserver.cpp)
+static const char *const SECTIONS[] = {"general", "monitor", "reset", "safety", "ap", "provider", "lag",
+                                       "schedule", "watchdog", "mode", "backup", "admin", "diag"};
+
+// Wyjście bez pamięci - mierzy sam koszt generowania
+class NullSink : public Print
+{
+public:
+    uint32_t bytes = 0;
+    size_t write(uint8_t) override
+    {
+        bytes++;
+        return 1;
+    }
+    size_t write(const uint8_t *, size_t size) override
+    {
+        bytes += size;
+        return size;
+    }
+};
+
+static uint32_t heapFloor;
+
+static void sampleHeap()
+{
+    uint32_t free = ESP.getFreeHeap();
+    if (free < heapFloor)
+        heapFloor = free;
+}
+
+static uint32_t cyclesToUs(uint32_t cycles)
+{
+    return cycles / ESP.getCpuFreqMHz();
+}
+
+void test_config_sections_known()
+{
+    for (const char *name : SECTIONS)
+    {
+        JsonDocument doc;
+        TEST_ASSERT_TRUE_MESSAGE(apiJsonConfig(doc, name), name);
+        TEST_ASSERT_TRUE_MESSAGE(doc.as<JsonObject>().size() > 0, name);
+    }
+    JsonDocument doc;
+    TEST_ASSERT_FALSE(apiJsonConfig(doc, "nope"));
+}
+
+void test_config_benchmark_vs_string()
+{
+    // Wartości wszystkich sekcji zebrane przed pomiarem - oba warianty piszą te same pola
+    JsonDocument all;
+    for (const char *name : SECTIONS)
+    {
+        JsonDocument section;
+        apiJsonConfig(section, name);
+        all[name] = section;
+    }
+    NullSink sink;
+
+    // Dotychczas: cała strona w String, potem jeden sendContent. Tylko wiersze
+    // formularza (bez układu strony i skryptów) - wynik zaniża dawny koszt.
+    uint32_t heapBefore = ESP.getFreeHeap();
+    heapFloor = heapBefore;
+    uint32_t start = ESP.getCycleCount();
+    uint32_t stringLen;
+    {
+        String html;
+        for (JsonPair section : all.as<JsonObject>())
+        {
+            for (JsonPair field : section.value().as<JsonObject>())
+            {
+                html += F("<div class=\"row\"><label>");
+                html += field.key().c_str();
+                html += F("</label><input name=\"");
+                html += field.key().c_str();
+                html += F("\" value=\"");
+                html += field.value().as<String>();
+                html += F("\"></div>\n");
+                sampleHeap();
+            }
+        }
+        stringLen = html.length();
+        sink.write((const uint8_t *)html.c_str(), html.length());
+    }
+    uint32_t stringCycles = ESP.getCycleCount() - start;
+    uint32_t stringDip = heapBefore - heapFloor;
+
+    // Obecnie: powłoka prosto z PROGMEM przez bufor o stałym rozmiarze
+    heapBefore = ESP.getFreeHeap();
+    heapFloor = heapBefore;
+    start = ESP.getCycleCount();
+    {
+        ResponseWriter out(sink);
+        out.writeP((PGM_P)STATIC_CONFIG_HTML_GZ, STATIC_CONFIG_HTML_GZ_LEN);
+        sampleHeap();
+    }
+    uint32_t shellCycles = ESP.getCycleCount() - start;
+    uint32_t shellDip = heapBefore - heapFloor;
+
+    // ...i sekcje jak w handleApiConfig: JsonDocument + serializacja przez writer.
+    // Liczy się najgorsza sekcja (każda to osobne żądanie) i suma czasu.
+    uint32_t sectionCycles = 0;
+    uint32_t sectionDip = 0;
+    uint32_t sectionBytes = 0;
+    const char *worst = "";
+    for (const char *name : SECTIONS)
+    {
+        heapBefore = ESP.getFreeHeap();
+        heapFloor = heapBefore;
+        start = ESP.getCycleCount();
+        {
+            JsonDocument doc;
+            apiJsonConfig(doc, name);
+            sampleHeap();
+            ResponseWriter out(sink);
+            serializeJson(doc, out);
+            sampleHeap();
+            out.flush();
+            sectionBytes += out.total();
+        }
+        sectionCycles += ESP.getCycleCount() - start;
+        if (heapBefore - heapFloor > sectionDip)
+        {
+            sectionDip = heapBefore - heapFloor;
+            worst = name;
+        }
+    }
+
+    char msg[192];
+    snprintf(msg, sizeof(msg), "String: %lu B, %lu us, heap -%lu B | powloka: %lu B gzip, %lu us, heap -%lu B",
+             (unsigned long)stringLen, (unsigned long)cyclesToUs(stringCycles), (unsigned long)stringDip,
+             (unsigned long)STATIC_CONFIG_HTML_GZ_LEN, (unsigned long)cyclesToUs(shellCycles), (unsigned long)shellDip);
+    TEST_MESSAGE(msg);
+    snprintf(msg, sizeof(msg), "Sekcje: %lu B JSON, %lu us razem, heap -%lu B najwiecej (%s)",
+             (unsigned long)sectionBytes, (unsigned long)cyclesToUs(sectionCycles), (unsigned long)sectionDip, worst);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_TRUE(sectionDip < stringDip);
+}
+
+void setup()
+{
+    delay(2000); // Stabilizacja UART
+    UNITY_BEGIN();
+    RUN_TEST(test_config_sections_known);
+    RUN_TEST(test_config_benchmark_vs_string);
+    UNITY_END();
+}
+
+void loop()
+{
+    // Nie używamy pętli w testach jednostkowych
+}
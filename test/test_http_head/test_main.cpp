@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "http_head.h"
+
+static const char HEAD[] = "GET /api/status?ev=12&x HTTP/1.1\r\n"
+                           "Host: 192.168.1.50\r\n"
+                           "cookie:  theme=dark; ESPSESSIONID=abc\r\n"
+                           "\r\n";
+
+void test_head_length()
+{
+    size_t full = strlen(HEAD);
+    TEST_ASSERT_EQUAL(full, httpHeadLength(HEAD, full));
+    TEST_ASSERT_EQUAL(0, httpHeadLength(HEAD, full - 1));
+    String withBody = String(HEAD) + "user=admin";
+    TEST_ASSERT_EQUAL(full, httpHeadLength(withBody.c_str(), withBody.length())); // Treść po nagłówku się nie liczy
+    TEST_ASSERT_EQUAL(16, httpHeadLength("GET / HTTP/1.0\n\nbody", 20));
+}
+
+void test_request_line()
+{
+    char method[8], path[32], query[32];
+    TEST_ASSERT_TRUE(httpHeadRequestLine(HEAD, method, sizeof(method), path, sizeof(path), query, sizeof(query)));
+    TEST_ASSERT_EQUAL_STRING("GET", method);
+    TEST_ASSERT_EQUAL_STRING("/api/status", path);
+    TEST_ASSERT_EQUAL_STRING("ev=12&x", query);
+
+    TEST_ASSERT_TRUE(httpHeadRequestLine("POST /login HTTP/1.1\r\n\r\n", method, sizeof(method), path, sizeof(path), query, sizeof(query)));
+    TEST_ASSERT_EQUAL_STRING("POST", method);
+    TEST_ASSERT_EQUAL_STRING("/login", path);
+    TEST_ASSERT_EQUAL_STRING("", query);
+
+    // Niepoprawna linia albo ścieżka dłuższa niż bufor
+    TEST_ASSERT_FALSE(httpHeadRequestLine("GET\r\n\r\n", method, sizeof(method), path, sizeof(path), query, sizeof(query)));
+    TEST_ASSERT_FALSE(httpHeadRequestLine("GET http://x/ HTTP/1.1\r\n\r\n", method, sizeof(method), path, sizeof(path), query, sizeof(query)));
+    TEST_ASSERT_FALSE(httpHeadRequestLine(HEAD, method, sizeof(method), path, 8, query, sizeof(query)));
+}
+
+void test_header_field()
+{
+    char value[40];
+    TEST_ASSERT_TRUE(httpHeadField(HEAD, "Cookie", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("theme=dark; ESPSESSIONID=abc", value);
+    TEST_ASSERT_TRUE(httpHeadField(HEAD, "host", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("192.168.1.50", value);
+    TEST_ASSERT_FALSE(httpHeadField(HEAD, "Hos", value, sizeof(value)));
+    TEST_ASSERT_FALSE(httpHeadField(HEAD, "If-None-Match", value, sizeof(value)));
+    TEST_ASSERT_FALSE(httpHeadField(HEAD, "Cookie", value, 8)); // Za długa wartość
+}
+
+void test_query_arg()
+{
+    char value[8];
+    TEST_ASSERT_TRUE(httpQueryArg("ev=12&x", "ev", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("12", value);
+    TEST_ASSERT_TRUE(httpQueryArg("ev=12&x", "x", value, sizeof(value)));
+    TEST_ASSERT_EQUAL_STRING("", value);
+    TEST_ASSERT_FALSE(httpQueryArg("event=1", "ev", value, sizeof(value)));
+    TEST_ASSERT_FALSE(httpQueryArg("", "ev", value, sizeof(value)));
+    TEST_ASSERT_FALSE(httpQueryArg("res=123456789", "res", value, sizeof(value)));
+}
+
+void setup()
+{
+    delay(2000); // Stabilizacja UART
+    UNITY_BEGIN();
+    RUN_TEST(test_head_length);
+    RUN_TEST(test_request_line);
+    RUN_TEST(test_header_field);
+    RUN_TEST(test_query_arg);
+    UNITY_END();
+}
+
+void loop()
+{
+    // Nie używamy pętli w testach jednostkowych
+}
@@ -0,0 +1,91 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "rate_limit.h"
+
+static const uint32_t IP_A = 0x0A01A8C0; // 192.168.1.10
+static const uint32_t IP_B = 0x0B01A8C0; // 192.168.1.11
+
+// Ile żądań przejdzie pod rząd w tej samej chwili
+static uint16_t burstAllowed(uint32_t ip, uint8_t cls, uint32_t nowMs)
+{
+    uint32_t retryMs;
+    uint16_t n = 0;
+    while (n < 1000 && rateAllow(ip, cls, nowMs, retryMs))
+        n++;
+    return n;
+}
+
+void test_bucket_burst_and_refill()
+{
+    rateReset();
+    uint16_t burst = burstAllowed(IP_A, RATE_ACTION, 1000);
+    TEST_ASSERT_TRUE(burst > 0 && burst < 1000);
+
+    uint32_t retryMs;
+    TEST_ASSERT_FALSE(rateAllow(IP_A, RATE_ACTION, 1000, retryMs));
+    TEST_ASSERT_TRUE(retryMs > 0);
+    TEST_ASSERT_TRUE(rateAllow(IP_A, RATE_ACTION, 1000 + retryMs, retryMs)); // Żeton wrócił
+
+    // Inna klasa i inny adres mają własne kubełki
+    TEST_ASSERT_TRUE(rateAllow(IP_A, RATE_PAGE, 1000, retryMs));
+    TEST_ASSERT_TRUE(rateAllow(IP_B, RATE_ACTION, 1000, retryMs));
+    TEST_ASSERT_TRUE(rateAllow(IP_A, RATE_EXEMPT, 1000, retryMs));
+
+    RateLimitCounters c;
+    rateCounters(c);
+    TEST_ASSERT_EQUAL_UINT32(2, c.rejected[RATE_ACTION]); // Koniec serii + jawna próba
+    TEST_ASSERT_EQUAL_UINT8(2, c.clients);
+}
+
+void test_login_lockout_grows()
+{
+    rateReset();
+    uint32_t now = 1000;
+    for (uint8_t i = 0; i < RATE_LOGIN_FREE_FAILS; i++)
+        TEST_ASSERT_EQUAL_UINT32(0, rateLoginFailed(IP_A, now));
+
+    uint32_t first = rateLoginFailed(IP_A, now);
+    TEST_ASSERT_EQUAL_UINT32(RATE_LOGIN_LOCK_BASE_MS, first);
+    uint32_t retryMs;
+    TEST_ASSERT_FALSE(rateAllow(IP_A, RATE_LOGIN, now + first - 1, retryMs));
+    TEST_ASSERT_EQUAL_UINT32(1, retryMs);
+    TEST_ASSERT_TRUE(rateAllow(IP_B, RATE_LOGIN, now, retryMs)); // Inny adres bez blokady
+
+    now += first;
+    TEST_ASSERT_EQUAL_UINT32(2 * RATE_LOGIN_LOCK_BASE_MS, rateLoginFailed(IP_A, now));
+    for (uint8_t i = 0; i < 20; i++)
+        rateLoginFailed(IP_A, now);
+    TEST_ASSERT_EQUAL_UINT32(RATE_LOGIN_LOCK_MAX_MS, rateLoginFailed(IP_A, now));
+
+    rateLoginSucceeded(IP_A);
+    TEST_ASSERT_TRUE(rateAllow(IP_A, RATE_LOGIN, now + 1, retryMs));
+    TEST_ASSERT_EQUAL_UINT32(0, rateLoginFailed(IP_A, now + 1));
+}
+
+void test_lockout_survives_address_churn()
+{
+    rateReset();
+    for (uint8_t i = 0; i <= RATE_LOGIN_FREE_FAILS; i++)
+        rateLoginFailed(IP_A, 0);
+
+    // Nowe adresy zajmują tablicę - zablokowany adres nie jest wypierany
+    uint32_t retryMs;
+    for (uint32_t i = 1; i <= 3 * RATE_MAX_CLIENTS; i++)
+        rateAllow(IP_B + (i << 24), RATE_PAGE, i, retryMs);
+    TEST_ASSERT_FALSE(rateAllow(IP_A, RATE_LOGIN, 100, retryMs));
+}
+
+void setup()
+{
+    delay(2000); // Stabilizacja UART
+    UNITY_BEGIN();
+    RUN_TEST(test_bucket_burst_and_refill);
+    RUN_TEST(test_login_lockout_grows);
+    RUN_TEST(test_lockout_survives_address_churn);
+    UNITY_END();
+}
+
+void loop()
+{
+    // Nie używamy pętli w testach jednostkowych
+}
@@ -0,0 +1,87 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "rtt_stats.h"
+
+void test_rtt_empty_window()
+{
+    rttStatsReset();
+    RttWindowSummary s;
+    TEST_ASSERT_FALSE(rttStatsSummary(RTT_WIN_1M, s));
+    TEST_ASSERT_EQUAL_UINT32(0, s.samples);
+    TEST_ASSERT_EQUAL_UINT32(0, s.lost);
+}
+
+void test_rtt_quantiles_ignore_single_spike()
+{
+    rttStatsReset();
+    for (int i = 0; i < 100; i++)
+        rttStatsRecord(20 + (i % 10)); // 20..29 ms
+    rttStatsRecord(1500);              // Pojedynczy spike
+
+    RttWindowSummary s;
+    TEST_ASSERT_TRUE(rttStatsSummary(RTT_WIN_15M, s));
+    TEST_ASSERT_EQUAL_UINT32(101, s.samples);
+    TEST_ASSERT_EQUAL_UINT16(20, s.minMs);
+    TEST_ASSERT_EQUAL_UINT16(1500, s.maxMs);
+    TEST_ASSERT_UINT32_WITHIN(5, 25, s.p50);
+    TEST_ASSERT_LESS_OR_EQUAL(30, s.p95);
+    TEST_ASSERT_FALSE(rttStatsP95Exceeds(1000));
+}
+
+void test_rtt_p95_needs_min_samples()
+{
+    rttStatsReset();
+    for (int i = 0; i < RTT_P95_MIN_SAMPLES - 1; i++)
+        rttStatsRecord(3000);
+    TEST_ASSERT_FALSE(rttStatsP95Exceeds(2000));
+    rttStatsRecord(3000);
+    TEST_ASSERT_TRUE(rttStatsP95Exceeds(2000));
+}
+
+void test_rtt_loss_and_jitter()
+{
+    rttStatsReset();
+    rttStatsRecord(10);
+    rttStatsRecord(26); // |D| = 16 -> J = 1
+    rttStatsRecordLoss();
+
+    RttWindowSummary s;
+    TEST_ASSERT_TRUE(rttStatsSummary(RTT_WIN_1M, s));
+    TEST_ASSERT_EQUAL_UINT32(2, s.samples);
+    TEST_ASSERT_EQUAL_UINT32(1, s.lost);
+    TEST_ASSERT_TRUE(rttStatsJitter() > 0.99f && rttStatsJitter() < 1.01f);
+    TEST_ASSERT_TRUE(rttStatsEwma() > 11.9f && rttStatsEwma() < 12.1f);
+}
+
+void test_rtt_restart_short_windows()
+{
+    rttStatsReset();
+    for (int i = 0; i < RTT_P95_MIN_SAMPLES; i++)
+        rttStatsRecord(3000);
+    TEST_ASSERT_TRUE(rttStatsP95Exceeds(2000));
+
+    // Po cyklu routera stary P95 nie oblewa nowego połączenia; 24 h zostaje
+    rttStatsRestartShortWindows();
+    TEST_ASSERT_FALSE(rttStatsP95Exceeds(2000));
+    RttWindowSummary s;
+    TEST_ASSERT_FALSE(rttStatsSummary(RTT_WIN_15M, s));
+    TEST_ASSERT_TRUE(rttStatsSummary(RTT_WIN_24H, s));
+    TEST_ASSERT_EQUAL_UINT32(RTT_P95_MIN_SAMPLES, s.samples);
+}
+
+void setup()
+{
+    delay(2000); // Stabilizacja UART
+    UNITY_BEGIN();
+    RUN_TEST(test_rtt_empty_window);
+    RUN_TEST(test_rtt_quantiles_ignore_single_spike);
+    RUN_TEST(test_rtt_p95_needs_min_samples);
+    RUN_TEST(test_rtt_loss_and_jitter);
+    RUN_TEST(test_rtt_restart_short_windows);
+    UNITY_END();
+}
+
+void loop()
+{
+    // Nie używamy pętli w testach jednostkowych
+}
@@ -0,0 +1,82 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "scheduler.h"
+
+// Harmonogram nie ma funkcji usuwania zadań - każdy test rejestruje własne
+static uint16_t fastRuns = 0;
+static uint16_t lateRuns = 0;
+static uint16_t oneShotRuns = 0;
+static int8_t oneShotId = -1;
+
+static void taskFast() { fastRuns++; }
+static void taskLate() { lateRuns++; }
+
+static void taskOneShot()
+{
+    oneShotRuns++;
+    schedEnable(oneShotId, false); // Jednorazowe wybudzenie - do kolejnego schedWakeIn
+}
+
+// Obiegi loop() przez durationMs, jak w main.cpp (bez oddawania procesora dłużej niż idle)
+static void runFor(uint32_t durationMs)
+{
+    unsigned long start = millis();
+    while (millis() - start < durationMs)
+    {
+        uint32_t idle = schedRun();
+        delay(idle ? idle : 1);
+    }
+}
+
+void test_period_and_idle()
+{
+    schedAdd("fast", taskFast, 5, 0);
+    runFor(100);
+    TEST_ASSERT_UINT32_WITHIN(2, 20, fastRuns);
+
+    uint32_t idle = schedRun();
+    TEST_ASSERT_TRUE(idle <= 5);
+}
+
+void test_wakeup_beyond_one_revolution()
+{
+    int8_t id = schedAdd("late", taskLate, 100000, 0);
+    runFor(5); // Pierwsze uruchomienie zaraz po rejestracji
+    TEST_ASSERT_EQUAL_UINT16(1, lateRuns);
+
+    schedWakeIn(id, 10 * SCHED_WHEEL_SLOTS + 3); // Kilka obrotów koła
+    runFor(10 * SCHED_WHEEL_SLOTS);
+    TEST_ASSERT_EQUAL_UINT16(1, lateRuns);
+    runFor(20);
+    TEST_ASSERT_EQUAL_UINT16(2, lateRuns);
+}
+
+void test_one_shot_and_long_stall()
+{
+    oneShotId = schedAdd("oneshot", taskOneShot, 1000, 0);
+    runFor(5);
+    TEST_ASSERT_EQUAL_UINT16(1, oneShotRuns);
+    runFor(3000);
+    TEST_ASSERT_EQUAL_UINT16(1, oneShotRuns); // Wyłączone - brak terminu
+
+    schedEnable(oneShotId, true);
+    schedWakeIn(oneShotId, 50);
+    delay(500); // Obieg zablokowany dłużej niż obrót koła (np. ping)
+    schedRun();
+    TEST_ASSERT_EQUAL_UINT16(2, oneShotRuns);
+}
+
+void setup()
+{
+    delay(2000); // Stabilizacja UART
+    UNITY_BEGIN();
+    RUN_TEST(test_period_and_idle);
+    RUN_TEST(test_wakeup_beyond_one_revolution);
+    RUN_TEST(test_one_shot_and_long_stall);
+    UNITY_END();
+}
+
+void loop()
+{
+    // Nie używamy pętli w testach jednostkowych
+}
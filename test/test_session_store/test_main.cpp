@@ -0,0 +1,90 @@
+#include <Arduino.h>
+#include <unity.h>
+#include "session_store.h"
+
+// Nagłówek Cookie z tokenem (jak wysyła przeglądarka, z innym ciasteczkiem przed nim)
+static String cookieFor(const char *token)
+{
+    return String("theme=dark; ") + COOKIE_NAME + "=" + token;
+}
+
+void test_cookie_parse()
+{
+    char token[SESSION_TOKEN_LENGTH + 1];
+    TEST_ASSERT_FALSE(sessionTokenFromCookie("", token, sizeof(token)));
+    TEST_ASSERT_FALSE(sessionTokenFromCookie("XESPSESSIONID=0123456789abcdef0123456789abcdef", token, sizeof(token)));
+    TEST_ASSERT_FALSE(sessionTokenFromCookie("ESPSESSIONID=short", token, sizeof(token)));
+    TEST_ASSERT_TRUE(sessionTokenFromCookie("a=1;ESPSESSIONID=0123456789abcdef0123456789abcdef; b=2", token, sizeof(token)));
+    TEST_ASSERT_EQUAL_STRING("0123456789abcdef0123456789abcdef", token);
+}
+
+void test_sessions_are_independent()
+{
+    sessionClearAll();
+    String first = sessionCreate(1000);
+    String second = sessionCreate(2000);
+    TEST_ASSERT_FALSE(first == second);
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(first.c_str(), 3000));
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(second.c_str(), 3000));
+
+    sessionEnd(first.c_str());
+    TEST_ASSERT_EQUAL(SESSION_NONE, sessionCheck(first.c_str(), 4000));
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(second.c_str(), 4000));
+
+    // Ten sam numer miejsca, inny token
+    String forged = second;
+    forged[SESSION_TOKEN_LENGTH - 1] ^= 1;
+    TEST_ASSERT_EQUAL(SESSION_NONE, sessionCheck(forged.c_str(), 4000));
+}
+
+void test_session_expiry_per_session()
+{
+    sessionClearAll();
+    String idle = sessionCreate(0);
+    String active = sessionCreate(0);
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(active.c_str(), SESSION_TIMEOUT_MS - 1));
+    TEST_ASSERT_EQUAL(SESSION_EXPIRED, sessionCheck(idle.c_str(), SESSION_TIMEOUT_MS + 1));
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(active.c_str(), SESSION_TIMEOUT_MS + 1));
+    TEST_ASSERT_EQUAL(1, sessionActiveCount(SESSION_TIMEOUT_MS + 1));
+}
+
+void test_lru_eviction()
+{
+    sessionClearAll();
+    String tokens[SESSION_MAX];
+    for (uint8_t i = 0; i < SESSION_MAX; i++)
+        tokens[i] = sessionCreate(1000 + i);
+    sessionCheck(tokens[0].c_str(), 2000); // Najstarsza, ale właśnie użyta
+
+    String extra = sessionCreate(3000); // Zastępuje najdawniej używaną: tokens[1]
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(tokens[0].c_str(), 3000));
+    TEST_ASSERT_EQUAL(SESSION_NONE, sessionCheck(tokens[1].c_str(), 3000));
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(extra.c_str(), 3000));
+    TEST_ASSERT_EQUAL(SESSION_MAX, sessionActiveCount(3000));
+}
+
+void test_cookie_round_trip()
+{
+    sessionClearAll();
+    String issued = sessionCreate(0);
+    char token[SESSION_TOKEN_LENGTH + 1];
+    TEST_ASSERT_TRUE(sessionTokenFromCookie(cookieFor(issued.c_str()).c_str(), token, sizeof(token)));
+    TEST_ASSERT_EQUAL(SESSION_VALID, sessionCheck(token, 10));
+}
+
+void setup()
+{
+    delay(2000); // Stabilizacja UART
+    UNITY_BEGIN();
+    RUN_TEST(test_cookie_parse);
+    RUN_TEST(test_sessions_are_independent);
+    RUN_TEST(test_session_expiry_per_session);
+    RUN_TEST(test_lru_eviction);
+    RUN_TEST(test_cookie_round_trip);
+    UNITY_END();
+}
+
+void loop()
+{
+    // Nie używamy pętli w testach jednostkowych
+}
@@ -0,0 +1,176 @@
+function updateHidden(id) {
+    var dispInput = document.getElementById(id + '_disp');
+    var disp = dispInput.value;
+    if (disp < 0) { disp = 0; dispInput.value = 0; }
+    var unit = document.getElementById(id + '_unit').value;
+    document.getElementById(id).value = Math.round(disp * unit);
+}
+function initTimeField(id, valMs) {
+    console.log('[JS] initTimeField(' + id + ', ' + valMs + ' ms)');
+    
+    var unit = 1;
+    if (valMs > 0) {
+        if (valMs % 60000 == 0) unit = 60000;
+        else if (valMs % 1000 == 0) unit = 1000;
+    }
+    document.getElementById(id + '_unit').value = unit;
+    document.getElementById(id + '_disp').value = valMs / unit;
+    document.getElementById(id).value = valMs;
+    
+    console.log('[JS] ' + id + '_disp = ' + (valMs / unit) + ', unit = ' + unit);
+}
+function convertUnit(id) {
+    var valMs = document.getElementById(id).value;
+    var unit = document.getElementById(id + '_unit').value;
+    var newDisp = valMs / unit;
+    if (newDisp % 1 !== 0) newDisp = parseFloat(newDisp.toFixed(2));
+    document.getElementById(id + '_disp').value = newDisp;
+}
+function setGlobalUnit(unit) {
+    // Zmień jednostki we wszystkich fieldach
+    var fieldIds = ['pingInterval', 'routerOffTime', 'baseBootTime', 'noWiFiTimeout', 'apConfigTimeout', 'awakeWindowMs', 'sleepWindowMs', 'maxPingMs', 'apBackoffMs', 'dhcpTimeoutMs', 'backupNetworkRetryInterval'];
+    fieldIds.forEach(id => {
+        var unitEl = document.getElementById(id + '_unit');
+        if (unitEl) {
+            unitEl.value = unit;
+            convertUnit(id);
+        }
+    });
+    // Zapisz wybraną jednostkę w ukrytym polu
+    var globalUnitInput = document.getElementById('globalUnitValue');
+    if (globalUnitInput) {
+        globalUnitInput.value = unit;
+    }
+}
+function showSaveNotice() {
+    const params = new URLSearchParams(window.location.search);
+    if (params.get('saved') !== '1') return;
+
+    showToast('✅ Konfiguracja zapisana', 'success');
+
+    // Usuń parametr z adresu, żeby nie powtarzać powiadomienia
+    history.replaceState({}, '', window.location.pathname);
+}
+function showToast(message, type='info') {
+    const toast = document.createElement('div');
+    toast.className = 'toast ' + (type==='success' ? 'toast-success' : type==='error' ? 'toast-error' : 'toast-info');
+    toast.textContent = message;
+    document.body.appendChild(toast);
+    setTimeout(() => {
+        toast.classList.add('hide');
+        setTimeout(() => toast.remove(), 450);
+    }, 1800);
+}
+function validateSleepTimes() {
+    // Walidacja czasów uśpienia: min 5 min, max 60 min
+    const SLEEP_MIN_MS = 5 * 60 * 1000;      // 5 minut
+    const SLEEP_MAX_MS = 60 * 60 * 1000;     // 60 minut
+    const sleepField = document.getElementById('sleepWindowMs');
+    const sleepDispField = document.getElementById('sleepWindowMs_disp');
+    const sleepUnitField = document.getElementById('sleepWindowMs_unit');
+    
+    if (!sleepField || !sleepDispField || !sleepUnitField) return;
+    
+    let valMs = parseInt(sleepField.value) || 0;
+    let currentUnit = parseInt(sleepUnitField.value);
+    
+    // Sprawdzenie limitów
+    if (valMs < SLEEP_MIN_MS) {
+        sleepField.value = SLEEP_MIN_MS;
+        sleepDispField.value = (SLEEP_MIN_MS / currentUnit).toFixed(currentUnit >= 60000 ? 1 : (currentUnit >= 1000 ? 0 : 0));
+        
+        let unitName = currentUnit >= 60000 ? 'min' : (currentUnit >= 1000 ? 's' : 'ms');
+        let displayValue = (SLEEP_MIN_MS / currentUnit).toFixed(1);
+        alert('⚠️ Minimalny czas uśpienia to 5 minut (' + displayValue + ' ' + unitName + ')');
+    } else if (valMs > SLEEP_MAX_MS) {
+        sleepField.value = SLEEP_MAX_MS;
+        sleepDispField.value = (SLEEP_MAX_MS / currentUnit).toFixed(currentUnit >= 60000 ? 1 : (currentUnit >= 1000 ? 0 : 0));
+        
+        let unitName = currentUnit >= 60000 ? 'min' : (currentUnit >= 1000 ? 's' : 'ms');
+        let displayValue = (SLEEP_MAX_MS / currentUnit).toFixed(1);
+        alert('⚠️ Maksymalny czas uśpienia to 60 minut (' + displayValue + ' ' + unitName + ')');
+    }
+}
+function toggleTheme(checked) {
+    document.documentElement.setAttribute('data-theme', checked ? 'dark' : 'light');
+    localStorage.setItem('theme', checked ? 'dark' : 'light');
+}
+function initTheme() {
+    var checkbox = document.getElementById('themeSwitch');
+    if (!checkbox) return;
+    var isConfigPage = (checkbox.getAttribute('form') === 'configForm');
+    if (isConfigPage) {
+        var isDark = checkbox.checked;
+        document.documentElement.setAttribute('data-theme', isDark ? 'dark' : 'light');
+        localStorage.setItem('theme', isDark ? 'dark' : 'light');
+    } else {
+        var savedTheme = localStorage.getItem('theme');
+        if (savedTheme) {
+            var isDark = (savedTheme === 'dark');
+            document.documentElement.setAttribute('data-theme', isDark ? 'dark' : 'light');
+            checkbox.checked = isDark;
+        } else {
+            var isDark = checkbox.checked;
+            document.documentElement.setAttribute('data-theme', isDark ? 'dark' : 'light');
+            localStorage.setItem('theme', isDark ? 'dark' : 'light');
+        }
+    }
+}
+function togglePassword(id) {
+    var x = document.getElementById(id);
+    var btn = x.parentElement.querySelector('button');
+    x.type = (x.type === "password") ? "text" : "password";
+    if (btn) {
+        btn.textContent = x.type === "password" ? "👁️" : "👁️‍🗨️";
+    }
+    if (x) {
+        x.focus();
+        if (x.value && x.value.length) {
+            x.setSelectionRange(x.value.length, x.value.length);
+        }
+    }
+}
+// Suwak jasności: etykieta od razu, żądanie najwyżej co BRIGHTNESS_SEND_MS
+// (wspólny limit żądań stron) - ostatnia wartość zawsze dochodzi
+var BRIGHTNESS_SEND_MS = 250;
+var brightnessTimer = null;
+var brightnessSentAt = 0;
+var brightnessValue = null;
+function updateBrightness(value) {
+    document.getElementById('ledBrightnessVal').textContent = value;
+    brightnessValue = value;
+    if (brightnessTimer) return;
+    var wait = Math.max(0, brightnessSentAt + BRIGHTNESS_SEND_MS - Date.now());
+    brightnessTimer = setTimeout(sendBrightness, wait);
+}
+function sendBrightness() {
+    brightnessTimer = null;
+    brightnessSentAt = Date.now();
+    fetch('/setbrightness?val=' + brightnessValue);
+}
+
+// Accordion - zamykaj poprzednio otwartą zakładkę gdy otworzy się nowa
+document.addEventListener('DOMContentLoaded', function() {
+    const accordions = document.querySelectorAll('.accordion, .section.accordion');
+    accordions.forEach(accordion => {
+        const summary = accordion.querySelector('summary');
+        if (summary) {
+            summary.addEventListener('click', function() {
+                const wasOpen = accordion.hasAttribute('open');
+                const container = accordion.parentElement || accordion;
+                const allAccordions = container.querySelectorAll('.accordion, .section.accordion');
+                allAccordions.forEach(other => {
+                    if (other !== accordion) {
+                        other.removeAttribute('open');
+                    }
+                });
+                // Przewiń do otwartej sekcji (po krótkim opóźnieniu aby accordion się rozwinął)
+                if (!wasOpen) {
+                    setTimeout(() => {
+                        accordion.scrollIntoView({ behavior: 'smooth', block: 'start' });
+                    }, 100);
+                }
+            });
+        }
+    });
+});
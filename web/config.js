@@ -0,0 +1,226 @@
+// Strona konfiguracji (web/config.html) - statyczna powłoka buforowana przez przeglądarkę.
+// Każdy element z data-section="nazwa" należy do sekcji /api/config/<nazwa>: wartości
+// pobierane są przy pierwszym rozwinięciu sekcji (sekcje zawsze widoczne - od razu),
+// a zapis wysyła tylko pola zmienionych sekcji, każdą osobnym żądaniem POST.
+// Klucze JSON = atrybuty name pól formularza; data-field="klucz" to wartości tylko do odczytu.
+
+const SESSION_MS = 300000; // 5 minut
+let sessionEndsAt = Date.now() + SESSION_MS;
+let warnedExpiring = false;
+let countdownInterval = null;
+
+const TIME_FIELDS = ['pingInterval', 'routerOffTime', 'baseBootTime', 'noWiFiTimeout', 'apConfigTimeout',
+    'awakeWindowMs', 'sleepWindowMs', 'maxPingMs', 'apBackoffMs', 'dhcpTimeoutMs', 'backupNetworkRetryInterval'];
+const BOOT_PHASES = ['WiFi', 'Brama', 'Internet'];
+
+const loaded = {};   // Sekcje już pobrane (lub w trakcie)
+const dirty = {};    // Sekcje ze zmianami do zapisu
+let globalUnit = 0;  // Jednostka pól czasu z sekcji "general" (0 = jeszcze nieznana)
+
+function sectionEls(name) { return document.querySelectorAll('[data-section="' + name + '"]'); }
+
+function sectionFields(name) {
+    const out = [];
+    sectionEls(name).forEach(el => el.querySelectorAll('[name]').forEach(f => out.push(f)));
+    return out;
+}
+
+function apiError(r) {
+    // checkAuth() przekierowuje na /login - sesja wygasła
+    if (r.redirected && r.url.indexOf('/login') >= 0) {
+        window.location.href = '/login';
+        throw new Error('Sesja wygasła');
+    }
+    // Limit żądań (rate_limit.h) - odpowiedź bez treści
+    if (r.status === 429) throw new Error('Zbyt wiele żądań - spróbuj za ' + (r.headers.get('Retry-After') || '1') + ' s');
+    return r.json().then(j => { throw new Error(j.error || ('HTTP ' + r.status)); });
+}
+
+function loadSection(name) {
+    if (loaded[name]) return;
+    loaded[name] = true;
+    sectionEls(name).forEach(el => el.classList.add('loading'));
+    fetch('/api/config/' + name, { credentials: 'include', cache: 'no-store' })
+        .then(r => r.ok && !r.redirected ? r.json() : apiError(r))
+        .then(data => fillSection(name, data))
+        .catch(e => {
+            loaded[name] = false; // Ponowna próba przy kolejnym rozwinięciu
+            showToast('❌ ' + name + ': ' + e.message, 'error');
+        })
+        .then(() => sectionEls(name).forEach(el => el.classList.remove('loading')));
+}
+
+function fillSection(name, data) {
+    sectionFields(name).forEach(f => {
+        if (!(f.name in data)) return;
+        const v = data[f.name];
+        if (f.type === 'checkbox') f.checked = !!v;
+        else if (f.type === 'radio') f.checked = (f.value === String(v));
+        else if (TIME_FIELDS.indexOf(f.id) >= 0) {
+            initTimeField(f.id, v);
+            if (globalUnit) { document.getElementById(f.id + '_unit').value = globalUnit; convertUnit(f.id); }
+        } else f.value = v;
+    });
+    sectionEls(name).forEach(el => el.querySelectorAll('[data-field]').forEach(f => {
+        const key = f.getAttribute('data-field');
+        if (key in data) renderField(f, key, data[key]);
+    }));
+    if (name === 'general') applyGeneral(data);
+    if (name === 'mode') toggleDutyFields();
+    if (name === 'diag') applyDiag(data);
+    dirty[name] = false;
+}
+
+function renderField(el, key, v) {
+    if (key === 'bootModel') return renderBootModel(el, v);
+    if (key === 'safeModeActive') {
+        el.textContent = v ? '⚠️ AKTYWNY - Router zablokowany!' : '✓ Nieaktywny';
+        el.style.cssText = v ? 'color:red; font-weight:bold;' : 'color:green;';
+        return;
+    }
+    el.textContent = v;
+}
+
+function renderBootModel(el, m) {
+    const sec = ms => (ms / 1000).toFixed(1) + ' s';
+    if (!m.samples) {
+        el.innerHTML = "<p style='font-size:0.85em; color:#666; margin-top:5px;'>Brak pomiarów rozruchu - pojawią się po pierwszym resecie routera.</p>";
+        return;
+    }
+    let html = "<p style='margin-top:10px;'>Zmierzone rozruchy: <b>" + m.samples + '</b>, bez potwierdzenia internetu: <b>' + m.timeouts +
+        "</b></p><table style='width:100%; text-align:center;'><tr><th>Faza</th><th>Próbki</th><th>P50</th><th>P95</th><th>Max</th></tr>";
+    m.phases.forEach((p, i) => {
+        html += '<tr><td>' + BOOT_PHASES[i] + '</td><td>' + p.samples + '</td>' +
+            (p.samples ? '<td>' + sec(p.p50Ms) + '</td><td>' + sec(p.p95Ms) + '</td><td>' + sec(p.maxMs) + '</td>' : '<td>-</td><td>-</td><td>-</td>') + '</tr>';
+    });
+    html += '</table><p>Proponowany czas rozruchu: <b>' + (m.suggestedMs
+        ? Math.floor(m.suggestedMs / 1000) + ' s</b> (obecnie ' + Math.floor(m.currentMs / 1000) + ' s)'
+        : 'za mało pomiarów</b> (min. ' + m.minSamples + ')') + '</p>';
+    el.innerHTML = html;
+}
+
+function applyGeneral(data) {
+    toggleTheme(data.darkMode);
+    document.getElementById('ledBrightnessVal').textContent = data.ledBrightness;
+    globalUnit = data.globalUnitValue;
+    setGlobalUnit(globalUnit);
+}
+
+function applyDiag(data) {
+    document.querySelectorAll('[data-led]').forEach(d => d.classList.toggle('glow-' + d.getAttribute('data-led'), d.getAttribute('data-led') === data.led));
+    const label = document.getElementById('simLabel');
+    label.textContent = data.simLabel;
+    label.style.color = data.simActive ? 'red' : 'green';
+    document.getElementById('simStatus').textContent = data.simStatus;
+    document.getElementById('manualConfigLink').style.display = data.apMode ? 'none' : '';
+}
+
+// Pola formularza sekcji jak przy zwykłym wysłaniu: bez wyłączonych i niezaznaczonych
+function sectionBody(name) {
+    const params = new URLSearchParams();
+    sectionFields(name).forEach(f => {
+        if (f.disabled) return;
+        if ((f.type === 'checkbox' || f.type === 'radio') && !f.checked) return;
+        params.append(f.name, f.value);
+    });
+    return params.toString();
+}
+
+function sectionValid(name) {
+    return sectionFields(name).every(f => f.disabled || f.reportValidity());
+}
+
+function saveSection(name) {
+    TIME_FIELDS.forEach(id => { if (document.getElementById(id + '_disp')) updateHidden(id); });
+    return fetch('/api/config/' + name, {
+        method: 'POST',
+        credentials: 'include',
+        headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
+        body: sectionBody(name)
+    })
+        .then(r => r.ok && !r.redirected ? r.json() : apiError(r))
+        .then(data => fillSection(name, data)); // Wartości po normalizacji przez urządzenie
+}
+
+function saveDirty() {
+    const names = Object.keys(dirty).filter(n => dirty[n]);
+    if (!names.length) { showToast('Brak zmian do zapisania', 'info'); return; }
+    if (!names.every(sectionValid)) return;
+    // Po kolei - urządzenie obsługuje jedno żądanie naraz
+    let chain = Promise.resolve();
+    const failed = [];
+    names.forEach(n => { chain = chain.then(() => saveSection(n).catch(e => { failed.push(n); showToast('❌ ' + e.message, 'error'); })); });
+    chain.then(() => {
+        if (!failed.length) {
+            showToast('✅ Konfiguracja zapisana', 'success');
+            clearDirty();
+        }
+    });
+}
+
+// ========== FAB Save (pływający przycisk zapisu) ==========
+const fab = document.getElementById('fabSave');
+let beforeHandlerBound = false;
+
+function beforeUnloadHandler(e) { e.preventDefault(); e.returnValue = ''; }
+
+function markDirty(e) {
+    const sec = e.target.closest('[data-section]');
+    if (!sec || !e.target.name) return;
+    dirty[sec.getAttribute('data-section')] = true;
+    fab.classList.add('show');
+    if (!beforeHandlerBound) { window.addEventListener('beforeunload', beforeUnloadHandler); beforeHandlerBound = true; }
+}
+
+function clearDirty() {
+    fab.classList.remove('show');
+    if (beforeHandlerBound) { window.removeEventListener('beforeunload', beforeUnloadHandler); beforeHandlerBound = false; }
+}
+
+function updateSessionCountdown() {
+    const msLeft = sessionEndsAt - Date.now();
+
+    if (msLeft <= 0) {
+        if (countdownInterval) clearInterval(countdownInterval);
+        alert('Twoja sesja wygasła. Zostaniesz wylogowany.');
+        window.location.href = '/';
+        return;
+    }
+
+    // Alert ~20 s przed końcem i pozwól użytkownikowi przedłużyć timer lokalnie
+    if (msLeft <= 20000 && !warnedExpiring) {
+        warnedExpiring = true;
+        if (confirm('Sesja wygaśnie za 20 sekund. Przedłużyć o kolejne 5 minut?')) {
+            sessionEndsAt = Date.now() + SESSION_MS;
+            warnedExpiring = false;
+        }
+    }
+}
+
+function toggleDutyFields() {
+    const intermittent = document.querySelector('input[name="workMode"][value="intermittent"]').checked;
+    const dutyDiv = document.getElementById('dutyFields');
+    dutyDiv.style.display = intermittent ? 'block' : 'none';
+    dutyDiv.querySelectorAll('input, select').forEach(input => { input.disabled = !intermittent; });
+}
+
+document.addEventListener('DOMContentLoaded', () => {
+    const form = document.getElementById('configForm');
+    form.addEventListener('input', markDirty);
+    form.addEventListener('change', markDirty);
+    form.addEventListener('submit', e => { e.preventDefault(); saveDirty(); });
+    fab.addEventListener('click', saveDirty);
+
+    // Jednostka globalna dotyczy pól wszystkich sekcji - zapisywana w "general"
+    document.getElementById('globalUnit').addEventListener('change', e => { globalUnit = parseInt(e.target.value); });
+    document.querySelectorAll('input[name="workMode"]').forEach(r => r.addEventListener('change', toggleDutyFields));
+
+    // Harmonijki pobierają dane przy pierwszym rozwinięciu
+    document.querySelectorAll('details[data-section]').forEach(d => {
+        d.addEventListener('toggle', () => { if (d.open) loadSection(d.getAttribute('data-section')); });
+    });
+    loadSection('general');
+    loadSection('diag');
+
+    countdownInterval = setInterval(updateSessionCountdown, 1000);
+});
@@ -0,0 +1,275 @@
+// Strona główna (web/index.html) - dane pobierane z API, strona sama jest statyczna
+// i buforowana przez przeglądarkę. Pierwszy stan z /api/status, potem zmiany
+// przychodzą przez /api/events (EventSource). Bez EventSource albo po odmowie
+// (limit subskrybentów) - odpytywanie co STATUS_POLL_MS. Karta w tle nie pyta
+// i nie trzyma połączenia; lista zdarzeń przychodzi tylko, gdy w logu przybyło wpisów.
+
+var STATUS_POLL_MS = 5000;
+var EVENTS_MAX = 8; // Jak STATUS_EVENTS_MAX w constants.h
+var eventSeq = -1; // Wersja listy zdarzeń, którą już mamy (-1 = żadna)
+var pollTimer = null;
+var live = null; // EventSource, gdy push działa
+var liveState = null; // Ostatnia pełna migawka z push, uzupełniana zdarzeniami "delta"
+var liveRefused = false; // Serwer odmówił - do przeładowania strony tylko odpytywanie
+
+function byId(id) { return document.getElementById(id); }
+function show(id, on) { byId(id).style.display = on ? '' : 'none'; }
+function setText(id, text) { byId(id).textContent = text; }
+
+// Czas trwania w czytelnej postaci (jak formatDurationSec w firmware)
+function fmtDur(sec) {
+    var p2 = function (n) { return (n < 10 ? '0' : '') + n; };
+    if (sec >= 86400) return Math.floor(sec / 86400) + 'd ' + Math.floor(sec % 86400 / 3600) + 'h';
+    if (sec >= 3600) return Math.floor(sec / 3600) + 'h ' + p2(Math.floor(sec % 3600 / 60)) + 'm';
+    if (sec >= 60) return Math.floor(sec / 60) + 'm ' + p2(sec % 60) + 's';
+    return sec + 's';
+}
+
+function tableRow(cells) {
+    var tr = document.createElement('tr');
+    cells.forEach(function (c) {
+        var td = document.createElement('td');
+        td.textContent = c;
+        tr.appendChild(td);
+    });
+    return tr;
+}
+
+function applyDefaultTheme(dark) {
+    // Motyw z konfiguracji tylko, gdy użytkownik nie wybrał własnego w tej przeglądarce
+    if (localStorage.getItem('theme')) return;
+    document.documentElement.setAttribute('data-theme', dark ? 'dark' : 'light');
+    byId('themeSwitch').checked = dark;
+}
+
+function eventLine(line) {
+    var d = document.createElement('div'), l = line.toLowerCase();
+    d.style.cssText = 'padding: 2px; border-bottom: 1px solid #eee;';
+    if (l.indexOf('blad') >= 0 || l.indexOf('reset') >= 0 || l.indexOf('brak') >= 0 || l.indexOf('ota') >= 0)
+        d.style.cssText += 'color:#dc3545; font-weight:bold;';
+    d.textContent = line;
+    return d;
+}
+
+// Nowy wpis logu z /api/events - dopisany na końcu, najstarszy wypada
+function appendEvent(line) {
+    var ev = byId('events');
+    if (!ev.firstElementChild) ev.textContent = ''; // "Brak logów."
+    ev.appendChild(eventLine(line));
+    while (ev.children.length > EVENTS_MAX) ev.removeChild(ev.firstElementChild);
+}
+
+function renderStatus(s) {
+    var a = byId('stAlert');
+    if (s.failCount == 0) {
+        a.className = 'alert alert-ok';
+        a.innerHTML = '<b>INTERNET DOSTĘPNY</b>';
+    } else {
+        a.className = 'alert alert-bad';
+        a.innerHTML = '<b></b>';
+        a.firstChild.textContent = 'PROBLEMY Z SIECIĄ (' + s.failCount + '/' + s.failLimit + ')';
+    }
+
+    show('stBackoff', s.backoffSec > 0);
+    setText('stBackoffTime', fmtDur(s.backoffSec));
+
+    show('stCycle', !!s.router);
+    if (s.router) {
+        setText('stCycleState', s.router.state);
+        setText('stCycleLeft', s.router.remainingSec);
+        byId('stCycleBar').style.width = s.router.progressPct + '%';
+        show('stCycleBoot', s.router.waitBoot);
+        setText('stBootWifi', s.router.wifiSec ? s.router.wifiSec + ' s' : '…');
+        setText('stBootGw', s.router.gatewaySec ? s.router.gatewaySec + ' s' : '…');
+    }
+
+    show('stLastBoot', !!s.lastBoot);
+    if (s.lastBoot) {
+        var b = s.lastBoot;
+        setText('stLastBootVal', b.confirmed ? b.internetSec + ' s' : 'internet niepotwierdzony');
+        setText('stLastBootInfo', b.confirmed ? '(WiFi ' + b.wifiSec + ' s, brama ' + b.gatewaySec + ' s)' : '(limit ' + b.limitSec + ' s)');
+    }
+
+    setText('stPing', s.lastPingMs);
+    setText('stEwma', s.ewmaMs.toFixed(1));
+    setText('stJitter', s.jitterMs.toFixed(1));
+    show('stBurst', !!s.burst);
+    if (s.burst) {
+        setText('stLoss', s.burst.lossPct);
+        setText('stLost', s.burst.lost + '/' + s.burst.sent);
+    }
+    setText('stResets', s.totalResets);
+    setText('stMsg', s.msg);
+    setText('stUptime', Math.floor(s.uptimeSec / 60));
+
+    show('stBackup', !!s.backup);
+    show('stBackupErr', !!(s.backup && s.backup.active));
+    if (s.backup) {
+        var st = byId('stBackupState');
+        st.textContent = s.backup.active ? 'AKTYWNA (Backup)' : 'Wyłączona (Główna)';
+        st.style.color = s.backup.active ? '#ff9800' : '#4caf50';
+        setText('stBackupFails', s.backup.failCount + '/' + s.backup.failLimit);
+    }
+
+    var rtt = byId('rttBody');
+    rtt.textContent = '';
+    s.rtt.forEach(function (w) {
+        if (!w.samples && !w.lost) {
+            var tr = tableRow([w.win, 'brak danych']);
+            tr.lastChild.colSpan = 6;
+            rtt.appendChild(tr);
+            return;
+        }
+        rtt.appendChild(tableRow([w.win, w.samples, w.lossPct.toFixed(1) + '%', w.p50, w.p95, w.p99, w.maxMs]));
+    });
+
+    var inc = s.incidents;
+    show('incOpen', !!inc.open);
+    if (inc.open) {
+        setText('incOpenCause', inc.open.cause);
+        setText('incOpenTime', fmtDur(inc.open.durationSec));
+        setText('incOpenResets', inc.open.resets);
+    }
+    setText('incAvail', inc.availabilityPct.toFixed(3));
+    setText('incMttr', inc.count ? fmtDur(inc.mttrSec) : '-');
+    setText('incMtbf', inc.count ? fmtDur(inc.mtbfSec) : '-');
+    setText('incCount', inc.count);
+    setText('incObserved', fmtDur(inc.observedSec));
+    setText('incFixed', inc.resetsFixed);
+    setText('incResets', inc.resets);
+    show('incTable', inc.causes.length > 0);
+    var ib = byId('incBody');
+    ib.textContent = '';
+    inc.causes.forEach(function (c) { ib.appendChild(tableRow([c.name, c.count, fmtDur(c.downSec)])); });
+
+    if (s.events) {
+        var ev = byId('events');
+        ev.textContent = s.events.length ? '' : 'Brak logów.';
+        s.events.forEach(function (line) { ev.appendChild(eventLine(line)); });
+    }
+    eventSeq = s.eventSeq;
+
+    show('perfLink', s.perf);
+    setText('appVersion', s.version);
+    applyDefaultTheme(s.darkMode);
+}
+
+function loadStatus() {
+    clearTimeout(pollTimer);
+    fetch('/api/status?ev=' + eventSeq, { cache: 'no-store' })
+        .then(function (r) { if (!r.ok) throw new Error(r.status); return r.json(); })
+        .then(renderStatus)
+        .catch(function () {
+            var a = byId('stAlert');
+            a.className = 'alert alert-bad';
+            a.textContent = 'Brak połączenia z urządzeniem';
+        })
+        .then(function () {
+            if (!document.hidden && !startLive()) pollTimer = setTimeout(loadStatus, STATUS_POLL_MS);
+        });
+}
+
+// Zwraca true, gdy push działa (odpytywanie niepotrzebne)
+function startLive() {
+    if (live) return true;
+    if (!window.EventSource || liveRefused) return false;
+    live = new EventSource('/api/events');
+    // Po (ponownym) połączeniu pełna migawka "status", potem "delta" - tylko zmienione pola (null = usunięte)
+    live.addEventListener('status', function (e) {
+        liveState = JSON.parse(e.data);
+        renderStatus(liveState);
+    });
+    live.addEventListener('delta', function (e) {
+        if (!liveState) return;
+        var d = JSON.parse(e.data);
+        Object.keys(d).forEach(function (k) {
+            if (d[k] === null) delete liveState[k];
+            else liveState[k] = d[k];
+        });
+        renderStatus(liveState);
+    });
+    live.addEventListener('log', function (e) { appendEvent(e.data); });
+    live.onerror = function () {
+        // Zerwane połączenie przeglądarka wznawia sama; CLOSED = odmowa (503) - wracamy do odpytywania
+        if (live.readyState !== EventSource.CLOSED) return;
+        live = null;
+        liveRefused = true;
+        pollTimer = setTimeout(loadStatus, STATUS_POLL_MS);
+    };
+    return true;
+}
+
+function stopLive() {
+    if (live) live.close();
+    live = null;
+    liveState = null;
+}
+
+document.addEventListener('visibilitychange', function () {
+    if (document.hidden) {
+        clearTimeout(pollTimer);
+        stopLive(); // Zwolnij miejsce subskrybenta na urządzeniu
+    } else loadStatus(); // Pełny stan z listą zdarzeń, potem ponownie push
+});
+
+// Wykres historii: przeglądarka pobiera binarny zrzut archiwum z /api/history
+// i sama go dekoduje (DataView, little-endian) oraz rysuje.
+//
+// Format odpowiedzi /api/history:
+//   nagłówek 16 B: "RRD1", ver u8, rozmiar kubełka u8, długość kubełka s u16,
+//                  liczba kubełków u16, zarezerwowane u16, bieżący epoch u32
+//   kubełki 16 B:  start u32, rttMin u16, rttAvg u16, rttMax u16,
+//                  upSeconds u16, downSeconds u16, lossPct u8, probes u8
+function loadHistory() {
+    var res = document.getElementById('histRes').value;
+    fetch('/api/history?res=' + res).then(function (r) { return r.arrayBuffer(); }).then(drawHistory)
+        .catch(function () { document.getElementById('histInfo').textContent = 'Brak danych historii'; });
+}
+function drawHistory(buf) {
+    var v = new DataView(buf), info = document.getElementById('histInfo');
+    if (buf.byteLength < 16 || v.getUint8(0) != 82 || v.getUint8(3) != 49) { info.textContent = 'Niepoprawny format'; return; }
+    var bsz = v.getUint8(5), step = v.getUint16(6, true), cnt = v.getUint16(8, true), now = v.getUint32(12, true);
+    var pts = [], up = 0, down = 0, maxRtt = 1;
+    for (var off = 16; off + bsz <= buf.byteLength; off += bsz) {
+        var s = v.getUint32(off, true);
+        if (!s || (now && (s > now || now - s >= cnt * step))) continue;
+        var p = { s: s, mn: v.getUint16(off + 4, true), av: v.getUint16(off + 6, true), mx: v.getUint16(off + 8, true),
+                  up: v.getUint16(off + 10, true), dn: v.getUint16(off + 12, true), loss: v.getUint8(off + 14) };
+        up += p.up; down += p.dn;
+        if (p.av != 65535 && p.mx > maxRtt) maxRtt = p.mx;
+        pts.push(p);
+    }
+    pts.sort(function (a, b) { return a.s - b.s; });
+    var c = document.getElementById('histChart'), ctx = c.getContext('2d');
+    c.width = c.clientWidth;
+    var W = c.width, H = c.height, barH = 10, plotH = H - barH - 16;
+    var fg = getComputedStyle(document.body).color;
+    ctx.clearRect(0, 0, W, H);
+    var t1 = now || (pts.length ? pts[pts.length - 1].s : 0), t0 = t1 - cnt * step;
+    var X = function (t) { return (t - t0) / (cnt * step) * W; };
+    var Y = function (ms) { return plotH - ms / maxRtt * (plotH - 4); };
+    var bw = Math.max(1, W / cnt);
+    pts.forEach(function (p) {
+        var x = X(p.s);
+        if (p.av != 65535) {
+            ctx.fillStyle = 'rgba(0,123,255,0.25)';
+            ctx.fillRect(x, Y(p.mx), bw, Math.max(1, Y(p.mn) - Y(p.mx)));
+            ctx.fillStyle = '#007bff';
+            ctx.fillRect(x, Y(p.av) - 1, bw, 2);
+        }
+        if (p.up + p.dn > 0) {
+            ctx.fillStyle = p.dn == 0 ? '#28a745' : (p.up == 0 ? '#dc3545' : '#ffc107');
+            ctx.fillRect(x, H - barH, bw, barH);
+        }
+    });
+    ctx.fillStyle = fg; ctx.font = '11px Arial';
+    ctx.fillText(maxRtt + ' ms', 2, 10);
+    ctx.fillText('0', 2, plotH);
+    var avail = (up + down) ? (100 * up / (up + down)).toFixed(3) + '%' : '-';
+    info.textContent = 'Dostępność: ' + avail + ' (kubełków: ' + pts.length + ')';
+}
+
+var savedTheme = localStorage.getItem('theme');
+if (savedTheme) byId('themeSwitch').checked = (savedTheme === 'dark');
+loadStatus();
+loadHistory();